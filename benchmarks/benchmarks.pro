@@ -0,0 +1,35 @@
+QT += testlib network
+QT -= gui
+
+CONFIG += qt console warn_on depend_includepath
+CONFIG -= app_bundle
+
+TEMPLATE = app
+TARGET = synqclient-bench
+
+DEFINES += SYNQCLIENT_VERSION=\\\"$$cat(../version.txt)\\\"
+
+SOURCES += \
+    main.cpp \
+    resourceusage.cpp \
+    syncbenchmark.cpp \
+    treegenerator.cpp \
+    ../tests/shared/fakedropboxserver.cpp \
+    ../tests/shared/fakehttpserver.cpp \
+    ../tests/shared/fakewebdavserver.cpp
+
+HEADERS += \
+    resourceusage.h \
+    syncbenchmark.h \
+    treegenerator.h \
+    ../tests/shared/fakedropboxserver.h \
+    ../tests/shared/fakehttpserver.h \
+    ../tests/shared/fakewebdavserver.h \
+    ../tests/shared/utils.h
+
+win32:CONFIG(release, debug|release): LIBS += -L$$OUT_PWD/../libsynqclient/release/ -lsynqclient
+else:win32:CONFIG(debug, debug|release): LIBS += -L$$OUT_PWD/../libsynqclient/debug/ -lsynqclient
+else:unix: LIBS += -L$$OUT_PWD/../libsynqclient/ -lsynqclient
+
+INCLUDEPATH += $$PWD/../libsynqclient/inc $$PWD/../tests/shared
+DEPENDPATH += $$PWD/../libsynqclient/inc
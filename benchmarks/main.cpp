@@ -0,0 +1,139 @@
+#include <algorithm>
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSysInfo>
+#include <QTextStream>
+
+#include "syncbenchmark.h"
+#include "treegenerator.h"
+
+using SynqClient::Benchmark::SyncBenchmark;
+using SynqClient::Benchmark::TreeGenerator;
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("synqclient-bench");
+    QCoreApplication::setApplicationVersion(SYNQCLIENT_VERSION);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+            "Runs synchronizations of synthetic folder trees against local fake servers and "
+            "reports the measurements as JSON.");
+    parser.addHelpOption();
+    parser.addVersionOption();
+    QCommandLineOption scenarioOption(
+            { "s", "scenario" },
+            "Run the given scenario (can be given multiple times). Defaults to all scenarios.",
+            "name");
+    QCommandLineOption backendOption(
+            { "b", "backend" },
+            "Run against the given backend (can be given multiple times). Defaults to all "
+            "backends.",
+            "name");
+    QCommandLineOption scaleOption(
+            "scale", "Multiply the number of files (or their size) by the given factor.",
+            "factor", "1");
+    QCommandLineOption latencyOption("latency", "Latency of each request in milliseconds.", "ms",
+                                     "0");
+    QCommandLineOption bandwidthOption(
+            "bandwidth", "Bandwidth of the server in bytes per second (0 for unlimited).",
+            "bytes", "0");
+    QCommandLineOption outputOption({ "o", "output" },
+                                    "Write the results to the given file instead of stdout.",
+                                    "file");
+    QCommandLineOption listOption("list", "List the available scenarios and backends.");
+    parser.addOptions({ scenarioOption, backendOption, scaleOption, latencyOption,
+                        bandwidthOption, outputOption, listOption });
+    parser.process(app);
+
+    QTextStream err(stderr);
+    auto scale = parser.value(scaleOption).toDouble();
+    if (scale <= 0) {
+        err << "Invalid scale: " << parser.value(scaleOption) << Qt::endl;
+        return 1;
+    }
+    auto scenarios = TreeGenerator::scenarios(scale);
+
+    if (parser.isSet(listOption)) {
+        QTextStream out(stdout);
+        out << "Scenarios:" << Qt::endl;
+        for (const auto& spec : qAsConst(scenarios)) {
+            out << "  " << spec.name << " - " << spec.description << Qt::endl;
+        }
+        out << "Backends:" << Qt::endl;
+        for (const auto& backend : SyncBenchmark::backends()) {
+            out << "  " << backend << Qt::endl;
+        }
+        return 0;
+    }
+
+    auto scenarioNames = parser.values(scenarioOption);
+    auto backends = parser.values(backendOption);
+    if (backends.isEmpty()) {
+        backends = SyncBenchmark::backends();
+    }
+    for (const auto& backend : qAsConst(backends)) {
+        if (!SyncBenchmark::backends().contains(backend)) {
+            err << "Unknown backend: " << backend << Qt::endl;
+            return 1;
+        }
+    }
+    for (const auto& name : qAsConst(scenarioNames)) {
+        if (std::none_of(scenarios.cbegin(), scenarios.cend(),
+                         [=](const SynqClient::Benchmark::TreeSpec& spec) {
+                             return spec.name == name;
+                         })) {
+            err << "Unknown scenario: " << name << Qt::endl;
+            return 1;
+        }
+    }
+
+    QJsonArray results;
+    bool ok = true;
+    for (const auto& spec : qAsConst(scenarios)) {
+        if (!scenarioNames.isEmpty() && !scenarioNames.contains(spec.name)) {
+            continue;
+        }
+        for (const auto& backend : qAsConst(backends)) {
+            err << "Running scenario " << spec.name << " against " << backend << "..."
+                << Qt::endl;
+            SyncBenchmark benchmark(backend);
+            benchmark.setLatency(parser.value(latencyOption).toInt());
+            benchmark.setBandwidth(parser.value(bandwidthOption).toLongLong());
+            auto result = benchmark.run(spec);
+            if (result.contains("error")) {
+                err << "  Failed: " << result.value("error").toString() << Qt::endl;
+                ok = false;
+            }
+            results << result;
+        }
+    }
+
+    QJsonObject report { { "version", SYNQCLIENT_VERSION },
+                         { "qtVersion", qVersion() },
+                         { "platform", QSysInfo::prettyProductName() },
+                         { "timestamp", QDateTime::currentDateTimeUtc().toString(Qt::ISODate) },
+                         { "scale", scale },
+                         { "latencyMs", parser.value(latencyOption).toInt() },
+                         { "bandwidth", parser.value(bandwidthOption).toLongLong() },
+                         { "results", results } };
+    auto json = QJsonDocument(report).toJson();
+    if (parser.isSet(outputOption)) {
+        QFile file(parser.value(outputOption));
+        if (!file.open(QIODevice::WriteOnly) || file.write(json) != json.size()) {
+            err << "Failed to write " << file.fileName() << ": " << file.errorString()
+                << Qt::endl;
+            return 1;
+        }
+    } else {
+        QTextStream(stdout) << json;
+    }
+    return ok ? 0 : 1;
+}
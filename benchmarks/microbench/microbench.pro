@@ -0,0 +1,17 @@
+QT += testlib
+QT -= gui
+
+CONFIG += qt console warn_on depend_includepath
+CONFIG -= app_bundle
+
+TEMPLATE = app
+TARGET = synqclient-microbench
+
+SOURCES += tst_microbench.cpp
+
+win32:CONFIG(release, debug|release): LIBS += -L$$OUT_PWD/../../libsynqclient/release/ -lsynqclient
+else:win32:CONFIG(debug, debug|release): LIBS += -L$$OUT_PWD/../../libsynqclient/debug/ -lsynqclient
+else:unix: LIBS += -L$$OUT_PWD/../../libsynqclient/ -lsynqclient
+
+INCLUDEPATH += $$PWD/../../libsynqclient/inc $$PWD/../../libsynqclient/src
+DEPENDPATH += $$PWD/../../libsynqclient/inc
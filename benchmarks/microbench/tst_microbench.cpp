@@ -0,0 +1,328 @@
+#include <QDir>
+#include <QSharedPointer>
+#include <QTemporaryDir>
+#include <QtTest>
+
+#include "SynqClient/JSONSyncStateDatabase"
+#include "SynqClient/SQLSyncStateDatabase"
+#include "SynqClient/SyncStateDatabase"
+#include "SynqClient/SyncStateEntry"
+
+// The change tree is an internal, header-only data structure:
+#include "changetree.h"
+
+using SynqClient::ChangeTree;
+using SynqClient::JSONSyncStateDatabase;
+using SynqClient::SQLSyncStateDatabase;
+using SynqClient::SyncStateDatabase;
+using SynqClient::SyncStateEntry;
+
+/**
+ * @brief Microbenchmarks for the data structures used while planning a sync.
+ *
+ * Each benchmark is run for trees of different sizes. The trees are built such that each folder
+ * contains ten files and (if needed) ten sub-folders, i.e. the depth grows logarithmically with
+ * the number of entries.
+ */
+class MicroBenchmark : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void makePath();
+    void makePath_data();
+    void makePathRelative();
+    void makePathRelative_data() { sizes(); }
+    void changeTreeBuild();
+    void changeTreeBuild_data() { sizes(); }
+    void changeTreeFindNode();
+    void changeTreeFindNode_data() { sizes(); }
+    void changeTreeNormalize();
+    void changeTreeNormalize_data() { sizes(); }
+    void changeTreeHasAnyChange();
+    void changeTreeHasAnyChange_data() { sizes(); }
+    void databaseAddEntry();
+    void databaseAddEntry_data() { databases(); }
+    void databaseGetEntry();
+    void databaseGetEntry_data() { databases(); }
+    void databaseFindEntries();
+    void databaseFindEntries_data() { databases(); }
+    void databaseIterate();
+    void databaseIterate_data() { databases(); }
+
+private:
+    void sizes();
+    void databases();
+
+    static QStringList paths(int count);
+    static QStringList folders(int count);
+    static QSharedPointer<SyncStateDatabase> createDatabase(const QString& backend,
+                                                            const QTemporaryDir& dir);
+    static void populate(ChangeTree& tree, const QStringList& paths);
+    static bool populate(SyncStateDatabase& db, const QStringList& paths);
+};
+
+void MicroBenchmark::makePath()
+{
+    QFETCH(int, entries);
+    QFETCH(bool, clean);
+    auto input = paths(entries);
+    if (!clean) {
+        // Mimic paths as they are received from servers or built by concatenation:
+        for (auto& path : input) {
+            path = "." + path.replace("/", "//") + "/";
+        }
+    }
+    QCOMPARE(SyncStateEntry::makePath(input.last()), paths(entries).last());
+    QBENCHMARK
+    {
+        for (const auto& path : qAsConst(input)) {
+            SyncStateEntry::makePath(path);
+        }
+    }
+}
+
+void MicroBenchmark::makePath_data()
+{
+    QTest::addColumn<int>("entries");
+    QTest::addColumn<bool>("clean");
+    for (auto entries : { 100, 1000, 10000 }) {
+        QTest::addRow("clean-%d", entries) << entries << true;
+        QTest::addRow("unclean-%d", entries) << entries << false;
+    }
+}
+
+void MicroBenchmark::makePathRelative()
+{
+    QFETCH(int, entries);
+    QDir dir(QDir::tempPath());
+    QStringList input;
+    for (const auto& path : paths(entries)) {
+        input << dir.absolutePath() + path;
+    }
+    QCOMPARE(SyncStateEntry::makePath(dir, input.last()), paths(entries).last());
+    QBENCHMARK
+    {
+        for (const auto& path : qAsConst(input)) {
+            SyncStateEntry::makePath(dir, path);
+        }
+    }
+}
+
+void MicroBenchmark::changeTreeBuild()
+{
+    QFETCH(int, entries);
+    auto input = paths(entries);
+    QBENCHMARK
+    {
+        ChangeTree tree;
+        populate(tree, input);
+    }
+}
+
+void MicroBenchmark::changeTreeFindNode()
+{
+    QFETCH(int, entries);
+    auto input = paths(entries);
+    ChangeTree tree;
+    populate(tree, input);
+    QVERIFY(tree.findNode(input.last()) != nullptr);
+    QBENCHMARK
+    {
+        for (const auto& path : qAsConst(input)) {
+            tree.findNode(path);
+        }
+    }
+}
+
+void MicroBenchmark::changeTreeNormalize()
+{
+    QFETCH(int, entries);
+    ChangeTree tree;
+    populate(tree, paths(entries));
+    QBENCHMARK
+    {
+        tree.normalize();
+    }
+}
+
+void MicroBenchmark::changeTreeHasAnyChange()
+{
+    QFETCH(int, entries);
+    auto input = paths(entries);
+    ChangeTree tree;
+    populate(tree, input);
+
+    // Worst case: only the last node carries a change, so the whole tree needs to be searched.
+    for (const auto& path : qAsConst(input)) {
+        tree.findNode(path)->change = ChangeTree::Unknown;
+    }
+    tree.findNode(input.last())->change = ChangeTree::Changed;
+    QVERIFY(ChangeTree::hasAnyChange(*tree.root));
+    QBENCHMARK
+    {
+        ChangeTree::hasAnyChange(*tree.root);
+    }
+}
+
+void MicroBenchmark::databaseAddEntry()
+{
+    QFETCH(QString, backend);
+    QFETCH(int, entries);
+    QTemporaryDir dir;
+    auto db = createDatabase(backend, dir);
+    QVERIFY(db->openDatabase());
+    auto input = paths(entries);
+    QBENCHMARK
+    {
+        populate(*db, input);
+    }
+    QVERIFY(db->getEntry(input.last()).isValid());
+}
+
+void MicroBenchmark::databaseGetEntry()
+{
+    QFETCH(QString, backend);
+    QFETCH(int, entries);
+    QTemporaryDir dir;
+    auto db = createDatabase(backend, dir);
+    QVERIFY(db->openDatabase());
+    auto input = paths(entries);
+    QVERIFY(populate(*db, input));
+    QBENCHMARK
+    {
+        for (const auto& path : qAsConst(input)) {
+            db->getEntry(path);
+        }
+    }
+}
+
+void MicroBenchmark::databaseFindEntries()
+{
+    QFETCH(QString, backend);
+    QFETCH(int, entries);
+    QTemporaryDir dir;
+    auto db = createDatabase(backend, dir);
+    QVERIFY(db->openDatabase());
+    QVERIFY(populate(*db, paths(entries)));
+    auto input = folders(entries);
+    QBENCHMARK
+    {
+        for (const auto& folder : qAsConst(input)) {
+            db->findEntries(folder);
+        }
+    }
+}
+
+void MicroBenchmark::databaseIterate()
+{
+    QFETCH(QString, backend);
+    QFETCH(int, entries);
+    QTemporaryDir dir;
+    auto db = createDatabase(backend, dir);
+    QVERIFY(db->openDatabase());
+    QVERIFY(populate(*db, paths(entries)));
+    int count = 0;
+    QBENCHMARK
+    {
+        count = 0;
+        db->iterate([&](const SyncStateEntry&) { ++count; });
+    }
+    QVERIFY(count >= entries);
+}
+
+void MicroBenchmark::sizes()
+{
+    QTest::addColumn<int>("entries");
+    for (auto entries : { 100, 1000, 10000 }) {
+        QTest::addRow("%d", entries) << entries;
+    }
+}
+
+void MicroBenchmark::databases()
+{
+    QTest::addColumn<QString>("backend");
+    QTest::addColumn<int>("entries");
+    for (auto backend : { "SQL", "JSON" }) {
+        for (auto entries : { 100, 1000, 10000 }) {
+            QTest::addRow("%s-%d", backend, entries) << QString(backend) << entries;
+        }
+    }
+}
+
+/**
+ * @brief Generate @p count file paths.
+ *
+ * The decimal digits of the file's index determine its location, e.g. file number 1234 is
+ * stored as `/folder-1/folder-2/folder-3/file-4.txt`.
+ */
+QStringList MicroBenchmark::paths(int count)
+{
+    QStringList result;
+    result.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        auto digits = QString::number(i);
+        QString path;
+        for (int j = 0; j < digits.length() - 1; ++j) {
+            path += "/folder-" + digits.at(j);
+        }
+        result << path + "/file-" + digits.back() + ".txt";
+    }
+    return result;
+}
+
+/**
+ * @brief The folders containing the files generated by paths().
+ */
+QStringList MicroBenchmark::folders(int count)
+{
+    QSet<QString> result { "/" };
+    for (const auto& path : paths(count)) {
+        auto parts = path.split("/", Qt::SkipEmptyParts);
+        parts.removeLast();
+        for (int i = 1; i <= parts.length(); ++i) {
+            result.insert("/" + parts.mid(0, i).join("/"));
+        }
+    }
+    return result.values();
+}
+
+QSharedPointer<SyncStateDatabase> MicroBenchmark::createDatabase(const QString& backend,
+                                                                 const QTemporaryDir& dir)
+{
+    if (backend == "SQL") {
+        return QSharedPointer<SyncStateDatabase>(
+                new SQLSyncStateDatabase(dir.filePath("sync.db")));
+    }
+    return QSharedPointer<SyncStateDatabase>(new JSONSyncStateDatabase(dir.filePath("db.json")));
+}
+
+/**
+ * @brief Add all @p paths as files to the @p tree, marking every fourth one as changed.
+ */
+void MicroBenchmark::populate(ChangeTree& tree, const QStringList& paths)
+{
+    for (int i = 0; i < paths.length(); ++i) {
+        auto node = tree.findNode(paths.at(i), ChangeTree::FindAndCreate);
+        node->type = ChangeTree::File;
+        node->change = i % 4 == 0 ? ChangeTree::Changed : ChangeTree::Unknown;
+    }
+}
+
+/**
+ * @brief Add an entry for each of the @p paths to the @p db.
+ */
+bool MicroBenchmark::populate(SyncStateDatabase& db, const QStringList& paths)
+{
+    auto modificationTime = QDateTime::currentDateTime();
+    for (const auto& path : paths) {
+        if (!db.addEntry(SyncStateEntry(path, modificationTime, "etag"))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+QTEST_MAIN(MicroBenchmark)
+
+#include "tst_microbench.moc"
@@ -0,0 +1,33 @@
+#include "resourceusage.h"
+
+#ifdef Q_OS_UNIX
+#    include <sys/resource.h>
+#endif
+
+namespace SynqClient {
+namespace Benchmark {
+
+/**
+ * @brief Get the CPU time (user and system) and the peak resident set size of the process.
+ */
+ResourceUsage ResourceUsage::current()
+{
+    ResourceUsage result;
+#ifdef Q_OS_UNIX
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        result.cpuTimeMs = (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000
+                + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000;
+#    ifdef Q_OS_MACOS
+        // On macOS, the maximum RSS is reported in bytes:
+        result.peakRssKiB = usage.ru_maxrss / 1024;
+#    else
+        result.peakRssKiB = usage.ru_maxrss;
+#    endif
+    }
+#endif
+    return result;
+}
+
+} // namespace Benchmark
+} // namespace SynqClient
@@ -0,0 +1,25 @@
+#ifndef SYNQCLIENT_BENCH_RESOURCEUSAGE_H_
+#define SYNQCLIENT_BENCH_RESOURCEUSAGE_H_
+
+#include <QtGlobal>
+
+namespace SynqClient {
+namespace Benchmark {
+
+/**
+ * @brief Resources used by the current process so far.
+ *
+ * Values which cannot be determined on the current platform are set to -1.
+ */
+struct ResourceUsage
+{
+    qint64 cpuTimeMs = -1;
+    qint64 peakRssKiB = -1;
+
+    static ResourceUsage current();
+};
+
+} // namespace Benchmark
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_BENCH_RESOURCEUSAGE_H_
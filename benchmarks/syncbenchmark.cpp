@@ -0,0 +1,210 @@
+#include "syncbenchmark.h"
+
+#include <QDir>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QJsonArray>
+#include <QNetworkAccessManager>
+#include <QScopedPointer>
+#include <QTemporaryDir>
+
+#include "SynqClient/DirectorySynchronizer"
+#include "SynqClient/DropboxJobFactory"
+#include "SynqClient/SQLSyncStateDatabase"
+#include "SynqClient/WebDAVJobFactory"
+
+#include "fakedropboxserver.h"
+#include "fakewebdavserver.h"
+#include "resourceusage.h"
+
+namespace SynqClient {
+namespace Benchmark {
+
+namespace {
+
+// The path on the server the trees are synced to:
+const char* RemotePath = "/benchmark";
+
+// The fraction of files changed for the incremental phases:
+const double ChangedFilesFraction = 0.01;
+
+// The phases run for each tree and whether they sync the first or the second local folder:
+const struct
+{
+    const char* name;
+    bool secondFolder;
+} Phases[] = { { "upload", false },
+               { "download", true },
+               { "noop", false },
+               { "incremental-upload", false },
+               { "incremental-download", true } };
+
+} // namespace
+
+/**
+ * @brief The names of the supported backends.
+ */
+QStringList SyncBenchmark::backends()
+{
+    return { "webdav", "nextcloud", "dropbox" };
+}
+
+/**
+ * @brief Create a benchmark running against the fake server of the given @p backend.
+ */
+SyncBenchmark::SyncBenchmark(const QString& backend)
+    : m_backend(backend), m_latency(0), m_bandwidth(0)
+{
+}
+
+/**
+ * @brief The latency in milliseconds of each request to the fake server.
+ */
+int SyncBenchmark::latency() const
+{
+    return m_latency;
+}
+
+void SyncBenchmark::setLatency(int latency)
+{
+    m_latency = latency;
+}
+
+/**
+ * @brief The bandwidth of the fake server in bytes per second (0 for unlimited).
+ */
+qint64 SyncBenchmark::bandwidth() const
+{
+    return m_bandwidth;
+}
+
+void SyncBenchmark::setBandwidth(qint64 bandwidth)
+{
+    m_bandwidth = bandwidth;
+}
+
+/**
+ * @brief Run all phases for the tree described by the @p spec.
+ *
+ * Returns a JSON object describing the run and the measurements taken for each phase. If a phase
+ * fails, the remaining ones are skipped and the error is reported in the result.
+ */
+QJsonObject SyncBenchmark::run(const TreeSpec& spec)
+{
+    QJsonObject result { { "scenario", spec.name }, { "backend", m_backend } };
+
+    QScopedPointer<UnitTest::FakeHttpServer> server;
+    QScopedPointer<QNetworkAccessManager> nam;
+    QScopedPointer<AbstractJobFactory> factory;
+    if (m_backend == "dropbox") {
+        server.reset(new UnitTest::FakeDropboxServer);
+        if (!server->listen()) {
+            result.insert("error", "Failed to start the fake server");
+            return result;
+        }
+        nam.reset(new UnitTest::RedirectingNetworkAccessManager(server->serverUrl()));
+        auto dropboxFactory = new DropboxJobFactory;
+        dropboxFactory->setNetworkAccessManager(nam.data());
+        dropboxFactory->setToken("benchmark");
+        factory.reset(dropboxFactory);
+    } else {
+        auto type = m_backend == "nextcloud" ? WebDAVServerType::NextCloud
+                                             : WebDAVServerType::Generic;
+        auto webdavServer = new UnitTest::FakeWebDAVServer(type);
+        server.reset(webdavServer);
+        if (!server->listen()) {
+            result.insert("error", "Failed to start the fake server");
+            return result;
+        }
+        nam.reset(new QNetworkAccessManager);
+        auto webdavFactory = new WebDAVJobFactory;
+        webdavFactory->setNetworkAccessManager(nam.data());
+        webdavFactory->setServerType(type);
+        webdavFactory->setUrl(webdavServer->url());
+        factory.reset(webdavFactory);
+    }
+    server->setLatency(m_latency);
+    server->setBandwidth(m_bandwidth);
+
+    QTemporaryDir workDir;
+    auto localPath1 = workDir.filePath("local1");
+    auto localPath2 = workDir.filePath("local2");
+    auto dbPath1 = workDir.filePath("sync1.db");
+    auto dbPath2 = workDir.filePath("sync2.db");
+
+    TreeStats stats;
+    if (!workDir.isValid() || !TreeGenerator::generate(spec, localPath1, stats)
+        || !QDir(localPath2).mkpath(".")) {
+        result.insert("error", "Failed to generate the tree");
+        return result;
+    }
+    result.insert("files", stats.files);
+    result.insert("folders", stats.folders);
+    result.insert("bytes", stats.bytes);
+
+    QJsonArray phases;
+    for (const auto& phase : Phases) {
+        if (QString(phase.name) == "incremental-upload") {
+            auto changed = TreeGenerator::modify(localPath1, ChangedFilesFraction, {});
+            if (changed < 0) {
+                result.insert("error", "Failed to change local files");
+                break;
+            }
+            result.insert("changedFiles", changed);
+        }
+        auto measurements = phase.secondFolder
+                ? runPhase(phase.name, localPath2, dbPath2, factory.data(), server.data())
+                : runPhase(phase.name, localPath1, dbPath1, factory.data(), server.data());
+        phases << measurements;
+        if (measurements.contains("error")) {
+            result.insert("error", measurements.value("error"));
+            break;
+        }
+    }
+    result.insert("phases", phases);
+    return result;
+}
+
+QJsonObject SyncBenchmark::runPhase(const QString& name, const QString& localPath,
+                                    const QString& dbPath, AbstractJobFactory* factory,
+                                    UnitTest::FakeHttpServer* server)
+{
+    SQLSyncStateDatabase syncDb(dbPath);
+    DirectorySynchronizer sync;
+    sync.setJobFactory(factory);
+    sync.setLocalDirectoryPath(localPath);
+    sync.setRemoteDirectoryPath(RemotePath);
+    sync.setSyncStateDatabase(&syncDb);
+
+    QEventLoop loop;
+    QObject::connect(&sync, &DirectorySynchronizer::finished, &loop, &QEventLoop::quit);
+
+    server->resetStatistics();
+    auto usageBefore = ResourceUsage::current();
+    QElapsedTimer timer;
+    timer.start();
+    sync.start();
+    if (sync.state() == SynchronizerState::Running) {
+        loop.exec();
+    }
+    auto wallTime = timer.elapsed();
+    auto usageAfter = ResourceUsage::current();
+
+    QJsonObject result { { "name", name },
+                         { "wallTimeMs", wallTime },
+                         { "cpuTimeMs", usageAfter.cpuTimeMs >= 0
+                                   ? usageAfter.cpuTimeMs - usageBefore.cpuTimeMs
+                                   : -1 },
+                         { "peakRssKiB", usageAfter.peakRssKiB },
+                         { "requests", server->numRequests() },
+                         { "maxParallelRequests", server->maxParallelRequests() },
+                         { "bytesUploaded", server->bytesReceived() },
+                         { "bytesDownloaded", server->bytesSent() } };
+    if (sync.error() != SynchronizerError::NoError) {
+        result.insert("error", sync.errorString());
+    }
+    return result;
+}
+
+} // namespace Benchmark
+} // namespace SynqClient
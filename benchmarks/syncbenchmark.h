@@ -0,0 +1,61 @@
+#ifndef SYNQCLIENT_BENCH_SYNCBENCHMARK_H_
+#define SYNQCLIENT_BENCH_SYNCBENCHMARK_H_
+
+#include <QJsonObject>
+#include <QString>
+#include <QStringList>
+
+#include "treegenerator.h"
+
+namespace SynqClient {
+
+class AbstractJobFactory;
+
+namespace UnitTest {
+class FakeHttpServer;
+}
+
+namespace Benchmark {
+
+/**
+ * @brief Runs a DirectorySynchronizer against a fake server and measures each sync phase.
+ *
+ * A benchmark run generates a synthetic tree and syncs it through the following phases:
+ *
+ * - "upload": Initial sync of the generated tree to the empty server.
+ * - "download": Initial sync of an empty folder, fetching the tree from the server.
+ * - "noop": Another sync of the original folder without any changes.
+ * - "incremental-upload": Sync after changing some of the local files.
+ * - "incremental-download": Sync of the second folder, fetching these changes.
+ *
+ * For each phase, the wall and CPU time, the peak resident set size, the number of requests and
+ * the number of bytes sent to and received from the server are reported.
+ */
+class SyncBenchmark
+{
+public:
+    static QStringList backends();
+
+    explicit SyncBenchmark(const QString& backend);
+
+    int latency() const;
+    void setLatency(int latency);
+
+    qint64 bandwidth() const;
+    void setBandwidth(qint64 bandwidth);
+
+    QJsonObject run(const TreeSpec& spec);
+
+private:
+    QString m_backend;
+    int m_latency;
+    qint64 m_bandwidth;
+
+    QJsonObject runPhase(const QString& name, const QString& localPath, const QString& dbPath,
+                         AbstractJobFactory* factory, UnitTest::FakeHttpServer* server);
+};
+
+} // namespace Benchmark
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_BENCH_SYNCBENCHMARK_H_
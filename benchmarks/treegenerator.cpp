@@ -0,0 +1,171 @@
+#include "treegenerator.h"
+
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QRandomGenerator>
+#include <QVector>
+
+namespace SynqClient {
+namespace Benchmark {
+
+namespace {
+
+// Files are written in chunks of this size to keep memory usage low for huge files:
+const qint64 WriteChunkSize = 1024 * 1024;
+
+int scaled(int value, double scale)
+{
+    return qMax(1, qRound(value * scale));
+}
+
+} // namespace
+
+/**
+ * @brief The trees used by the benchmark.
+ *
+ * The number of files (respectively the file size for the "huge" scenario) is multiplied by the
+ * @p scale.
+ */
+QVector<TreeSpec> TreeGenerator::scenarios(double scale)
+{
+    QVector<TreeSpec> result;
+    {
+        TreeSpec spec;
+        spec.name = "deep";
+        spec.description = "A single chain of deeply nested folders";
+        spec.depth = scaled(32, scale);
+        spec.foldersPerFolder = 1;
+        spec.filesPerFolder = 4;
+        spec.fileSize = 1024;
+        result << spec;
+    }
+    {
+        TreeSpec spec;
+        spec.name = "wide";
+        spec.description = "Many sibling folders below the top level";
+        spec.depth = 1;
+        spec.foldersPerFolder = scaled(200, scale);
+        spec.filesPerFolder = 10;
+        spec.fileSize = 1024;
+        result << spec;
+    }
+    {
+        TreeSpec spec;
+        spec.name = "tiny";
+        spec.description = "Many tiny files in a moderately nested tree";
+        spec.depth = 2;
+        spec.foldersPerFolder = 10;
+        spec.filesPerFolder = scaled(50, scale);
+        spec.fileSize = 16;
+        result << spec;
+    }
+    {
+        TreeSpec spec;
+        spec.name = "huge";
+        spec.description = "A few huge files";
+        spec.depth = 0;
+        spec.foldersPerFolder = 0;
+        spec.filesPerFolder = 4;
+        spec.fileSize = static_cast<qint64>(32 * 1024 * 1024 * scale);
+        result << spec;
+    }
+    return result;
+}
+
+/**
+ * @brief Create the tree described by the @p spec in the folder @p path.
+ *
+ * The content of the files is pseudo random, but the same for each run.
+ */
+bool TreeGenerator::generate(const TreeSpec& spec, const QString& path, TreeStats& stats)
+{
+    stats = TreeStats();
+    if (!QDir(path).mkpath(".")) {
+        return false;
+    }
+    return generateFolder(spec, path, 0, stats);
+}
+
+/**
+ * @brief Change the content of a @p fraction of the files in the folder @p path.
+ *
+ * Files whose names are in the @p excludes list are not touched. At least one file is changed.
+ * Returns the number of changed files or -1 on error.
+ */
+int TreeGenerator::modify(const QString& path, double fraction, const QStringList& excludes)
+{
+    QStringList files;
+    QDirIterator it(path, QDir::Files, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        auto fileName = it.next();
+        if (!excludes.contains(it.fileName())) {
+            files << fileName;
+        }
+    }
+    files.sort();
+    if (files.isEmpty()) {
+        return 0;
+    }
+    auto step = qMax(1, qRound(1.0 / fraction));
+    int result = 0;
+    for (int i = 0; i < files.length(); i += step) {
+        QFile file(files.at(i));
+        if (!file.open(QIODevice::Append)) {
+            return -1;
+        }
+        file.write("changed\n");
+        ++result;
+    }
+    return result;
+}
+
+bool TreeGenerator::generateFolder(const TreeSpec& spec, const QString& path, int level,
+                                   TreeStats& stats)
+{
+    QDir dir(path);
+    for (int i = 0; i < spec.filesPerFolder; ++i) {
+        auto fileName = dir.absoluteFilePath(QString("file-%1.dat").arg(i));
+        if (!writeFile(fileName, spec.fileSize, static_cast<quint32>(stats.files))) {
+            return false;
+        }
+        ++stats.files;
+        stats.bytes += spec.fileSize;
+    }
+    if (level < spec.depth) {
+        for (int i = 0; i < spec.foldersPerFolder; ++i) {
+            auto name = QString("folder-%1").arg(i);
+            if (!dir.mkdir(name)) {
+                return false;
+            }
+            ++stats.folders;
+            if (!generateFolder(spec, dir.absoluteFilePath(name), level + 1, stats)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool TreeGenerator::writeFile(const QString& fileName, qint64 size, quint32 seed)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    QRandomGenerator generator(seed);
+    QVector<quint32> words;
+    for (qint64 written = 0; written < size;) {
+        auto length = qMin(WriteChunkSize, size - written);
+        words.resize(static_cast<int>((length + 3) / 4));
+        generator.fillRange(words.data(), words.size());
+        if (file.write(reinterpret_cast<const char*>(words.constData()), length) != length) {
+            return false;
+        }
+        written += length;
+    }
+    return true;
+}
+
+} // namespace Benchmark
+} // namespace SynqClient
@@ -0,0 +1,53 @@
+#ifndef SYNQCLIENT_BENCH_TREEGENERATOR_H_
+#define SYNQCLIENT_BENCH_TREEGENERATOR_H_
+
+#include <QString>
+#include <QVector>
+
+namespace SynqClient {
+namespace Benchmark {
+
+/**
+ * @brief Describes the shape of a synthetic folder tree.
+ *
+ * Each folder contains filesPerFolder files of fileSize bytes. Folders above the given depth
+ * additionally contain foldersPerFolder sub-folders.
+ */
+struct TreeSpec
+{
+    QString name;
+    QString description;
+    int depth = 0;
+    int foldersPerFolder = 0;
+    int filesPerFolder = 0;
+    qint64 fileSize = 0;
+};
+
+/**
+ * @brief Statistics about a generated tree.
+ */
+struct TreeStats
+{
+    int files = 0;
+    int folders = 0;
+    qint64 bytes = 0;
+};
+
+class TreeGenerator
+{
+public:
+    static QVector<TreeSpec> scenarios(double scale);
+
+    static bool generate(const TreeSpec& spec, const QString& path, TreeStats& stats);
+    static int modify(const QString& path, double fraction, const QStringList& excludes);
+
+private:
+    static bool generateFolder(const TreeSpec& spec, const QString& path, int level,
+                               TreeStats& stats);
+    static bool writeFile(const QString& fileName, qint64 size, quint32 seed);
+};
+
+} // namespace Benchmark
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_BENCH_TREEGENERATOR_H_
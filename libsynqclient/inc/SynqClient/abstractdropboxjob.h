@@ -49,6 +49,9 @@ public:
     QString token() const;
     void setToken(const QString& token);
 
+    bool http2Allowed() const;
+    void setHttp2Allowed(bool http2Allowed);
+
 protected:
     explicit AbstractDropboxJob(AbstractDropboxJobPrivate* d);
 
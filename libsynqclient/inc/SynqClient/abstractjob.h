@@ -24,6 +24,7 @@
 #include <QScopedPointer>
 #include <QtGlobal>
 
+#include "jobmetrics.h"
 #include "libsynqclient.h"
 #include "libsynqclient_global.h"
 
@@ -50,11 +51,13 @@ public:
     JobState state() const;
     int transferTimeout() const;
     void setTransferTimeout(int transferTimeout);
+    JobMetrics metrics() const;
 
 signals:
 
     void finished();
     void transferTimeoutChanged();
+    void transferProgress(qint64 bytesSent, qint64 bytesReceived);
 
 protected:
     explicit AbstractJob(AbstractJobPrivate* d, QObject* parent = nullptr);
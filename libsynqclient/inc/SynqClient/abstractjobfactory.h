@@ -36,6 +36,11 @@ class DownloadFileJob;
 class UploadFileJob;
 class GetFileInfoJob;
 class ListFilesJob;
+class CreateDirectoryBatchJob;
+class DeleteBatchJob;
+class UploadFileBatchJob;
+class MoveJob;
+class CopyJob;
 
 class AbstractJobFactoryPrivate;
 
@@ -52,10 +57,21 @@ public:
     UploadFileJob* uploadFile(QObject* parent = nullptr);
     GetFileInfoJob* getFileInfo(QObject* parent = nullptr);
     ListFilesJob* listFiles(QObject* parent = nullptr);
+    CreateDirectoryBatchJob* createDirectoryBatch(QObject* parent = nullptr);
+    DeleteBatchJob* deleteResourceBatch(QObject* parent = nullptr);
+    UploadFileBatchJob* uploadFileBatch(QObject* parent = nullptr);
+    MoveJob* moveResource(QObject* parent = nullptr);
+    CopyJob* copyResource(QObject* parent = nullptr);
+
+    int maxBatchSize(JobType type) const;
+    qint64 maxBatchFileSize() const;
 
     RemoteChangeDetectionMode remoteChangeDetectionMode() const;
     bool alwaysCheckSubfolders() const;
 
+    bool http2Allowed() const;
+    void setHttp2Allowed(bool http2Allowed);
+
 protected:
     explicit AbstractJobFactory(AbstractJobFactoryPrivate* d, QObject* parent = nullptr);
 
@@ -76,6 +92,8 @@ protected:
 
     void setRemoteChangeDetectionMode(RemoteChangeDetectionMode mode);
     void setAlwaysCheckSubfolders(bool alwaysCheckSubfolders);
+    void setMaxBatchSize(JobType type, int maxBatchSize);
+    void setMaxBatchFileSize(qint64 maxBatchFileSize);
 };
 
 } // namespace SynqClient
@@ -36,6 +36,9 @@ public:
     QString userAgent() const;
     void setUserAgent(const QString& userAgent);
 
+    bool http2Allowed() const;
+    void setHttp2Allowed(bool http2Allowed);
+
 protected:
     explicit AbstractWebDAVJob(AbstractWebDAVJobPrivate* d);
 
@@ -0,0 +1,73 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_ASYNCSYNCSTATEDATABASE_H
+#define SYNQCLIENT_ASYNCSYNCSTATEDATABASE_H
+
+#include <functional>
+
+#include <QObject>
+#include <QScopedPointer>
+#include <QtGlobal>
+
+#include "SyncStateDatabase"
+#include "libsynqclient_global.h"
+
+namespace SynqClient {
+
+class AsyncSyncStateDatabasePrivate;
+
+class LIBSYNQCLIENT_EXPORT AsyncSyncStateDatabase : public SyncStateDatabase
+{
+    Q_OBJECT
+public:
+    typedef std::function<SyncStateDatabase*()> Factory;
+    typedef std::function<void(bool ok)> Callback;
+
+    explicit AsyncSyncStateDatabase(const Factory& factory, QObject* parent = nullptr);
+    ~AsyncSyncStateDatabase() override;
+
+    int pendingWrites() const;
+    bool waitForPendingWrites(int timeout = -1) const;
+    void flushDatabaseLater(const Callback& callback);
+
+signals:
+
+    void writeFailed(const QString& path);
+
+protected:
+    explicit AsyncSyncStateDatabase(AsyncSyncStateDatabasePrivate* d, QObject* parent = nullptr);
+
+    Q_DECLARE_PRIVATE(AsyncSyncStateDatabase);
+
+    // SyncStateDatabase interface
+public:
+    bool openDatabase() override;
+    bool flushDatabase() override;
+    bool closeDatabase() override;
+    bool addEntry(const SyncStateEntry& entry) override;
+    SyncStateEntry getEntry(const QString& path) override;
+    QVector<SyncStateEntry> findEntries(const QString& parent, bool* ok) override;
+    bool removeEntries(const QString& path) override;
+    bool removeEntry(const QString& path) override;
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_ASYNCSYNCSTATEDATABASE_H
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_BATCHJOB_H
+#define SYNQCLIENT_BATCHJOB_H
+
+#include <QObject>
+#include <QScopedPointer>
+#include <QStringList>
+#include <QtGlobal>
+
+#include "SynqClient/AbstractJob"
+#include "SynqClient/FileInfo"
+#include "SynqClient/libsynqclient_global.h"
+
+namespace SynqClient {
+
+class BatchJobPrivate;
+
+class LIBSYNQCLIENT_EXPORT BatchJob : public AbstractJob
+{
+    Q_OBJECT
+public:
+    explicit BatchJob(QObject* parent = nullptr);
+    ~BatchJob() override;
+
+    FileInfo fileInfo(const QString& path) const;
+    JobError entryError(const QString& path) const;
+    QString entryErrorString(const QString& path) const;
+    QStringList failedEntries() const;
+
+protected:
+    explicit BatchJob(BatchJobPrivate* d, QObject* parent = nullptr);
+
+    Q_DECLARE_PRIVATE(BatchJob);
+
+    void setEntryFileInfo(const QString& path, const FileInfo& fileInfo);
+    void setEntryError(const QString& path, JobError error, const QString& errorString);
+    void clearEntryResults();
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_BATCHJOB_H
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_CONTINUOUSSYNCHRONIZER_H
+#define SYNQCLIENT_CONTINUOUSSYNCHRONIZER_H
+
+#include <QObject>
+#include <QScopedPointer>
+#include <QtGlobal>
+
+#include "directorysynchronizer.h"
+#include "libsynqclient.h"
+#include "libsynqclient_global.h"
+
+namespace SynqClient {
+
+class AbstractJobFactory;
+class ContinuousSynchronizerPrivate;
+class LocalChangeWatcher;
+class SyncStateDatabase;
+
+class LIBSYNQCLIENT_EXPORT ContinuousSynchronizer : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(bool running READ running NOTIFY runningChanged);
+    Q_PROPERTY(bool syncing READ syncing NOTIFY syncingChanged);
+
+public:
+    explicit ContinuousSynchronizer(QObject* parent = nullptr);
+    ~ContinuousSynchronizer() override;
+
+    bool running() const;
+    bool syncing() const;
+
+    AbstractJobFactory* jobFactory() const;
+    void setJobFactory(AbstractJobFactory* jobFactory);
+
+    SyncStateDatabase* syncStateDatabase() const;
+    void setSyncStateDatabase(SyncStateDatabase* syncStateDatabase);
+
+    QString localDirectoryPath() const;
+    void setLocalDirectoryPath(const QString& localDirectoryPath);
+
+    QString remoteDirectoryPath() const;
+    void setRemoteDirectoryPath(const QString& remoteDirectoryPath);
+
+    DirectorySynchronizer::Filter filter() const;
+    void setFilter(const DirectorySynchronizer::Filter& filter);
+
+    LocalChangeWatcher* localChangeWatcher() const;
+    void setLocalChangeWatcher(LocalChangeWatcher* localChangeWatcher);
+
+    int maxJobs() const;
+    void setMaxJobs(int maxJobs);
+
+    int maxMultiplexedJobs() const;
+    void setMaxMultiplexedJobs(int maxMultiplexedJobs);
+
+    SyncConflictStrategy syncConflictStrategy() const;
+    void setSyncConflictStrategy(SyncConflictStrategy strategy);
+
+    SynchronizerFlags flags() const;
+    void setFlags(const SynchronizerFlags flags);
+
+    int debounceInterval() const;
+    void setDebounceInterval(int debounceInterval);
+
+    int pollInterval() const;
+    void setPollInterval(int pollInterval);
+
+    SynchronizerError lastError() const;
+    QString lastErrorString() const;
+
+public slots:
+
+    void start();
+    void stop();
+    void requestSync();
+
+signals:
+
+    /**
+     * @brief The running property changed.
+     */
+    void runningChanged();
+
+    /**
+     * @brief The syncing property changed.
+     */
+    void syncingChanged();
+
+    /**
+     * @brief A sync cycle finished.
+     *
+     * Use lastError() and lastErrorString() to check if the sync was successful.
+     */
+    void syncFinished();
+
+    /**
+     * @brief A message from the currently running sync is available.
+     *
+     * @sa DirectorySynchronizer::logMessageAvailable()
+     */
+    void logMessageAvailable(SynchronizerLogEntryType type, const QString& message);
+
+    /**
+     * @brief Progress of the currently running sync.
+     *
+     * @sa DirectorySynchronizer::progress()
+     */
+    void progress(int value);
+
+    /**
+     * @brief Detailed progress of the currently running sync.
+     *
+     * @sa DirectorySynchronizer::progressAvailable()
+     */
+    void progressAvailable(const SyncProgress& progress);
+
+protected:
+    explicit ContinuousSynchronizer(ContinuousSynchronizerPrivate* d, QObject* parent = nullptr);
+
+    QScopedPointer<ContinuousSynchronizerPrivate> d_ptr;
+    Q_DECLARE_PRIVATE(ContinuousSynchronizer);
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_CONTINUOUSSYNCHRONIZER_H
@@ -0,0 +1,54 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_DELETEBATCHJOB_H
+#define SYNQCLIENT_DELETEBATCHJOB_H
+
+#include <QObject>
+#include <QScopedPointer>
+#include <QStringList>
+#include <QtGlobal>
+
+#include "SynqClient/BatchJob"
+#include "SynqClient/libsynqclient_global.h"
+
+namespace SynqClient {
+
+class DeleteBatchJobPrivate;
+
+class LIBSYNQCLIENT_EXPORT DeleteBatchJob : public BatchJob
+{
+    Q_OBJECT
+public:
+    explicit DeleteBatchJob(QObject* parent = nullptr);
+    ~DeleteBatchJob() override;
+
+    QStringList paths() const;
+    void setPaths(const QStringList& paths);
+    void addPath(const QString& path);
+
+protected:
+    explicit DeleteBatchJob(DeleteBatchJobPrivate* d, QObject* parent = nullptr);
+
+    Q_DECLARE_PRIVATE(DeleteBatchJob);
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_DELETEBATCHJOB_H
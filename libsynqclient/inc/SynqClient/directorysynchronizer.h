@@ -29,11 +29,16 @@
 #include "FileInfo"
 #include "libsynqclient.h"
 #include "libsynqclient_global.h"
+#include "syncevent.h"
+#include "syncprogress.h"
+#include "syncstatistics.h"
 
 namespace SynqClient {
 
 class AbstractJobFactory;
+class LocalChangeWatcher;
 class SyncStateDatabase;
+class SyncTracer;
 
 class DirectorySynchronizerPrivate;
 
@@ -61,9 +66,15 @@ public:
     Filter filter() const;
     void setFilter(const Filter& filter);
 
+    LocalChangeWatcher* localChangeWatcher() const;
+    void setLocalChangeWatcher(LocalChangeWatcher* localChangeWatcher);
+
     int maxJobs() const;
     void setMaxJobs(int maxJobs);
 
+    int maxMultiplexedJobs() const;
+    void setMaxMultiplexedJobs(int maxMultiplexedJobs);
+
     bool retryWithFewerJobs() const;
 
     SyncConflictStrategy syncConflictStrategy() const;
@@ -72,6 +83,21 @@ public:
     SynchronizerFlags flags() const;
     void setFlags(const SynchronizerFlags flags);
 
+    int statisticsInterval() const;
+    void setStatisticsInterval(int statisticsInterval);
+
+    SyncStatistics statistics() const;
+
+    int progressInterval() const;
+    void setProgressInterval(int progressInterval);
+
+    SyncProgress currentProgress() const;
+
+    SyncTracer* tracer() const;
+    void setTracer(SyncTracer* tracer);
+
+    QString eventPath(quint32 pathId) const;
+
     SynchronizerState state() const;
     SynchronizerError error() const;
     QString errorString() const;
@@ -83,7 +109,10 @@ signals:
 
     void finished();
     void logMessageAvailable(SynchronizerLogEntryType type, const QString& message);
+    void syncEventAvailable(const SyncEvent& event);
     void progress(int value);
+    void progressAvailable(const SyncProgress& progress);
+    void statisticsAvailable(const SyncStatistics& statistics);
 
 protected:
     explicit DirectorySynchronizer(DirectorySynchronizerPrivate* d, QObject* parent = nullptr);
@@ -0,0 +1,102 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_DROPBOXCHANGEWATCHER_H
+#define SYNQCLIENT_DROPBOXCHANGEWATCHER_H
+
+#include <QObject>
+#include <QScopedPointer>
+#include <QtGlobal>
+
+#include "libsynqclient_global.h"
+
+class QNetworkAccessManager;
+
+namespace SynqClient {
+
+class DropboxChangeWatcherPrivate;
+class SyncStateDatabase;
+
+class LIBSYNQCLIENT_EXPORT DropboxChangeWatcher : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(bool running READ running NOTIFY runningChanged);
+
+public:
+    explicit DropboxChangeWatcher(QObject* parent = nullptr);
+    ~DropboxChangeWatcher() override;
+
+    bool running() const;
+
+    QNetworkAccessManager* networkAccessManager() const;
+    void setNetworkAccessManager(QNetworkAccessManager* networkAccessManager);
+
+    QString userAgent() const;
+    void setUserAgent(const QString& userAgent);
+
+    SyncStateDatabase* syncStateDatabase() const;
+    void setSyncStateDatabase(SyncStateDatabase* syncStateDatabase);
+
+    QString cursor() const;
+    void setCursor(const QString& cursor);
+
+    int timeout() const;
+    void setTimeout(int timeout);
+
+public slots:
+
+    void start();
+    void stop();
+
+signals:
+
+    /**
+     * @brief The remote folder has changed.
+     *
+     * This signal is emitted once the watcher learns that there are changes in the remote
+     * folder. Client code usually reacts on this by running a sync.
+     *
+     * After the signal has been emitted, the watcher pauses until the cursor changes (which
+     * happens when the changes have been fetched, e.g. by running a DirectorySynchronizer).
+     */
+    void remoteChanged();
+
+    /**
+     * @brief The running property changed.
+     */
+    void runningChanged();
+
+    /**
+     * @brief Watching for changes failed.
+     *
+     * This signal is emitted if a request to the Dropbox API failed. The @p errorString
+     * describes the issue. The watcher keeps running and retries after some time.
+     */
+    void errorOccurred(const QString& errorString);
+
+protected:
+    explicit DropboxChangeWatcher(DropboxChangeWatcherPrivate* d, QObject* parent = nullptr);
+
+    QScopedPointer<DropboxChangeWatcherPrivate> d_ptr;
+    Q_DECLARE_PRIVATE(DropboxChangeWatcher);
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_DROPBOXCHANGEWATCHER_H
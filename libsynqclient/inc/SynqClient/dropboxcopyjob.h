@@ -0,0 +1,54 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_DROPBOXCOPYJOB_H
+#define SYNQCLIENT_DROPBOXCOPYJOB_H
+
+#include <QObject>
+#include <QScopedPointer>
+#include <QtGlobal>
+
+#include "SynqClient/AbstractDropboxJob"
+#include "SynqClient/CopyJob"
+#include "SynqClient/libsynqclient_global.h"
+
+namespace SynqClient {
+
+class DropboxCopyJobPrivate;
+
+class LIBSYNQCLIENT_EXPORT DropboxCopyJob : public CopyJob, public AbstractDropboxJob
+{
+    Q_OBJECT
+public:
+    explicit DropboxCopyJob(QObject* parent = nullptr);
+    ~DropboxCopyJob() override;
+
+    // AbstractJob interface
+    void start() override;
+    void stop() override;
+
+protected:
+    explicit DropboxCopyJob(DropboxCopyJobPrivate* d, QObject* parent = nullptr);
+
+    Q_DECLARE_PRIVATE(DropboxCopyJob);
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_DROPBOXCOPYJOB_H
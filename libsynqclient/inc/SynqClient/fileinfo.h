@@ -20,6 +20,8 @@
 #ifndef SYNQCLIENT_FILEINFO_H
 #define SYNQCLIENT_FILEINFO_H
 
+#include <QDateTime>
+#include <QMap>
 #include <QObject>
 #include <QSharedDataPointer>
 #include <QVector>
@@ -62,6 +64,19 @@ public:
     bool isDeleted() const;
     void setDeleted(bool deleted);
 
+    qint64 size() const;
+    void setSize(qint64 size);
+
+    QDateTime lastModified() const;
+    void setLastModified(const QDateTime& lastModified);
+
+    QString fileId() const;
+    void setFileId(const QString& fileId);
+
+    QMap<QString, QString> checksums() const;
+    QString checksum(const QString& algorithm) const;
+    void setChecksum(const QString& algorithm, const QString& checksum);
+
     QVariant customProperty(const QString& name) const;
     void setCustomProperty(const QString& name, const QVariant& propertyValue);
 
@@ -0,0 +1,78 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_JOBMETRICS_H
+#define SYNQCLIENT_JOBMETRICS_H
+
+#include <QDateTime>
+#include <QSharedDataPointer>
+#include <QtGlobal>
+
+#include "libsynqclient_global.h"
+
+namespace SynqClient {
+
+class JobMetricsPrivate;
+
+class LIBSYNQCLIENT_EXPORT JobMetrics
+{
+public:
+    JobMetrics();
+    JobMetrics(const JobMetrics& other);
+    virtual ~JobMetrics();
+    JobMetrics& operator=(const JobMetrics& other);
+
+    QDateTime queuedTime() const;
+    void setQueuedTime(const QDateTime& queuedTime);
+
+    QDateTime startedTime() const;
+    void setStartedTime(const QDateTime& startedTime);
+
+    QDateTime firstByteTime() const;
+    void setFirstByteTime(const QDateTime& firstByteTime);
+
+    QDateTime finishedTime() const;
+    void setFinishedTime(const QDateTime& finishedTime);
+
+    qint64 bytesSent() const;
+    void setBytesSent(qint64 bytesSent);
+
+    qint64 bytesReceived() const;
+    void setBytesReceived(qint64 bytesReceived);
+
+    int requests() const;
+    void setRequests(int requests);
+
+    int retries() const;
+    void setRetries(int retries);
+
+    int httpStatus() const;
+    void setHttpStatus(int httpStatus);
+
+    qint64 queueDuration() const;
+    qint64 timeToFirstByte() const;
+    qint64 duration() const;
+
+private:
+    QSharedDataPointer<JobMetricsPrivate> d;
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_JOBMETRICS_H
@@ -50,6 +50,7 @@ protected:
     // SyncStateDatabase interface
 public:
     bool openDatabase() override;
+    bool flushDatabase() override;
     bool closeDatabase() override;
     bool addEntry(const SyncStateEntry& entry) override;
     SyncStateEntry getEntry(const QString& path) override;
@@ -83,6 +83,31 @@ enum class JobError : quint32 {
      * might support "listing" a remote file.
      */
     RemoteResourceIsNotAFolder,
+
+    /**
+     * @brief The remote resource already exists.
+     *
+     * This error is used by jobs which move remote resources to indicate that the target
+     * already exists and shall not be overwritten.
+     */
+    ResourceExists,
+
+    /**
+     * @brief The transferred data did not match the checksum reported by the server.
+     *
+     * This error is used by jobs transferring files if the checksum calculated while the data
+     * was sent or received differs from the one reported by the server, i.e. the data was
+     * corrupted on the way.
+     */
+    ChecksumMismatch,
+
+    /**
+     * @brief Writing data to a local file or device failed.
+     *
+     * This error is used by jobs downloading files if the received data could not be written to
+     * the configured output, e.g. because the disk is full.
+     */
+    WriteFailed,
 };
 
 Q_ENUM_NS(JobError);
@@ -199,6 +224,16 @@ enum class SynchronizerError : quint32 {
      * @brief Deleting a remote resource has failed.
      */
     FailedDeletingRemoteResource,
+
+    /**
+     * @brief Moving a remote resource has failed.
+     */
+    FailedMovingRemoteResource,
+
+    /**
+     * @brief Copying a remote resource has failed.
+     */
+    FailedCopyingRemoteResource,
 };
 
 Q_ENUM_NS(SynchronizerError);
@@ -255,7 +290,12 @@ enum class JobType : quint32 {
     DownloadFile, //!< A job to download a file.
     UploadFile, //!< A job to upload a file.
     GetFileInfo, //!< A job to get information about a single file or directory.
-    ListFiles //!< A job to get information about entries in a folder.
+    ListFiles, //!< A job to get information about entries in a folder.
+    CreateDirectoryBatch, //!< A job to create several directories at once.
+    DeleteResourceBatch, //!< A job to delete several files or directories at once.
+    UploadFileBatch, //!< A job to upload several files at once.
+    MoveResource, //!< A job to move or rename a file or directory.
+    CopyResource //!< A job to copy a file or directory on the server side.
 };
 
 Q_ENUM_NS(JobType);
@@ -292,6 +332,17 @@ enum class RemoteChangeDetectionMode : quint32 {
      * the changes since the previous sync can be queried from the server.
      */
     RootFolderSyncStream,
+
+    /**
+     * @brief The remote supports WebDAV collection synchronization.
+     *
+     * This mode can be used for WebDAV servers which implement sync-collection reports (RFC 6578),
+     * like e.g. NextCloud. Instead of walking down all folders with changed sync attributes, the
+     * sync stores the sync token reported by the server and - on the next run - only queries the
+     * members which have been changed or deleted since then. Hence, the costs of a remote scan are
+     * proportional to the number of changes instead of the size of the remote folder tree.
+     */
+    SyncCollection
 };
 
 Q_ENUM_NS(RemoteChangeDetectionMode);
@@ -340,6 +391,23 @@ enum class SynchronizerState : quint32 {
 
 Q_ENUM_NS(SynchronizerState);
 
+/**
+ * @brief The phases a synchronization runs through.
+ *
+ * This enum is used to report how much time a synchronizer spent in each of its phases, see
+ * SyncStatistics::phaseDuration().
+ */
+enum class SynchronizerPhase : quint32 {
+    CreateRemoteFolder = 0, //!< Creating the remote root folder on the first sync.
+    LocalScan, //!< Scanning the local folder for changes.
+    RemoteListing, //!< Listing the remote folder to detect changes on the server.
+    Merge, //!< Merging local and remote changes into a sync plan.
+    LocalActions, //!< Applying changes to the local folder (e.g. local deletes and moves).
+    Transfers, //!< Running remote actions (uploads, downloads, remote deletes and so on).
+};
+
+Q_ENUM_NS(SynchronizerPhase);
+
 /**
  * @brief Determines how to proceed in case a sync conflict is detected.
  *
@@ -481,7 +549,32 @@ enum class SynchronizerLogEntryType : quint32 {
      *
      * Such a message carries the path of a file which is uploaded.
      */
-    Upload
+    Upload,
+
+    /**
+     * @brief A file or folder is moved remotely.
+     *
+     * Such a message carries the old and the new path of a file or folder which is moved on the
+     * server side (separated by " -> ").
+     */
+    RemoteMove,
+
+    /**
+     * @brief A file is copied remotely.
+     *
+     * Such a message carries the path of an already synced file and the path of a new file with
+     * identical content, which is created by copying the former one on the server side (separated
+     * by " -> ").
+     */
+    RemoteCopy,
+
+    /**
+     * @brief A file or folder is moved locally.
+     *
+     * Such a message carries the old and the new path of a file or folder which has been moved
+     * on the server side and hence is moved locally as well (separated by " -> ").
+     */
+    LocalMove
 
 };
 
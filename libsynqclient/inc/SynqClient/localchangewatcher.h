@@ -0,0 +1,95 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_LOCALCHANGEWATCHER_H
+#define SYNQCLIENT_LOCALCHANGEWATCHER_H
+
+#include <QObject>
+#include <QScopedPointer>
+#include <QSet>
+#include <QString>
+#include <QtGlobal>
+
+#include "directorysynchronizer.h"
+#include "libsynqclient_global.h"
+
+namespace SynqClient {
+
+class LocalChangeWatcherPrivate;
+
+class LIBSYNQCLIENT_EXPORT LocalChangeWatcher : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(bool running READ running NOTIFY runningChanged);
+
+public:
+    explicit LocalChangeWatcher(QObject* parent = nullptr);
+    ~LocalChangeWatcher() override;
+
+    bool running() const;
+
+    QString directory() const;
+    void setDirectory(const QString& directory);
+
+    QString stateFile() const;
+    void setStateFile(const QString& stateFile);
+
+    bool exclusiveAccess() const;
+    void setExclusiveAccess(bool exclusiveAccess);
+
+    DirectorySynchronizer::Filter filter() const;
+    void setFilter(const DirectorySynchronizer::Filter& filter);
+
+    bool fullScanRequired() const;
+    QSet<QString> dirtyPaths() const;
+
+    void markDirty(const QString& path);
+    void requestFullScan();
+    void clear();
+
+public slots:
+
+    void start();
+    void stop();
+
+signals:
+
+    /**
+     * @brief The local directory has changed.
+     *
+     * This signal is emitted when a new path has been marked as dirty or a full scan of the local
+     * directory became necessary. Client code usually reacts on this by running a sync.
+     */
+    void localChanged();
+
+    /**
+     * @brief The running property changed.
+     */
+    void runningChanged();
+
+protected:
+    explicit LocalChangeWatcher(LocalChangeWatcherPrivate* d, QObject* parent = nullptr);
+
+    QScopedPointer<LocalChangeWatcherPrivate> d_ptr;
+    Q_DECLARE_PRIVATE(LocalChangeWatcher);
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_LOCALCHANGEWATCHER_H
@@ -0,0 +1,50 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef SYNQCLIENT_MOVEJOB_H
+#define SYNQCLIENT_MOVEJOB_H
+
+#include <QObject>
+#include <QScopedPointer>
+#include <QtGlobal>
+
+#include "AbstractCopyMoveJob"
+#include "libsynqclient_global.h"
+
+namespace SynqClient {
+
+class MoveJobPrivate;
+
+class LIBSYNQCLIENT_EXPORT MoveJob : public AbstractCopyMoveJob
+{
+    Q_OBJECT
+public:
+    explicit MoveJob(QObject* parent = nullptr);
+    ~MoveJob() override;
+
+protected:
+    explicit MoveJob(MoveJobPrivate* d, QObject* parent = nullptr);
+
+    Q_DECLARE_PRIVATE(MoveJob);
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_MOVEJOB_H
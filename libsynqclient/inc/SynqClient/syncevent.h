@@ -0,0 +1,53 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_SYNCEVENT_H
+#define SYNQCLIENT_SYNCEVENT_H
+
+#include <QMetaType>
+#include <QtGlobal>
+
+#include "libsynqclient.h"
+#include "libsynqclient_global.h"
+
+namespace SynqClient {
+
+class LIBSYNQCLIENT_EXPORT SyncEvent
+{
+public:
+    static const quint32 NoPath = 0;
+
+    SyncEvent();
+    SyncEvent(SynchronizerLogEntryType type, quint32 pathId, quint32 sourcePathId = NoPath);
+
+    SynchronizerLogEntryType type() const;
+    quint32 pathId() const;
+    quint32 sourcePathId() const;
+
+private:
+    SynchronizerLogEntryType m_type;
+    quint32 m_pathId;
+    quint32 m_sourcePathId;
+};
+
+} // namespace SynqClient
+
+Q_DECLARE_METATYPE(SynqClient::SyncEvent);
+
+#endif // SYNQCLIENT_SYNCEVENT_H
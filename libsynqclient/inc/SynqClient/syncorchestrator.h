@@ -0,0 +1,99 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_SYNCORCHESTRATOR_H
+#define SYNQCLIENT_SYNCORCHESTRATOR_H
+
+#include <functional>
+
+#include <QDateTime>
+#include <QList>
+#include <QObject>
+#include <QScopedPointer>
+#include <QUrl>
+#include <QtGlobal>
+
+#include "libsynqclient.h"
+#include "libsynqclient_global.h"
+
+class QNetworkAccessManager;
+
+namespace SynqClient {
+
+class DirectorySynchronizer;
+class SyncOrchestratorPrivate;
+
+class LIBSYNQCLIENT_EXPORT SyncOrchestrator : public QObject
+{
+    Q_OBJECT
+public:
+    typedef std::function<void(DirectorySynchronizer* synchronizer,
+                               QNetworkAccessManager* networkAccessManager)>
+            Setup;
+
+    explicit SyncOrchestrator(QObject* parent = nullptr);
+    ~SyncOrchestrator() override;
+
+    int maxJobs() const;
+    void setMaxJobs(int maxJobs);
+
+    int maxJobsPerHost() const;
+    void setMaxJobsPerHost(int maxJobsPerHost);
+
+    int addRoot(const QUrl& url, const Setup& setup, int priority = 0);
+    void removeRoot(int root);
+    QList<int> roots() const;
+
+    QUrl url(int root) const;
+    int priority(int root) const;
+    void setPriority(int root, int priority);
+    QDateTime lastSync(int root) const;
+    SynchronizerError lastError(int root) const;
+    QString lastErrorString(int root) const;
+    bool isQueued(int root) const;
+    bool isRunning(int root) const;
+    int jobLimit(int root) const;
+
+    int numQueued() const;
+    int numRunning() const;
+
+    QNetworkAccessManager* networkAccessManager(const QUrl& url);
+
+public slots:
+
+    void schedule(int root);
+    void scheduleAll();
+    void stop();
+
+signals:
+
+    void rootStarted(int root);
+    void rootFinished(int root);
+    void idle();
+
+protected:
+    explicit SyncOrchestrator(SyncOrchestratorPrivate* d, QObject* parent = nullptr);
+
+    QScopedPointer<SyncOrchestratorPrivate> d_ptr;
+    Q_DECLARE_PRIVATE(SyncOrchestrator);
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_SYNCORCHESTRATOR_H
@@ -0,0 +1,73 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_SYNCPROGRESS_H
+#define SYNQCLIENT_SYNCPROGRESS_H
+
+#include <QMetaType>
+#include <QSharedDataPointer>
+#include <QVariantMap>
+#include <QtGlobal>
+
+#include "libsynqclient_global.h"
+
+namespace SynqClient {
+
+class SyncProgressPrivate;
+
+class LIBSYNQCLIENT_EXPORT SyncProgress
+{
+public:
+    SyncProgress();
+    SyncProgress(const SyncProgress& other);
+    virtual ~SyncProgress();
+    SyncProgress& operator=(const SyncProgress& other);
+
+    int progress() const;
+    void setProgress(int progress);
+
+    int actionsDone() const;
+    void setActionsDone(int actionsDone);
+
+    int actionsTotal() const;
+    void setActionsTotal(int actionsTotal);
+
+    qint64 bytesDone() const;
+    void setBytesDone(qint64 bytesDone);
+
+    qint64 bytesTotal() const;
+    void setBytesTotal(qint64 bytesTotal);
+
+    double bytesPerSecond() const;
+    void setBytesPerSecond(double bytesPerSecond);
+
+    qint64 eta() const;
+    void setEta(qint64 eta);
+
+    QVariantMap toVariantMap() const;
+
+private:
+    QSharedDataPointer<SyncProgressPrivate> d;
+};
+
+} // namespace SynqClient
+
+Q_DECLARE_METATYPE(SynqClient::SyncProgress);
+
+#endif // SYNQCLIENT_SYNCPROGRESS_H
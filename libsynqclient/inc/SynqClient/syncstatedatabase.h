@@ -48,6 +48,7 @@ public:
     virtual bool removeEntries(const QString& path) = 0;
     virtual bool removeEntry(const QString& path) = 0;
     virtual bool closeDatabase();
+    virtual bool flushDatabase();
 
     bool isOpen() const;
 
@@ -54,6 +54,15 @@ public:
     QString syncProperty() const;
     void setSyncProperty(const QString& syncProperty);
 
+    QString localFileId() const;
+    void setLocalFileId(const QString& localFileId);
+
+    QString fingerprint() const;
+    void setFingerprint(const QString& fingerprint);
+
+    QString remoteFileId() const;
+    void setRemoteFileId(const QString& remoteFileId);
+
     static QString makePath(const QString& path);
     static QString makePath(const QDir& dir, const QString& path);
 
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_SYNCSTATISTICS_H
+#define SYNQCLIENT_SYNCSTATISTICS_H
+
+#include <QDateTime>
+#include <QMetaType>
+#include <QSharedDataPointer>
+#include <QVariantMap>
+#include <QVector>
+#include <QtGlobal>
+
+#include "libsynqclient.h"
+#include "libsynqclient_global.h"
+
+namespace SynqClient {
+
+class JobMetrics;
+class SyncStatisticsPrivate;
+
+class LIBSYNQCLIENT_EXPORT SyncStatistics
+{
+public:
+    SyncStatistics();
+    SyncStatistics(const SyncStatistics& other);
+    virtual ~SyncStatistics();
+    SyncStatistics& operator=(const SyncStatistics& other);
+
+    QDateTime startTime() const;
+    void setStartTime(const QDateTime& startTime);
+
+    QDateTime finishTime() const;
+    void setFinishTime(const QDateTime& finishTime);
+
+    qint64 duration() const;
+
+    qint64 phaseDuration(SynchronizerPhase phase) const;
+    void setPhaseDuration(SynchronizerPhase phase, qint64 duration);
+
+    int jobs() const;
+    int failedJobs() const;
+    int requests() const;
+    int retries() const;
+    qint64 bytesSent() const;
+    qint64 bytesReceived() const;
+    double uploadRate() const;
+    double downloadRate() const;
+    QVector<int> latencyHistogram() const;
+
+    void addJob(const JobMetrics& metrics, JobError error);
+
+    QVariantMap toVariantMap() const;
+
+    static QVector<int> latencyHistogramBounds();
+
+private:
+    QSharedDataPointer<SyncStatisticsPrivate> d;
+};
+
+} // namespace SynqClient
+
+Q_DECLARE_METATYPE(SynqClient::SyncStatistics);
+
+#endif // SYNQCLIENT_SYNCSTATISTICS_H
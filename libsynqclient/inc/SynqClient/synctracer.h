@@ -0,0 +1,70 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_SYNCTRACER_H
+#define SYNQCLIENT_SYNCTRACER_H
+
+#include <QByteArray>
+#include <QDateTime>
+#include <QObject>
+#include <QScopedPointer>
+#include <QVariantMap>
+#include <QtGlobal>
+
+#include "libsynqclient_global.h"
+
+namespace SynqClient {
+
+class SyncTracerPrivate;
+
+class LIBSYNQCLIENT_EXPORT SyncTracer : public QObject
+{
+    Q_OBJECT
+public:
+    enum Track : int {
+        AutoTrack = -1, //!< Place spans automatically on the first track where they don't overlap.
+    };
+
+    explicit SyncTracer(QObject* parent = nullptr);
+    ~SyncTracer() override;
+
+    bool isEmpty() const;
+    void clear();
+
+    void setTrackName(int track, const QString& name);
+    void addSpan(const QString& category, const QString& name, const QDateTime& start,
+                 const QDateTime& end, const QVariantMap& args = QVariantMap(),
+                 int track = AutoTrack);
+    void addInstant(const QString& category, const QString& name, const QDateTime& time,
+                    const QVariantMap& args, int track);
+    void addCounter(const QString& name, const QDateTime& time, const QVariantMap& values);
+
+    QByteArray toJson() const;
+    bool save(const QString& fileName) const;
+
+protected:
+    explicit SyncTracer(SyncTracerPrivate* d, QObject* parent = nullptr);
+
+    QScopedPointer<SyncTracerPrivate> d_ptr;
+    Q_DECLARE_PRIVATE(SyncTracer);
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_SYNCTRACER_H
@@ -0,0 +1,80 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_THREADEDSYNCHRONIZER_H
+#define SYNQCLIENT_THREADEDSYNCHRONIZER_H
+
+#include <functional>
+
+#include <QObject>
+#include <QScopedPointer>
+#include <QtGlobal>
+
+#include "directorysynchronizer.h"
+#include "libsynqclient.h"
+#include "libsynqclient_global.h"
+#include "syncprogress.h"
+#include "syncstatistics.h"
+
+namespace SynqClient {
+
+class ThreadedSynchronizerPrivate;
+
+class LIBSYNQCLIENT_EXPORT ThreadedSynchronizer : public QObject
+{
+    Q_OBJECT
+public:
+    typedef std::function<void(DirectorySynchronizer* synchronizer)> Setup;
+
+    explicit ThreadedSynchronizer(QObject* parent = nullptr);
+    ~ThreadedSynchronizer() override;
+
+    Setup setup() const;
+    void setSetup(const Setup& setup);
+
+    SynchronizerState state() const;
+    SynchronizerError error() const;
+    QString errorString() const;
+    SyncProgress currentProgress() const;
+    SyncStatistics statistics() const;
+
+    bool start();
+    void stop();
+    bool waitForFinished(int timeout = -1) const;
+
+signals:
+
+    void finished();
+    void logMessageAvailable(SynchronizerLogEntryType type, const QString& message);
+    void progress(int value);
+    void progressAvailable(const SyncProgress& progress);
+    void statisticsAvailable(const SyncStatistics& statistics);
+    void syncEventAvailable(SynchronizerLogEntryType type, const QString& path,
+                            const QString& sourcePath);
+
+protected:
+    explicit ThreadedSynchronizer(ThreadedSynchronizerPrivate* d, QObject* parent = nullptr);
+
+    QScopedPointer<ThreadedSynchronizerPrivate> d_ptr;
+    Q_DECLARE_PRIVATE(ThreadedSynchronizer);
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_THREADEDSYNCHRONIZER_H
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_UPLOADFILEBATCHJOB_H
+#define SYNQCLIENT_UPLOADFILEBATCHJOB_H
+
+#include <QObject>
+#include <QScopedPointer>
+#include <QStringList>
+#include <QVariant>
+#include <QtGlobal>
+
+#include "SynqClient/BatchJob"
+#include "SynqClient/libsynqclient_global.h"
+
+namespace SynqClient {
+
+class UploadFileBatchJobPrivate;
+
+class LIBSYNQCLIENT_EXPORT UploadFileBatchJob : public BatchJob
+{
+    Q_OBJECT
+public:
+    explicit UploadFileBatchJob(QObject* parent = nullptr);
+    ~UploadFileBatchJob() override;
+
+    void addFile(const QString& localFilename, const QString& remoteFilename,
+                 const QVariant& syncAttribute = QVariant());
+
+    QStringList remoteFilenames() const;
+    QString localFilename(const QString& remoteFilename) const;
+    QVariant syncAttribute(const QString& remoteFilename) const;
+
+    int maxParallelUploads() const;
+    void setMaxParallelUploads(int maxParallelUploads);
+
+protected:
+    explicit UploadFileBatchJob(UploadFileBatchJobPrivate* d, QObject* parent = nullptr);
+
+    Q_DECLARE_PRIVATE(UploadFileBatchJob);
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_UPLOADFILEBATCHJOB_H
@@ -61,6 +61,10 @@ public:
     int transferTimeout() const;
     void setTransferTimeout(int transferTimeout);
 
+    bool syncCollectionEnabled() const;
+    void setSyncCollectionEnabled(bool syncCollectionEnabled);
+    bool syncCollectionSupported() const;
+
 public slots:
 
     void testServer(const QString& path = QString());
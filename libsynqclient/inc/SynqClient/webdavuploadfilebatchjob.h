@@ -0,0 +1,67 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_WEBDAVUPLOADFILEBATCHJOB_H
+#define SYNQCLIENT_WEBDAVUPLOADFILEBATCHJOB_H
+
+#include <QObject>
+#include <QScopedPointer>
+#include <QtGlobal>
+
+#include "SynqClient/AbstractWebDAVJob"
+#include "SynqClient/UploadFileBatchJob"
+#include "SynqClient/libsynqclient_global.h"
+
+class QNetworkReply;
+
+namespace SynqClient {
+
+class WebDAVUploadFileBatchJobPrivate;
+
+class LIBSYNQCLIENT_EXPORT WebDAVUploadFileBatchJob : public UploadFileBatchJob,
+                                                    public AbstractWebDAVJob
+{
+    Q_OBJECT
+public:
+    explicit WebDAVUploadFileBatchJob(QObject* parent = nullptr);
+    ~WebDAVUploadFileBatchJob() override;
+
+    bool bulkUploadSupported() const;
+
+    // AbstractJob interface
+    void start() override;
+    void stop() override;
+
+protected:
+    explicit WebDAVUploadFileBatchJob(WebDAVUploadFileBatchJobPrivate* d,
+                                      QObject* parent = nullptr);
+
+    Q_DECLARE_PRIVATE(WebDAVUploadFileBatchJob);
+
+private:
+    void hashBulkUploads(const QStringList& remoteFilenames);
+    void runBulkUpload(const QStringList& remoteFilenames);
+    void handleBulkUploadFinished(QNetworkReply* reply, const QStringList& remoteFilenames);
+    void runIndividualUploads();
+    void startNextUploads();
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_WEBDAVUPLOADFILEBATCHJOB_H
@@ -2,6 +2,8 @@ QT *= network xml sql
 CONFIG *= c++14
 
 SOURCES *= \
+    $$PWD/src/abstractcopymovejob.cpp \
+    $$PWD/src/abstractcopymovejobprivate.cpp \
     $$PWD/src/abstractdropboxjob.cpp \
     $$PWD/src/abstractdropboxjobprivate.cpp \
     $$PWD/src/abstractjob.cpp \
@@ -10,18 +12,42 @@ SOURCES *= \
     $$PWD/src/abstractjobprivate.cpp \
     $$PWD/src/abstractwebdavjob.cpp \
     $$PWD/src/abstractwebdavjobprivate.cpp \
+    $$PWD/src/asyncdevicewriter.cpp \
+    $$PWD/src/asyncfilehasher.cpp \
+    $$PWD/src/asyncsyncstatedatabase.cpp \
+    $$PWD/src/asyncsyncstatedatabaseprivate.cpp \
+    $$PWD/src/batchjob.cpp \
+    $$PWD/src/batchjobprivate.cpp \
     $$PWD/src/compositejob.cpp \
     $$PWD/src/compositejobprivate.cpp \
+    $$PWD/src/contenthasher.cpp \
+    $$PWD/src/continuoussynchronizer.cpp \
+    $$PWD/src/continuoussynchronizerprivate.cpp \
+    $$PWD/src/copyjob.cpp \
+    $$PWD/src/copyjobprivate.cpp \
+    $$PWD/src/createdirectorybatchjob.cpp \
+    $$PWD/src/createdirectorybatchjobprivate.cpp \
     $$PWD/src/createdirectoryjob.cpp \
     $$PWD/src/createdirectoryjobprivate.cpp \
+    $$PWD/src/deletebatchjob.cpp \
+    $$PWD/src/deletebatchjobprivate.cpp \
     $$PWD/src/deletejob.cpp \
     $$PWD/src/deletejobprivate.cpp \
     $$PWD/src/directorysynchronizer.cpp \
     $$PWD/src/directorysynchronizerprivate.cpp \
     $$PWD/src/downloadfilejob.cpp \
     $$PWD/src/downloadfilejobprivate.cpp \
+    $$PWD/src/dropboxchangewatcher.cpp \
+    $$PWD/src/dropboxchangewatcherprivate.cpp \
+    $$PWD/src/dropboxcopyjob.cpp \
+    $$PWD/src/dropboxcopyjobprivate.cpp \
+    $$PWD/src/dropboxcopymoverequest.cpp \
+    $$PWD/src/dropboxcreatedirectorybatchjob.cpp \
+    $$PWD/src/dropboxcreatedirectorybatchjobprivate.cpp \
     $$PWD/src/dropboxcreatedirectoryjob.cpp \
     $$PWD/src/dropboxcreatedirectoryjobprivate.cpp \
+    $$PWD/src/dropboxdeletebatchjob.cpp \
+    $$PWD/src/dropboxdeletebatchjobprivate.cpp \
     $$PWD/src/dropboxdeletejob.cpp \
     $$PWD/src/dropboxdeletejobprivate.cpp \
     $$PWD/src/dropboxdownloadfilejob.cpp \
@@ -32,27 +58,55 @@ SOURCES *= \
     $$PWD/src/dropboxjobfactoryprivate.cpp \
     $$PWD/src/dropboxlistfilesjob.cpp \
     $$PWD/src/dropboxlistfilesjobprivate.cpp \
+    $$PWD/src/dropboxmovejob.cpp \
+    $$PWD/src/dropboxmovejobprivate.cpp \
+    $$PWD/src/dropboxuploadfilebatchjob.cpp \
+    $$PWD/src/dropboxuploadfilebatchjobprivate.cpp \
     $$PWD/src/dropboxuploadfilejob.cpp \
     $$PWD/src/dropboxuploadfilejobprivate.cpp \
     $$PWD/src/fileinfo.cpp \
     $$PWD/src/fileinfoprivate.cpp \
     $$PWD/src/getfileinfojob.cpp \
     $$PWD/src/getfileinfojobprivate.cpp \
+    $$PWD/src/hashingdevice.cpp \
+    $$PWD/src/jobmetrics.cpp \
+    $$PWD/src/jobmetricsprivate.cpp \
     $$PWD/src/jsonsyncstatedatabase.cpp \
     $$PWD/src/jsonsyncstatedatabaseprivate.cpp \
     $$PWD/src/libsynqclient.cpp \
     $$PWD/src/listfilesjob.cpp \
     $$PWD/src/listfilesjobprivate.cpp \
+    $$PWD/src/localchangewatcher.cpp \
+    $$PWD/src/localchangewatcherprivate.cpp \
+    $$PWD/src/movejob.cpp \
+    $$PWD/src/movejobprivate.cpp \
     $$PWD/src/nextcloudloginflow.cpp \
     $$PWD/src/nextcloudloginflowprivate.cpp \
+    $$PWD/src/readaheaddevice.cpp \
     $$PWD/src/sqlsyncstatedatabase.cpp \
     $$PWD/src/sqlsyncstatedatabaseprivate.cpp \
+    $$PWD/src/syncevent.cpp \
+    $$PWD/src/syncorchestrator.cpp \
+    $$PWD/src/syncorchestratorprivate.cpp \
+    $$PWD/src/syncprogress.cpp \
+    $$PWD/src/syncprogressprivate.cpp \
     $$PWD/src/syncstatedatabase.cpp \
     $$PWD/src/syncstatedatabaseprivate.cpp \
     $$PWD/src/syncstateentry.cpp \
     $$PWD/src/syncstateentryprivate.cpp \
+    $$PWD/src/syncstatistics.cpp \
+    $$PWD/src/syncstatisticsprivate.cpp \
+    $$PWD/src/synctracer.cpp \
+    $$PWD/src/synctracerprivate.cpp \
+    $$PWD/src/threadedsynchronizer.cpp \
+    $$PWD/src/threadedsynchronizerprivate.cpp \
+    $$PWD/src/uploadfilebatchjob.cpp \
+    $$PWD/src/uploadfilebatchjobprivate.cpp \
     $$PWD/src/uploadfilejob.cpp \
     $$PWD/src/uploadfilejobprivate.cpp \
+    $$PWD/src/webdavcopyjob.cpp \
+    $$PWD/src/webdavcopyjobprivate.cpp \
+    $$PWD/src/webdavcopymoverequest.cpp \
     $$PWD/src/webdavcreatedirectoryjob.cpp \
     $$PWD/src/webdavcreatedirectoryjobprivate.cpp \
     $$PWD/src/webdavdeletejob.cpp \
@@ -65,110 +119,198 @@ SOURCES *= \
     $$PWD/src/webdavjobfactoryprivate.cpp \
     $$PWD/src/webdavlistfilesjob.cpp \
     $$PWD/src/webdavlistfilesjobprivate.cpp \
+    $$PWD/src/webdavmovejob.cpp \
+    $$PWD/src/webdavmovejobprivate.cpp \
+    $$PWD/src/webdavuploadfilebatchjob.cpp \
+    $$PWD/src/webdavuploadfilebatchjobprivate.cpp \
     $$PWD/src/webdavuploadfilejob.cpp \
     $$PWD/src/webdavuploadfilejobprivate.cpp
 
 HEADERS *= \
+    $$PWD/inc/SynqClient/AbstractCopyMoveJob \
     $$PWD/inc/SynqClient/AbstractDropboxJob \
     $$PWD/inc/SynqClient/AbstractJob \
     $$PWD/inc/SynqClient/AbstractJobFactory \
     $$PWD/inc/SynqClient/AbstractWebDAVJob \
+    $$PWD/inc/SynqClient/AsyncSyncStateDatabase \
+    $$PWD/inc/SynqClient/BatchJob \
     $$PWD/inc/SynqClient/CompositeJob \
+    $$PWD/inc/SynqClient/ContinuousSynchronizer \
+    $$PWD/inc/SynqClient/CopyJob \
+    $$PWD/inc/SynqClient/CreateDirectoryBatchJob \
     $$PWD/inc/SynqClient/CreateDirectoryJob \
+    $$PWD/inc/SynqClient/DeleteBatchJob \
     $$PWD/inc/SynqClient/DeleteJob \
     $$PWD/inc/SynqClient/DirectorySynchronizer \
     $$PWD/inc/SynqClient/DownloadFileJob \
+    $$PWD/inc/SynqClient/DropboxChangeWatcher \
+    $$PWD/inc/SynqClient/DropboxCopyJob \
+    $$PWD/inc/SynqClient/DropboxCreateDirectoryBatchJob \
     $$PWD/inc/SynqClient/DropboxCreateDirectoryJob \
+    $$PWD/inc/SynqClient/DropboxDeleteBatchJob \
     $$PWD/inc/SynqClient/DropboxDeleteJob \
     $$PWD/inc/SynqClient/DropboxDownloadFileJob \
     $$PWD/inc/SynqClient/DropboxGetFileInfoJob \
     $$PWD/inc/SynqClient/DropboxJobFactory \
     $$PWD/inc/SynqClient/DropboxListFilesJob \
+    $$PWD/inc/SynqClient/DropboxMoveJob \
+    $$PWD/inc/SynqClient/DropboxUploadFileBatchJob \
     $$PWD/inc/SynqClient/DropboxUploadFileJob \
     $$PWD/inc/SynqClient/FileInfo \
     $$PWD/inc/SynqClient/GetFileInfoJob \
     $$PWD/inc/SynqClient/JSONSyncStateDatabase \
+    $$PWD/inc/SynqClient/JobMetrics \
     $$PWD/inc/SynqClient/ListFilesJob \
+    $$PWD/inc/SynqClient/LocalChangeWatcher \
+    $$PWD/inc/SynqClient/MoveJob \
     $$PWD/inc/SynqClient/NextCloudLoginFlow \
     $$PWD/inc/SynqClient/SQLSyncStateDatabase \
+    $$PWD/inc/SynqClient/SyncEvent \
+    $$PWD/inc/SynqClient/SyncOrchestrator \
+    $$PWD/inc/SynqClient/SyncProgress \
     $$PWD/inc/SynqClient/SyncStateDatabase \
     $$PWD/inc/SynqClient/SyncStateEntry \
+    $$PWD/inc/SynqClient/SyncStatistics \
+    $$PWD/inc/SynqClient/SyncTracer \
+    $$PWD/inc/SynqClient/ThreadedSynchronizer \
+    $$PWD/inc/SynqClient/UploadFileBatchJob \
     $$PWD/inc/SynqClient/UploadFileJob \
+    $$PWD/inc/SynqClient/WebDAVCopyJob \
     $$PWD/inc/SynqClient/WebDAVCreateDirectoryJob \
     $$PWD/inc/SynqClient/WebDAVDeleteJob \
     $$PWD/inc/SynqClient/WebDAVDownloadFileJob \
     $$PWD/inc/SynqClient/WebDAVGetFileInfoJob \
     $$PWD/inc/SynqClient/WebDAVJobFactory \
     $$PWD/inc/SynqClient/WebDAVListFilesJob \
+    $$PWD/inc/SynqClient/WebDAVMoveJob \
+    $$PWD/inc/SynqClient/WebDAVUploadFileBatchJob \
     $$PWD/inc/SynqClient/WebDAVUploadFileJob \
+    $$PWD/inc/SynqClient/abstractcopymovejob.h \
     $$PWD/inc/SynqClient/abstractdropboxjob.h \
     $$PWD/inc/SynqClient/abstractjob.h \
     $$PWD/inc/SynqClient/abstractjobfactory.h \
     $$PWD/inc/SynqClient/abstractwebdavjob.h \
+    $$PWD/inc/SynqClient/asyncsyncstatedatabase.h \
+    $$PWD/inc/SynqClient/batchjob.h \
     $$PWD/inc/SynqClient/compositejob.h \
+    $$PWD/inc/SynqClient/continuoussynchronizer.h \
+    $$PWD/inc/SynqClient/copyjob.h \
+    $$PWD/inc/SynqClient/createdirectorybatchjob.h \
     $$PWD/inc/SynqClient/createdirectoryjob.h \
+    $$PWD/inc/SynqClient/deletebatchjob.h \
     $$PWD/inc/SynqClient/deletejob.h \
     $$PWD/inc/SynqClient/directorysynchronizer.h \
     $$PWD/inc/SynqClient/downloadfilejob.h \
+    $$PWD/inc/SynqClient/dropboxchangewatcher.h \
+    $$PWD/inc/SynqClient/dropboxcopyjob.h \
+    $$PWD/inc/SynqClient/dropboxcreatedirectorybatchjob.h \
     $$PWD/inc/SynqClient/dropboxcreatedirectoryjob.h \
+    $$PWD/inc/SynqClient/dropboxdeletebatchjob.h \
     $$PWD/inc/SynqClient/dropboxdeletejob.h \
     $$PWD/inc/SynqClient/dropboxdownloadfilejob.h \
     $$PWD/inc/SynqClient/dropboxgetfileinfojob.h \
     $$PWD/inc/SynqClient/dropboxjobfactory.h \
     $$PWD/inc/SynqClient/dropboxlistfilesjob.h \
+    $$PWD/inc/SynqClient/dropboxmovejob.h \
+    $$PWD/inc/SynqClient/dropboxuploadfilebatchjob.h \
     $$PWD/inc/SynqClient/dropboxuploadfilejob.h \
     $$PWD/inc/SynqClient/fileinfo.h \
     $$PWD/inc/SynqClient/getfileinfojob.h \
+    $$PWD/inc/SynqClient/jobmetrics.h \
     $$PWD/inc/SynqClient/jsonsyncstatedatabase.h \
     $$PWD/inc/SynqClient/libsynqclient_global.h \
     $$PWD/inc/SynqClient/libsynqclient.h \
     $$PWD/inc/SynqClient/listfilesjob.h \
+    $$PWD/inc/SynqClient/localchangewatcher.h \
+    $$PWD/inc/SynqClient/movejob.h \
     $$PWD/inc/SynqClient/nextcloudloginflow.h \
     $$PWD/inc/SynqClient/sqlsyncstatedatabase.h \
+    $$PWD/inc/SynqClient/syncevent.h \
+    $$PWD/inc/SynqClient/syncorchestrator.h \
+    $$PWD/inc/SynqClient/syncprogress.h \
     $$PWD/inc/SynqClient/syncstatedatabase.h \
     $$PWD/inc/SynqClient/syncstateentry.h \
+    $$PWD/inc/SynqClient/syncstatistics.h \
+    $$PWD/inc/SynqClient/synctracer.h \
+    $$PWD/inc/SynqClient/threadedsynchronizer.h \
+    $$PWD/inc/SynqClient/uploadfilebatchjob.h \
     $$PWD/inc/SynqClient/uploadfilejob.h \
+    $$PWD/inc/SynqClient/webdavcopyjob.h \
     $$PWD/inc/SynqClient/webdavcreatedirectoryjob.h \
     $$PWD/inc/SynqClient/webdavdeletejob.h \
     $$PWD/inc/SynqClient/webdavdownloadfilejob.h \
     $$PWD/inc/SynqClient/webdavgetfileinfojob.h \
     $$PWD/inc/SynqClient/webdavjobfactory.h \
     $$PWD/inc/SynqClient/webdavlistfilesjob.h \
+    $$PWD/inc/SynqClient/webdavmovejob.h \
+    $$PWD/inc/SynqClient/webdavuploadfilebatchjob.h \
     $$PWD/inc/SynqClient/webdavuploadfilejob.h \
+    $$PWD/src/abstractcopymovejobprivate.h \
     $$PWD/src/abstractdropboxjobprivate.h \
     $$PWD/src/abstractjobfactoryprivate.h \
     $$PWD/src/abstractjobprivate.h \
     $$PWD/src/abstractwebdavjobprivate.h \
     $$PWD/inc/SynqClient/SynqClient \
+    $$PWD/src/asyncdevicewriter.h \
+    $$PWD/src/asyncfilehasher.h \
+    $$PWD/src/asyncsyncstatedatabaseprivate.h \
+    $$PWD/src/batchjobprivate.h \
     $$PWD/src/changetree.h \
     $$PWD/src/compositejobprivate.h \
+    $$PWD/src/contenthasher.h \
+    $$PWD/src/continuoussynchronizerprivate.h \
+    $$PWD/src/copyjobprivate.h \
+    $$PWD/src/createdirectorybatchjobprivate.h \
     $$PWD/src/createdirectoryjobprivate.h \
+    $$PWD/src/deletebatchjobprivate.h \
     $$PWD/src/deletejobprivate.h \
     $$PWD/src/directorysynchronizerprivate.h \
     $$PWD/src/downloadfilejobprivate.h \
+    $$PWD/src/dropboxchangewatcherprivate.h \
+    $$PWD/src/dropboxcopyjobprivate.h \
+    $$PWD/src/dropboxcopymoverequest.h \
+    $$PWD/src/dropboxcreatedirectorybatchjobprivate.h \
     $$PWD/src/dropboxcreatedirectoryjobprivate.h \
+    $$PWD/src/dropboxdeletebatchjobprivate.h \
     $$PWD/src/dropboxdeletejobprivate.h \
     $$PWD/src/dropboxdownloadfilejobprivate.h \
     $$PWD/src/dropboxgetfileinfojobprivate.h \
     $$PWD/src/dropboxjobfactoryprivate.h \
     $$PWD/src/dropboxlistfilesjobprivate.h \
+    $$PWD/src/dropboxmovejobprivate.h \
+    $$PWD/src/dropboxuploadfilebatchjobprivate.h \
     $$PWD/src/dropboxuploadfilejobprivate.h \
     $$PWD/src/fileinfoprivate.h \
     $$PWD/src/getfileinfojobprivate.h \
+    $$PWD/src/hashingdevice.h \
+    $$PWD/src/jobmetricsprivate.h \
     $$PWD/src/jsonsyncstatedatabaseprivate.h \
     $$PWD/src/listfilesjobprivate.h \
+    $$PWD/src/localchangewatcherprivate.h \
+    $$PWD/src/movejobprivate.h \
     $$PWD/src/nextcloudloginflowprivate.h \
+    $$PWD/src/readaheaddevice.h \
     $$PWD/src/sqlsyncstatedatabaseprivate.h \
     $$PWD/src/syncactions.h \
+    $$PWD/src/syncorchestratorprivate.h \
+    $$PWD/src/syncprogressprivate.h \
     $$PWD/src/syncstatedatabaseprivate.h \
     $$PWD/src/syncstateentryprivate.h \
+    $$PWD/src/syncstatisticsprivate.h \
+    $$PWD/src/synctracerprivate.h \
+    $$PWD/src/threadedsynchronizerprivate.h \
+    $$PWD/src/uploadfilebatchjobprivate.h \
     $$PWD/src/uploadfilejobprivate.h \
+    $$PWD/src/webdavcopyjobprivate.h \
+    $$PWD/src/webdavcopymoverequest.h \
     $$PWD/src/webdavcreatedirectoryjobprivate.h \
     $$PWD/src/webdavdeletejobprivate.h \
     $$PWD/src/webdavdownloadfilejobprivate.h \
     $$PWD/src/webdavgetfileinfojobprivate.h \
     $$PWD/src/webdavjobfactoryprivate.h \
     $$PWD/src/webdavlistfilesjobprivate.h \
+    $$PWD/src/webdavmovejobprivate.h \
+    $$PWD/src/webdavuploadfilebatchjobprivate.h \
     $$PWD/src/webdavuploadfilejobprivate.h
 
 INCLUDEPATH *= $$PWD/inc
@@ -0,0 +1,134 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "../inc/SynqClient/abstractcopymovejob.h"
+
+#include "abstractcopymovejobprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @class AbstractCopyMoveJob
+ * @brief Base class for jobs which copy or move remote files or folders.
+ *
+ * This class holds the properties shared by the MoveJob and CopyJob: The path() of the remote
+ * resource to operate on, the targetPath() to copy or move it to and whether an existing target
+ * shall be replaced. Both operations are carried out on the server side, so no file contents need
+ * to be transferred.
+ *
+ * After the job finished successfully, fileInfo() holds information about the resource at the
+ * target path (as far as the server reports it).
+ */
+
+/**
+ * @brief Destructor.
+ */
+AbstractCopyMoveJob::~AbstractCopyMoveJob() {}
+
+/**
+ * @brief The path to the remote file or folder to copy or move.
+ */
+QString AbstractCopyMoveJob::path() const
+{
+    Q_D(const AbstractCopyMoveJob);
+    return d->path;
+}
+
+/**
+ * @brief Set the path to the remote file or folder to copy or move.
+ */
+void AbstractCopyMoveJob::setPath(const QString& path)
+{
+    Q_D(AbstractCopyMoveJob);
+    d->path = path;
+}
+
+/**
+ * @brief The path the remote file or folder shall be copied or moved to.
+ */
+QString AbstractCopyMoveJob::targetPath() const
+{
+    Q_D(const AbstractCopyMoveJob);
+    return d->targetPath;
+}
+
+/**
+ * @brief Set the path the remote file or folder shall be copied or moved to.
+ */
+void AbstractCopyMoveJob::setTargetPath(const QString& targetPath)
+{
+    Q_D(AbstractCopyMoveJob);
+    d->targetPath = targetPath;
+}
+
+/**
+ * @brief Replace the target if it already exists.
+ *
+ * If this property is false (the default), the job fails with JobError::ResourceExists if there
+ * already is a resource at the targetPath(). If set to true, an existing resource is replaced.
+ */
+bool AbstractCopyMoveJob::overwrite() const
+{
+    Q_D(const AbstractCopyMoveJob);
+    return d->overwrite;
+}
+
+/**
+ * @brief Set if an existing target shall be replaced.
+ */
+void AbstractCopyMoveJob::setOverwrite(bool overwrite)
+{
+    Q_D(AbstractCopyMoveJob);
+    d->overwrite = overwrite;
+}
+
+/**
+ * @brief Meta information about the file or folder at the target path.
+ *
+ * This can be used e.g. to learn the sync attribute of the resource at its new location. Note
+ * that not all backends report information about the resulting resource.
+ */
+FileInfo AbstractCopyMoveJob::fileInfo() const
+{
+    Q_D(const AbstractCopyMoveJob);
+    return d->fileInfo;
+}
+
+/**
+ * @brief Constructor.
+ */
+AbstractCopyMoveJob::AbstractCopyMoveJob(AbstractCopyMoveJobPrivate* d, QObject* parent)
+    : AbstractJob(d, parent)
+{
+}
+
+/**
+ * @brief Set meta information about the resource at the target path.
+ *
+ * This method shall be used by classes implementing this job to set the information about the
+ * resource at its new location.
+ */
+void AbstractCopyMoveJob::setFileInfo(const FileInfo& fileInfo)
+{
+    Q_D(AbstractCopyMoveJob);
+    d->fileInfo = fileInfo;
+}
+
+} // namespace SynqClient
@@ -0,0 +1,68 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "abstractcopymovejobprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @brief Constructor.
+ *
+ * The @p operation is the name of what the job does (e.g. "move" or "copy"). It is used in
+ * error messages.
+ */
+AbstractCopyMoveJobPrivate::AbstractCopyMoveJobPrivate(AbstractCopyMoveJob* q,
+                                                       const QString& operation)
+    : AbstractJobPrivate(q),
+      operation(operation),
+      path(),
+      targetPath(),
+      overwrite(false),
+      fileInfo()
+{
+}
+
+// The following forward to the protected interface of the job, so that the request helpers
+// shared by the copy and move jobs of a backend can drive the job:
+
+void AbstractCopyMoveJobPrivate::setError(JobError error, const QString& errorString)
+{
+    Q_Q(AbstractCopyMoveJob);
+    q->setError(error, errorString);
+}
+
+void AbstractCopyMoveJobPrivate::setState(JobState state)
+{
+    Q_Q(AbstractCopyMoveJob);
+    q->setState(state);
+}
+
+void AbstractCopyMoveJobPrivate::finishLater()
+{
+    Q_Q(AbstractCopyMoveJob);
+    q->finishLater();
+}
+
+JobError AbstractCopyMoveJobPrivate::fromNetworkError(const QNetworkReply& reply)
+{
+    return AbstractCopyMoveJob::fromNetworkError(reply);
+}
+
+} // namespace SynqClient
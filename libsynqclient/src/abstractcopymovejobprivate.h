@@ -0,0 +1,53 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef SYNQCLIENT_ABSTRACTCOPYMOVEJOBPRIVATE_H
+#define SYNQCLIENT_ABSTRACTCOPYMOVEJOBPRIVATE_H
+
+#include <QString>
+
+#include "abstractjobprivate.h"
+#include "SynqClient/abstractcopymovejob.h"
+
+namespace SynqClient {
+
+class AbstractCopyMoveJobPrivate : public AbstractJobPrivate
+{
+public:
+    AbstractCopyMoveJobPrivate(AbstractCopyMoveJob* q, const QString& operation);
+
+    Q_DECLARE_PUBLIC(AbstractCopyMoveJob);
+
+    QString operation;
+    QString path;
+    QString targetPath;
+    bool overwrite;
+    FileInfo fileInfo;
+
+    void setError(JobError error, const QString& errorString);
+    void setState(JobState state);
+    void finishLater();
+
+    static JobError fromNetworkError(const QNetworkReply& reply);
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_ABSTRACTCOPYMOVEJOBPRIVATE_H
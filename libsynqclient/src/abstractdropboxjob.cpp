@@ -102,6 +102,29 @@ void AbstractDropboxJob::setToken(const QString& token)
     d->token = token;
 }
 
+/**
+ * @brief Indicates if requests may use HTTP/2.
+ *
+ * The Dropbox API servers support HTTP/2. If this is set to true, requests run by the job
+ * explicitly allow it, so that concurrent requests can be multiplexed over a single connection.
+ *
+ * If this is false (the default), the default of the Qt version in use is kept.
+ */
+bool AbstractDropboxJob::http2Allowed() const
+{
+    Q_D(const AbstractDropboxJob);
+    return d->http2Allowed;
+}
+
+/**
+ * @brief Set if requests may use HTTP/2.
+ */
+void AbstractDropboxJob::setHttp2Allowed(bool http2Allowed)
+{
+    Q_D(AbstractDropboxJob);
+    d->http2Allowed = http2Allowed;
+}
+
 /**
  * @brief Constructor.
  */
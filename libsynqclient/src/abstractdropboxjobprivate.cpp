@@ -23,10 +23,13 @@
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QLoggingCategory>
+#include <QTimer>
 
 #include <cmath>
 
+#include "abstractjobprivate.h"
 #include "abstractwebdavjobprivate.h"
+#include "contenthasher.h"
 
 namespace SynqClient {
 
@@ -41,6 +44,7 @@ AbstractDropboxJobPrivate::AbstractDropboxJobPrivate(AbstractDropboxJob* q)
       userAgent(AbstractWebDAVJobPrivate::DefaultUserAgent),
       token(),
       numRetries(0),
+      http2Allowed(false),
       reply(nullptr)
 {
 }
@@ -94,6 +98,16 @@ FileInfo AbstractDropboxJobPrivate::fileInfoFromJson(const QJsonObject& obj,
     if (tag == "file") {
         result.setIsFile();
         result.setSyncAttribute(obj.value("rev").toString());
+        if (obj.contains("size")) {
+            result.setSize(static_cast<qint64>(obj.value("size").toDouble()));
+        }
+        if (obj.contains("content_hash")) {
+            result.setChecksum(ContentHasher::Dropbox, obj.value("content_hash").toString());
+        }
+        if (obj.contains("server_modified")) {
+            result.setLastModified(QDateTime::fromString(obj.value("server_modified").toString(),
+                                                         Qt::ISODate));
+        }
     } else if (tag == "folder") {
         result.setIsDirectory();
     } else if (tag == "deleted") {
@@ -102,6 +116,7 @@ FileInfo AbstractDropboxJobPrivate::fileInfoFromJson(const QJsonObject& obj,
 
     if (result.isValid() || result.isDeleted()) {
         result.setName(obj.value("name").toString());
+        result.setFileId(obj.value("id").toString());
         if (!basePath.isNull()) {
             result.setPath(
                     QDir(fixPath(basePath)).relativeFilePath(obj.value("path_display").toString()));
@@ -122,6 +137,7 @@ QNetworkReply* AbstractDropboxJobPrivate::post(const QString& endpoint, const QV
 
     auto reply_ = networkAccessManager->post(
             req, QJsonDocument::fromVariant(data).toJson(QJsonDocument::Compact));
+    AbstractJobPrivate::get(job)->trackReply(reply_);
 
     return reply_;
 }
@@ -138,6 +154,7 @@ QNetworkReply* AbstractDropboxJobPrivate::postData(const QString& endpoint, cons
                      QJsonDocument::fromVariant(data).toJson(QJsonDocument::Compact));
 
     auto reply_ = networkAccessManager->post(req, content);
+    AbstractJobPrivate::get(job)->trackReply(reply_);
 
     return reply_;
 }
@@ -150,6 +167,10 @@ QNetworkReply* AbstractDropboxJobPrivate::postData(const QString& endpoint, cons
 void AbstractDropboxJobPrivate::prepareNetworkRequest(QNetworkRequest& req, AbstractJob* job)
 {
     req.setTransferTimeout(job->transferTimeout());
+    AbstractJobPrivate::get(job)->metrics.setRetries(numRetries);
+    if (http2Allowed) {
+        req.setAttribute(QNetworkRequest::Http2AllowedAttribute, true);
+    }
 }
 
 /**
@@ -211,6 +232,122 @@ QString AbstractDropboxJobPrivate::fixPath(const QString& path)
     }
 }
 
+/**
+ * @brief Run a batch operation.
+ *
+ * This posts the @p data to the batch @p endpoint (e.g. `/files/delete_batch`). Dropbox might
+ * either process the batch right away or launch an asynchronous job. In the latter case, the
+ * status of the job is polled via the `check` endpoint belonging to the batch endpoint until it
+ * completes. Polling starts with a short interval which is increased over time.
+ *
+ * Once the batch completed, @p onCompleted is called with the result object (which usually
+ * contains an `entries` array holding the per entry results). If the batch fails as a whole,
+ * @p onFailed is called instead.
+ *
+ * Requests which are answered with "Too Many Requests" are retried automatically.
+ */
+void AbstractDropboxJobPrivate::runBatch(const QString& endpoint, const QVariant& data,
+                                         AbstractJob* job,
+                                         BatchCompletedHandlerFunction onCompleted,
+                                         BatchFailedHandlerFunction onFailed)
+{
+    auto reply_ = post(endpoint, data, job);
+    if (!reply_) {
+        onFailed(JobError::InvalidResponse, tr("Received null network reply"));
+        return;
+    }
+    reply = reply_;
+    QObject::connect(reply_, &QNetworkReply::finished, job, [=]() {
+        reply_->deleteLater();
+        if (checkIfRequestShallBeRetried(reply_)) {
+            numRetries += 1;
+            QTimer::singleShot(getRetryDelayInMilliseconds(reply_), job, [=]() {
+                if (job->error() == JobError::NoError) {
+                    runBatch(endpoint, data, job, onCompleted, onFailed);
+                }
+            });
+            return;
+        }
+        handleBatchStatus(endpoint, QString(), reply_, MinBatchPollInterval, job, onCompleted,
+                          onFailed);
+    });
+}
+
+void AbstractDropboxJobPrivate::pollBatchStatus(const QString& endpoint,
+                                                const QString& asyncJobId, int pollInterval,
+                                                AbstractJob* job,
+                                                BatchCompletedHandlerFunction onCompleted,
+                                                BatchFailedHandlerFunction onFailed)
+{
+    QTimer::singleShot(pollInterval, job, [=]() {
+        if (job->error() != JobError::NoError) {
+            // The job has been stopped meanwhile.
+            return;
+        }
+        auto reply_ = post(endpoint + "/check", QVariantMap { { "async_job_id", asyncJobId } },
+                           job);
+        if (!reply_) {
+            onFailed(JobError::InvalidResponse, tr("Received null network reply"));
+            return;
+        }
+        reply = reply_;
+        QObject::connect(reply_, &QNetworkReply::finished, job, [=]() {
+            reply_->deleteLater();
+            if (checkIfRequestShallBeRetried(reply_)) {
+                numRetries += 1;
+                pollBatchStatus(endpoint, asyncJobId, getRetryDelayInMilliseconds(reply_), job,
+                                onCompleted, onFailed);
+                return;
+            }
+            handleBatchStatus(endpoint, asyncJobId, reply_,
+                              qMin(pollInterval * 3 / 2, MaxBatchPollInterval), job, onCompleted,
+                              onFailed);
+        });
+    });
+}
+
+void AbstractDropboxJobPrivate::handleBatchStatus(const QString& endpoint,
+                                                  const QString& asyncJobId,
+                                                  QNetworkReply* batchReply,
+                                                  int pollInterval, AbstractJob* job,
+                                                  BatchCompletedHandlerFunction onCompleted,
+                                                  BatchFailedHandlerFunction onFailed)
+{
+    if (batchReply->error() != QNetworkReply::NoError) {
+        onFailed(JobError::NetworkRequestFailed,
+                 batchReply->errorString() + " " + batchReply->readAll());
+        return;
+    }
+    QJsonParseError error;
+    auto doc = QJsonDocument::fromJson(batchReply->readAll(), &error);
+    if (error.error != QJsonParseError::NoError) {
+        onFailed(JobError::InvalidResponse,
+                 tr("Failed to parse JSON response: %1").arg(error.errorString()));
+        return;
+    }
+    auto obj = doc.object();
+    auto tag = obj.value(".tag").toString();
+    if (tag == "async_job_id") {
+        qCDebug(log) << "Batch operation" << endpoint << "runs asynchronously - polling status";
+        pollBatchStatus(endpoint, obj.value("async_job_id").toString(), MinBatchPollInterval, job,
+                        onCompleted, onFailed);
+    } else if (tag == "in_progress") {
+        pollBatchStatus(endpoint, asyncJobId, pollInterval, job, onCompleted, onFailed);
+    } else if (tag == "complete" || (tag.isEmpty() && obj.contains("entries"))) {
+        // Note: Some endpoints (like upload_session/finish_batch_v2) return the result
+        // right away without tagging it.
+        onCompleted(obj);
+    } else if (tag == "failed") {
+        onFailed(JobError::InvalidResponse,
+                 tr("The batch operation failed: %1")
+                         .arg(QString::fromUtf8(
+                                 QJsonDocument(obj).toJson(QJsonDocument::Compact))));
+    } else {
+        onFailed(JobError::InvalidResponse,
+                 tr("Received unexpected batch status '%1'").arg(tag));
+    }
+}
+
 bool AbstractDropboxJobPrivate::checkIfRequestShallBeRetried(QNetworkReply* reply) const
 {
     if (reply && reply->error() != QNetworkReply::NoError && numRetries < MaxRetries) {
@@ -46,6 +46,8 @@ public:
     static const QString ContentAPIv2;
 
     typedef std::function<void(const QJsonDocument&)> KnownErrorHandlerFunction;
+    typedef std::function<void(const QJsonObject&)> BatchCompletedHandlerFunction;
+    typedef std::function<void(JobError, const QString&)> BatchFailedHandlerFunction;
 
     explicit AbstractDropboxJobPrivate(AbstractDropboxJob* q);
     virtual ~AbstractDropboxJobPrivate();
@@ -57,12 +59,15 @@ public:
     QString userAgent;
     QString token;
     int numRetries;
+    bool http2Allowed;
 
     QPointer<QNetworkReply> reply;
 
     std::tuple<JobError, QString> checkDefaultParameters();
 
     const int MaxRetries = 30;
+    const int MinBatchPollInterval = 500;
+    const int MaxBatchPollInterval = 5000;
 
     static FileInfo fileInfoFromJson(const QJsonObject& obj, const QString& basePath = QString(),
                                      const QString& forceTag = QString());
@@ -78,9 +83,22 @@ public:
 
     static QString fixPath(const QString& path);
 
+    // Helpers for batch operations
+    void runBatch(const QString& endpoint, const QVariant& data, AbstractJob* job,
+                  BatchCompletedHandlerFunction onCompleted, BatchFailedHandlerFunction onFailed);
+
     // Helpers for "Too Many Requests" errors from server
     bool checkIfRequestShallBeRetried(QNetworkReply* reply) const;
     int getRetryDelayInMilliseconds(QNetworkReply* reply) const;
+
+private:
+    void pollBatchStatus(const QString& endpoint, const QString& asyncJobId, int pollInterval,
+                         AbstractJob* job, BatchCompletedHandlerFunction onCompleted,
+                         BatchFailedHandlerFunction onFailed);
+    void handleBatchStatus(const QString& endpoint, const QString& asyncJobId,
+                           QNetworkReply* batchReply, int pollInterval, AbstractJob* job,
+                           BatchCompletedHandlerFunction onCompleted,
+                           BatchFailedHandlerFunction onFailed);
 };
 
 } // namespace SynqClient
@@ -110,6 +110,15 @@ static Q_LOGGING_CATEGORY(log, "SynqClient.AbstractJob", QtWarningMsg);
  * @note Do not reuse jobs. For each transaction you want to run, a new job object must be created.
  */
 
+/**
+ * @fn AbstractJob::transferProgress(qint64 bytesSent, qint64 bytesReceived)
+ * @brief Data has been transferred.
+ *
+ * This signal is emitted while the job is running whenever payload data has been sent to or
+ * received from the server. The @p bytesSent and @p bytesReceived are the totals transferred by
+ * the job so far (including any retries), i.e. the same values as reported by the metrics().
+ */
+
 /**
  * @brief Constructor.
  */
@@ -185,6 +194,19 @@ void AbstractJob::setTransferTimeout(int transferTimeout)
     emit transferTimeoutChanged();
 }
 
+/**
+ * @brief Timing and transfer information of the job.
+ *
+ * This returns the metrics collected so far. Jobs record when they have been created, started
+ * and finished as well as when the first response from the server arrived. Network based jobs in
+ * addition count the requests they sent, the number of retries and the payload bytes transferred.
+ */
+JobMetrics AbstractJob::metrics() const
+{
+    Q_D(const AbstractJob);
+    return d->metrics;
+}
+
 /**
  * @brief Constructor.
  */
@@ -207,12 +229,25 @@ void AbstractJob::setError(JobError error, const QString& errorString)
  * @brief Set the job state.
  *
  * This sets the @p state of the job to the specified value. This method shall be used by concrete
- * subclasses to progress the job through the usual lifecycle.
+ * subclasses to progress the job through the usual lifecycle. Entering the JobState::Running and
+ * JobState::Finished states is recorded in the job's metrics().
  */
 void AbstractJob::setState(JobState state)
 {
     Q_D(AbstractJob);
     d->state = state;
+    switch (state) {
+    case JobState::Running:
+        if (!d->metrics.startedTime().isValid()) {
+            d->metrics.setStartedTime(QDateTime::currentDateTimeUtc());
+        }
+        break;
+    case JobState::Finished:
+        d->metrics.setFinishedTime(QDateTime::currentDateTimeUtc());
+        break;
+    case JobState::Ready:
+        break;
+    }
 }
 
 /**
@@ -241,12 +276,11 @@ void AbstractJob::setState(JobState state)
  */
 void AbstractJob::finishLater()
 {
-    Q_D(AbstractJob);
     auto timer = new QTimer(this);
     timer->setInterval(0);
     timer->setSingleShot(true);
     connect(timer, &QTimer::timeout, this, [=]() {
-        d->state = JobState::Finished;
+        setState(JobState::Finished);
         emit finished();
         timer->deleteLater();
     });
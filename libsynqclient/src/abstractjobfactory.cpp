@@ -27,6 +27,11 @@
 #include "SynqClient/uploadfilejob.h"
 #include "SynqClient/getfileinfojob.h"
 #include "SynqClient/listfilesjob.h"
+#include "SynqClient/createdirectorybatchjob.h"
+#include "SynqClient/deletebatchjob.h"
+#include "SynqClient/uploadfilebatchjob.h"
+#include "SynqClient/movejob.h"
+#include "SynqClient/copyjob.h"
 
 namespace SynqClient {
 
@@ -141,6 +146,100 @@ ListFilesJob* AbstractJobFactory::listFiles(QObject* parent)
     return checkJob<ListFilesJob>(createJob(JobType::ListFiles, parent));
 }
 
+/**
+ * @brief Create a job to create several folders at once.
+ *
+ * This creates a job which creates several remote folders within a single operation. The
+ * resulting object will be owned by the @p parent. If the factory does not support this kind of
+ * job or creating the job fails, a nullptr is returned.
+ *
+ * @sa maxBatchSize()
+ */
+CreateDirectoryBatchJob* AbstractJobFactory::createDirectoryBatch(QObject* parent)
+{
+    return checkJob<CreateDirectoryBatchJob>(createJob(JobType::CreateDirectoryBatch, parent));
+}
+
+/**
+ * @brief Create a job to delete several files or folders at once.
+ *
+ * This creates a job which deletes several remote resources within a single operation. The
+ * resulting object will be owned by the @p parent. If the factory does not support this kind of
+ * job or creating the job fails, a nullptr is returned.
+ *
+ * @sa maxBatchSize()
+ */
+DeleteBatchJob* AbstractJobFactory::deleteResourceBatch(QObject* parent)
+{
+    return checkJob<DeleteBatchJob>(createJob(JobType::DeleteResourceBatch, parent));
+}
+
+/**
+ * @brief Create a job to upload several files at once.
+ *
+ * This creates a job which uploads several files within a single operation. The resulting object
+ * will be owned by the @p parent. If the factory does not support this kind of job or creating
+ * the job fails, a nullptr is returned.
+ *
+ * @sa maxBatchSize()
+ */
+UploadFileBatchJob* AbstractJobFactory::uploadFileBatch(QObject* parent)
+{
+    return checkJob<UploadFileBatchJob>(createJob(JobType::UploadFileBatch, parent));
+}
+
+/**
+ * @brief Create a job to move or rename a file or directory.
+ *
+ * This creates a job which moves a resource on the server side. The resulting object will be
+ * owned by the @p parent. If the backend does not support moving resources or creating the job
+ * fails, a nullptr is returned.
+ */
+MoveJob* AbstractJobFactory::moveResource(QObject* parent)
+{
+    return checkJob<MoveJob>(createJob(JobType::MoveResource, parent));
+}
+
+/**
+ * @brief Create a job to copy a file or directory.
+ *
+ * This creates a job which copies a resource on the server side. The resulting object will be
+ * owned by the @p parent. If the backend does not support copying resources or creating the job
+ * fails, a nullptr is returned.
+ */
+CopyJob* AbstractJobFactory::copyResource(QObject* parent)
+{
+    return checkJob<CopyJob>(createJob(JobType::CopyResource, parent));
+}
+
+/**
+ * @brief The maximum number of entries a batch job of the given @p type can handle.
+ *
+ * This returns the maximum number of entries that can be put into a single batch job of the
+ * given type (e.g. JobType::DeleteResourceBatch). If the factory does not support batch jobs of
+ * that type, 0 is returned.
+ *
+ * Synchronization code like the DirectorySynchronizer uses this to decide if it can group
+ * individual operations into batches.
+ */
+int AbstractJobFactory::maxBatchSize(JobType type) const
+{
+    Q_D(const AbstractJobFactory);
+    return d->maxBatchSizes.value(type, 0);
+}
+
+/**
+ * @brief The maximum size (in bytes) of files which shall be uploaded as part of a batch.
+ *
+ * Larger files should be uploaded individually using uploadFile(). A value of 0 means that
+ * there is no such limit.
+ */
+qint64 AbstractJobFactory::maxBatchFileSize() const
+{
+    Q_D(const AbstractJobFactory);
+    return d->maxBatchFileSize;
+}
+
 /**
  * @brief Returns the mode that is used to detect remote changes.
  *
@@ -167,6 +266,32 @@ bool AbstractJobFactory::alwaysCheckSubfolders() const
     return d->alwaysCheckSubfolders;
 }
 
+/**
+ * @brief Indicates if jobs created by the factory may use HTTP/2.
+ *
+ * If set to true, jobs created by the factory will allow the use of HTTP/2 for their network
+ * requests. This allows many concurrent requests to be multiplexed over a single connection to
+ * the server instead of being limited to a few parallel HTTP/1.1 connections. The default is
+ * false.
+ *
+ * Synchronization code like the DirectorySynchronizer can query this property to decide how many
+ * jobs it can run concurrently.
+ */
+bool AbstractJobFactory::http2Allowed() const
+{
+    Q_D(const AbstractJobFactory);
+    return d->http2Allowed;
+}
+
+/**
+ * @brief Set if jobs created by the factory may use HTTP/2.
+ */
+void AbstractJobFactory::setHttp2Allowed(bool http2Allowed)
+{
+    Q_D(AbstractJobFactory);
+    d->http2Allowed = http2Allowed;
+}
+
 /**
  * @brief Constructor.
  */
@@ -211,4 +336,30 @@ void AbstractJobFactory::setAlwaysCheckSubfolders(bool alwaysCheckSubfolders)
     d->alwaysCheckSubfolders = alwaysCheckSubfolders;
 }
 
+/**
+ * @brief Set the maximum number of entries a batch job of the given @p type can handle.
+ *
+ * Concrete factories shall call this (usually in their constructor) for each type of batch job
+ * they support. Setting a @p maxBatchSize of 0 indicates that batch jobs of that type are not
+ * supported.
+ */
+void AbstractJobFactory::setMaxBatchSize(JobType type, int maxBatchSize)
+{
+    Q_D(AbstractJobFactory);
+    if (maxBatchSize > 0) {
+        d->maxBatchSizes[type] = maxBatchSize;
+    } else {
+        d->maxBatchSizes.remove(type);
+    }
+}
+
+/**
+ * @brief Set the maximum size of files which shall be uploaded as part of a batch.
+ */
+void AbstractJobFactory::setMaxBatchFileSize(qint64 maxBatchFileSize)
+{
+    Q_D(AbstractJobFactory);
+    d->maxBatchFileSize = maxBatchFileSize;
+}
+
 } // namespace SynqClient
@@ -24,7 +24,10 @@ namespace SynqClient {
 AbstractJobFactoryPrivate::AbstractJobFactoryPrivate(AbstractJobFactory* q)
     : q_ptr(q),
       syncDetectionMode(RemoteChangeDetectionMode::FoldersWithSyncAttributes),
-      alwaysCheckSubfolders(false)
+      alwaysCheckSubfolders(false),
+      http2Allowed(false),
+      maxBatchSizes(),
+      maxBatchFileSize(0)
 {
 }
 
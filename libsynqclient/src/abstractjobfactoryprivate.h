@@ -20,6 +20,8 @@
 #ifndef SYNQCLIENT_ABSTRACTJOBFACTORYPRIVATE_H
 #define SYNQCLIENT_ABSTRACTJOBFACTORYPRIVATE_H
 
+#include <QMap>
+
 #include "SynqClient/abstractjobfactory.h"
 
 namespace SynqClient {
@@ -34,6 +36,9 @@ public:
 
     RemoteChangeDetectionMode syncDetectionMode;
     bool alwaysCheckSubfolders;
+    bool http2Allowed;
+    QMap<JobType, int> maxBatchSizes;
+    qint64 maxBatchFileSize;
 };
 
 } // namespace SynqClient
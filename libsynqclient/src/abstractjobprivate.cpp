@@ -1,6 +1,8 @@
 #include "abstractjobprivate.h"
 
+#include <QNetworkReply>
 #include <QNetworkRequest>
+#include <QSharedPointer>
 
 namespace SynqClient {
 
@@ -9,10 +11,72 @@ AbstractJobPrivate::AbstractJobPrivate(AbstractJob* q)
       error(JobError::NoError),
       errorString(),
       state(JobState::Ready),
-      transferTimeout(QNetworkRequest::DefaultTransferTimeoutConstant)
+      transferTimeout(QNetworkRequest::DefaultTransferTimeoutConstant),
+      metrics()
 {
+    metrics.setQueuedTime(QDateTime::currentDateTimeUtc());
 }
 
 AbstractJobPrivate::~AbstractJobPrivate() {}
 
+/**
+ * @brief Record metrics of a network @p reply sent by the job.
+ *
+ * Jobs shall call this for each request they send. This counts the request and keeps track of
+ * the time the first response arrives, the HTTP status of the response as well as the number of
+ * payload bytes sent and received. Whenever the latter change, the AbstractJob::transferProgress()
+ * signal is emitted.
+ */
+void AbstractJobPrivate::trackReply(QNetworkReply* reply)
+{
+    Q_Q(AbstractJob);
+    if (!reply) {
+        return;
+    }
+    metrics.setRequests(metrics.requests() + 1);
+
+    auto markFirstByte = [=]() {
+        if (!metrics.firstByteTime().isValid()) {
+            metrics.setFirstByteTime(QDateTime::currentDateTimeUtc());
+        }
+    };
+    QObject::connect(reply, &QNetworkReply::metaDataChanged, q, markFirstByte);
+    QObject::connect(reply, &QNetworkReply::readyRead, q, markFirstByte);
+    QObject::connect(reply, &QNetworkReply::finished, q, [=]() {
+        auto status = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute);
+        if (status.isValid()) {
+            metrics.setHttpStatus(status.toInt());
+        }
+    });
+
+    // The progress signals report totals per reply, so only add what changed since the last one:
+    auto bytesSent = QSharedPointer<qint64>::create(0);
+    QObject::connect(reply, &QNetworkReply::uploadProgress, q, [=](qint64 sent, qint64) {
+        if (sent > *bytesSent) {
+            metrics.setBytesSent(metrics.bytesSent() + sent - *bytesSent);
+            *bytesSent = sent;
+            emit q->transferProgress(metrics.bytesSent(), metrics.bytesReceived());
+        }
+    });
+    auto bytesReceived = QSharedPointer<qint64>::create(0);
+    QObject::connect(reply, &QNetworkReply::downloadProgress, q, [=](qint64 received, qint64) {
+        if (received > *bytesReceived) {
+            metrics.setBytesReceived(metrics.bytesReceived() + received - *bytesReceived);
+            *bytesReceived = received;
+            emit q->transferProgress(metrics.bytesSent(), metrics.bytesReceived());
+        }
+    });
+}
+
+/**
+ * @brief Get the private object of the @p job.
+ *
+ * This is used by the backend specific helper classes, which are not part of the job's class
+ * hierarchy, to update the job's metrics.
+ */
+AbstractJobPrivate* AbstractJobPrivate::get(AbstractJob* job)
+{
+    return job->d_func();
+}
+
 } // namespace SynqClient
@@ -5,6 +5,9 @@
 #include <QtGlobal>
 
 #include "SynqClient/abstractjob.h"
+#include "SynqClient/jobmetrics.h"
+
+class QNetworkReply;
 
 namespace SynqClient {
 
@@ -21,6 +24,11 @@ public:
     QString errorString;
     JobState state;
     int transferTimeout;
+    JobMetrics metrics;
+
+    void trackReply(QNetworkReply* reply);
+
+    static AbstractJobPrivate* get(AbstractJob* job);
 };
 
 } // namespace SynqClient
@@ -159,6 +159,30 @@ void AbstractWebDAVJob::setUserAgent(const QString& userAgent)
     d->userAgent = userAgent;
 }
 
+/**
+ * @brief Indicates if requests may use HTTP/2.
+ *
+ * If this is set to true, network requests run by the job explicitly allow the use of HTTP/2. If
+ * the server supports it, requests can then be multiplexed over a single connection, avoiding the
+ * limit of concurrent connections per host imposed by QNetworkAccessManager.
+ *
+ * If this is false (the default), the default of the Qt version in use is kept.
+ */
+bool AbstractWebDAVJob::http2Allowed() const
+{
+    Q_D(const AbstractWebDAVJob);
+    return d->http2Allowed;
+}
+
+/**
+ * @brief Set if requests may use HTTP/2.
+ */
+void AbstractWebDAVJob::setHttp2Allowed(bool http2Allowed)
+{
+    Q_D(AbstractWebDAVJob);
+    d->http2Allowed = http2Allowed;
+}
+
 /**
  * @brief Constructor.
  */
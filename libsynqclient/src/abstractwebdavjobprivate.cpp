@@ -3,6 +3,7 @@
 #include <QDir>
 #include <QDomDocument>
 #include <QLoggingCategory>
+#include <QXmlStreamWriter>
 
 namespace SynqClient {
 
@@ -12,16 +13,41 @@ const char* AbstractWebDAVJobPrivate::DefaultEncoding = "text/xml; charset=utf-8
 const char* AbstractWebDAVJobPrivate::OctetStreamEncoding = "application/octet-stream";
 const char* AbstractWebDAVJobPrivate::PROPFIND = "PROPFIND";
 const char* AbstractWebDAVJobPrivate::MKCOL = "MKCOL";
+const char* AbstractWebDAVJobPrivate::MOVE = "MOVE";
+const char* AbstractWebDAVJobPrivate::COPY = "COPY";
+const char* AbstractWebDAVJobPrivate::REPORT = "REPORT";
 
 const char* AbstractWebDAVJobPrivate::DefaultUserAgent = "SynqClient";
 
-const QByteArray AbstractWebDAVJobPrivate::PropFindRequestData = "<?xml version=\"1.0\"?>"
-                                                                 "<a:propfind xmlns:a=\"DAV:\">"
-                                                                 "<a:prop>"
-                                                                 "<a:getetag/>"
-                                                                 "<a:resourcetype/>"
-                                                                 "</a:prop>"
-                                                                 "</a:propfind>";
+const char* AbstractWebDAVJobPrivate::DAVNamespace = "DAV:";
+const char* AbstractWebDAVJobPrivate::OwnCloudNamespace = "http://owncloud.org/ns";
+
+/**
+ * @brief The properties to request when listing resources on a server of the given type.
+ *
+ * All servers are asked for the standard DAV properties. NextCloud and ownCloud additionally
+ * provide stable file IDs, checksums and (recursive) folder sizes in their own namespace. To
+ * request further properties, add them here and handle them in parseResponseEntry().
+ */
+QVector<AbstractWebDAVJobPrivate::Property>
+AbstractWebDAVJobPrivate::requestedProperties(WebDAVServerType serverType)
+{
+    QVector<Property> result { { DAVNamespace, "getetag" },
+                               { DAVNamespace, "resourcetype" },
+                               { DAVNamespace, "getcontentlength" },
+                               { DAVNamespace, "getlastmodified" } };
+    switch (serverType) {
+    case WebDAVServerType::NextCloud:
+    case WebDAVServerType::OwnCloud:
+        result << Property { OwnCloudNamespace, "fileid" }
+               << Property { OwnCloudNamespace, "checksums" }
+               << Property { OwnCloudNamespace, "size" };
+        break;
+    case WebDAVServerType::Generic:
+        break;
+    }
+    return result;
+}
 
 AbstractWebDAVJobPrivate::AbstractWebDAVJobPrivate(AbstractWebDAVJob* q)
     : q_ptr(q),
@@ -33,7 +59,8 @@ AbstractWebDAVJobPrivate::AbstractWebDAVJobPrivate(AbstractWebDAVJob* q)
       numManualRedirects(0),
       nextUrl(QUrl()),
       reply(nullptr),
-      numRetries(0)
+      numRetries(0),
+      http2Allowed(false)
 {
 }
 
@@ -72,10 +99,66 @@ QUrl AbstractWebDAVJobPrivate::urlFromPath(const QString& path)
     return result;
 }
 
+/**
+ * @brief Parse a list of @p checksums in the format used by NextCloud and ownCloud.
+ *
+ * Checksums are reported (e.g. in the `oc:checksums` property or the `OC-Checksum` header) as
+ * space separated list of `ALGORITHM:checksum` pairs, e.g. `SHA1:abc MD5:def`.
+ */
+QMap<QString, QString> AbstractWebDAVJobPrivate::parseChecksums(const QString& checksums)
+{
+    QMap<QString, QString> result;
+    const auto values = checksums.split(" ", Qt::SkipEmptyParts);
+    for (const auto& value : values) {
+        auto algorithm = value.section(":", 0, 0);
+        auto checksum = value.section(":", 1);
+        if (!algorithm.isEmpty() && !checksum.isEmpty()) {
+            result[algorithm.toUpper()] = checksum.toLower();
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief The body of a PROPFIND request asking for the properties supported by the server.
+ */
+QByteArray AbstractWebDAVJobPrivate::propFindRequestData() const
+{
+    QByteArray data;
+    QXmlStreamWriter writer(&data);
+    writer.writeStartDocument();
+    writer.writeNamespace(DAVNamespace, "a");
+    writer.writeNamespace(OwnCloudNamespace, "oc");
+    writer.writeStartElement(DAVNamespace, "propfind");
+    writeRequestedProperties(writer);
+    writer.writeEndElement();
+    writer.writeEndDocument();
+    return data;
+}
+
+/**
+ * @brief Write a DAV prop element containing the properties to request using the @p writer.
+ *
+ * Namespaces used by the properties should be declared on the document element beforehand.
+ */
+void AbstractWebDAVJobPrivate::writeRequestedProperties(QXmlStreamWriter& writer) const
+{
+    const auto properties = requestedProperties(serverType);
+    writer.writeStartElement(DAVNamespace, "prop");
+    for (const auto& property : properties) {
+        writer.writeEmptyElement(property.first, property.second);
+    }
+    writer.writeEndElement();
+}
+
 void AbstractWebDAVJobPrivate::prepareNetworkRequest(QNetworkRequest& request, AbstractJob* job)
 {
     request.setRawHeader("User-Agent", userAgent.toUtf8());
     request.setTransferTimeout(job->transferTimeout());
+    AbstractJobPrivate::get(job)->metrics.setRetries(numRetries);
+    if (http2Allowed) {
+        request.setAttribute(QNetworkRequest::Http2AllowedAttribute, true);
+    }
 }
 
 void AbstractWebDAVJobPrivate::disableCaching(QNetworkRequest& request)
@@ -129,6 +212,67 @@ FileInfos AbstractWebDAVJobPrivate::parseEntryList(const QUrl& url, const QByteA
     return result;
 }
 
+/**
+ * @brief Parse the response to a sync-collection REPORT.
+ *
+ * This parses the multistatus @p reply to a sync-collection REPORT (see RFC 6578) sent to the
+ * @p url. The returned entries have their path set relative to the collection the report was run
+ * on. Members which have been removed since the sync token used in the request are returned as
+ * deleted entries.
+ *
+ * The new sync token reported by the server is stored in @p syncToken. If the server truncated the
+ * result (i.e. the client needs to send another request using the new token to get the remaining
+ * changes), @p truncated is set to true.
+ */
+FileInfos AbstractWebDAVJobPrivate::parseSyncCollection(const QUrl& url, const QByteArray& reply,
+                                                        QString& syncToken, bool& truncated,
+                                                        bool& ok)
+{
+    FileInfos result;
+    QDomDocument doc;
+    QString errorMsg;
+    int errorLine;
+    ok = false;
+    truncated = false;
+    if (!doc.setContent(reply, true, &errorMsg, &errorLine)) {
+        qCWarning(log) << "Failed to parse WebDAV response:" << errorMsg << "in line" << errorLine;
+        return result;
+    }
+    auto root = doc.documentElement();
+    if (root.tagName() != "multistatus") {
+        qCWarning(log) << "Received invalid sync-collection response from server starting with "
+                          "element"
+                       << root.tagName();
+        return result;
+    }
+
+    ok = true;
+    syncToken = root.firstChildElement("sync-token").text();
+    auto baseDir = QDir::cleanPath("/" + url.path());
+    auto resp = root.firstChildElement("response");
+    while (resp.isElement()) {
+        // Removed members and the truncation marker come with a status directly in the response:
+        auto status = resp.firstChildElement("status").text();
+        auto entry = parseResponseEntry(url, resp, baseDir, ok);
+        auto path = entry.name();
+        if (status.contains(" 507")) {
+            truncated = true;
+        } else if (!path.isEmpty() && path != "." && !path.startsWith("../")) {
+            if (status.contains(" 404")) {
+                FileInfo deletedEntry;
+                deletedEntry.setDeleted(true);
+                deletedEntry.setUrl(entry.url());
+                entry = deletedEntry;
+            }
+            entry.setPath(path);
+            entry.setName(path.split("/").last());
+            result << entry;
+        }
+        resp = resp.nextSiblingElement("response");
+    }
+    return result;
+}
+
 bool AbstractWebDAVJobPrivate::checkIfRequestShallBeRetried(QNetworkReply* reply) const
 {
     if (reply && reply->error() != QNetworkReply::NoError && numRetries < MaxRetries) {
@@ -220,6 +364,31 @@ FileInfo AbstractWebDAVJobPrivate::parseResponseEntry(const QUrl& url, const QDo
                         etagValue.append('"');
                     }
                     result.setSyncAttribute(etagValue);
+                } else if (child.tagName() == "getcontentlength"
+                           || child.tagName() == "size") {
+                    // oc:size is also reported for folders (recursive size of their content):
+                    bool sizeOk = false;
+                    auto size = child.text().toLongLong(&sizeOk);
+                    if (sizeOk) {
+                        result.setSize(size);
+                    }
+                } else if (child.tagName() == "getlastmodified") {
+                    // RFC 1123 date, e.g. "Sun, 06 Nov 1994 08:49:37 GMT":
+                    auto lastModified = QDateTime::fromString(child.text(), Qt::RFC2822Date);
+                    if (lastModified.isValid()) {
+                        result.setLastModified(lastModified);
+                    }
+                } else if (child.tagName() == "fileid") {
+                    result.setFileId(child.text());
+                } else if (child.tagName() == "checksums") {
+                    auto checksum = child.firstChildElement("checksum");
+                    while (checksum.isElement()) {
+                        const auto checksums = parseChecksums(checksum.text());
+                        for (auto it = checksums.cbegin(); it != checksums.cend(); ++it) {
+                            result.setChecksum(it.key(), it.value());
+                        }
+                        checksum = checksum.nextSiblingElement("checksum");
+                    }
                 } else {
                     qCWarning(log) << "Unknown DAV Property:" << child.tagName();
                 }
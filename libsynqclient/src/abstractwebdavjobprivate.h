@@ -1,9 +1,12 @@
 #ifndef SYNQCLIENT_ABSTRACTWEBDAVJOBPRIVATE_H
 #define SYNQCLIENT_ABSTRACTWEBDAVJOBPRIVATE_H
 
+#include <QMap>
 #include <QNetworkReply>
 #include <QNetworkRequest>
+#include <QPair>
 #include <QVariantList>
+#include <QVector>
 
 #include "abstractjobprivate.h"
 #include "SynqClient/abstractwebdavjob.h"
@@ -12,6 +15,7 @@
 
 class QDomDocument;
 class QDomElement;
+class QXmlStreamWriter;
 
 namespace SynqClient {
 
@@ -22,18 +26,28 @@ public:
     static const char* OctetStreamEncoding;
     static const char* PROPFIND;
     static const char* MKCOL;
+    static const char* MOVE;
+    static const char* COPY;
+    static const char* REPORT;
     static const int HTTPOkay = 200;
     static const int HTTPCreated = 201;
     static const int HTTPNoContent = 204;
     static const int HTTPForbidden = 403;
+    static const int HTTPNotFound = 404;
     static const int HTTPNotAllowed = 405;
+    static const int HTTPConflict = 409;
     static const int HTTPPreconditionFailed = 412;
     static const int WebDAVMultiStatus = 207;
     static const int WebDAVCreated = 201;
 
     static const char* DefaultUserAgent;
 
-    static const QByteArray PropFindRequestData;
+    static const char* DAVNamespace;
+    static const char* OwnCloudNamespace;
+
+    typedef QPair<QString, QString> Property; // Namespace URI and name of a DAV property
+    static QVector<Property> requestedProperties(WebDAVServerType serverType);
+    static QMap<QString, QString> parseChecksums(const QString& checksums);
 
     explicit AbstractWebDAVJobPrivate(AbstractWebDAVJob* q);
     virtual ~AbstractWebDAVJobPrivate();
@@ -50,15 +64,20 @@ public:
     QUrl nextUrl;
     QNetworkReply* reply;
     int numRetries;
+    bool http2Allowed;
 
     const int MaxRedirects = 30;
     const int MaxRetries = 30;
 
     QUrl urlFromPath(const QString& path);
+    QByteArray propFindRequestData() const;
+    void writeRequestedProperties(QXmlStreamWriter& writer) const;
     void prepareNetworkRequest(QNetworkRequest& request, AbstractJob* job);
     void disableCaching(QNetworkRequest& request);
     bool shouldFollowUnhandledRedirect(QNetworkReply* reply);
     FileInfos parseEntryList(const QUrl& url, const QByteArray& reply, bool& ok);
+    FileInfos parseSyncCollection(const QUrl& url, const QByteArray& reply, QString& syncToken,
+                                  bool& truncated, bool& ok);
     bool checkIfRequestShallBeRetried(QNetworkReply* reply) const;
     int getRetryDelayInMilliseconds(QNetworkReply* reply) const;
 
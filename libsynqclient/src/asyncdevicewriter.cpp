@@ -0,0 +1,249 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "asyncdevicewriter.h"
+
+#include <QFileDevice>
+#include <QMutexLocker>
+#include <QThreadPool>
+
+namespace SynqClient {
+
+namespace {
+
+/**
+ * @brief The pool running the writer thread shared by all writers.
+ *
+ * The pool is restricted to a single thread, so disk writes don't compete with each other and
+ * chunks of the same device are written in order.
+ */
+class WriterThreadPool : public QThreadPool
+{
+public:
+    WriterThreadPool() : QThreadPool() { setMaxThreadCount(1); }
+};
+
+Q_GLOBAL_STATIC(WriterThreadPool, writerThreadPool)
+
+} // namespace
+
+/**
+ * @class AsyncDeviceWriter
+ * @brief Writes data to a device in a dedicated writer thread using a bounded queue.
+ *
+ * This class is used to write downloaded data to local files without blocking the thread the
+ * network communication happens in. Data is passed in chunks of up to ChunkSize bytes, which are
+ * queued and written to the device in a dedicated writer thread. Buffers for the chunks are
+ * recycled once they have been written, see takeBuffer().
+ *
+ * The queue is bounded: If MaxPendingChunks are pending, canWrite() returns false and callers
+ * shall stop reading data from their source until the chunksWritten() signal is emitted. This
+ * keeps the memory used per writer constant, no matter how much data is written in total.
+ *
+ * Only file devices (i.e. QFileDevice and sub-classes like QSaveFile) are written asynchronously.
+ * Other devices might rely on being used from the thread they live in, hence, data is written to
+ * them directly.
+ *
+ * @note While the writer is not idle, the device must not be used otherwise. Destroying the writer
+ * drops any pending chunks and waits for the chunk currently being written.
+ */
+
+/**
+ * @brief The size of the chunks to write in bytes.
+ */
+const qint64 AsyncDeviceWriter::ChunkSize = 64 * 1024;
+
+/**
+ * @brief The maximum number of chunks pending before canWrite() returns false.
+ */
+const int AsyncDeviceWriter::MaxPendingChunks = 16;
+
+/**
+ * @brief Constructor.
+ *
+ * Creates a writer for the given @p device, which must be open for writing.
+ */
+AsyncDeviceWriter::AsyncDeviceWriter(QIODevice* device, QObject* parent)
+    : QObject(parent),
+      m_device(device),
+      m_async(qobject_cast<QFileDevice*>(device) != nullptr),
+      m_mutex(),
+      m_idle(),
+      m_pendingChunks(),
+      m_freeBuffers(),
+      m_running(false),
+      m_errorString()
+{
+}
+
+/**
+ * @brief Destructor.
+ */
+AsyncDeviceWriter::~AsyncDeviceWriter()
+{
+    QMutexLocker locker(&m_mutex);
+    m_pendingChunks.clear();
+    while (m_running) {
+        m_idle.wait(&m_mutex);
+    }
+}
+
+/**
+ * @brief Indicates if data is written in the writer thread.
+ */
+bool AsyncDeviceWriter::isAsync() const
+{
+    return m_async;
+}
+
+/**
+ * @brief Check if more chunks can be queued.
+ *
+ * This returns false if the queue is full or if writing failed.
+ */
+bool AsyncDeviceWriter::canWrite() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_errorString.isEmpty() && m_pendingChunks.length() < MaxPendingChunks;
+}
+
+/**
+ * @brief Check if all queued data has been written.
+ */
+bool AsyncDeviceWriter::isIdle() const
+{
+    QMutexLocker locker(&m_mutex);
+    return !m_running && m_pendingChunks.isEmpty();
+}
+
+/**
+ * @brief Indicates if writing to the device failed.
+ */
+bool AsyncDeviceWriter::hasError() const
+{
+    QMutexLocker locker(&m_mutex);
+    return !m_errorString.isEmpty();
+}
+
+/**
+ * @brief A description of the error which occurred when writing to the device.
+ */
+QString AsyncDeviceWriter::errorString() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_errorString;
+}
+
+/**
+ * @brief Get a buffer of ChunkSize bytes to fill with data.
+ *
+ * If possible, this returns one of the buffers recycled after previous chunks have been written.
+ * Callers shall resize the buffer to the number of bytes actually filled before passing it to
+ * write().
+ */
+QByteArray AsyncDeviceWriter::takeBuffer()
+{
+    QByteArray buffer;
+    {
+        QMutexLocker locker(&m_mutex);
+        if (!m_freeBuffers.isEmpty()) {
+            buffer = m_freeBuffers.takeLast();
+        }
+    }
+    buffer.resize(static_cast<int>(ChunkSize));
+    return buffer;
+}
+
+/**
+ * @brief Write a @p chunk of data to the device.
+ *
+ * The chunk is queued and written in the writer thread. Note that the chunk is always queued, even
+ * if canWrite() returns false - it is the caller's responsibility to respect the limit.
+ */
+void AsyncDeviceWriter::write(const QByteArray& chunk)
+{
+    if (!m_async) {
+        if (m_errorString.isEmpty() && m_device->write(chunk) != chunk.length()) {
+            m_errorString = m_device->errorString();
+        }
+        recycleBuffer(chunk);
+        return;
+    }
+
+    QMutexLocker locker(&m_mutex);
+    if (!m_errorString.isEmpty()) {
+        return;
+    }
+    m_pendingChunks.enqueue(chunk);
+    if (!m_running) {
+        m_running = true;
+        writerThreadPool->start([=]() { drain(); });
+    }
+}
+
+void AsyncDeviceWriter::recycleBuffer(QByteArray buffer)
+{
+    QMutexLocker locker(&m_mutex);
+    if (m_freeBuffers.length() < MaxPendingChunks) {
+        m_freeBuffers.append(buffer);
+    }
+}
+
+/**
+ * @brief Write all pending chunks to the device.
+ *
+ * This runs in the writer thread.
+ */
+void AsyncDeviceWriter::drain()
+{
+    forever {
+        QByteArray chunk;
+        {
+            QMutexLocker locker(&m_mutex);
+            if (m_pendingChunks.isEmpty()) {
+                m_running = false;
+                m_idle.wakeAll();
+                return;
+            }
+            chunk = m_pendingChunks.dequeue();
+        }
+        bool written = m_device->write(chunk) == chunk.length();
+        bool queueEmpty;
+        {
+            QMutexLocker locker(&m_mutex);
+            queueEmpty = m_pendingChunks.isEmpty();
+        }
+        if (written && queueEmpty) {
+            // Hand buffered data over to the OS, so it is visible once we are idle:
+            written = static_cast<QFileDevice*>(m_device)->flush();
+        }
+        {
+            QMutexLocker locker(&m_mutex);
+            if (!written && m_errorString.isEmpty()) {
+                m_errorString = m_device->errorString();
+                m_pendingChunks.clear();
+            }
+        }
+        recycleBuffer(std::move(chunk));
+        emit chunksWritten();
+    }
+}
+
+} // namespace SynqClient
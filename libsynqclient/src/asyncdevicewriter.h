@@ -0,0 +1,79 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef SYNQCLIENT_ASYNCDEVICEWRITER_H
+#define SYNQCLIENT_ASYNCDEVICEWRITER_H
+
+#include <QByteArray>
+#include <QMutex>
+#include <QObject>
+#include <QQueue>
+#include <QVector>
+#include <QWaitCondition>
+
+class QIODevice;
+
+namespace SynqClient {
+
+class AsyncDeviceWriter : public QObject
+{
+    Q_OBJECT
+public:
+    static const qint64 ChunkSize;
+    static const int MaxPendingChunks;
+
+    explicit AsyncDeviceWriter(QIODevice* device, QObject* parent = nullptr);
+    ~AsyncDeviceWriter() override;
+
+    bool isAsync() const;
+    bool canWrite() const;
+    bool isIdle() const;
+    bool hasError() const;
+    QString errorString() const;
+
+    QByteArray takeBuffer();
+    void write(const QByteArray& chunk);
+
+signals:
+
+    /**
+     * @brief Pending chunks have been written to the device.
+     *
+     * This signal is emitted from the writer thread, hence, connections to it are queued.
+     */
+    void chunksWritten();
+
+private:
+    QIODevice* m_device;
+    bool m_async;
+    mutable QMutex m_mutex;
+    QWaitCondition m_idle;
+    QQueue<QByteArray> m_pendingChunks;
+    QVector<QByteArray> m_freeBuffers;
+    bool m_running;
+    QString m_errorString;
+
+    void recycleBuffer(QByteArray buffer);
+    void drain();
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_ASYNCDEVICEWRITER_H
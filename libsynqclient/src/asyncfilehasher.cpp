@@ -0,0 +1,153 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "asyncfilehasher.h"
+
+#include <QMutexLocker>
+#include <QThreadPool>
+
+#include "contenthasher.h"
+
+namespace SynqClient {
+
+namespace {
+
+/**
+ * @brief The pool running the thread hashing files for all hashers.
+ */
+class HasherThreadPool : public QThreadPool
+{
+public:
+    HasherThreadPool() : QThreadPool() { setMaxThreadCount(1); }
+};
+
+Q_GLOBAL_STATIC(HasherThreadPool, hasherThreadPool)
+
+} // namespace
+
+/**
+ * @class AsyncFileHasher
+ * @brief Calculates checksums of local files in a dedicated hashing thread.
+ *
+ * Some requests need the checksum of a file before its data is sent (for example, the NextCloud
+ * bulk upload endpoint expects the MD5 sum of each file in the part headers). This class reads and
+ * hashes such files in a worker thread, so the thread the network communication happens in is not
+ * blocked by disk I/O. Once all files have been processed, the finished() signal is emitted and
+ * the checksums can be retrieved via result().
+ *
+ * @note Destroying the hasher drops any files which have not been hashed yet and waits for the
+ * file currently being hashed.
+ */
+
+/**
+ * @brief Constructor.
+ *
+ * Creates a hasher which calculates checksums using the given @p algorithm (one of the
+ * ContentHasher::supportedAlgorithms()).
+ */
+AsyncFileHasher::AsyncFileHasher(const QString& algorithm, QObject* parent)
+    : QObject(parent),
+      m_algorithm(algorithm),
+      m_mutex(),
+      m_idle(),
+      m_pendingFiles(),
+      m_results(),
+      m_running(false)
+{
+}
+
+/**
+ * @brief Destructor.
+ */
+AsyncFileHasher::~AsyncFileHasher()
+{
+    QMutexLocker locker(&m_mutex);
+    m_pendingFiles.clear();
+    while (m_running) {
+        m_idle.wait(&m_mutex);
+    }
+}
+
+/**
+ * @brief Start hashing the files with the given @p fileNames.
+ *
+ * The files are hashed in addition to the ones passed previously. Results of files which have
+ * already been hashed are kept.
+ */
+void AsyncFileHasher::start(const QStringList& fileNames)
+{
+    QMutexLocker locker(&m_mutex);
+    m_pendingFiles << fileNames;
+    if (!m_running) {
+        m_running = true;
+        hasherThreadPool->start([=]() { run(); });
+    }
+}
+
+/**
+ * @brief Indicates if all files passed to start() have been hashed.
+ */
+bool AsyncFileHasher::isFinished() const
+{
+    QMutexLocker locker(&m_mutex);
+    return !m_running && m_pendingFiles.isEmpty();
+}
+
+/**
+ * @brief The checksum of the file with the given @p fileName.
+ *
+ * The checksum is returned in hex encoding. If the file has not been hashed (yet) or could not be
+ * read, an empty string is returned.
+ */
+QString AsyncFileHasher::result(const QString& fileName) const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_results.value(fileName);
+}
+
+/**
+ * @brief Hash all pending files.
+ *
+ * This runs in the hashing thread.
+ */
+void AsyncFileHasher::run()
+{
+    forever {
+        QString fileName;
+        {
+            QMutexLocker locker(&m_mutex);
+            if (m_pendingFiles.isEmpty()) {
+                break;
+            }
+            fileName = m_pendingFiles.takeFirst();
+        }
+        auto checksum = ContentHasher::hashFile(fileName, m_algorithm);
+        {
+            QMutexLocker locker(&m_mutex);
+            m_results[fileName] = checksum;
+        }
+    }
+    emit finished();
+    QMutexLocker locker(&m_mutex);
+    m_running = false;
+    m_idle.wakeAll();
+}
+
+} // namespace SynqClient
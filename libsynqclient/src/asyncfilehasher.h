@@ -0,0 +1,65 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef SYNQCLIENT_ASYNCFILEHASHER_H
+#define SYNQCLIENT_ASYNCFILEHASHER_H
+
+#include <QMap>
+#include <QMutex>
+#include <QObject>
+#include <QStringList>
+#include <QWaitCondition>
+
+namespace SynqClient {
+
+class AsyncFileHasher : public QObject
+{
+    Q_OBJECT
+public:
+    explicit AsyncFileHasher(const QString& algorithm, QObject* parent = nullptr);
+    ~AsyncFileHasher() override;
+
+    void start(const QStringList& fileNames);
+    bool isFinished() const;
+    QString result(const QString& fileName) const;
+
+signals:
+
+    /**
+     * @brief All files have been hashed.
+     *
+     * This signal is emitted from the hashing thread, hence, connections to it are queued.
+     */
+    void finished();
+
+private:
+    QString m_algorithm;
+    mutable QMutex m_mutex;
+    QWaitCondition m_idle;
+    QStringList m_pendingFiles;
+    QMap<QString, QString> m_results;
+    bool m_running;
+
+    void run();
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_ASYNCFILEHASHER_H
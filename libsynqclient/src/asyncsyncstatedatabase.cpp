@@ -0,0 +1,323 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SynqClient/asyncsyncstatedatabase.h"
+
+#include <QDeadlineTimer>
+#include <QMutexLocker>
+
+#include "asyncsyncstatedatabaseprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @class AsyncSyncStateDatabase
+ * @brief Access another sync state database from a dedicated database thread.
+ *
+ * This class wraps another SyncStateDatabase, which lives in a dedicated thread. Writes
+ * (addEntry(), removeEntry() and removeEntries()) are queued to that thread and return
+ * immediately, so the thread using the database - typically the one a DirectorySynchronizer runs
+ * in - never waits for the disk while recording the results of finished jobs.
+ *
+ * Reads are served from a write-through cache: When the database is opened, all entries reachable
+ * from the root are read once; afterwards, writes update the cache before they are queued. Hence,
+ * getEntry(), findEntries() and iterate() see all previously issued writes and usually don't wait
+ * for the database thread at all. Only paths outside of the cached folders (e.g. entries whose
+ * parent folder has no entry itself) are read from the wrapped database, behind the queued
+ * writes.
+ *
+ * The wrapped database is created by a factory function, which is called in the database
+ * thread. This is required for databases which are bound to a thread, like the
+ * SQLSyncStateDatabase:
+ *
+ * @code
+ * auto db = new SynqClient::AsyncSyncStateDatabase([=]() {
+ *     auto db = new SynqClient::SQLSyncStateDatabase();
+ *     db->setDatabase(dbPath);
+ *     return db;
+ * });
+ * synchronizer->setSyncStateDatabase(db);
+ * @endcode
+ *
+ * As writes return before they have been run, errors are reported later: The writeFailed()
+ * signal is emitted and the next call to flushDatabase() or closeDatabase() returns false. Use
+ * flushDatabaseLater() to persist the state without blocking.
+ *
+ * The class itself must be used from a single thread.
+ */
+
+/**
+ * @brief Constructor.
+ *
+ * Creates a new database which runs the database returned by the @p factory in a dedicated
+ * thread. The factory is called once, when the database is opened for the first time.
+ */
+AsyncSyncStateDatabase::AsyncSyncStateDatabase(const Factory& factory, QObject* parent)
+    : SyncStateDatabase(new AsyncSyncStateDatabasePrivate(this), parent)
+{
+    Q_D(AsyncSyncStateDatabase);
+    d->factory = factory;
+}
+
+/**
+ * @brief Destructor.
+ *
+ * If the database still is open, it is closed, which waits for all pending writes.
+ */
+AsyncSyncStateDatabase::~AsyncSyncStateDatabase()
+{
+    if (isOpen()) {
+        closeDatabase();
+    }
+}
+
+/**
+ * @brief The number of writes which have been queued but not yet been run.
+ */
+int AsyncSyncStateDatabase::pendingWrites() const
+{
+    Q_D(const AsyncSyncStateDatabase);
+    QMutexLocker locker(&d->mutex);
+    return d->pendingWrites;
+}
+
+/**
+ * @brief Block until all queued writes have been run.
+ *
+ * This waits for at most @p timeout milliseconds (or forever if it is negative) and returns true
+ * if no writes are pending (anymore).
+ */
+bool AsyncSyncStateDatabase::waitForPendingWrites(int timeout) const
+{
+    Q_D(const AsyncSyncStateDatabase);
+    QDeadlineTimer deadline(timeout);
+    QMutexLocker locker(&d->mutex);
+    while (d->pendingWrites > 0) {
+        if (!d->writesDone.wait(&d->mutex, deadline)) {
+            return d->pendingWrites == 0;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Write pending changes to persistent storage without blocking.
+ *
+ * This is the asynchronous counterpart of flushDatabase(). Once all writes queued before have
+ * been run and the wrapped database has been flushed, the @p callback is called in the thread
+ * this object lives in. Its argument indicates if the flush and all writes since the last flush
+ * were successful.
+ */
+void AsyncSyncStateDatabase::flushDatabaseLater(const Callback& callback)
+{
+    Q_D(AsyncSyncStateDatabase);
+    QMetaObject::invokeMethod(
+            d->worker,
+            [=]() {
+                auto ok = d->db && d->db->flushDatabase();
+                ok = !d->takeWriteFailed() && ok;
+                if (callback) {
+                    QMetaObject::invokeMethod(
+                            this, [=]() { callback(ok); }, Qt::QueuedConnection);
+                }
+            },
+            Qt::QueuedConnection);
+}
+
+/**
+ * @brief Implementation of SyncStateDatabase::openDatabase().
+ *
+ * This creates the wrapped database (if this did not happen before), opens it and fills the cache.
+ */
+bool AsyncSyncStateDatabase::openDatabase()
+{
+    Q_D(AsyncSyncStateDatabase);
+    if (isOpen()) {
+        return false;
+    }
+    auto ok = d->call<bool>([=]() {
+        auto db = d->createDatabase();
+        return db && db->openDatabase();
+    });
+    d->takeWriteFailed();
+    if (ok) {
+        d->loadCache();
+    }
+    setOpen(ok);
+    return ok;
+}
+
+/**
+ * @brief Implementation of SyncStateDatabase::flushDatabase().
+ *
+ * This blocks until all pending writes have been run and the wrapped database has been flushed.
+ * Returns false if this or any of the writes since the last flush failed.
+ */
+bool AsyncSyncStateDatabase::flushDatabase()
+{
+    Q_D(AsyncSyncStateDatabase);
+    auto ok = d->call<bool>([=]() { return d->db && d->db->flushDatabase(); });
+    return !d->takeWriteFailed() && ok;
+}
+
+/**
+ * @brief Implementation of SyncStateDatabase::closeDatabase().
+ *
+ * This blocks until all pending writes have been run and the wrapped database has been closed.
+ * Returns false if this or any of the writes since the last flush failed.
+ */
+bool AsyncSyncStateDatabase::closeDatabase()
+{
+    Q_D(AsyncSyncStateDatabase);
+    auto ok = d->call<bool>([=]() { return d->db && d->db->closeDatabase(); });
+    d->clearCache();
+    setOpen(false);
+    return !d->takeWriteFailed() && ok;
+}
+
+/**
+ * @brief Implementation of SyncStateDatabase::addEntry().
+ *
+ * The entry is written asynchronously. This returns false only if the database is not open or the
+ * @p entry is invalid.
+ */
+bool AsyncSyncStateDatabase::addEntry(const SyncStateEntry& entry)
+{
+    Q_D(AsyncSyncStateDatabase);
+    if (!isOpen() || !entry.isValid()) {
+        return false;
+    }
+    d->cacheEntry(entry.path(), entry);
+    d->enqueueWrite(entry.path(), [=](SyncStateDatabase* db) { return db->addEntry(entry); });
+    return true;
+}
+
+/**
+ * @brief Implementation of SyncStateDatabase::getEntry().
+ *
+ * The entry is returned from the cache. Only if the path is outside of the cached folders, it is
+ * read in the database thread.
+ */
+SyncStateEntry AsyncSyncStateDatabase::getEntry(const QString& path)
+{
+    Q_D(AsyncSyncStateDatabase);
+    auto entryPath = SyncStateEntry::makePath(path);
+    auto it = d->entries.constFind(entryPath);
+    if (it != d->entries.constEnd()) {
+        return *it;
+    }
+    if (entryPath != "/" && d->children.contains(d->parentPath(entryPath))) {
+        return SyncStateEntry();
+    }
+    auto entry = d->call<SyncStateEntry>(
+            [=]() { return d->db ? d->db->getEntry(entryPath) : SyncStateEntry(); });
+    if (isOpen()) {
+        d->entries.insert(entryPath, entry);
+    }
+    return entry;
+}
+
+/**
+ * @brief Implementation of SyncStateDatabase::findEntries().
+ *
+ * The entries are returned from the cache. Only if the @p parent has not been cached yet, they
+ * are read in the database thread.
+ */
+QVector<SyncStateEntry> AsyncSyncStateDatabase::findEntries(const QString& parent, bool* ok)
+{
+    Q_D(AsyncSyncStateDatabase);
+    auto parentPath = SyncStateEntry::makePath(parent);
+    QVector<SyncStateEntry> entries;
+    auto it = d->children.constFind(parentPath);
+    if (it != d->children.constEnd()) {
+        for (const auto& path : *it) {
+            auto entry = d->entries.value(path);
+            if (entry.isValid()) {
+                entries << entry;
+            }
+        }
+        if (ok) {
+            *ok = true;
+        }
+        return entries;
+    }
+    bool result = false;
+    entries = d->call<QVector<SyncStateEntry>>([=, &result]() {
+        if (d->db) {
+            return d->db->findEntries(parentPath, &result);
+        }
+        return QVector<SyncStateEntry>();
+    });
+    if (result && isOpen()) {
+        d->cacheFolder(parentPath, entries);
+    }
+    if (ok) {
+        *ok = result;
+    }
+    return entries;
+}
+
+/**
+ * @brief Implementation of SyncStateDatabase::removeEntries().
+ *
+ * The entries are removed asynchronously. This returns false only if the database is not open.
+ */
+bool AsyncSyncStateDatabase::removeEntries(const QString& path)
+{
+    Q_D(AsyncSyncStateDatabase);
+    if (!isOpen()) {
+        return false;
+    }
+    auto entryPath = SyncStateEntry::makePath(path);
+    d->uncacheEntries(entryPath);
+    d->enqueueWrite(entryPath, [=](SyncStateDatabase* db) { return db->removeEntries(path); });
+    return true;
+}
+
+/**
+ * @brief Implementation of SyncStateDatabase::removeEntry().
+ *
+ * The entry is removed asynchronously. This returns false only if the database is not open.
+ */
+bool AsyncSyncStateDatabase::removeEntry(const QString& path)
+{
+    Q_D(AsyncSyncStateDatabase);
+    if (!isOpen()) {
+        return false;
+    }
+    auto entryPath = SyncStateEntry::makePath(path);
+    d->cacheEntry(entryPath, SyncStateEntry());
+    d->enqueueWrite(entryPath, [=](SyncStateDatabase* db) { return db->removeEntry(path); });
+    return true;
+}
+
+/**
+ * @brief Constructor.
+ */
+AsyncSyncStateDatabase::AsyncSyncStateDatabase(AsyncSyncStateDatabasePrivate* d, QObject* parent)
+    : SyncStateDatabase(d, parent)
+{
+}
+
+/**
+ * @fn AsyncSyncStateDatabase::writeFailed(const QString& path)
+ * @brief Writing the entry with the given @p path to the wrapped database failed.
+ */
+
+} // namespace SynqClient
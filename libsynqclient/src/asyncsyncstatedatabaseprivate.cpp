@@ -0,0 +1,238 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "asyncsyncstatedatabaseprivate.h"
+
+#include <QMutexLocker>
+#include <QQueue>
+#include <QThread>
+
+namespace SynqClient {
+
+AsyncSyncStateDatabasePrivate::AsyncSyncStateDatabasePrivate(AsyncSyncStateDatabase* q)
+    : SyncStateDatabasePrivate(q),
+      factory(),
+      entries(),
+      children(),
+      mutex(),
+      writesDone(),
+      pendingWrites(0),
+      writeFailed(false),
+      thread(new QThread),
+      worker(new QObject),
+      db(nullptr)
+{
+    thread->setObjectName("SynqClientDatabaseThread");
+    worker->moveToThread(thread);
+    QObject::connect(thread, &QThread::finished, worker, &QObject::deleteLater);
+    thread->start();
+}
+
+/**
+ * @brief Destructor.
+ *
+ * This stops the database thread. The wrapped database is deleted together with the worker.
+ */
+AsyncSyncStateDatabasePrivate::~AsyncSyncStateDatabasePrivate()
+{
+    thread->quit();
+    thread->wait();
+    delete thread;
+}
+
+/**
+ * @brief Queue a @p write of the given @p path to be run in the database thread.
+ */
+void AsyncSyncStateDatabasePrivate::enqueueWrite(const QString& path, const Write& write)
+{
+    {
+        QMutexLocker locker(&mutex);
+        ++pendingWrites;
+    }
+    QMetaObject::invokeMethod(
+            worker, [=]() { finishWrite(path, db && write(db)); }, Qt::QueuedConnection);
+}
+
+/**
+ * @brief Book keeping after a write of the @p path has been run in the database thread.
+ */
+void AsyncSyncStateDatabasePrivate::finishWrite(const QString& path, bool ok)
+{
+    Q_Q(AsyncSyncStateDatabase);
+    {
+        QMutexLocker locker(&mutex);
+        if (!ok) {
+            writeFailed = true;
+        }
+        if (--pendingWrites == 0) {
+            writesDone.wakeAll();
+        }
+    }
+    if (!ok) {
+        QMetaObject::invokeMethod(
+                q, [=]() { emit q->writeFailed(path); }, Qt::QueuedConnection);
+    }
+}
+
+/**
+ * @brief Read all entries reachable from the root into the cache.
+ *
+ * This walks the wrapped database once in the database thread. If this fails, the cache stays
+ * empty and reads fall back to the wrapped database.
+ */
+void AsyncSyncStateDatabasePrivate::loadCache()
+{
+    clearCache();
+    if (!db) {
+        return;
+    }
+    auto root = call<SyncStateEntry>([=]() { return db->getEntry("/"); });
+    auto folders = call<Folders>([=]() {
+        Folders result;
+        QQueue<QString> queue;
+        queue.enqueue("/");
+        while (!queue.isEmpty()) {
+            auto folder = queue.dequeue();
+            bool ok = false;
+            auto folderEntries = db->findEntries(folder, &ok);
+            if (!ok) {
+                return Folders();
+            }
+            for (const auto& entry : qAsConst(folderEntries)) {
+                queue.enqueue(entry.path());
+            }
+            result.insert(folder, folderEntries);
+        }
+        return result;
+    });
+    if (folders.isEmpty()) {
+        return;
+    }
+    entries.insert("/", root);
+    for (auto it = folders.cbegin(); it != folders.cend(); ++it) {
+        cacheFolder(it.key(), it.value());
+    }
+}
+
+/**
+ * @brief Record the complete list of valid children of the folder with the given @p path.
+ *
+ * Once a folder has been cached, paths below it which are not in the cache are known to be
+ * absent and reads of them don't have to be answered by the wrapped database.
+ */
+void AsyncSyncStateDatabasePrivate::cacheFolder(const QString& path,
+                                                const QVector<SyncStateEntry>& folderEntries)
+{
+    auto& folder = children[path];
+    for (const auto& entry : folderEntries) {
+        entries.insert(entry.path(), entry);
+        folder.insert(entry.path());
+    }
+}
+
+/**
+ * @brief Store the @p entry for the @p path in the cache.
+ *
+ * Pass an invalid entry to record that the path is absent.
+ */
+void AsyncSyncStateDatabasePrivate::cacheEntry(const QString& path, const SyncStateEntry& entry)
+{
+    entries.insert(path, entry);
+    if (path != "/") {
+        auto it = children.find(parentPath(path));
+        if (it != children.end()) {
+            it->insert(path);
+        }
+    }
+}
+
+/**
+ * @brief Forget the cached entries for the @p path and everything below it.
+ *
+ * The path itself is recorded as an empty folder, as this is used when a whole sub-tree is
+ * removed.
+ */
+void AsyncSyncStateDatabasePrivate::uncacheEntries(const QString& path)
+{
+    auto prefix = path.endsWith("/") ? path : path + "/";
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (it.key().startsWith(prefix)) {
+            it = entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    for (auto it = children.begin(); it != children.end();) {
+        if (it.key().startsWith(prefix)) {
+            it = children.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    cacheEntry(path, SyncStateEntry());
+    children.insert(path, QSet<QString>());
+}
+
+/**
+ * @brief Drop all cached entries.
+ */
+void AsyncSyncStateDatabasePrivate::clearCache()
+{
+    entries.clear();
+    children.clear();
+}
+
+/**
+ * @brief Check if a write failed since the last call and reset the flag.
+ */
+bool AsyncSyncStateDatabasePrivate::takeWriteFailed()
+{
+    QMutexLocker locker(&mutex);
+    auto result = writeFailed;
+    writeFailed = false;
+    return result;
+}
+
+/**
+ * @brief Get the wrapped database, creating it on first use.
+ *
+ * This is run in the database thread, so the database (and any connection it opens) belongs to
+ * that thread.
+ */
+SyncStateDatabase* AsyncSyncStateDatabasePrivate::createDatabase()
+{
+    if (!db && factory) {
+        db = factory();
+        if (db && !db->parent()) {
+            db->setParent(worker);
+        }
+    }
+    return db;
+}
+
+/**
+ * @brief Get the path of the folder containing the entry with the given @p path.
+ */
+QString AsyncSyncStateDatabasePrivate::parentPath(const QString& path)
+{
+    auto index = path.lastIndexOf("/");
+    return index <= 0 ? QStringLiteral("/") : path.left(index);
+}
+
+} // namespace SynqClient
@@ -0,0 +1,98 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_ASYNCSYNCSTATEDATABASEPRIVATE_H
+#define SYNQCLIENT_ASYNCSYNCSTATEDATABASEPRIVATE_H
+
+#include <functional>
+
+#include <QHash>
+#include <QMutex>
+#include <QSet>
+#include <QWaitCondition>
+
+#include "syncstatedatabaseprivate.h"
+#include "SynqClient/asyncsyncstatedatabase.h"
+
+class QThread;
+
+namespace SynqClient {
+
+class AsyncSyncStateDatabasePrivate : public SyncStateDatabasePrivate
+{
+public:
+    typedef std::function<bool(SyncStateDatabase* db)> Write;
+    typedef QHash<QString, QVector<SyncStateEntry>> Folders;
+
+    explicit AsyncSyncStateDatabasePrivate(AsyncSyncStateDatabase* q);
+    ~AsyncSyncStateDatabasePrivate() override;
+
+    Q_DECLARE_PUBLIC(AsyncSyncStateDatabase);
+
+    AsyncSyncStateDatabase::Factory factory;
+
+    // Write-through cache - only to be accessed from the thread the facade is used in:
+    QHash<QString, SyncStateEntry> entries;
+    QHash<QString, QSet<QString>> children;
+
+    // Shared between the facade and the database thread - guarded by the mutex:
+    mutable QMutex mutex;
+    mutable QWaitCondition writesDone;
+    int pendingWrites;
+    bool writeFailed;
+
+    QThread* thread;
+
+    // Objects living in the database thread - only to be accessed from there:
+    QObject* worker;
+    SyncStateDatabase* db;
+
+    void enqueueWrite(const QString& path, const Write& write);
+    void finishWrite(const QString& path, bool ok);
+    void loadCache();
+    void cacheFolder(const QString& path, const QVector<SyncStateEntry>& folderEntries);
+    void cacheEntry(const QString& path, const SyncStateEntry& entry);
+    void uncacheEntries(const QString& path);
+    void clearCache();
+    bool takeWriteFailed();
+    SyncStateDatabase* createDatabase();
+
+    static QString parentPath(const QString& path);
+
+    template<typename T>
+    T call(const std::function<T()>& function);
+};
+
+/**
+ * @brief Run the @p function in the database thread and return its result.
+ *
+ * This blocks until the function has been run. As the function is queued behind all writes
+ * issued before, it sees their effects.
+ */
+template<typename T>
+T AsyncSyncStateDatabasePrivate::call(const std::function<T()>& function)
+{
+    T result {};
+    QMetaObject::invokeMethod(worker, function, Qt::BlockingQueuedConnection, &result);
+    return result;
+}
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_ASYNCSYNCSTATEDATABASEPRIVATE_H
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../inc/SynqClient/batchjob.h"
+
+#include "batchjobprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @class BatchJob
+ * @brief Base class for jobs operating on several remote resources at once.
+ *
+ * Some backends allow to apply the same operation to many files or folders within a single
+ * request. This is usually a lot cheaper than running one job per resource - both in terms of the
+ * number of requests that need to be made as well as for the server, which might need to acquire
+ * locks for every single write operation.
+ *
+ * This class is the abstract base for such jobs. Sub-classes define which resources the job
+ * operates on. Once the job finished, results are reported per resource (identified by its path).
+ *
+ * # Error Handling
+ *
+ * The error() of the job itself is used to indicate that the batch as a whole failed (e.g. because
+ * the server could not be reached). If the batch was processed, individual entries might still
+ * have failed. Use failedEntries() to get the list of such entries and entryError() as well as
+ * entryErrorString() to learn about the reason.
+ */
+
+/**
+ * @brief Constructor.
+ */
+BatchJob::BatchJob(QObject* parent) : AbstractJob(new BatchJobPrivate(this), parent) {}
+
+/**
+ * @brief Destructor.
+ */
+BatchJob::~BatchJob() {}
+
+/**
+ * @brief Information about the resource with the given @p path.
+ *
+ * After the job finished, this returns the information about the resource as reported by the
+ * server. If the operation failed for this resource (or the server did not report any information),
+ * an invalid FileInfo object is returned.
+ */
+FileInfo BatchJob::fileInfo(const QString& path) const
+{
+    Q_D(const BatchJob);
+    return d->fileInfos.value(path);
+}
+
+/**
+ * @brief The error that occurred when processing the resource with the given @p path.
+ *
+ * If the operation succeeded for this resource, JobError::NoError is returned.
+ */
+JobError BatchJob::entryError(const QString& path) const
+{
+    Q_D(const BatchJob);
+    return d->entryErrors.value(path, qMakePair(JobError::NoError, QString())).first;
+}
+
+/**
+ * @brief A textual description of the error that occurred for the resource with the @p path.
+ */
+QString BatchJob::entryErrorString(const QString& path) const
+{
+    Q_D(const BatchJob);
+    return d->entryErrors.value(path).second;
+}
+
+/**
+ * @brief The paths of all entries for which the operation failed.
+ */
+QStringList BatchJob::failedEntries() const
+{
+    Q_D(const BatchJob);
+    return d->entryErrors.keys();
+}
+
+/**
+ * @brief Constructor.
+ */
+BatchJob::BatchJob(BatchJobPrivate* d, QObject* parent) : AbstractJob(d, parent) {}
+
+/**
+ * @brief Set the @p fileInfo reported by the server for the entry with the given @p path.
+ */
+void BatchJob::setEntryFileInfo(const QString& path, const FileInfo& fileInfo)
+{
+    Q_D(BatchJob);
+    d->fileInfos[path] = fileInfo;
+}
+
+/**
+ * @brief Mark the entry with the given @p path as failed.
+ */
+void BatchJob::setEntryError(const QString& path, JobError error, const QString& errorString)
+{
+    Q_D(BatchJob);
+    d->entryErrors[path] = qMakePair(error, errorString);
+}
+
+/**
+ * @brief Remove all per-entry results.
+ *
+ * Concrete jobs should call this when (re-)starting.
+ */
+void BatchJob::clearEntryResults()
+{
+    Q_D(BatchJob);
+    d->fileInfos.clear();
+    d->entryErrors.clear();
+}
+
+} // namespace SynqClient
@@ -60,6 +60,7 @@ struct ChangeTreeNode
     ChangeTree::ChangeType change = ChangeTree::Unknown;
     QDateTime lastModified = QDateTime();
     QString syncAttribute = QString();
+    qint64 size = -1;
     Children children = Children();
 
     void dump(const QString& name, const QString& indentation = "") const;
@@ -128,6 +128,7 @@ void CompositeJob::start()
     if (d->state != JobState::Ready) {
         return;
     }
+    setState(JobState::Running);
     d->runJobs();
 }
 
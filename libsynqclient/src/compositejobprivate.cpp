@@ -67,6 +67,7 @@ void CompositeJobPrivate::runJobs()
                 remainingJobs << job;
                 break;
             case JobState::Finished:
+                addChildMetrics(job->metrics());
                 if (job->error() != JobError::NoError) {
                     // The job had an error. Record, if it is the first one:
                     if (firstChildError == JobError::NoError) {
@@ -115,4 +116,20 @@ void CompositeJobPrivate::runJobs()
     childJobs = remainingJobs;
 }
 
+/**
+ * @brief Add the requests, retries and bytes transferred by a finished child job to our metrics.
+ */
+void CompositeJobPrivate::addChildMetrics(const JobMetrics& childMetrics)
+{
+    metrics.setRequests(metrics.requests() + childMetrics.requests());
+    metrics.setRetries(metrics.retries() + childMetrics.retries());
+    metrics.setBytesSent(metrics.bytesSent() + childMetrics.bytesSent());
+    metrics.setBytesReceived(metrics.bytesReceived() + childMetrics.bytesReceived());
+    auto firstByteTime = childMetrics.firstByteTime();
+    if (firstByteTime.isValid()
+        && (!metrics.firstByteTime().isValid() || firstByteTime < metrics.firstByteTime())) {
+        metrics.setFirstByteTime(firstByteTime);
+    }
+}
+
 } // namespace SynqClient
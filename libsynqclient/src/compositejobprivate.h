@@ -47,6 +47,7 @@ public:
     Q_DECLARE_PUBLIC(CompositeJob);
 
     void runJobs();
+    void addChildMetrics(const JobMetrics& childMetrics);
 };
 
 } // namespace SynqClient
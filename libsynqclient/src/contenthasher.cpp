@@ -0,0 +1,205 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "contenthasher.h"
+
+#include <QFile>
+#include <QIODevice>
+
+namespace SynqClient {
+
+/**
+ * @class ContentHasher
+ * @brief Calculate checksums of file contents.
+ *
+ * This class calculates checksums of file contents using one of the algorithms used by the
+ * supported backends to report checksums of remote files. Data can be passed in chunks (e.g.
+ * while a file is transferred). Algorithms are identified by the same (upper case) names used in
+ * FileInfo::checksums().
+ *
+ * Besides the usual cryptographic hashes, the Dropbox content hash is supported: It splits the
+ * data into blocks of 4 MB, calculates the SHA-256 of each block and finally the SHA-256 of the
+ * concatenated block hashes.
+ */
+
+const char* ContentHasher::SHA1 = "SHA1";
+const char* ContentHasher::MD5 = "MD5";
+const char* ContentHasher::SHA256 = "SHA256";
+const char* ContentHasher::Dropbox = "DROPBOX";
+
+/**
+ * @brief Constructor.
+ *
+ * Creates a hasher for the given @p algorithm. If the algorithm is not supported, the hasher is
+ * invalid.
+ */
+ContentHasher::ContentHasher(const QString& algorithm)
+    : m_algorithm(algorithm.toUpper()), m_hash(), m_blockHash(), m_blockBytes(0)
+{
+    if (m_algorithm == SHA1) {
+        m_hash.reset(new QCryptographicHash(QCryptographicHash::Sha1));
+    } else if (m_algorithm == MD5) {
+        m_hash.reset(new QCryptographicHash(QCryptographicHash::Md5));
+    } else if (m_algorithm == SHA256) {
+        m_hash.reset(new QCryptographicHash(QCryptographicHash::Sha256));
+    } else if (m_algorithm == Dropbox) {
+        m_hash.reset(new QCryptographicHash(QCryptographicHash::Sha256));
+        m_blockHash.reset(new QCryptographicHash(QCryptographicHash::Sha256));
+    }
+}
+
+/**
+ * @brief Indicates if the algorithm of the hasher is supported.
+ */
+bool ContentHasher::isValid() const
+{
+    return !m_hash.isNull();
+}
+
+/**
+ * @brief The name of the algorithm used.
+ */
+QString ContentHasher::algorithm() const
+{
+    return m_algorithm;
+}
+
+/**
+ * @brief Add the @p data to the checksum.
+ */
+void ContentHasher::addData(const QByteArray& data)
+{
+    addData(data.constData(), data.size());
+}
+
+/**
+ * @brief Add @p length bytes starting at @p data to the checksum.
+ */
+void ContentHasher::addData(const char* data, qint64 length)
+{
+    if (!m_blockHash) {
+        if (m_hash) {
+            m_hash->addData(data, static_cast<int>(length));
+        }
+        return;
+    }
+    qint64 offset = 0;
+    while (offset < length) {
+        auto blockLength = qMin(DropboxBlockSize - m_blockBytes, length - offset);
+        m_blockHash->addData(data + offset, static_cast<int>(blockLength));
+        m_blockBytes += blockLength;
+        offset += blockLength;
+        if (m_blockBytes == DropboxBlockSize) {
+            m_hash->addData(m_blockHash->result());
+            m_blockHash->reset();
+            m_blockBytes = 0;
+        }
+    }
+}
+
+/**
+ * @brief Add all data read from the @p device to the checksum.
+ *
+ * Returns false if reading from the device failed.
+ */
+bool ContentHasher::addData(QIODevice* device)
+{
+    if (!device || !device->isReadable()) {
+        return false;
+    }
+    while (!device->atEnd()) {
+        auto data = device->read(64 * 1024);
+        if (data.isEmpty() && !device->atEnd()) {
+            return false;
+        }
+        addData(data);
+    }
+    return true;
+}
+
+/**
+ * @brief Get the checksum of the data added so far as lower case hex string.
+ */
+QString ContentHasher::result()
+{
+    if (!m_hash) {
+        return QString();
+    }
+    if (m_blockHash && m_blockBytes > 0) {
+        m_hash->addData(m_blockHash->result());
+        m_blockHash->reset();
+        m_blockBytes = 0;
+    }
+    return QString::fromLatin1(m_hash->result().toHex());
+}
+
+/**
+ * @brief Discard all data added so far and start over.
+ */
+void ContentHasher::reset()
+{
+    if (m_hash) {
+        m_hash->reset();
+    }
+    if (m_blockHash) {
+        m_blockHash->reset();
+    }
+    m_blockBytes = 0;
+}
+
+/**
+ * @brief The names of all supported algorithms, in order of preference.
+ */
+QStringList ContentHasher::supportedAlgorithms()
+{
+    return { SHA256, Dropbox, SHA1, MD5 };
+}
+
+/**
+ * @brief Select the most preferred supported algorithm out of the given @p algorithms.
+ *
+ * If none of the @p algorithms is supported, an empty string is returned.
+ */
+QString ContentHasher::preferredAlgorithm(const QStringList& algorithms)
+{
+    const auto supported = supportedAlgorithms();
+    for (const auto& algorithm : supported) {
+        if (algorithms.contains(algorithm, Qt::CaseInsensitive)) {
+            return algorithm;
+        }
+    }
+    return QString();
+}
+
+/**
+ * @brief Calculate the checksum of the local file @p fileName using the given @p algorithm.
+ *
+ * If the file cannot be read or the algorithm is not supported, an empty string is returned.
+ */
+QString ContentHasher::hashFile(const QString& fileName, const QString& algorithm)
+{
+    ContentHasher hasher(algorithm);
+    QFile file(fileName);
+    if (!hasher.isValid() || !file.open(QIODevice::ReadOnly) || !hasher.addData(&file)) {
+        return QString();
+    }
+    return hasher.result();
+}
+
+} // namespace SynqClient
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_CONTENTHASHER_H
+#define SYNQCLIENT_CONTENTHASHER_H
+
+#include <QByteArray>
+#include <QCryptographicHash>
+#include <QScopedPointer>
+#include <QString>
+#include <QStringList>
+
+class QIODevice;
+
+namespace SynqClient {
+
+class ContentHasher
+{
+public:
+    static const char* SHA1;
+    static const char* MD5;
+    static const char* SHA256;
+    static const char* Dropbox;
+
+    explicit ContentHasher(const QString& algorithm);
+
+    bool isValid() const;
+    QString algorithm() const;
+
+    void addData(const QByteArray& data);
+    void addData(const char* data, qint64 length);
+    bool addData(QIODevice* device);
+    QString result();
+    void reset();
+
+    static QStringList supportedAlgorithms();
+    static QString preferredAlgorithm(const QStringList& algorithms);
+    static QString hashFile(const QString& fileName, const QString& algorithm);
+
+private:
+    static const qint64 DropboxBlockSize = 4 * 1024 * 1024;
+
+    QString m_algorithm;
+    QScopedPointer<QCryptographicHash> m_hash;
+    QScopedPointer<QCryptographicHash> m_blockHash;
+    qint64 m_blockBytes;
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_CONTENTHASHER_H
@@ -0,0 +1,457 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../inc/SynqClient/continuoussynchronizer.h"
+
+#include <QTimer>
+
+#include "continuoussynchronizerprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @class ContinuousSynchronizer
+ * @brief Keep a local and a remote directory in sync continuously.
+ *
+ * The DirectorySynchronizer runs a single sync and needs to be re-created for each run. This
+ * class instead is meant to run for a long time: Once started, it keeps the sync state database
+ * open and runs small, incremental sync cycles whenever changes are reported:
+ *
+ * - Local changes are reported by a LocalChangeWatcher (if one is set).
+ * - Remote changes can be reported by calling requestSync(), e.g. from the
+ *   DropboxChangeWatcher::remoteChanged() signal. In addition, the remote is polled regularly
+ *   (see pollInterval()).
+ *
+ * Bursts of changes are debounced (see debounceInterval()), so that they are handled by a single
+ * sync cycle:
+ *
+ * @code
+ * auto watcher = new SynqClient::LocalChangeWatcher(this);
+ * watcher->setDirectory(localDir);
+ * watcher->start();
+ *
+ * auto sync = new SynqClient::ContinuousSynchronizer(this);
+ * sync->setJobFactory(factory);
+ * sync->setSyncStateDatabase(db);
+ * sync->setLocalDirectoryPath(localDir);
+ * sync->setRemoteDirectoryPath(remoteDir);
+ * sync->setLocalChangeWatcher(watcher);
+ * sync->start();
+ * @endcode
+ *
+ * Failed sync cycles are retried with an exponential backoff. Each cycle is run by a
+ * DirectorySynchronizer; its result can be checked via lastError() once syncFinished() has been
+ * emitted.
+ *
+ * @note Local changes done by a sync cycle itself (e.g. downloading files) are reported by the
+ * LocalChangeWatcher as well. This causes another - cheap - cycle which only scans the affected
+ * folders.
+ */
+
+/**
+ * @brief Constructor.
+ */
+ContinuousSynchronizer::ContinuousSynchronizer(QObject* parent)
+    : QObject(parent), d_ptr(new ContinuousSynchronizerPrivate(this))
+{
+}
+
+/**
+ * @brief Destructor.
+ */
+ContinuousSynchronizer::~ContinuousSynchronizer()
+{
+    Q_D(ContinuousSynchronizer);
+    if (d->synchronizer) {
+        d->synchronizer->disconnect(d);
+        delete d->synchronizer;
+    }
+    if (d->running && d->closeSyncStateDatabase && d->syncStateDatabase
+        && d->syncStateDatabase->isOpen()) {
+        d->syncStateDatabase->closeDatabase();
+    }
+}
+
+/**
+ * @brief Indicates if the synchronizer is running.
+ */
+bool ContinuousSynchronizer::running() const
+{
+    Q_D(const ContinuousSynchronizer);
+    return d->running;
+}
+
+/**
+ * @brief Indicates if a sync cycle is currently running.
+ */
+bool ContinuousSynchronizer::syncing() const
+{
+    Q_D(const ContinuousSynchronizer);
+    return !d->synchronizer.isNull();
+}
+
+/**
+ * @brief The job factory used to create jobs to talk to the remote.
+ */
+AbstractJobFactory* ContinuousSynchronizer::jobFactory() const
+{
+    Q_D(const ContinuousSynchronizer);
+    return d->jobFactory;
+}
+
+/**
+ * @brief Set the @p jobFactory used to create jobs to talk to the remote.
+ */
+void ContinuousSynchronizer::setJobFactory(AbstractJobFactory* jobFactory)
+{
+    Q_D(ContinuousSynchronizer);
+    d->jobFactory = jobFactory;
+}
+
+/**
+ * @brief The persistent sync state storage.
+ *
+ * The database is opened when the synchronizer is started and kept open until it is stopped. After
+ * each sync cycle, SyncStateDatabase::flushDatabase() is called to persist the state.
+ */
+SyncStateDatabase* ContinuousSynchronizer::syncStateDatabase() const
+{
+    Q_D(const ContinuousSynchronizer);
+    return d->syncStateDatabase;
+}
+
+/**
+ * @brief Set the persistent sync state storage.
+ */
+void ContinuousSynchronizer::setSyncStateDatabase(SyncStateDatabase* syncStateDatabase)
+{
+    Q_D(ContinuousSynchronizer);
+    d->syncStateDatabase = syncStateDatabase;
+}
+
+/**
+ * @brief The path to the local directory to sync.
+ */
+QString ContinuousSynchronizer::localDirectoryPath() const
+{
+    Q_D(const ContinuousSynchronizer);
+    return d->localDirectoryPath;
+}
+
+/**
+ * @brief Set the path to the local directory to sync.
+ */
+void ContinuousSynchronizer::setLocalDirectoryPath(const QString& localDirectoryPath)
+{
+    Q_D(ContinuousSynchronizer);
+    d->localDirectoryPath = localDirectoryPath;
+}
+
+/**
+ * @brief The path to the remote directory to sync.
+ */
+QString ContinuousSynchronizer::remoteDirectoryPath() const
+{
+    Q_D(const ContinuousSynchronizer);
+    return d->remoteDirectoryPath;
+}
+
+/**
+ * @brief Set the path to the remote directory to sync.
+ */
+void ContinuousSynchronizer::setRemoteDirectoryPath(const QString& remoteDirectoryPath)
+{
+    Q_D(ContinuousSynchronizer);
+    d->remoteDirectoryPath = remoteDirectoryPath;
+}
+
+/**
+ * @brief A filter to exclude files and folders from the sync.
+ *
+ * @sa DirectorySynchronizer::filter()
+ */
+DirectorySynchronizer::Filter ContinuousSynchronizer::filter() const
+{
+    Q_D(const ContinuousSynchronizer);
+    return d->filter;
+}
+
+/**
+ * @brief Set the @p filter used to exclude files and folders from the sync.
+ */
+void ContinuousSynchronizer::setFilter(const DirectorySynchronizer::Filter& filter)
+{
+    Q_D(ContinuousSynchronizer);
+    d->filter = filter;
+}
+
+/**
+ * @brief A watcher which reports local changes.
+ *
+ * If set, a sync cycle is scheduled whenever the watcher reports a local change. In addition,
+ * the watcher is used to limit the local scan to the folders which changed, see
+ * DirectorySynchronizer::localChangeWatcher(). Changing the watcher takes effect the next time
+ * the synchronizer is started.
+ */
+LocalChangeWatcher* ContinuousSynchronizer::localChangeWatcher() const
+{
+    Q_D(const ContinuousSynchronizer);
+    return d->localChangeWatcher;
+}
+
+/**
+ * @brief Set the @p localChangeWatcher which reports local changes.
+ */
+void ContinuousSynchronizer::setLocalChangeWatcher(LocalChangeWatcher* localChangeWatcher)
+{
+    Q_D(ContinuousSynchronizer);
+    d->localChangeWatcher = localChangeWatcher;
+}
+
+/**
+ * @brief The maximal number of jobs to spawn in parallel.
+ *
+ * If a sync cycle indicates that it should be retried with fewer jobs (see
+ * DirectorySynchronizer::retryWithFewerJobs()), this value is halved.
+ *
+ * @sa DirectorySynchronizer::maxJobs()
+ */
+int ContinuousSynchronizer::maxJobs() const
+{
+    Q_D(const ContinuousSynchronizer);
+    return d->maxJobs;
+}
+
+/**
+ * @brief Set the maximal number of jobs to spawn in parallel.
+ */
+void ContinuousSynchronizer::setMaxJobs(int maxJobs)
+{
+    Q_D(ContinuousSynchronizer);
+    d->maxJobs = maxJobs;
+}
+
+/**
+ * @brief The maximal number of jobs to spawn in parallel when using HTTP/2.
+ *
+ * @sa DirectorySynchronizer::maxMultiplexedJobs()
+ */
+int ContinuousSynchronizer::maxMultiplexedJobs() const
+{
+    Q_D(const ContinuousSynchronizer);
+    return d->maxMultiplexedJobs;
+}
+
+/**
+ * @brief Set the maximal number of jobs to spawn in parallel when using HTTP/2.
+ */
+void ContinuousSynchronizer::setMaxMultiplexedJobs(int maxMultiplexedJobs)
+{
+    Q_D(ContinuousSynchronizer);
+    d->maxMultiplexedJobs = maxMultiplexedJobs;
+}
+
+/**
+ * @brief The strategy to be used in case a sync conflict is detected.
+ */
+SyncConflictStrategy ContinuousSynchronizer::syncConflictStrategy() const
+{
+    Q_D(const ContinuousSynchronizer);
+    return d->syncConflictStrategy;
+}
+
+/**
+ * @brief Set the @p strategy to be used when a sync conflict is detected.
+ */
+void ContinuousSynchronizer::setSyncConflictStrategy(SyncConflictStrategy strategy)
+{
+    Q_D(ContinuousSynchronizer);
+    d->syncConflictStrategy = strategy;
+}
+
+/**
+ * @brief Settings to fine tune the synchronization.
+ *
+ * @sa DirectorySynchronizer::flags()
+ */
+SynchronizerFlags ContinuousSynchronizer::flags() const
+{
+    Q_D(const ContinuousSynchronizer);
+    return d->flags;
+}
+
+/**
+ * @brief Set the @p flags which control some of the behavior of the sync.
+ */
+void ContinuousSynchronizer::setFlags(const SynchronizerFlags flags)
+{
+    Q_D(ContinuousSynchronizer);
+    d->flags = flags;
+}
+
+/**
+ * @brief The time (in milliseconds) to wait for further changes before running a sync.
+ *
+ * When a change is reported, the synchronizer waits for this interval before running a sync. If
+ * further changes are reported in the meantime, the sync is postponed - but at most for ten
+ * times this interval. This way, bursts of changes are handled in a single sync cycle. The
+ * default is 1000ms.
+ */
+int ContinuousSynchronizer::debounceInterval() const
+{
+    Q_D(const ContinuousSynchronizer);
+    return d->debounceInterval;
+}
+
+/**
+ * @brief Set the @p debounceInterval in milliseconds.
+ */
+void ContinuousSynchronizer::setDebounceInterval(int debounceInterval)
+{
+    Q_D(ContinuousSynchronizer);
+    d->debounceInterval = qMax(0, debounceInterval);
+}
+
+/**
+ * @brief The interval (in milliseconds) in which to check for remote changes.
+ *
+ * If no sync ran for this interval, a sync cycle is run to pick up remote changes. Set this to 0
+ * if remote changes are reported via requestSync() only (e.g. by connecting the
+ * DropboxChangeWatcher::remoteChanged() signal to it). The default is 5 minutes.
+ */
+int ContinuousSynchronizer::pollInterval() const
+{
+    Q_D(const ContinuousSynchronizer);
+    return d->pollInterval;
+}
+
+/**
+ * @brief Set the @p pollInterval in milliseconds.
+ */
+void ContinuousSynchronizer::setPollInterval(int pollInterval)
+{
+    Q_D(ContinuousSynchronizer);
+    d->pollInterval = qMax(0, pollInterval);
+}
+
+/**
+ * @brief The result of the last sync cycle.
+ */
+SynchronizerError ContinuousSynchronizer::lastError() const
+{
+    Q_D(const ContinuousSynchronizer);
+    return d->lastError;
+}
+
+/**
+ * @brief A textual description of the error of the last sync cycle.
+ */
+QString ContinuousSynchronizer::lastErrorString() const
+{
+    Q_D(const ContinuousSynchronizer);
+    return d->lastErrorString;
+}
+
+/**
+ * @brief Start synchronizing.
+ *
+ * This opens the sync state database and runs a first sync cycle right away. Afterwards, sync
+ * cycles are run whenever changes are reported.
+ *
+ * If parameters are missing or the database cannot be opened, the synchronizer does not start.
+ * In this case, lastError() indicates the reason.
+ */
+void ContinuousSynchronizer::start()
+{
+    Q_D(ContinuousSynchronizer);
+    if (d->running) {
+        return;
+    }
+
+    if (!d->jobFactory || !d->syncStateDatabase || !d->filter || d->localDirectoryPath.isEmpty()
+        || d->remoteDirectoryPath.isEmpty()) {
+        d->setError(SynchronizerError::MissingParameter, tr("Some parameters are missing"));
+        return;
+    }
+
+    if (d->syncStateDatabase->isOpen()) {
+        d->closeSyncStateDatabase = false;
+    } else if (d->syncStateDatabase->openDatabase()) {
+        d->closeSyncStateDatabase = true;
+    } else {
+        d->setError(SynchronizerError::FailedOpeningSyncStateDatabase,
+                    tr("Failed to open the sync state database"));
+        return;
+    }
+
+    d->lastError = SynchronizerError::NoError;
+    d->lastErrorString.clear();
+    d->numFailures = 0;
+    d->syncPending = false;
+    d->running = true;
+    if (d->localChangeWatcher) {
+        connect(d->localChangeWatcher, &LocalChangeWatcher::localChanged, d,
+                [=]() { d->scheduleSync(d->debounceInterval); });
+    }
+    emit runningChanged();
+    d->scheduleSync(0);
+}
+
+/**
+ * @brief Stop synchronizing.
+ *
+ * If a sync cycle is currently running, it is stopped. The synchronizer stops running (and closes
+ * the sync state database) once the cycle finished.
+ */
+void ContinuousSynchronizer::stop()
+{
+    Q_D(ContinuousSynchronizer);
+    if (!d->running || d->stopRequested) {
+        return;
+    }
+    d->stopRequested = true;
+    d->syncTimer->stop();
+    d->pollTimer->stop();
+    if (d->synchronizer) {
+        d->synchronizer->stop();
+    } else {
+        d->finishStopping();
+    }
+}
+
+/**
+ * @brief Request a sync cycle.
+ *
+ * Call this when learning about remote changes. The sync is run after the debounceInterval().
+ */
+void ContinuousSynchronizer::requestSync()
+{
+    Q_D(ContinuousSynchronizer);
+    d->scheduleSync(d->debounceInterval);
+}
+
+/**
+ * @brief Constructor.
+ */
+ContinuousSynchronizer::ContinuousSynchronizer(ContinuousSynchronizerPrivate* d, QObject* parent)
+    : QObject(parent), d_ptr(d)
+{
+}
+
+} // namespace SynqClient
@@ -0,0 +1,207 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "continuoussynchronizerprivate.h"
+
+#include <QLoggingCategory>
+#include <QTimer>
+
+namespace SynqClient {
+
+static Q_LOGGING_CATEGORY(log, "SynqClient.ContinuousSynchronizer", QtWarningMsg);
+
+ContinuousSynchronizerPrivate::ContinuousSynchronizerPrivate(ContinuousSynchronizer* q)
+    : QObject(),
+      q_ptr(q),
+      jobFactory(nullptr),
+      syncStateDatabase(nullptr),
+      localDirectoryPath(),
+      remoteDirectoryPath(),
+      filter([](const QString&, const FileInfo&) { return true; }),
+      localChangeWatcher(nullptr),
+      maxJobs(12),
+      maxMultiplexedJobs(48),
+      syncConflictStrategy(SyncConflictStrategy::RemoteWins),
+      flags(SynchronizerFlag::DefaultFlags),
+      debounceInterval(1000),
+      pollInterval(5 * 60 * 1000),
+      lastError(SynchronizerError::NoError),
+      lastErrorString(),
+      running(false),
+      stopRequested(false),
+      closeSyncStateDatabase(true),
+      syncPending(false),
+      numFailures(0),
+      synchronizer(nullptr),
+      syncTimer(new QTimer(this)),
+      pollTimer(new QTimer(this)),
+      pendingSince()
+{
+    syncTimer->setSingleShot(true);
+    connect(syncTimer, &QTimer::timeout, this, &ContinuousSynchronizerPrivate::runSync);
+    pollTimer->setSingleShot(true);
+    connect(pollTimer, &QTimer::timeout, this, [=]() { scheduleSync(0); });
+}
+
+/**
+ * @brief Schedule a sync cycle to run after @p delay milliseconds.
+ *
+ * If a sync is already scheduled, it is postponed, such that bursts of changes are handled by a
+ * single sync. To keep the latency bounded, a sync is postponed at most for ten times the
+ * debounce interval. If a sync is currently running, another one is run once it finished.
+ */
+void ContinuousSynchronizerPrivate::scheduleSync(int delay)
+{
+    if (!running || stopRequested) {
+        return;
+    }
+    if (synchronizer) {
+        syncPending = true;
+        return;
+    }
+    if (!syncTimer->isActive()) {
+        pendingSince.start();
+        syncTimer->start(delay);
+    } else if (pendingSince.elapsed() + delay <= debounceInterval * MaxDebounceFactor) {
+        syncTimer->start(delay);
+    }
+}
+
+void ContinuousSynchronizerPrivate::setError(SynchronizerError error, const QString& errorString)
+{
+    Q_Q(ContinuousSynchronizer);
+    lastError = error;
+    lastErrorString = errorString;
+    emit q->logMessageAvailable(SynchronizerLogEntryType::Error, errorString);
+}
+
+/**
+ * @brief Release resources after the last sync cycle finished.
+ */
+void ContinuousSynchronizerPrivate::finishStopping()
+{
+    Q_Q(ContinuousSynchronizer);
+    syncTimer->stop();
+    pollTimer->stop();
+    if (localChangeWatcher) {
+        disconnect(localChangeWatcher, nullptr, this, nullptr);
+    }
+    if (closeSyncStateDatabase && syncStateDatabase && syncStateDatabase->isOpen()
+        && !syncStateDatabase->closeDatabase()) {
+        setError(SynchronizerError::FailedClosingSyncStateDatabase,
+                 tr("Failed to close the sync state database"));
+    }
+    running = false;
+    stopRequested = false;
+    emit q->runningChanged();
+}
+
+/**
+ * @brief Run a single sync cycle.
+ */
+void ContinuousSynchronizerPrivate::runSync()
+{
+    Q_Q(ContinuousSynchronizer);
+    if (!running || stopRequested || synchronizer) {
+        return;
+    }
+    qCDebug(log) << "Starting sync cycle";
+    syncPending = false;
+    pollTimer->stop();
+
+    auto sync = new DirectorySynchronizer(this);
+    sync->setJobFactory(jobFactory);
+    sync->setSyncStateDatabase(syncStateDatabase);
+    sync->setLocalDirectoryPath(localDirectoryPath);
+    sync->setRemoteDirectoryPath(remoteDirectoryPath);
+    sync->setFilter(filter);
+    sync->setLocalChangeWatcher(localChangeWatcher);
+    sync->setMaxJobs(maxJobs);
+    sync->setMaxMultiplexedJobs(maxMultiplexedJobs);
+    sync->setSyncConflictStrategy(syncConflictStrategy);
+    sync->setFlags(flags);
+    connect(sync, &DirectorySynchronizer::logMessageAvailable, q,
+            &ContinuousSynchronizer::logMessageAvailable);
+    connect(sync, &DirectorySynchronizer::progress, q, &ContinuousSynchronizer::progress);
+    connect(sync, &DirectorySynchronizer::progressAvailable, q,
+            &ContinuousSynchronizer::progressAvailable);
+    connect(sync, &DirectorySynchronizer::finished, this,
+            &ContinuousSynchronizerPrivate::onSynchronizerFinished);
+    synchronizer = sync;
+    emit q->syncingChanged();
+    sync->start();
+}
+
+void ContinuousSynchronizerPrivate::onSynchronizerFinished()
+{
+    Q_Q(ContinuousSynchronizer);
+    auto sync = synchronizer;
+    synchronizer = nullptr;
+    if (!sync) {
+        return;
+    }
+    sync->deleteLater();
+
+    lastError = sync->error();
+    lastErrorString = sync->errorString();
+
+    // The database stays open between cycles - make sure the state of this cycle is persisted:
+    if (syncStateDatabase && syncStateDatabase->isOpen() && !syncStateDatabase->flushDatabase()
+        && lastError == SynchronizerError::NoError) {
+        setError(SynchronizerError::FailedClosingSyncStateDatabase,
+                 tr("Failed to write the sync state database"));
+    }
+
+    if (sync->retryWithFewerJobs()) {
+        maxJobs = qMax(1, maxJobs / 2);
+        maxMultiplexedJobs = qMax(1, maxMultiplexedJobs / 2);
+        qCDebug(log) << "Reducing number of parallel jobs to" << maxJobs << "and"
+                     << maxMultiplexedJobs;
+    }
+
+    emit q->syncingChanged();
+    emit q->syncFinished();
+
+    if (stopRequested) {
+        finishStopping();
+        return;
+    }
+
+    if (lastError != SynchronizerError::NoError) {
+        // Retry with exponential backoff:
+        ++numFailures;
+        auto delay = qMin(RetryInterval * (1 << qMin(numFailures - 1, 6)), MaxRetryInterval);
+        qCDebug(log) << "Sync cycle failed:" << lastErrorString << "- retrying in" << delay
+                     << "ms";
+        pendingSince.start();
+        syncTimer->start(delay);
+    } else {
+        numFailures = 0;
+        if (syncPending) {
+            // Changes came in while the sync was running:
+            scheduleSync(debounceInterval);
+        }
+    }
+
+    if (pollInterval > 0) {
+        pollTimer->start(pollInterval);
+    }
+}
+
+} // namespace SynqClient
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_CONTINUOUSSYNCHRONIZERPRIVATE_H
+#define SYNQCLIENT_CONTINUOUSSYNCHRONIZERPRIVATE_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QPointer>
+
+#include "SynqClient/abstractjobfactory.h"
+#include "SynqClient/continuoussynchronizer.h"
+#include "SynqClient/localchangewatcher.h"
+#include "SynqClient/syncstatedatabase.h"
+
+class QTimer;
+
+namespace SynqClient {
+
+class ContinuousSynchronizerPrivate : public QObject
+{
+    Q_OBJECT
+public:
+    explicit ContinuousSynchronizerPrivate(ContinuousSynchronizer* q);
+
+    ContinuousSynchronizer* q_ptr;
+    Q_DECLARE_PUBLIC(ContinuousSynchronizer);
+
+    QPointer<AbstractJobFactory> jobFactory;
+    QPointer<SyncStateDatabase> syncStateDatabase;
+    QString localDirectoryPath;
+    QString remoteDirectoryPath;
+    DirectorySynchronizer::Filter filter;
+    QPointer<LocalChangeWatcher> localChangeWatcher;
+    int maxJobs;
+    int maxMultiplexedJobs;
+    SyncConflictStrategy syncConflictStrategy;
+    SynchronizerFlags flags;
+    int debounceInterval;
+    int pollInterval;
+    SynchronizerError lastError;
+    QString lastErrorString;
+
+    bool running;
+    bool stopRequested;
+    bool closeSyncStateDatabase;
+    bool syncPending;
+    int numFailures;
+    QPointer<DirectorySynchronizer> synchronizer;
+    QTimer* syncTimer;
+    QTimer* pollTimer;
+    QElapsedTimer pendingSince;
+
+    const int MaxDebounceFactor = 10;
+    const int RetryInterval = 5000;
+    const int MaxRetryInterval = 300000;
+
+    void scheduleSync(int delay);
+    void setError(SynchronizerError error, const QString& errorString);
+    void finishStopping();
+
+public slots:
+
+    void runSync();
+    void onSynchronizerFinished();
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_CONTINUOUSSYNCHRONIZERPRIVATE_H
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../inc/SynqClient/createdirectorybatchjob.h"
+
+#include "createdirectorybatchjobprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @class CreateDirectoryBatchJob
+ * @brief Create several remote folders at once.
+ *
+ * This class is an abstract base for jobs which create several folders on the remote within a
+ * single operation. The folders to create are set via setPaths() or addPath().
+ *
+ * Note that parent folders should be listed before their children. Depending on the backend,
+ * missing parent folders might be created implicitly.
+ *
+ * # Error Handling
+ *
+ * Per entry, the following error codes are used to indicate non-fatal errors:
+ *
+ * - JobError::FolderExists: The remote folder already exists.
+ *
+ * @sa CreateDirectoryJob
+ */
+
+/**
+ * @brief Constructor.
+ */
+CreateDirectoryBatchJob::CreateDirectoryBatchJob(QObject* parent)
+    : BatchJob(new CreateDirectoryBatchJobPrivate(this), parent)
+{
+}
+
+/**
+ * @brief Destructor.
+ */
+CreateDirectoryBatchJob::~CreateDirectoryBatchJob() {}
+
+/**
+ * @brief The paths of the remote folders to be created.
+ */
+QStringList CreateDirectoryBatchJob::paths() const
+{
+    Q_D(const CreateDirectoryBatchJob);
+    return d->paths;
+}
+
+/**
+ * @brief Set the @p paths of the remote folders to be created.
+ */
+void CreateDirectoryBatchJob::setPaths(const QStringList& paths)
+{
+    Q_D(CreateDirectoryBatchJob);
+    d->paths = paths;
+}
+
+/**
+ * @brief Add the @p path to the list of remote folders to be created.
+ */
+void CreateDirectoryBatchJob::addPath(const QString& path)
+{
+    Q_D(CreateDirectoryBatchJob);
+    d->paths << path;
+}
+
+/**
+ * @brief Constructor.
+ */
+CreateDirectoryBatchJob::CreateDirectoryBatchJob(CreateDirectoryBatchJobPrivate* d,
+                                                 QObject* parent)
+    : BatchJob(d, parent)
+{
+}
+
+} // namespace SynqClient
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../inc/SynqClient/deletebatchjob.h"
+
+#include "deletebatchjobprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @class DeleteBatchJob
+ * @brief Delete several remote files or folders at once.
+ *
+ * This class is an abstract base for jobs which delete several remote resources within a single
+ * operation. The resources to delete are set via setPaths() or addPath(). Folders are deleted
+ * recursively.
+ *
+ * # Error Handling
+ *
+ * Per entry, the following error codes are used to indicate non-fatal errors:
+ *
+ * - JobError::ResourceNotFound: The remote resource does not/no longer exist.
+ *
+ * @sa DeleteJob
+ */
+
+/**
+ * @brief Constructor.
+ */
+DeleteBatchJob::DeleteBatchJob(QObject* parent) : BatchJob(new DeleteBatchJobPrivate(this), parent)
+{
+}
+
+/**
+ * @brief Destructor.
+ */
+DeleteBatchJob::~DeleteBatchJob() {}
+
+/**
+ * @brief The paths of the remote resources to be deleted.
+ */
+QStringList DeleteBatchJob::paths() const
+{
+    Q_D(const DeleteBatchJob);
+    return d->paths;
+}
+
+/**
+ * @brief Set the @p paths of the remote resources to be deleted.
+ */
+void DeleteBatchJob::setPaths(const QStringList& paths)
+{
+    Q_D(DeleteBatchJob);
+    d->paths = paths;
+}
+
+/**
+ * @brief Add the @p path to the list of remote resources to be deleted.
+ */
+void DeleteBatchJob::addPath(const QString& path)
+{
+    Q_D(DeleteBatchJob);
+    d->paths << path;
+}
+
+/**
+ * @brief Constructor.
+ */
+DeleteBatchJob::DeleteBatchJob(DeleteBatchJobPrivate* d, QObject* parent) : BatchJob(d, parent) {}
+
+} // namespace SynqClient
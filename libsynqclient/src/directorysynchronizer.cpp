@@ -19,11 +19,13 @@
 
 #include "SynqClient/directorysynchronizer.h"
 
+#include <QDateTime>
 #include <QFileInfo>
 #include <QTimer>
 
 #include "SynqClient/abstractjobfactory.h"
 #include "SynqClient/syncstatedatabase.h"
+#include "SynqClient/synctracer.h"
 
 #include "directorysynchronizerprivate.h"
 
@@ -76,6 +78,9 @@ DirectorySynchronizer::DirectorySynchronizer(QObject* parent)
     : QObject(parent), d_ptr(new DirectorySynchronizerPrivate(this))
 {
     qRegisterMetaType<SynchronizerLogEntryType>();
+    qRegisterMetaType<SyncStatistics>();
+    qRegisterMetaType<SyncProgress>();
+    qRegisterMetaType<SyncEvent>();
     connect(this, &DirectorySynchronizer::finished, this, [=]() {
         emit logMessageAvailable(SynchronizerLogEntryType::Information,
                                  tr("Finished synchronization"));
@@ -115,6 +120,9 @@ void DirectorySynchronizer::setJobFactory(AbstractJobFactory* jobFactory)
  * This holds the database used to persistently store sync state information. This is required
  * to detect both local and remote changes between sync runs. By default, this is a nullptr and
  * must be set to a valid database before using the synchronizer.
+ *
+ * The synchronizer opens the database when it starts and closes it once it is done. If the
+ * database already is open when the sync starts, it is used as is and left open afterwards.
  */
 SyncStateDatabase* DirectorySynchronizer::syncStateDatabase() const
 {
@@ -228,6 +236,32 @@ void DirectorySynchronizer::setFilter(const DirectorySynchronizer::Filter& filte
     d->filter = filter;
 }
 
+/**
+ * @brief A watcher which tracks local changes between syncs.
+ *
+ * If a running LocalChangeWatcher is set, the synchronizer only scans the local folders in which
+ * the watcher observed changes instead of the complete local directory. If the watcher lost track
+ * of changes (see LocalChangeWatcher::fullScanRequired()), a full scan is done.
+ *
+ * The synchronizer clears the dirty state of the watcher when it starts scanning for local
+ * changes. If the sync fails, the dirty state is restored, such that the changes are picked up by
+ * the next sync.
+ */
+LocalChangeWatcher* DirectorySynchronizer::localChangeWatcher() const
+{
+    Q_D(const DirectorySynchronizer);
+    return d->localChangeWatcher;
+}
+
+/**
+ * @brief Set the @p localChangeWatcher used to track local changes between syncs.
+ */
+void DirectorySynchronizer::setLocalChangeWatcher(LocalChangeWatcher* localChangeWatcher)
+{
+    Q_D(DirectorySynchronizer);
+    d->localChangeWatcher = localChangeWatcher;
+}
+
 /**
  * @brief The maximal number of jobs to spawn in parallel.
  *
@@ -241,6 +275,13 @@ void DirectorySynchronizer::setFilter(const DirectorySynchronizer::Filter& filte
  * When using a job factory which does not internally use QNetworkAccessManager, adjust this
  * value accordingly. In particular, in case you have a job implementation which requires
  * sequential access, you should set this value to 1.
+ *
+ * @note If the job factory allows the use of HTTP/2 (see AbstractJobFactory::http2Allowed()),
+ * the maxMultiplexedJobs() limit is used instead.
+ *
+ * @note If the job factory supports batch jobs (see AbstractJobFactory::maxBatchSize()), the
+ * synchronizer combines several uploads, remote folder creations and remote file deletions into
+ * a single batch job. Each batch only counts as one job.
  */
 int DirectorySynchronizer::maxJobs() const
 {
@@ -257,6 +298,32 @@ void DirectorySynchronizer::setMaxJobs(int maxJobs)
     d->maxJobs = maxJobs;
 }
 
+/**
+ * @brief The maximal number of jobs to spawn in parallel when using HTTP/2.
+ *
+ * If the jobFactory() allows the use of HTTP/2, requests to the same host can be multiplexed over
+ * a single connection. In this case, the number of parallel jobs is no longer bound by the number
+ * of connections QNetworkAccessManager opens per host and this limit is used instead of maxJobs().
+ * By default, this is set to 48.
+ *
+ * If the server turns out to not support HTTP/2, Qt falls back to HTTP/1.1 and queues requests
+ * internally, so a higher value only results in more jobs waiting for a free connection.
+ */
+int DirectorySynchronizer::maxMultiplexedJobs() const
+{
+    Q_D(const DirectorySynchronizer);
+    return d->maxMultiplexedJobs;
+}
+
+/**
+ * @brief Set the maximal number of jobs to spawn in parallel when using HTTP/2.
+ */
+void DirectorySynchronizer::setMaxMultiplexedJobs(int maxMultiplexedJobs)
+{
+    Q_D(DirectorySynchronizer);
+    d->maxMultiplexedJobs = maxMultiplexedJobs;
+}
+
 /**
  * @brief Indicates that the sync should be retried with fewer parallel jobs.
  *
@@ -317,6 +384,121 @@ void DirectorySynchronizer::setFlags(const SynchronizerFlags flags)
     d->flags = flags;
 }
 
+/**
+ * @brief The interval in milliseconds in which statistics are reported while syncing.
+ *
+ * If this is greater than zero, the statisticsAvailable() signal is emitted periodically with a
+ * snapshot of the statistics() while the synchronization is running. The default is 0, in which
+ * case the signal is only emitted once when the synchronization finished.
+ */
+int DirectorySynchronizer::statisticsInterval() const
+{
+    Q_D(const DirectorySynchronizer);
+    return d->statisticsInterval;
+}
+
+/**
+ * @brief Set the interval in which statistics are reported to @p statisticsInterval milliseconds.
+ *
+ * This must be set before calling start().
+ */
+void DirectorySynchronizer::setStatisticsInterval(int statisticsInterval)
+{
+    Q_D(DirectorySynchronizer);
+    d->statisticsInterval = statisticsInterval;
+}
+
+/**
+ * @brief Metrics about the current or last synchronization run.
+ *
+ * This returns the time spent in each phase of the sync as well as the aggregated metrics of all
+ * jobs that have finished so far. It can be called at any time, e.g. from a monitoring endpoint.
+ */
+SyncStatistics DirectorySynchronizer::statistics() const
+{
+    Q_D(const DirectorySynchronizer);
+    return d->statisticsSnapshot();
+}
+
+/**
+ * @brief The interval in milliseconds in which progress is reported while syncing.
+ *
+ * While the synchronization is running, the progress() and progressAvailable() signals are
+ * emitted at most once per interval (and only if the progress changed meanwhile). This keeps
+ * syncs of many small files from flooding the event loop with progress updates. The default is
+ * 100ms.
+ */
+int DirectorySynchronizer::progressInterval() const
+{
+    Q_D(const DirectorySynchronizer);
+    return d->progressInterval;
+}
+
+/**
+ * @brief Set the interval in which progress is reported to @p progressInterval milliseconds.
+ *
+ * This must be set before calling start().
+ */
+void DirectorySynchronizer::setProgressInterval(int progressInterval)
+{
+    Q_D(DirectorySynchronizer);
+    d->progressInterval = progressInterval;
+}
+
+/**
+ * @brief The detailed progress of the running synchronization.
+ *
+ * This includes the bytes transferred so far and in total as well as an estimate of the
+ * throughput and the time remaining.
+ */
+SyncProgress DirectorySynchronizer::currentProgress() const
+{
+    Q_D(const DirectorySynchronizer);
+    return d->progressSnapshot();
+}
+
+/**
+ * @brief Get the path referred to by a SyncEvent.
+ *
+ * This returns the path (relative to the localDirectoryPath() and remoteDirectoryPath()) which
+ * has been assigned the @p pathId in an event emitted via the syncEventAvailable() signal. If the
+ * id is unknown, an empty string is returned.
+ *
+ * @note Path ids are only valid for the synchronizer which emitted the event.
+ */
+QString DirectorySynchronizer::eventPath(quint32 pathId) const
+{
+    Q_D(const DirectorySynchronizer);
+    return d->eventPaths.value(static_cast<int>(pathId) - 1);
+}
+
+/**
+ * @brief The tracer used to record the synchronization.
+ *
+ * By default, no tracer is set.
+ */
+SyncTracer* DirectorySynchronizer::tracer() const
+{
+    Q_D(const DirectorySynchronizer);
+    return d->tracer;
+}
+
+/**
+ * @brief Set the @p tracer used to record the synchronization.
+ *
+ * If set, the synchronizer records the phases of the sync, all jobs it runs and the decisions
+ * taken when scheduling remote actions in the tracer. The synchronizer does not take ownership
+ * of the tracer. Recorded events are appended, so a single tracer can be used to record several
+ * synchronization runs.
+ *
+ * This must be set before calling start().
+ */
+void DirectorySynchronizer::setTracer(SyncTracer* tracer)
+{
+    Q_D(DirectorySynchronizer);
+    d->tracer = tracer;
+}
+
 /**
  * @brief The state of the synchronizer.
  *
@@ -373,14 +555,30 @@ void DirectorySynchronizer::start()
     }
 
     auto progressTimer = new QTimer(this);
-    progressTimer->setInterval(100);
+    progressTimer->setInterval(qMax(d->progressInterval, 1));
     progressTimer->setSingleShot(false);
-    connect(progressTimer, &QTimer::timeout, this, [=]() { emit progress(d->progress); });
+    connect(progressTimer, &QTimer::timeout, d, &DirectorySynchronizerPrivate::reportProgress);
+    connect(this, &DirectorySynchronizer::finished, progressTimer, &QObject::deleteLater);
     progressTimer->start();
 
     emit logMessageAvailable(SynchronizerLogEntryType::Information, tr("Starting synchronization"));
 
     d->state = SynchronizerState::Running;
+    d->statistics.setStartTime(QDateTime::currentDateTimeUtc());
+
+    if (d->statisticsInterval > 0) {
+        auto statisticsTimer = new QTimer(this);
+        statisticsTimer->setInterval(d->statisticsInterval);
+        connect(statisticsTimer, &QTimer::timeout, this,
+                [=]() { emit statisticsAvailable(d->statisticsSnapshot()); });
+        connect(this, &DirectorySynchronizer::finished, statisticsTimer, &QObject::deleteLater);
+        statisticsTimer->start();
+    }
+
+    if (d->tracer) {
+        d->tracer->setTrackName(DirectorySynchronizerPrivate::PhaseTrack, tr("Sync phases"));
+        d->tracer->setTrackName(DirectorySynchronizerPrivate::SchedulerTrack, tr("Scheduler"));
+    }
 
     if (!d->jobFactory || !d->syncStateDatabase || !d->filter || d->localDirectoryPath.isEmpty()
         || d->remoteDirectoryPath.isEmpty()) {
@@ -389,7 +587,7 @@ void DirectorySynchronizer::start()
         return;
     }
 
-    if (d->maxJobs < 1) {
+    if (d->maxJobs < 1 || d->maxMultiplexedJobs < 1) {
         d->setError(SynchronizerError::InvalidParameter,
                     tr("The maximum number of jobs must be at least 1"), JobError::NoError);
         return;
@@ -401,7 +599,10 @@ void DirectorySynchronizer::start()
         return;
     }
 
-    if (!d->syncStateDatabase->openDatabase()) {
+    if (d->syncStateDatabase->isOpen()) {
+        // The database is managed by the caller (e.g. a ContinuousSynchronizer):
+        d->closeSyncStateDatabase = false;
+    } else if (!d->syncStateDatabase->openDatabase()) {
         d->setError(SynchronizerError::FailedOpeningSyncStateDatabase,
                     tr("Failed to open the sync state database"), JobError::NoError);
     }
@@ -468,6 +669,20 @@ DirectorySynchronizer::DirectorySynchronizer(DirectorySynchronizerPrivate* d, QO
  * Depending on the concrete type, @p message is either an arbitrary string (containing more details
  * about the issue) or the path (relative to the local and remote root folder) which is being
  * affected.
+ *
+ * Messages about individual files and folders are only formatted if this signal is connected.
+ * For large syncs, consider using the syncEventAvailable() signal instead.
+ */
+
+/**
+ * @fn DirectorySynchronizer::syncEventAvailable(const SyncEvent& event)
+ * @brief An action has been carried out on a file or folder.
+ *
+ * This signal is emitted for each file or folder the synchronizer creates, deletes, moves,
+ * copies, uploads or downloads. It carries the same information as the corresponding
+ * logMessageAvailable() messages, but the @p event refers to paths by ids, which can be resolved
+ * using eventPath(). The synchronizer only does the bookkeeping for the events if this signal is
+ * connected, so there is no overhead if nobody listens.
  */
 
 /**
@@ -479,6 +694,28 @@ DirectorySynchronizer::DirectorySynchronizer(DirectorySynchronizerPrivate* d, QO
  * reported in the initial phase when the sync plan is being created). As soon as
  * the known steps are gathered, this signal is emitted with values between
  * 0 and 100, indicating the overall progress of the operation.
+ *
+ * The progress is weighted by the number of bytes to transfer, so it advances steadily even if
+ * the sync includes a few very large files. The signal is emitted at most once per
+ * progressInterval().
+ */
+
+/**
+ * @fn DirectorySynchronizer::progressAvailable(const SyncProgress& progress)
+ * @brief Detailed progress of the sync operation is available.
+ *
+ * This signal is emitted along with the progress() signal. In addition to the overall
+ * percentage, the @p progress includes the bytes transferred, the current throughput and an
+ * estimate of the time remaining.
+ */
+
+/**
+ * @fn DirectorySynchronizer::statisticsAvailable(const SyncStatistics& statistics)
+ * @brief A snapshot of the sync's statistics is available.
+ *
+ * This signal is emitted periodically while the sync is running if the statisticsInterval() is
+ * greater than zero. In any case, it is emitted once with the final @p statistics right before
+ * the finished() signal.
  */
 
 /**
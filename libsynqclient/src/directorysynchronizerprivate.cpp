@@ -24,50 +24,95 @@
 #include <QDateTime>
 #include <QDir>
 #include <QDirIterator>
+#include <QFile>
+#include <QHash>
 #include <QLoggingCategory>
+#include <QMetaEnum>
+#include <QMetaMethod>
 #include <QQueue>
 #include <QSaveFile>
 #include <QThread>
 #include <QTimer>
 
+#ifdef Q_OS_UNIX
+#    include <sys/stat.h>
+#endif
+
 #include "SynqClient/abstractjobfactory.h"
+#include "SynqClient/copyjob.h"
+#include "SynqClient/createdirectorybatchjob.h"
 #include "SynqClient/createdirectoryjob.h"
+#include "SynqClient/deletebatchjob.h"
 #include "SynqClient/deletejob.h"
 #include "SynqClient/downloadfilejob.h"
 #include "SynqClient/getfileinfojob.h"
 #include "SynqClient/listfilesjob.h"
+#include "SynqClient/movejob.h"
 #include "SynqClient/syncstatedatabase.h"
+#include "SynqClient/uploadfilebatchjob.h"
 #include "SynqClient/uploadfilejob.h"
+#include "contenthasher.h"
 
 namespace SynqClient {
 
 static Q_LOGGING_CATEGORY(log, "SynqClient.DirectorySynchronizer", QtWarningMsg);
 
+// Files smaller than this are always uploaded - copying them on the server side would not save
+// anything worth computing a fingerprint for:
+static const qint64 MinServerSideCopyFileSize = 64 * 1024;
+
 DirectorySynchronizerPrivate::DirectorySynchronizerPrivate(DirectorySynchronizer* q)
     : QObject(),
       q_ptr(q),
       jobFactory(nullptr),
       syncStateDatabase(nullptr),
+      closeSyncStateDatabase(true),
       localDirectoryPath(),
       remoteDirectoryPath(),
       filter([](const QString&, const FileInfo&) { return true; }),
+      localChangeWatcher(nullptr),
       state(SynchronizerState::Ready),
       error(SynchronizerError::NoError),
       errorString(),
       maxJobs(12),
+      maxMultiplexedJobs(48),
       retryWithFewerJobs(false),
       syncConflictStrategy(SyncConflictStrategy::RemoteWins),
       flags(SynchronizerFlag::DefaultFlags),
       stopped(false),
       progress(-1),
       numTotalSyncActionsToRun(0),
+      progressInterval(100),
+      plannedBytes(0),
+      transferredBytes(0),
+      rateTimer(),
+      rateSampleBytes(0),
+      bytesPerSecond(0.0),
+      reportedProgress(-2),
+      reportedBytes(-1),
+      statisticsInterval(0),
+      statistics(),
+      currentPhase(SynchronizerPhase::CreateRemoteFolder),
+      inPhase(false),
+      phaseTimer(),
+      tracer(nullptr),
+      phaseStartTime(),
+      eventPathIds(),
+      eventPaths(),
       remoteFoldersSyncAttributes(),
       runningJobs(0),
       createdRemoteFolderParts(),
       remoteFolderPartsToCreate(),
       localChangeTree(),
       remoteChangeTree(),
+      localChangeWatcherStateTaken(false),
+      localChangeWatcherFullScan(true),
+      localChangeWatcherDirtyPaths(),
       remoteFoldersToScan(),
+      initialSync(false),
+      remoteFilesToReconcile(),
+      remoteFileIds(),
+      remoteFileIdUpdates(),
       syncActionsToRun(),
       remoteFoldersToCreate(),
       remoteResourcesToDelete()
@@ -78,11 +123,18 @@ DirectorySynchronizerPrivate::DirectorySynchronizerPrivate(DirectorySynchronizer
  * @brief Set up some default job signal/slot connections.
  *
  * This mainly takes care to auto-delete jobs once they are finished as well as making sure that
- * jobs stop executing when the user requests to terminate the sync.
+ * jobs stop executing when the user requests to terminate the sync. In addition, the metrics of
+ * the job are added to the statistics of the sync (and recorded in the tracer, if any) once it
+ * finished.
  */
 void DirectorySynchronizerPrivate::setupDefaultJobSignals(AbstractJob* job)
 {
     connect(this, &DirectorySynchronizerPrivate::stopRequested, job, &AbstractJob::stop);
+    connect(job, &AbstractJob::finished, this,
+            [=]() {
+                statistics.addJob(job->metrics(), job->error());
+                traceJob(job);
+            });
     connect(job, &AbstractJob::finished, job, &QObject::deleteLater);
 }
 
@@ -99,6 +151,111 @@ DirectorySynchronizerPrivate::syncStateListToMap(const QVector<SyncStateEntry>&
     return result;
 }
 
+/**
+ * @brief Get an identifier of the local file @p fileName which is independent of its path.
+ *
+ * On Unix like systems, this is derived from the device and inode number of the file. On other
+ * systems, an empty string is returned.
+ */
+QString DirectorySynchronizerPrivate::localFileId(const QString& fileName)
+{
+#ifdef Q_OS_UNIX
+    struct stat st;
+    if (::stat(QFile::encodeName(fileName).constData(), &st) == 0) {
+        return QString("%1:%2").arg(st.st_dev).arg(st.st_ino);
+    }
+#else
+    Q_UNUSED(fileName);
+#endif
+    return QString();
+}
+
+/**
+ * @brief Create a fingerprint of a file of the given @p size.
+ *
+ * The fingerprint consists of the size of the file and - if the @p fileInfo holds any - the
+ * "best" checksum of the file, e.g. `1234:SHA1:abcd`. The checksum is taken from the transfer
+ * which synced the file (i.e. it has been calculated while streaming the data), so no file needs
+ * to be read here. If no checksum is known, the fingerprint only contains the size.
+ *
+ * @sa parseFingerprint()
+ */
+QString DirectorySynchronizerPrivate::makeFingerprint(qint64 size, const FileInfo& fileInfo)
+{
+    auto algorithm = ContentHasher::preferredAlgorithm(fileInfo.checksums().keys());
+    auto checksum = fileInfo.checksum(algorithm);
+    if (algorithm.isEmpty() || checksum.isEmpty()) {
+        return QString::number(size);
+    }
+    return QString("%1:%2:%3").arg(size).arg(algorithm, checksum);
+}
+
+/**
+ * @brief Split a @p fingerprint created by makeFingerprint() into its parts.
+ *
+ * Fingerprints written by earlier versions (consisting of the size and a SHA-256 checksum) are
+ * understood as well. If the fingerprint holds no checksum, the @p algorithm and @p checksum are
+ * set to empty strings. Returns false if the fingerprint cannot be parsed.
+ */
+bool DirectorySynchronizerPrivate::parseFingerprint(const QString& fingerprint, qint64& size,
+                                                    QString& algorithm, QString& checksum)
+{
+    auto parts = fingerprint.split(":");
+    bool ok = false;
+    size = parts.value(0).toLongLong(&ok);
+    switch (parts.length()) {
+    case 1:
+        algorithm.clear();
+        checksum.clear();
+        break;
+    case 2:
+        algorithm = ContentHasher::SHA256;
+        checksum = parts.at(1);
+        break;
+    case 3:
+        algorithm = parts.at(1);
+        checksum = parts.at(2);
+        break;
+    default:
+        return false;
+    }
+    return ok;
+}
+
+/**
+ * @brief Create a sync state entry for the local file or folder @p path.
+ *
+ * In addition to the given properties, this stores the localFileId() of the local resource in the
+ * entry, which is used to detect local moves and renames. For larger files, a fingerprint (see
+ * makeFingerprint()) is stored as well, so identical files can later be copied on the server side.
+ * Its checksum is taken from the @p fileInfo reported by the job which synced the file. If known,
+ * the ID of the remote resource is stored, too, which is used to detect moves and renames on the
+ * server.
+ */
+SyncStateEntry DirectorySynchronizerPrivate::makeSyncStateEntry(const QString& path,
+                                                                 const QDateTime& lastModified,
+                                                                 const QString& syncProperty,
+                                                                 const FileInfo& fileInfo) const
+{
+    SyncStateEntry entry(path, lastModified, syncProperty);
+    entry.setLocalFileId(localFileId(localDirectoryPath + "/" + path));
+    auto remoteFileId = remoteFileIds.value(path);
+    if (remoteFileId.isEmpty()) {
+        // We did not see the remote resource in this sync - keep the ID we already know of:
+        remoteFileId = syncStateDatabase->getEntry(path).remoteFileId();
+    }
+    entry.setRemoteFileId(remoteFileId);
+    if (lastModified.isValid()) {
+        QFileInfo localFileInfo(localDirectoryPath + "/" + path);
+        // Only store a fingerprint if the file has not been changed since it has been synced:
+        if (localFileInfo.size() >= MinServerSideCopyFileSize
+            && localFileInfo.lastModified() == lastModified) {
+            entry.setFingerprint(makeFingerprint(localFileInfo.size(), fileInfo));
+        }
+    }
+    return entry;
+}
+
 /**
  * @brief Create the next part of the path of a remote folder.
  */
@@ -153,7 +310,36 @@ ChangeTree DirectorySynchronizerPrivate::buildLocalChangeTree()
 {
     ChangeTree result;
     QQueue<QString> paths;
-    paths.enqueue("/");
+
+    // If we have a watcher which tracked local changes, only descend into folders which contain
+    // changes (i.e. the dirty folders themselves and their parents):
+    bool fullScan = true;
+    QSet<QString> foldersToScan;
+    if (localChangeWatcher && localChangeWatcher->running()) {
+        localChangeWatcherFullScan = localChangeWatcher->fullScanRequired();
+        localChangeWatcherDirtyPaths = localChangeWatcher->dirtyPaths();
+        localChangeWatcherStateTaken = true;
+        localChangeWatcher->clear();
+        fullScan = localChangeWatcherFullScan;
+        for (const auto& dirtyPath : qAsConst(localChangeWatcherDirtyPaths)) {
+            auto folder = dirtyPath;
+            while (!foldersToScan.contains(folder)) {
+                foldersToScan.insert(folder);
+                auto index = folder.lastIndexOf("/");
+                if (index <= 0) {
+                    foldersToScan.insert("/");
+                    break;
+                }
+                folder = folder.left(index);
+            }
+        }
+        qCDebug(log) << "Local change watcher reports" << localChangeWatcherDirtyPaths.size()
+                     << "dirty folders - full scan required:" << fullScan;
+    }
+
+    if (fullScan || foldersToScan.contains("/")) {
+        paths.enqueue("/");
+    }
     while (!paths.isEmpty()) {
         auto path = paths.dequeue();
         bool innerOk;
@@ -178,8 +364,10 @@ ChangeTree DirectorySynchronizerPrivate::buildLocalChangeTree()
             }
             if (previousEntriesMap.contains(entryPath)) {
                 if (entry.isDir()) {
-                    paths.enqueue(entryPath); // We need to go into sub-folders to find out if
-                                              // something changed. Enqueue the path.
+                    if (fullScan || foldersToScan.contains(entryPath)) {
+                        paths.enqueue(entryPath); // We need to go into sub-folders to find out if
+                                                  // something changed. Enqueue the path.
+                    }
                 } else {
                     QFileInfo fi(entry.absoluteFilePath());
                     auto previousEntry = previousEntriesMap.value(entryPath);
@@ -232,6 +420,8 @@ void DirectorySynchronizerPrivate::buildRemoteChangeTree()
         buildRemoteChangeTreeWebDAVLike();
         break;
     case RemoteChangeDetectionMode::RootFolderSyncStream:
+    case RemoteChangeDetectionMode::SyncCollection:
+        // The sync token of a sync-collection report is used just like a cursor:
         buildRemoteChangeTreeDropboxLike();
         break;
     }
@@ -240,7 +430,7 @@ void DirectorySynchronizerPrivate::buildRemoteChangeTree()
 void DirectorySynchronizerPrivate::buildRemoteChangeTreeWebDAVLike()
 {
     while (!remoteFoldersToScan.isEmpty() && error == SynchronizerError::NoError
-           && runningJobs < maxJobs) {
+           && runningJobs < effectiveMaxJobs()) {
         auto nextRemoteFolder = remoteFoldersToScan.dequeue();
         qCDebug(log) << "Scanning" << nextRemoteFolder << "for changes";
         auto job = jobFactory->listFiles(this);
@@ -286,6 +476,10 @@ void DirectorySynchronizerPrivate::buildRemoteChangeTreeWebDAVLike()
                             continue;
                         }
 
+                        if (!remoteEntry.fileId().isEmpty()) {
+                            remoteFileIds[remoteEntryPath] = remoteEntry.fileId();
+                        }
+
                         auto previousRemoteEntry = previousEntriesMap.value(remoteEntryPath);
                         if (previousRemoteEntry.syncProperty() != remoteEntry.syncAttribute()
                             || previousRemoteEntry.syncProperty().isEmpty()
@@ -302,10 +496,20 @@ void DirectorySynchronizerPrivate::buildRemoteChangeTreeWebDAVLike()
                             }
                             if (previousRemoteEntry.syncProperty().isEmpty()) {
                                 node->change = ChangeTree::Created;
+                                if (initialSync && remoteEntry.isFile()) {
+                                    remoteFilesToReconcile[remoteEntryPath] = remoteEntry;
+                                }
                             } else {
                                 node->change = ChangeTree::Changed;
                             }
                             node->syncAttribute = remoteEntry.syncAttribute();
+                            node->size = remoteEntry.size();
+                        } else if (!remoteEntry.fileId().isEmpty()
+                                   && previousRemoteEntry.remoteFileId() != remoteEntry.fileId()) {
+                            // The entry is unchanged, but we did not know its ID yet:
+                            auto entry = previousRemoteEntry;
+                            entry.setRemoteFileId(remoteEntry.fileId());
+                            remoteFileIdUpdates << entry;
                         }
                     }
 
@@ -379,6 +583,9 @@ void DirectorySynchronizerPrivate::buildRemoteChangeTreeDropboxLike()
                 if (!filter(SyncStateEntry::makePath(entryPath), entry)) {
                     continue;
                 }
+                if (!entry.isDeleted() && !entry.fileId().isEmpty()) {
+                    remoteFileIds[SyncStateEntry::makePath(entryPath)] = entry.fileId();
+                }
                 if (entry.isFile()) {
                     auto lastSyncStateEntry = syncStateDatabase->getEntry(entry.path());
                     if (!lastSyncStateEntry.isValid()
@@ -388,12 +595,20 @@ void DirectorySynchronizerPrivate::buildRemoteChangeTreeDropboxLike()
                         node->change = ChangeTree::Created;
                         node->type = ChangeTree::File;
                         node->syncAttribute = entry.syncAttribute();
+                        node->size = entry.size();
                         // Check if this is a known entry - i.e. we have a change instead of a
                         // create:
                         if (lastSyncStateEntry.isValid()
                             && !lastSyncStateEntry.syncProperty().isEmpty()) {
                             node->change = ChangeTree::Changed;
+                        } else if (initialSync) {
+                            remoteFilesToReconcile[SyncStateEntry::makePath(entryPath)] = entry;
                         }
+                    } else if (!entry.fileId().isEmpty()
+                               && lastSyncStateEntry.remoteFileId() != entry.fileId()) {
+                        // The file is unchanged, but we did not know its ID yet:
+                        lastSyncStateEntry.setRemoteFileId(entry.fileId());
+                        remoteFileIdUpdates << lastSyncStateEntry;
                     }
                 } else if (entry.isDeleted()) {
                     auto node = remoteChangeTree.findNode(entry.path(), ChangeTree::FindAndCreate);
@@ -408,6 +623,13 @@ void DirectorySynchronizerPrivate::buildRemoteChangeTreeDropboxLike()
                                 remoteChangeTree.findNode(entry.path(), ChangeTree::FindAndCreate);
                         node->change = ChangeTree::Created;
                         node->type = ChangeTree::Folder;
+                    } else if (!entry.fileId().isEmpty()) {
+                        auto lastSyncStateEntry = syncStateDatabase->getEntry(entry.path());
+                        if (lastSyncStateEntry.isValid()
+                            && lastSyncStateEntry.remoteFileId() != entry.fileId()) {
+                            lastSyncStateEntry.setRemoteFileId(entry.fileId());
+                            remoteFileIdUpdates << lastSyncStateEntry;
+                        }
                     }
                 }
             }
@@ -419,7 +641,6 @@ void DirectorySynchronizerPrivate::buildRemoteChangeTreeDropboxLike()
                 for (const auto& entry : entries) {
                     allRemoteEntries.insert(SyncStateEntry::makePath(entry.path()));
                 }
-                qCWarning(log) << "All remote entries:" << allRemoteEntries;
                 syncStateDatabase->iterate([&](const SyncStateEntry& dbEntry) {
                     if (dbEntry.path() == "/") {
                         // Do not consider the root folder - might not be included in remote
@@ -427,15 +648,13 @@ void DirectorySynchronizerPrivate::buildRemoteChangeTreeDropboxLike()
                         return;
                     }
                     if (!allRemoteEntries.contains(dbEntry.path())) {
-                        qCWarning(log) << "Marking" << dbEntry.path() << "as deleted";
+                        qCDebug(log) << "Marking" << dbEntry.path() << "as deleted";
                         // The entry could not be found in the DB, so assume it has been deleted on
                         // the server side. Hence, we're going to delete it:
                         auto node = remoteChangeTree.findNode(dbEntry.path(),
                                                               ChangeTree::FindAndCreate);
                         node->change = ChangeTree::Deleted;
                         node->syncAttribute = dbEntry.syncProperty();
-                    } else {
-                        qCWarning(log) << "Entry" << dbEntry.path() << "found remotely - all fine";
                     }
                 });
             }
@@ -459,10 +678,17 @@ void DirectorySynchronizerPrivate::buildRemoteChangeTreeDropboxLike()
  */
 void DirectorySynchronizerPrivate::mergeChangeTrees()
 {
+    enterPhase(SynchronizerPhase::Merge);
     QQueue<QString> paths;
     localChangeTree.dump("Local Change Tree");
     remoteChangeTree.dump("Remote Change Tree");
 
+    reconcileInitialSync();
+    updateRemoteFileIds();
+    if (error != SynchronizerError::NoError) {
+        return;
+    }
+
     // Normalize change trees:
     localChangeTree.normalize();
     remoteChangeTree.normalize();
@@ -490,7 +716,13 @@ void DirectorySynchronizerPrivate::mergeChangeTrees()
         }
     }
 
-    numTotalSyncActionsToRun = syncActionsToRun.length();
+    if (error == SynchronizerError::NoError) {
+        detectLocalMoves();
+        detectRemoteMoves();
+        detectRemoteCopies();
+    }
+
+    addPlannedActions(syncActionsToRun);
     updateProgress();
 
     if (error == SynchronizerError::NoError) {
@@ -498,6 +730,66 @@ void DirectorySynchronizerPrivate::mergeChangeTrees()
     }
 }
 
+/**
+ * @brief Adopt files which already are identical locally and remotely on the first sync.
+ *
+ * If we sync for the first time (i.e. the sync state database is empty), files present on both
+ * sides are considered to be created on both sides. Depending on the conflict strategy, this would
+ * cause them to be downloaded or uploaded again - even if they already are identical.
+ *
+ * To avoid this, we compare the size and checksums reported by the server with the local files.
+ * If one of the checksums we can calculate locally matches, the file is written directly into the
+ * sync state database and no further action is taken for it.
+ */
+void DirectorySynchronizerPrivate::reconcileInitialSync()
+{
+    Q_Q(DirectorySynchronizer);
+    int numReconciled = 0;
+    for (auto it = remoteFilesToReconcile.cbegin(); it != remoteFilesToReconcile.cend(); ++it) {
+        const auto& path = it.key();
+        const auto& remoteEntry = it.value();
+        auto localNode = localChangeTree.findNode(path);
+        auto remoteNode = remoteChangeTree.findNode(path);
+        if (!localNode || !remoteNode || localNode->type != ChangeTree::File
+            || localNode->change != ChangeTree::Created || remoteNode->type != ChangeTree::File
+            || remoteNode->change != ChangeTree::Created) {
+            continue;
+        }
+        QFileInfo fileInfo(localDirectoryPath + "/" + path);
+        if (remoteEntry.size() >= 0 && remoteEntry.size() != fileInfo.size()) {
+            continue;
+        }
+
+        // Compare using the "best" checksum reported by the server:
+        auto algorithm = ContentHasher::preferredAlgorithm(remoteEntry.checksums().keys());
+        if (algorithm.isEmpty()
+            || ContentHasher::hashFile(fileInfo.absoluteFilePath(), algorithm)
+                    != remoteEntry.checksum(algorithm)) {
+            continue;
+        }
+
+        qCDebug(log) << "File" << path << "is identical locally and remotely";
+        if (!syncStateDatabase->addEntry(makeSyncStateEntry(path, localNode->lastModified,
+                                                            remoteEntry.syncAttribute(),
+                                                            remoteEntry))) {
+            setError(SynchronizerError::SyncStateDatabaseWriteFailed,
+                     tr("Failed to write to the sync state database"), JobError::NoError);
+            return;
+        }
+        localNode->change = ChangeTree::Unknown;
+        remoteNode->change = ChangeTree::Unknown;
+        ++numReconciled;
+    }
+    remoteFilesToReconcile.clear();
+
+    if (numReconciled > 0) {
+        emit q->logMessageAvailable(
+                SynchronizerLogEntryType::Information,
+                tr("Found %1 files which are already identical locally and remotely")
+                        .arg(numReconciled));
+    }
+}
+
 void DirectorySynchronizerPrivate::mergeChangeNodes(const QString& path,
                                                     const ChangeTreeNode* localChange,
                                                     const ChangeTreeNode* remoteChange)
@@ -853,154 +1145,881 @@ void DirectorySynchronizerPrivate::mergeChangeNodesRemoteWins(const QString& pat
     }
 }
 
-void DirectorySynchronizerPrivate::addSyncAction(SyncAction* action)
+/**
+ * @brief Store the IDs of remote resources which we learned about during the remote scan.
+ *
+ * Resources which have been synced before the backend reported IDs (or before we stored them)
+ * get their IDs written into the sync state database here. Changed resources get them written
+ * when they are synced.
+ */
+void DirectorySynchronizerPrivate::updateRemoteFileIds()
 {
-    syncActionsToRun << QSharedPointer<SyncAction>(action);
+    for (const auto& entry : qAsConst(remoteFileIdUpdates)) {
+        if (!syncStateDatabase->addEntry(entry)) {
+            setError(SynchronizerError::SyncStateDatabaseWriteFailed,
+                     tr("Failed to write to the sync state database"), JobError::NoError);
+            break;
+        }
+    }
+    remoteFileIdUpdates.clear();
 }
 
 /**
- * @brief Run any local actions that do not require server interaction.
+ * @brief Replace local deletions and downloads by moves where possible.
+ *
+ * If files or folders have been moved or renamed on the server, the sync plan contains actions to
+ * delete the previously synced resources locally and to download them again at their new
+ * location. This method matches such deletions with new remote resources using the stable IDs
+ * the server assigned to them (see SyncStateEntry::remoteFileId()) and replaces them with a move
+ * of the local resource.
+ *
+ * Only resources which are unchanged locally are moved. Downloads of files within a moved folder
+ * are dropped if the file is unchanged on the server. Other actions within the new location (e.g.
+ * downloading files changed on the server) are still run after the move. Resources which have
+ * been removed from a moved folder on the server are deleted locally after the move.
  */
-void DirectorySynchronizerPrivate::runLocalActions()
+void DirectorySynchronizerPrivate::detectLocalMoves()
 {
-    Q_Q(DirectorySynchronizer);
-    decltype(syncActionsToRun) remainingSyncActions;
+    if (remoteFileIds.isEmpty()) {
+        return;
+    }
+
+    auto isSameOrBelow = [](const QString& path, const QString& parent) {
+        return path == parent || path.startsWith(parent + "/");
+    };
+
+    // Previously synced resources which are deleted locally (including everything below deleted
+    // folders) are move sources, remote resources which do not exist locally are move targets:
+    QHash<QString, SyncStateEntry> sources;
+    QHash<QString, QString> sourcesByRemoteFileId;
+    QMap<QString, QSharedPointer<SyncAction>> targets;
     for (const auto& action : qAsConst(syncActionsToRun)) {
         switch (action->type) {
-        case MkDirLocal: {
-            qCDebug(log) << "Creating local folder" << action->path;
-            emit q->logMessageAvailable(SynchronizerLogEntryType::LocalMkDir, action->path);
-            QDir dir(localDirectoryPath + "/" + action->path);
-            if (!dir.mkpath(".")) {
-                setError(SynchronizerError::FailedCreatingLocalFolder,
-                         tr("Creating folder %1 has failed").arg(dir.absolutePath()),
-                         JobError::NoError);
-                return;
+        case DeleteLocal: {
+            if (!qSharedPointerCast<DeleteLocalSyncAction>(action)->previousSyncEntry.isValid()) {
+                break;
             }
-            remoteFoldersSyncAttributes[action->path] =
-                    qSharedPointerCast<MkDirLocalSyncAction>(action)->syncAttribute;
+            auto localNode = localChangeTree.findNode(action->path);
+            if (localNode && ChangeTree::hasAnyChange(*localNode)) {
+                break;
+            }
+            auto addSource = [&](const SyncStateEntry& entry) {
+                sources[entry.path()] = entry;
+                if (!entry.remoteFileId().isEmpty()) {
+                    sourcesByRemoteFileId[entry.remoteFileId()] = entry.path();
+                }
+            };
+            addSource(syncStateDatabase->getEntry(action->path));
+            syncStateDatabase->iterate(addSource, action->path);
             break;
         }
-        case DeleteLocal:
-            qCDebug(log) << "Deleting local resource" << action->path;
-            emit q->logMessageAvailable(SynchronizerLogEntryType::LocalDelete, action->path);
-
-            if (!deleteLocally(action->path)) {
-                return;
-            } else {
-                if (!syncStateDatabase->removeEntries(action->path)
-                    || !syncStateDatabase->removeEntry(action->path)) {
-                    setError(SynchronizerError::SyncStateDatabaseDeleteFailed,
-                             tr("Failed to delete entries from the sync state database"),
-                             JobError::NoError);
-                    return;
-                }
+        case Download:
+            if (!qSharedPointerCast<DownloadSyncAction>(action)->previousSyncEntry.isValid()
+                && !QFileInfo::exists(localDirectoryPath + "/" + action->path)) {
+                targets[action->path] = action;
             }
             break;
-        case Upload:
-        case Download:
-        case MkDirRemote:
-        case DeleteRemote:
-            // Nothing to do for now
-            remainingSyncActions << action;
+        case MkDirLocal:
+            if (!QFileInfo::exists(localDirectoryPath + "/" + action->path)) {
+                targets[action->path] = action;
+            }
+            break;
+        default:
             break;
         }
     }
 
-    syncActionsToRun = remainingSyncActions;
-}
-
-void DirectorySynchronizerPrivate::runRemoteActions()
-{
-    if (error != SynchronizerError::NoError) {
-        finishLater();
+    if (sourcesByRemoteFileId.isEmpty() || targets.isEmpty()) {
         return;
     }
 
-    updateProgress();
+    // As targets are sorted, we visit parent folders before their children:
+    QVector<QSharedPointer<MoveLocalSyncAction>> moves;
+    for (auto it = targets.cbegin(); it != targets.cend(); ++it) {
+        const auto& targetPath = it.key();
+        auto sourcePath = sourcesByRemoteFileId.value(remoteFileIds.value(targetPath));
+        if (sourcePath.isEmpty() || !QFileInfo::exists(localDirectoryPath + "/" + sourcePath)) {
+            continue;
+        }
+        auto source = sources.value(sourcePath);
+        // Folders are stored without a modification time in the sync state database:
+        auto sourceIsFolder = !source.modificationTime().isValid();
+        if (sourceIsFolder != (it.value()->type == MkDirLocal)) {
+            continue;
+        }
+        bool overlaps = false;
+        for (const auto& move : qAsConst(moves)) {
+            if (isSameOrBelow(sourcePath, move->sourcePath)
+                || isSameOrBelow(targetPath, move->path)) {
+                // Already covered by moving one of the parent folders:
+                overlaps = true;
+                break;
+            }
+        }
+        if (overlaps) {
+            continue;
+        }
+        moves << QSharedPointer<MoveLocalSyncAction>(
+                new MoveLocalSyncAction(sourcePath, targetPath, source));
+    }
 
-    if (runningJobs >= maxJobs) {
+    if (moves.isEmpty()) {
         return;
     }
 
-    decltype(syncActionsToRun) remainingSyncActions;
-    for (const auto& action : qAsConst(syncActionsToRun)) {
-        if (!canRunAction(action)) {
-            remainingSyncActions << action;
+    // The deletions of the moved resources are replaced below. Resources which are not present in
+    // a moved folder on the server anymore must be deleted at their new location instead:
+    QVector<QSharedPointer<SyncAction>> deletions;
+    for (const auto& move : qAsConst(moves)) {
+        auto targetNode = remoteChangeTree.findNode(move->path);
+        if (!targetNode || targetNode->change != ChangeTree::Created) {
             continue;
         }
+        QStringList sourcePaths;
+        for (auto it = sources.cbegin(); it != sources.cend(); ++it) {
+            if (it.key().startsWith(move->sourcePath + "/")) {
+                sourcePaths << it.key();
+            }
+        }
+        // Parent folders are sorted before their children:
+        std::sort(sourcePaths.begin(), sourcePaths.end());
+        QStringList deletedPaths;
+        for (const auto& sourcePath : qAsConst(sourcePaths)) {
+            auto targetPath = move->path + sourcePath.mid(move->sourcePath.length());
+            if (remoteChangeTree.findNode(targetPath) != nullptr) {
+                continue;
+            }
+            auto alreadyDeleted = std::any_of(
+                    deletedPaths.cbegin(), deletedPaths.cend(),
+                    [&](const QString& path) { return isSameOrBelow(targetPath, path); });
+            if (alreadyDeleted) {
+                continue;
+            }
+            auto entry = sources.value(sourcePath);
+            entry.setPath(targetPath);
+            deletions << QSharedPointer<SyncAction>(new DeleteLocalSyncAction(targetPath, entry));
+            deletedPaths << targetPath;
+        }
+    }
 
-        if (runningJobs >= maxJobs) {
+    // Replace the deletions of the moved resources as well as the downloads of files which are
+    // unchanged after the move:
+    decltype(syncActionsToRun) remainingSyncActions;
+    for (const auto& action : qAsConst(syncActionsToRun)) {
+        QSharedPointer<MoveLocalSyncAction> replacingMove;
+        for (const auto& move : qAsConst(moves)) {
+            if (action->type == DeleteLocal && isSameOrBelow(action->path, move->sourcePath)) {
+                replacingMove = move;
+            } else if (action->type == Download && isSameOrBelow(action->path, move->path)) {
+                auto download = qSharedPointerCast<DownloadSyncAction>(action);
+                auto sourcePath = move->sourcePath + action->path.mid(move->path.length());
+                auto source = sources.value(sourcePath);
+                if (source.isValid() && source.syncProperty() == download->syncAttribute) {
+                    replacingMove = move;
+                }
+            }
+            if (!replacingMove.isNull()) {
+                break;
+            }
+        }
+        if (replacingMove.isNull()) {
             remainingSyncActions << action;
-            continue;
+        } else {
+            replacingMove->fallbackActions << action;
         }
+    }
 
-        runRemoteAction(action);
+    // Moves are run before any other action, so the remaining actions within the moved folders
+    // operate on the moved resources:
+    syncActionsToRun.clear();
+    for (const auto& move : qAsConst(moves)) {
+        syncActionsToRun << move;
     }
+    syncActionsToRun << deletions;
+    syncActionsToRun << remainingSyncActions;
+}
 
-    if (remainingSyncActions.length() == syncActionsToRun.length() && runningJobs <= 0
-        && !syncActionsToRun.isEmpty()) {
-        setError(SynchronizerError::Stuck, tr("Cannot continue sync - it is stuck"),
-                 JobError::NoError);
+/**
+ * @brief Replace remote deletions and uploads by moves where possible.
+ *
+ * If files or folders have been moved or renamed locally, the sync plan contains actions to
+ * delete the previously synced resources remotely and to upload them again at their new
+ * location. If the job factory supports moving remote resources, this method tries to match
+ * such deletions with new local resources and replaces them with a single move of the remote
+ * resource.
+ *
+ * A new local resource is considered to be a moved one if its localFileId() matches the one
+ * stored in the sync state database. If this is not known, the name (and for files the
+ * modification time) must match instead. Folders are only moved if at least one file within
+ * them is unchanged at the new location. In addition, the remote resource must not have been
+ * changed since the last sync.
+ *
+ * Remaining changes within a moved folder are applied after the move. If the move fails because
+ * the remote changed in the meantime, the original actions are run instead.
+ */
+void DirectorySynchronizerPrivate::detectRemoteMoves()
+{
+    if (syncActionsToRun.isEmpty()) {
         return;
     }
 
-    syncActionsToRun = remainingSyncActions;
+    {
+        // Only continue if the backend supports moving resources at all:
+        QScopedPointer<MoveJob> job(jobFactory->moveResource());
+        if (!job) {
+            return;
+        }
+    }
 
-    if (syncActionsToRun.isEmpty() && runningJobs <= 0) {
-        if (error == SynchronizerError::NoError) {
-            // Safe remote folder sync attributes. This only is done if we don't have any errors.
-            // This will e.g. cause us to download/upload again in case we have failed transfers.
-            // Otherwise, we won't re-detect remote changes (as we only compare the parent folders'
-            // sync attributes).
-            for (auto it = remoteFoldersSyncAttributes.cbegin();
-                 it != remoteFoldersSyncAttributes.cend(); ++it) {
-                if (!syncStateDatabase->addEntry(
-                            SyncStateEntry(it.key(), QDateTime(), it.value()))) {
-                    setError(SynchronizerError::SyncStateDatabaseWriteFailed,
-                             tr("Failed to write folder sync attribute to sync state database"),
-                             JobError::NoError);
-                    break;
+    auto fileName = [](const QString& path) { return path.mid(path.lastIndexOf("/") + 1); };
+
+    // Deletions of previously synced and remotely unchanged resources are move sources, new
+    // local resources which do not exist remotely are move targets:
+    QMap<QString, QSharedPointer<DeleteRemoteSyncAction>> sources;
+    QMap<QString, QSharedPointer<SyncAction>> targets;
+    QHash<QString, QString> sourcesByLocalFileId;
+    QMultiHash<QString, QString> sourcesByName;
+    QMultiHash<qint64, QString> sourcesByModificationTime;
+    for (const auto& action : qAsConst(syncActionsToRun)) {
+        auto remoteNode = remoteChangeTree.findNode(action->path);
+        switch (action->type) {
+        case DeleteRemote: {
+            auto deleteAction = qSharedPointerCast<DeleteRemoteSyncAction>(action);
+            const auto& entry = deleteAction->previousSyncEntry;
+            if (entry.isValid() && (!remoteNode || !ChangeTree::hasAnyChange(*remoteNode))) {
+                sources[action->path] = deleteAction;
+                if (!entry.localFileId().isEmpty()) {
+                    sourcesByLocalFileId[entry.localFileId()] = action->path;
+                }
+                sourcesByName.insert(fileName(action->path), action->path);
+                if (entry.modificationTime().isValid()) {
+                    sourcesByModificationTime.insert(entry.modificationTime().toMSecsSinceEpoch(),
+                                                     action->path);
                 }
             }
+            break;
+        }
+        case Upload:
+            if (!qSharedPointerCast<UploadSyncAction>(action)->previousSyncEntry.isValid()
+                && !remoteNode) {
+                targets[action->path] = action;
+            }
+            break;
+        case MkDirRemote:
+            if (!remoteNode) {
+                targets[action->path] = action;
+            }
+            break;
+        default:
+            break;
         }
-        finishLater();
     }
-}
 
-bool DirectorySynchronizerPrivate::deleteLocally(const QString& path)
-{
-    auto fullPath = QDir::cleanPath(localDirectoryPath + "/" + path);
-    QFileInfo fi(fullPath);
-    if (fi.isFile()) {
-        QFile file(fullPath);
-        if (file.exists() && !file.remove()) {
-            setError(SynchronizerError::FailedDeletingLocalFile,
-                     tr("Failed deleting local file %1: %2")
-                             .arg(fi.absolutePath(), file.errorString()),
-                     JobError::NoError);
-            return false;
+    if (sources.isEmpty() || targets.isEmpty()) {
+        return;
+    }
+
+    auto isSameOrBelow = [](const QString& path, const QString& parent) {
+        return path == parent || path.startsWith(parent + "/");
+    };
+
+    // Folders first - moving a folder implicitly moves all of its contents. As targets are
+    // sorted, we visit parent folders before their children:
+    const auto targetPaths = targets.keys();
+    for (const auto& targetPath : targetPaths) {
+        auto target = targets.value(targetPath);
+        if (target.isNull() || target->type != MkDirRemote) {
+            continue;
         }
-    } else {
-        QDir dir(fullPath);
-        if (dir.exists()) {
-            {
-                QDirIterator it(fullPath, QDir::Files | QDir::Dirs | QDir::NoDotAndDotDot,
-                                QDirIterator::Subdirectories);
-                while (it.hasNext()) {
-                    qCWarning(log) << it.next();
+        auto id = localFileId(localDirectoryPath + "/" + targetPath);
+        QStringList candidates;
+        if (!id.isEmpty() && sources.contains(sourcesByLocalFileId.value(id))) {
+            candidates << sourcesByLocalFileId.value(id);
+        } else {
+            for (const auto& sourcePath : sourcesByName.values(fileName(targetPath))) {
+                auto source = sources.value(sourcePath);
+                if (!source.isNull()
+                    && (id.isEmpty() || source->previousSyncEntry.localFileId().isEmpty())) {
+                    candidates << sourcePath;
                 }
             }
-            {
-                QDirIterator it(fullPath, QDir::Files, QDirIterator::Subdirectories);
-                while (it.hasNext()) {
-                    auto next = it.next();
-                    auto entryPath =
-                            SyncStateEntry::makePath("/" + path + "/" + dir.relativeFilePath(next));
-                    if (filter(entryPath, FileInfo::fromLocalFile(next))) {
-                        QFile file(next);
-                        if (!file.remove()) {
-                            setError(SynchronizerError::FailedDeletingLocalFile,
+        }
+
+        QSharedPointer<MoveRemoteSyncAction> move;
+        int bestScore = 0;
+        for (const auto& sourcePath : qAsConst(candidates)) {
+            int score = 0;
+            auto candidateMove = planRemoteFolderMove(sourcePath, targetPath, targets, score);
+            if (!candidateMove.isNull() && score > bestScore) {
+                move = candidateMove;
+                bestScore = score;
+            }
+        }
+        if (move.isNull()) {
+            continue;
+        }
+
+        // Replace all actions in the source and target folder by the move:
+        decltype(syncActionsToRun) remainingSyncActions;
+        for (const auto& action : qAsConst(syncActionsToRun)) {
+            if (action->type == DeleteRemote && isSameOrBelow(action->path, move->sourcePath)) {
+                move->fallbackActions << action;
+                sources.remove(action->path);
+            } else if (isSameOrBelow(action->path, targetPath)) {
+                move->fallbackActions << action;
+                targets.remove(action->path);
+            } else {
+                remainingSyncActions << action;
+            }
+        }
+        remainingSyncActions << move;
+        syncActionsToRun = remainingSyncActions;
+    }
+
+    // Now check if there are files which have been moved on their own:
+    for (auto it = targets.cbegin(); it != targets.cend(); ++it) {
+        if (it.value()->type != Upload) {
+            continue;
+        }
+        auto upload = qSharedPointerCast<UploadSyncAction>(it.value());
+        auto id = localFileId(localDirectoryPath + "/" + it.key());
+        QSharedPointer<DeleteRemoteSyncAction> source;
+        const auto sourcePaths =
+                sourcesByModificationTime.values(upload->lastModified.toMSecsSinceEpoch());
+        for (const auto& sourcePath : sourcePaths) {
+            auto candidate = sources.value(sourcePath);
+            if (candidate.isNull()) {
+                continue;
+            }
+            auto sourceId = candidate->previousSyncEntry.localFileId();
+            if (!id.isEmpty() && !sourceId.isEmpty()) {
+                if (id != sourceId) {
+                    continue;
+                }
+            } else if (fileName(sourcePath) != fileName(it.key())) {
+                continue;
+            }
+            source = candidate;
+            break;
+        }
+        if (source.isNull()) {
+            continue;
+        }
+
+        sources.remove(source->path);
+        auto move = QSharedPointer<MoveRemoteSyncAction>(
+                new MoveRemoteSyncAction(source->path, it.key(), source->previousSyncEntry));
+        move->fallbackActions << source << it.value();
+        syncActionsToRun.removeOne(source);
+        syncActionsToRun.removeOne(it.value());
+        syncActionsToRun << move;
+    }
+}
+
+/**
+ * @brief Check if the previously synced folder @p sourcePath can be moved to @p targetPath.
+ *
+ * If so, a move action is returned which carries the actions required to apply the remaining
+ * changes within the folder after the move as follow up actions. The @p score is set to the
+ * number of files which are unchanged at the new location. If the folder cannot be moved (e.g.
+ * because the type of some of its contents changed), a null pointer is returned.
+ */
+QSharedPointer<MoveRemoteSyncAction> DirectorySynchronizerPrivate::planRemoteFolderMove(
+        const QString& sourcePath, const QString& targetPath,
+        const QMap<QString, QSharedPointer<SyncAction>>& targets, int& score)
+{
+    QVector<SyncStateEntry> entries;
+    QSet<QString> folders;
+    if (!syncStateDatabase->iterate(
+                [&](const SyncStateEntry& entry) {
+                    entries << entry;
+                    folders.insert(entry.path().left(entry.path().lastIndexOf("/")));
+                },
+                sourcePath)) {
+        return {};
+    }
+
+    QSharedPointer<MoveRemoteSyncAction> move;
+    score = 0;
+    QSet<QString> handledTargets;
+    for (const auto& entry : qAsConst(entries)) {
+        if (entry.path() == sourcePath) {
+            move = QSharedPointer<MoveRemoteSyncAction>(
+                    new MoveRemoteSyncAction(sourcePath, targetPath, entry));
+            continue;
+        }
+        auto path = targetPath + entry.path().mid(sourcePath.length());
+        auto movedEntry = entry;
+        movedEntry.setPath(path);
+        // Folders are stored without a modification time in the sync state database:
+        auto isFolder = folders.contains(entry.path()) || !entry.modificationTime().isValid();
+        auto target = targets.value(path);
+        if (target.isNull()) {
+            if (QFileInfo::exists(localDirectoryPath + "/" + path)) {
+                // The resource exists locally but is not a move target - don't touch it:
+                return {};
+            }
+            // The resource has been deleted locally - delete it after moving:
+            move->followUpActions << QSharedPointer<SyncAction>(
+                    new DeleteRemoteSyncAction(path, movedEntry));
+            continue;
+        }
+        handledTargets.insert(path);
+        if (isFolder != (target->type == MkDirRemote)) {
+            // The type changed - run the original actions instead:
+            return {};
+        }
+        if (!isFolder) {
+            auto upload = qSharedPointerCast<UploadSyncAction>(target);
+            if (upload->lastModified == entry.modificationTime()) {
+                // The file is unchanged - moving it is sufficient:
+                ++score;
+            } else {
+                move->followUpActions << QSharedPointer<SyncAction>(
+                        new UploadSyncAction(path, movedEntry, upload->lastModified));
+            }
+        }
+    }
+
+    if (move.isNull() || score == 0) {
+        return {};
+    }
+
+    // Newly created resources within the folder are uploaded after the move:
+    auto prefix = targetPath + "/";
+    for (auto it = targets.lowerBound(prefix); it != targets.cend() && it.key().startsWith(prefix);
+         ++it) {
+        if (!handledTargets.contains(it.key())) {
+            move->followUpActions << it.value();
+        }
+    }
+    return move;
+}
+
+/**
+ * @brief Replace uploads of files by server side copies where possible.
+ *
+ * If a new local file has the same content as a file we synced before (see makeFingerprint()), the
+ * remote copy of the latter is copied on the server side instead of uploading the data again. This
+ * is only done if the job factory supports copying and the source file is neither changed remotely
+ * nor touched by any other action of this sync.
+ */
+void DirectorySynchronizerPrivate::detectRemoteCopies()
+{
+    QVector<int> uploads;
+    QSet<QString> changedPaths;
+    QSet<QString> removedPaths;
+    for (int i = 0; i < syncActionsToRun.length(); ++i) {
+        const auto& action = syncActionsToRun.at(i);
+        changedPaths.insert(action->path);
+        switch (action->type) {
+        case Upload:
+            if (!qSharedPointerCast<UploadSyncAction>(action)->previousSyncEntry.isValid()) {
+                uploads << i;
+            }
+            break;
+        case DeleteRemote:
+            removedPaths.insert(action->path);
+            break;
+        case MoveRemote: {
+            auto move = qSharedPointerCast<MoveRemoteSyncAction>(action);
+            removedPaths.insert(move->sourcePath);
+            for (const auto& followUp : qAsConst(move->followUpActions)) {
+                changedPaths.insert(followUp->path);
+            }
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    if (uploads.isEmpty()) {
+        return;
+    }
+
+    {
+        // Only continue if the backend supports copying resources at all:
+        QScopedPointer<CopyJob> job(jobFactory->copyResource());
+        if (!job) {
+            return;
+        }
+    }
+
+    // Index all files we know a fingerprint of by their size:
+    QMultiHash<qint64, SyncStateEntry> entriesBySize;
+    if (!syncStateDatabase->iterate(
+                [&](const SyncStateEntry& entry) {
+                    if (!entry.fingerprint().isEmpty()) {
+                        entriesBySize.insert(entry.fingerprint().section(":", 0, 0).toLongLong(),
+                                             entry);
+                    }
+                },
+                "/")) {
+        return;
+    }
+    if (entriesBySize.isEmpty()) {
+        return;
+    }
+
+    auto isUnchanged = [&](const QString& path) {
+        if (changedPaths.contains(path)) {
+            return false;
+        }
+        auto remoteNode = remoteChangeTree.findNode(path);
+        if (remoteNode && ChangeTree::hasAnyChange(*remoteNode)) {
+            return false;
+        }
+        for (auto parent = path; !parent.isEmpty();
+             parent = parent.left(parent.lastIndexOf("/"))) {
+            if (removedPaths.contains(parent)) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    for (auto index : qAsConst(uploads)) {
+        auto upload = qSharedPointerCast<UploadSyncAction>(syncActionsToRun.at(index));
+        QFileInfo fileInfo(localDirectoryPath + "/" + upload->path);
+        if (fileInfo.size() < MinServerSideCopyFileSize
+            || !entriesBySize.contains(fileInfo.size())) {
+            continue;
+        }
+        // Files are only hashed once there is a candidate of the same size, and at most once per
+        // algorithm:
+        QHash<QString, QString> checksums;
+        auto checksumOf = [&](const QString& algorithm) {
+            auto it = checksums.find(algorithm);
+            if (it == checksums.end()) {
+                it = checksums.insert(
+                        algorithm, ContentHasher::hashFile(fileInfo.absoluteFilePath(), algorithm));
+            }
+            return it.value();
+        };
+        const auto candidates = entriesBySize.values(fileInfo.size());
+        for (const auto& entry : candidates) {
+            qint64 size;
+            QString algorithm;
+            QString checksum;
+            if (!isUnchanged(entry.path())
+                || !parseFingerprint(entry.fingerprint(), size, algorithm, checksum)) {
+                continue;
+            }
+            if (algorithm.isEmpty()) {
+                // No checksum was known when the source has been synced. If it has not been
+                // changed locally since then, we can hash the local copy instead:
+                QFileInfo sourceInfo(localDirectoryPath + "/" + entry.path());
+                if (sourceInfo.size() != size
+                    || sourceInfo.lastModified() != entry.modificationTime()) {
+                    continue;
+                }
+                algorithm = ContentHasher::SHA256;
+                checksum = ContentHasher::hashFile(sourceInfo.absoluteFilePath(), algorithm);
+            }
+            if (!checksum.isEmpty()
+                && checksumOf(algorithm).compare(checksum, Qt::CaseInsensitive) == 0) {
+                FileInfo copiedFileInfo;
+                copiedFileInfo.setChecksum(algorithm, checksumOf(algorithm));
+                syncActionsToRun[index] = QSharedPointer<SyncAction>(new CopyRemoteSyncAction(
+                        entry.path(), makeFingerprint(fileInfo.size(), copiedFileInfo), upload));
+                break;
+            }
+        }
+    }
+}
+
+void DirectorySynchronizerPrivate::addSyncAction(SyncAction* action)
+{
+    syncActionsToRun << QSharedPointer<SyncAction>(action);
+}
+
+/**
+ * @brief Register the remote folders to be created and resources to be deleted by the @p action.
+ *
+ * @sa canRunAction()
+ */
+void DirectorySynchronizerPrivate::registerRemoteAction(const QSharedPointer<SyncAction>& action)
+{
+    switch (action->type) {
+    case MkDirRemote:
+        remoteFoldersToCreate << action->path;
+        break;
+    case DeleteRemote:
+        remoteResourcesToDelete << action->path;
+        break;
+    case MoveRemote:
+        // The source of a move is "deleted" from the point of view of other actions:
+        remoteResourcesToDelete << qSharedPointerCast<MoveRemoteSyncAction>(action)->sourcePath;
+        break;
+    default:
+        // nothing to do
+        break;
+    }
+}
+
+/**
+ * @brief Add further @p actions to run while the remote actions are being executed.
+ */
+void DirectorySynchronizerPrivate::enqueueRemoteActions(
+        const QVector<QSharedPointer<SyncAction>>& actions)
+{
+    for (const auto& action : actions) {
+        registerRemoteAction(action);
+        syncActionsToRun << action;
+    }
+    addPlannedActions(actions);
+}
+
+/**
+ * @brief Update the sync state database after a resource has been moved.
+ *
+ * This moves the entry of the resource moved from @p sourcePath to @p targetPath as well as any
+ * entries below it to the new location. If a new @p syncAttribute is given (e.g. because the
+ * server reported one after moving the remote resource), it is used for the moved resource
+ * itself.
+ */
+bool DirectorySynchronizerPrivate::moveSyncStateEntries(const QString& sourcePath,
+                                                        const QString& targetPath,
+                                                        const QString& syncAttribute)
+{
+    QVector<SyncStateEntry> entries;
+    if (!syncStateDatabase->iterate([&](const SyncStateEntry& entry) { entries << entry; },
+                                    sourcePath)) {
+        return false;
+    }
+    if (!syncStateDatabase->removeEntries(sourcePath)
+        || !syncStateDatabase->removeEntry(sourcePath)) {
+        return false;
+    }
+    for (auto entry : qAsConst(entries)) {
+        auto path = targetPath + entry.path().mid(sourcePath.length());
+        entry.setPath(path);
+        if (path == targetPath) {
+            if (!syncAttribute.isEmpty()) {
+                entry.setSyncProperty(syncAttribute);
+            }
+            entry.setLocalFileId(localFileId(localDirectoryPath + "/" + path));
+        }
+        if (!syncStateDatabase->addEntry(entry)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Remember the ID of the remote resource at @p path, if the @p fileInfo contains one.
+ *
+ * The ID will be stored in the sync state database once the entry for the path is written.
+ */
+void DirectorySynchronizerPrivate::rememberRemoteFileId(const QString& path,
+                                                        const FileInfo& fileInfo)
+{
+    if (!fileInfo.fileId().isEmpty()) {
+        remoteFileIds[path] = fileInfo.fileId();
+    }
+}
+
+/**
+ * @brief Run any local actions that do not require server interaction.
+ */
+void DirectorySynchronizerPrivate::runLocalActions()
+{
+    decltype(syncActionsToRun) remainingSyncActions;
+    // Note: Actions might be added while iterating (if a local move fails):
+    for (int i = 0; i < syncActionsToRun.length(); ++i) {
+        auto action = syncActionsToRun.at(i);
+        switch (action->type) {
+        case MoveLocal: {
+            auto move = qSharedPointerCast<MoveLocalSyncAction>(action);
+            qCDebug(log) << "Moving local resource" << move->sourcePath << "to" << move->path;
+            reportAction(SynchronizerLogEntryType::LocalMove, move->path, move->sourcePath);
+            auto sourcePath = QDir::cleanPath(localDirectoryPath + "/" + move->sourcePath);
+            auto targetPath = QDir::cleanPath(localDirectoryPath + "/" + move->path);
+            auto targetDir = QFileInfo(targetPath).dir();
+            if (QFileInfo::exists(targetPath) || !targetDir.mkpath(".")
+                || !targetDir.rename(sourcePath, targetPath)) {
+                qCDebug(log) << "Moving" << sourcePath << "to" << targetPath
+                             << "failed - falling back to delete and download";
+                syncActionsToRun << move->fallbackActions;
+                addPlannedActions(move->fallbackActions);
+                break;
+            }
+            if (!moveSyncStateEntries(move->sourcePath, move->path, QString())) {
+                setError(SynchronizerError::SyncStateDatabaseWriteFailed,
+                         tr("Failed to write to the sync state database"), JobError::NoError);
+                return;
+            }
+            break;
+        }
+        case MkDirLocal: {
+            qCDebug(log) << "Creating local folder" << action->path;
+            reportAction(SynchronizerLogEntryType::LocalMkDir, action->path);
+            QDir dir(localDirectoryPath + "/" + action->path);
+            if (!dir.mkpath(".")) {
+                setError(SynchronizerError::FailedCreatingLocalFolder,
+                         tr("Creating folder %1 has failed").arg(dir.absolutePath()),
+                         JobError::NoError);
+                return;
+            }
+            remoteFoldersSyncAttributes[action->path] =
+                    qSharedPointerCast<MkDirLocalSyncAction>(action)->syncAttribute;
+            break;
+        }
+        case DeleteLocal:
+            qCDebug(log) << "Deleting local resource" << action->path;
+            reportAction(SynchronizerLogEntryType::LocalDelete, action->path);
+
+            if (!deleteLocally(action->path)) {
+                return;
+            } else {
+                if (!syncStateDatabase->removeEntries(action->path)
+                    || !syncStateDatabase->removeEntry(action->path)) {
+                    setError(SynchronizerError::SyncStateDatabaseDeleteFailed,
+                             tr("Failed to delete entries from the sync state database"),
+                             JobError::NoError);
+                    return;
+                }
+            }
+            break;
+        case Upload:
+        case Download:
+        case MkDirRemote:
+        case DeleteRemote:
+        case MoveRemote:
+        case CopyRemote:
+            // Nothing to do for now
+            remainingSyncActions << action;
+            break;
+        }
+    }
+
+    syncActionsToRun = remainingSyncActions;
+}
+
+void DirectorySynchronizerPrivate::runRemoteActions()
+{
+    if (error != SynchronizerError::NoError) {
+        finishLater();
+        return;
+    }
+
+    updateProgress();
+
+    if (runningJobs >= effectiveMaxJobs()) {
+        traceSchedule(0, 0, syncActionsToRun.length());
+        return;
+    }
+
+    decltype(syncActionsToRun) remainingSyncActions;
+    QMap<SyncActionType, decltype(syncActionsToRun)> batches;
+    int blockedByDependencies = 0;
+    int blockedByJobSlots = 0;
+    for (const auto& action : qAsConst(syncActionsToRun)) {
+        if (!canRunAction(action)) {
+            remainingSyncActions << action;
+            ++blockedByDependencies;
+            continue;
+        }
+
+        if (canBatchAction(action)) {
+            auto& batch = batches[action->type];
+            if (batch.isEmpty()) {
+                // Starting a new batch - it occupies one job slot:
+                if (runningJobs >= effectiveMaxJobs()) {
+                    remainingSyncActions << action;
+                    ++blockedByJobSlots;
+                    continue;
+                }
+                ++runningJobs;
+            }
+            batch << action;
+            if (batch.length() >= maxBatchSize(action->type)) {
+                runRemoteActionBatch(batch);
+                batch.clear();
+            }
+            continue;
+        }
+
+        if (runningJobs >= effectiveMaxJobs()) {
+            remainingSyncActions << action;
+            ++blockedByJobSlots;
+            continue;
+        }
+
+        runRemoteAction(action);
+    }
+
+    for (const auto& batch : qAsConst(batches)) {
+        if (batch.length() == 1) {
+            // Not worth a batch - run the action on its own:
+            --runningJobs;
+            runRemoteAction(batch.first());
+        } else if (!batch.isEmpty()) {
+            runRemoteActionBatch(batch);
+        }
+    }
+
+    traceSchedule(syncActionsToRun.length() - remainingSyncActions.length(),
+                  blockedByDependencies, blockedByJobSlots);
+
+    if (remainingSyncActions.length() == syncActionsToRun.length() && runningJobs <= 0
+        && !syncActionsToRun.isEmpty()) {
+        setError(SynchronizerError::Stuck, tr("Cannot continue sync - it is stuck"),
+                 JobError::NoError);
+        return;
+    }
+
+    syncActionsToRun = remainingSyncActions;
+
+    if (syncActionsToRun.isEmpty() && runningJobs <= 0) {
+        if (error == SynchronizerError::NoError) {
+            // Safe remote folder sync attributes. This only is done if we don't have any errors.
+            // This will e.g. cause us to download/upload again in case we have failed transfers.
+            // Otherwise, we won't re-detect remote changes (as we only compare the parent folders'
+            // sync attributes).
+            for (auto it = remoteFoldersSyncAttributes.cbegin();
+                 it != remoteFoldersSyncAttributes.cend(); ++it) {
+                if (!syncStateDatabase->addEntry(
+                            makeSyncStateEntry(it.key(), QDateTime(), it.value()))) {
+                    setError(SynchronizerError::SyncStateDatabaseWriteFailed,
+                             tr("Failed to write folder sync attribute to sync state database"),
+                             JobError::NoError);
+                    break;
+                }
+            }
+        }
+        finishLater();
+    }
+}
+
+bool DirectorySynchronizerPrivate::deleteLocally(const QString& path)
+{
+    auto fullPath = QDir::cleanPath(localDirectoryPath + "/" + path);
+    QFileInfo fi(fullPath);
+    if (fi.isFile()) {
+        QFile file(fullPath);
+        if (file.exists() && !file.remove()) {
+            setError(SynchronizerError::FailedDeletingLocalFile,
+                     tr("Failed deleting local file %1: %2")
+                             .arg(fi.absolutePath(), file.errorString()),
+                     JobError::NoError);
+            return false;
+        }
+    } else {
+        QDir dir(fullPath);
+        if (dir.exists()) {
+            {
+                QDirIterator it(fullPath, QDir::Files, QDirIterator::Subdirectories);
+                while (it.hasNext()) {
+                    auto next = it.next();
+                    auto entryPath =
+                            SyncStateEntry::makePath("/" + path + "/" + dir.relativeFilePath(next));
+                    if (filter(entryPath, FileInfo::fromLocalFile(next))) {
+                        QFile file(next);
+                        if (!file.remove()) {
+                            setError(SynchronizerError::FailedDeletingLocalFile,
                                      tr("Failed deleting local file %1: %2")
                                              .arg(next, file.errorString()),
                                      JobError::NoError);
@@ -1055,8 +2074,10 @@ bool DirectorySynchronizerPrivate::canRunAction(const QSharedPointer<SyncAction>
     for (const auto& path : qAsConst(remoteResourcesToDelete)) {
         if (path.startsWith(action->path)) {
             // This action is potentially blocked by the path. Exception: The action will delete
-            // exactly this resource:
-            if (path != action->path) {
+            // (or move away) exactly this resource:
+            if (path != action->path
+                && !(action->type == MoveRemote
+                     && qSharedPointerCast<MoveRemoteSyncAction>(action)->sourcePath == path)) {
                 // This action deletes another resource - we have to wait.
                 return false;
             }
@@ -1093,15 +2114,16 @@ void DirectorySynchronizerPrivate::runRemoteAction(const QSharedPointer<SyncActi
     switch (action->type) {
     case MkDirLocal:
     case DeleteLocal:
+    case MoveLocal:
         // There shouldn't be any such actions left
-        qCWarning(log) << "We should not have any MkDirLocal and DeleteLocal actions in"
+        qCWarning(log) << "We should not have any MkDirLocal, DeleteLocal and MoveLocal actions in"
                        << __func__;
         emit q->logMessageAvailable(SynchronizerLogEntryType::Warning,
                                     tr("Found local action in remote action execution phase"));
         break;
     case Upload: {
         qCDebug(log) << "Uploading" << action->path;
-        emit q->logMessageAvailable(SynchronizerLogEntryType::Upload, action->path);
+        reportAction(SynchronizerLogEntryType::Upload, action->path);
         ++runningJobs;
         auto job = jobFactory->uploadFile(this);
         job->setLocalFilename(localDirectoryPath + "/" + action->path);
@@ -1112,15 +2134,18 @@ void DirectorySynchronizerPrivate::runRemoteAction(const QSharedPointer<SyncActi
             job->setSyncAttribute(uploadAction->previousSyncEntry.syncProperty());
         }
         setupDefaultJobSignals(job);
+        trackTransfer(job, expectedTransferSize(action), true);
         connect(job, &AbstractJob::finished, this, [=]() {
             --runningJobs;
             switch (job->error()) {
             case JobError::NoError:
                 // Uploading succeeded. Save sync attribute
+                rememberRemoteFileId(uploadAction->path, job->fileInfo());
                 if (!job->fileInfo().syncAttribute().isEmpty()) {
                     if (!syncStateDatabase->addEntry(
-                                SyncStateEntry(uploadAction->path, uploadAction->lastModified,
-                                               job->fileInfo().syncAttribute()))) {
+                                makeSyncStateEntry(uploadAction->path, uploadAction->lastModified,
+                                                   job->fileInfo().syncAttribute(),
+                                                   job->fileInfo()))) {
                         setError(SynchronizerError::SyncStateDatabaseWriteFailed,
                                  tr("Failed to write to the sync state database"),
                                  JobError::NoError);
@@ -1129,35 +2154,7 @@ void DirectorySynchronizerPrivate::runRemoteAction(const QSharedPointer<SyncActi
                     runRemoteActions();
                 } else {
                     // We did not receive a sync attribute on upload - fetch one from the server.
-                    qCDebug(log) << "Didn't get a sync attribute on upload - fetching from server";
-                    auto fileInfoJob = jobFactory->getFileInfo();
-                    fileInfoJob->setPath(job->remoteFilename());
-                    setupDefaultJobSignals(fileInfoJob);
-                    fileInfoJob->start();
-                    connect(fileInfoJob, &AbstractJob::finished, this, [=]() {
-                        fileInfoJob->deleteLater();
-                        if (fileInfoJob->error() == JobError::NoError) {
-                            QString syncAttribute;
-                            syncAttribute = fileInfoJob->fileInfo().syncAttribute();
-                            qCDebug(log) << "Manually fetched sync attribute for"
-                                         << fileInfoJob->path() << "from server:" << syncAttribute;
-                            if (!syncStateDatabase->addEntry(SyncStateEntry(
-                                        uploadAction->path, uploadAction->lastModified,
-                                        syncAttribute))) {
-                                setError(SynchronizerError::SyncStateDatabaseWriteFailed,
-                                         tr("Failed to write to the sync state database"),
-                                         JobError::NoError);
-                                return;
-                            }
-                            runRemoteActions();
-                            return;
-                        } else {
-                            setError(SynchronizerError::UploadFailed,
-                                     tr("Failed to fetch file info from remote server: %1")
-                                             .arg(fileInfoJob->errorString()),
-                                     fileInfoJob->error());
-                        }
-                    });
+                    fetchUploadedFileSyncAttribute(uploadAction, job->remoteFilename());
                     return;
                 }
                 break;
@@ -1178,7 +2175,7 @@ void DirectorySynchronizerPrivate::runRemoteAction(const QSharedPointer<SyncActi
 
     case Download: {
         qCDebug(log) << "Downloading" << action->path;
-        emit q->logMessageAvailable(SynchronizerLogEntryType::Download, action->path);
+        reportAction(SynchronizerLogEntryType::Download, action->path);
         ++runningJobs;
         auto job = jobFactory->downloadFile(this);
         job->setRemoteFilename(remoteDirectoryPath + "/" + action->path);
@@ -1202,6 +2199,7 @@ void DirectorySynchronizerPrivate::runRemoteAction(const QSharedPointer<SyncActi
         }
         job->setOutput(saveFile);
         setupDefaultJobSignals(job);
+        trackTransfer(job, expectedTransferSize(action), false);
         QSharedPointer<DownloadSyncAction> downloadAction =
                 qSharedPointerCast<DownloadSyncAction>(action);
         connect(job, &AbstractJob::finished, this, [=]() {
@@ -1227,9 +2225,11 @@ void DirectorySynchronizerPrivate::runRemoteAction(const QSharedPointer<SyncActi
                         // the next sync.
                         syncAttribute = downloadAction->syncAttribute;
                     }
-                    if (!syncStateDatabase->addEntry(SyncStateEntry(
+                    rememberRemoteFileId(downloadAction->path, job->fileInfo());
+                    if (!syncStateDatabase->addEntry(makeSyncStateEntry(
                                 downloadAction->path,
-                                QFileInfo(saveFile->fileName()).lastModified(), syncAttribute))) {
+                                QFileInfo(saveFile->fileName()).lastModified(), syncAttribute,
+                                job->fileInfo()))) {
                         setError(SynchronizerError::SyncStateDatabaseWriteFailed,
                                  tr("Failed to write to sync state database"), JobError::NoError);
                         return;
@@ -1256,136 +2256,619 @@ void DirectorySynchronizerPrivate::runRemoteAction(const QSharedPointer<SyncActi
     }
 
     case DeleteRemote: {
-        qCDebug(log) << "Deleting remote" << action->path;
-        emit q->logMessageAvailable(SynchronizerLogEntryType::RemoteDelete, action->path);
-        // Deletions are tricky. The problem: We don't want to unconditionally remove any remote
-        // resource. In case of folders, other clients might update in between. However, for files,
-        // we want to avoid accidentally deleting them. So what we do: The sync algorithm will
-        // generate individual delete calls for each element in a hierarchy to be deleted. Before
-        // actually deleting, we query the current state of the remote node. Only it it has no
-        // children, we will try to delete it. Additionally, if it is a folder, we omit the
-        // sync-property (as this does not work at least against WebDAV) for some reasons.
-
-        // TODO: Check why a delete with if-match when using WebDAV fails against a folder.
-        ++runningJobs;
-        auto listJob = jobFactory->listFiles(this);
-        listJob->setPath(remoteDirectoryPath + "/" + action->path);
-        setupDefaultJobSignals(listJob);
-        connect(listJob, &AbstractJob::finished, this, [=]() {
-            switch (listJob->error()) {
-            case JobError::NoError: {
-                if (!listJob->entries().isEmpty()) {
-                    QStringList remoteEntryNames;
-                    auto listJobEntries = listJob->entries();
-                    for (const auto& remoteEntry : qAsConst(listJobEntries)) {
-                        remoteEntryNames << remoteEntry.name();
-                    }
+        qCDebug(log) << "Deleting remote" << action->path;
+        reportAction(SynchronizerLogEntryType::RemoteDelete, action->path);
+        // Deletions are tricky. The problem: We don't want to unconditionally remove any remote
+        // resource. In case of folders, other clients might update in between. However, for files,
+        // we want to avoid accidentally deleting them. So what we do: The sync algorithm will
+        // generate individual delete calls for each element in a hierarchy to be deleted. Before
+        // actually deleting, we query the current state of the remote node. Only it it has no
+        // children, we will try to delete it. Additionally, if it is a folder, we omit the
+        // sync-property (as this does not work at least against WebDAV) for some reasons.
+
+        // TODO: Check why a delete with if-match when using WebDAV fails against a folder.
+        ++runningJobs;
+        auto listJob = jobFactory->listFiles(this);
+        listJob->setPath(remoteDirectoryPath + "/" + action->path);
+        setupDefaultJobSignals(listJob);
+        connect(listJob, &AbstractJob::finished, this, [=]() {
+            switch (listJob->error()) {
+            case JobError::NoError: {
+                if (!listJob->entries().isEmpty()) {
+                    QStringList remoteEntryNames;
+                    auto listJobEntries = listJob->entries();
+                    for (const auto& remoteEntry : qAsConst(listJobEntries)) {
+                        remoteEntryNames << remoteEntry.name();
+                    }
+                    setError(SynchronizerError::FailedDeletingRemoteResource,
+                             tr("Remote resource %1 is not empty (it still contains %2)")
+                                     .arg(action->path, remoteEntryNames.join(", ")),
+                             JobError::NoError);
+                    return;
+                }
+                auto job = jobFactory->deleteResource(this);
+                job->setPath(remoteDirectoryPath + "/" + action->path);
+                // Does not work, see comment above.
+                // job->setSyncAttribute(listJob->folder().syncAttribute());
+                setupDefaultJobSignals(job);
+                connect(job, &AbstractJob::finished, this, [=]() {
+                    --runningJobs;
+                    switch (job->error()) {
+                    case JobError::NoError:
+                    case JobError::ResourceNotFound:
+                        syncStateDatabase->removeEntry(action->path);
+                        syncStateDatabase->removeEntries(action->path);
+                        remoteResourcesToDelete.removeAll(action->path);
+                        break;
+                    case JobError::SyncAttributeMismatch:
+                        // The resource was updated meanwhile. This could be because we are
+                        // recursively deleting. In this case, re-run this action:
+                        if (action->retries < 5 && error == SynchronizerError::NoError) {
+                            action->retries += 1;
+                            runRemoteAction(action);
+                            break;
+                        } else {
+                            setError(SynchronizerError::FailedDeletingRemoteResource,
+                                     tr("Permanently failed to remove remote resource %1 after %2 "
+                                        "retries - it keeps being updated too fast | %3")
+                                             .arg(action->path)
+                                             .arg(action->retries)
+                                             .arg(job->syncAttribute().toString()),
+                                     job->error());
+                            return;
+                        }
+                    default:
+                        setError(SynchronizerError::FailedDeletingRemoteResource,
+                                 tr("Failed deleting remote resource %1: %2")
+                                         .arg(action->path, job->errorString()),
+                                 job->error());
+                        return;
+                    }
+                    runRemoteActions(); // Currently dead code - keep to ensure we "keep going" in
+                                        // case of future changes.
+                });
+                job->start();
+                break;
+            }
+            case JobError::ResourceNotFound:
+                // The resource is no longer present - fine!
+                --runningJobs;
+                remoteResourcesToDelete.removeAll(action->path);
+                runRemoteActions();
+                break;
+            default:
+                setError(SynchronizerError::FailedDeletingRemoteResource,
+                         tr("Failed to list remote resource %1: %2")
+                                 .arg(action->path, listJob->errorString()),
+                         listJob->error());
+                break;
+            }
+        });
+        listJob->start();
+        break;
+    }
+
+    case MkDirRemote: {
+        qCDebug(log) << "Creating remote folder" << action->path;
+        reportAction(SynchronizerLogEntryType::RemoteMkDir, action->path);
+        ++runningJobs;
+        auto job = jobFactory->createDirectory(this);
+        job->setPath(remoteDirectoryPath + "/" + action->path);
+        setupDefaultJobSignals(job);
+        connect(job, &AbstractJob::finished, this, [=]() {
+            --runningJobs;
+            switch (job->error()) {
+            case JobError::NoError:
+            case JobError::FolderExists: {
+                remoteFoldersToCreate.removeAll(action->path);
+                break;
+            }
+            default:
+                setError(SynchronizerError::FailedCreatingRemoteFolder,
+                         tr("Failed to create remote folder %1: %2")
+                                 .arg(action->path, job->errorString()),
+                         job->error());
+                return;
+            }
+            runRemoteActions();
+        });
+        job->start();
+        break;
+    }
+    case MoveRemote: {
+        auto moveAction = qSharedPointerCast<MoveRemoteSyncAction>(action);
+        qCDebug(log) << "Moving remote resource" << moveAction->sourcePath << "to" << action->path;
+        reportAction(SynchronizerLogEntryType::RemoteMove, action->path, moveAction->sourcePath);
+        ++runningJobs;
+        auto job = jobFactory->moveResource(this);
+        job->setPath(remoteDirectoryPath + "/" + moveAction->sourcePath);
+        job->setTargetPath(remoteDirectoryPath + "/" + action->path);
+        setupDefaultJobSignals(job);
+        connect(job, &AbstractJob::finished, this, [=]() {
+            --runningJobs;
+            remoteResourcesToDelete.removeAll(moveAction->sourcePath);
+            switch (job->error()) {
+            case JobError::NoError:
+                if (!moveSyncStateEntries(moveAction->sourcePath, moveAction->path,
+                                          job->fileInfo().syncAttribute())) {
+                    setError(SynchronizerError::SyncStateDatabaseWriteFailed,
+                             tr("Failed to write to the sync state database"), JobError::NoError);
+                    return;
+                }
+                enqueueRemoteActions(moveAction->followUpActions);
+                break;
+            case JobError::ResourceNotFound:
+            case JobError::ResourceExists:
+            case JobError::ServerContentConflict:
+                // The remote changed in the meantime - fall back to deleting and uploading:
+                qCDebug(log) << "Moving" << moveAction->sourcePath << "to" << action->path
+                             << "failed:" << job->errorString() << "- falling back to upload";
+                enqueueRemoteActions(moveAction->fallbackActions);
+                break;
+            default:
+                setError(SynchronizerError::FailedMovingRemoteResource,
+                         tr("Failed to move remote resource %1 to %2: %3")
+                                 .arg(moveAction->sourcePath, action->path, job->errorString()),
+                         job->error());
+                return;
+            }
+            runRemoteActions();
+        });
+        job->start();
+        break;
+    }
+    case CopyRemote: {
+        auto copyAction = qSharedPointerCast<CopyRemoteSyncAction>(action);
+        qCDebug(log) << "Copying remote file" << copyAction->sourcePath << "to" << action->path;
+        reportAction(SynchronizerLogEntryType::RemoteCopy, action->path, copyAction->sourcePath);
+        ++runningJobs;
+        auto job = jobFactory->copyResource(this);
+        job->setPath(remoteDirectoryPath + "/" + copyAction->sourcePath);
+        job->setTargetPath(remoteDirectoryPath + "/" + action->path);
+        setupDefaultJobSignals(job);
+        connect(job, &AbstractJob::finished, this, [=]() {
+            --runningJobs;
+            auto uploadAction = copyAction->uploadAction;
+            switch (job->error()) {
+            case JobError::NoError: {
+                rememberRemoteFileId(uploadAction->path, job->fileInfo());
+                if (job->fileInfo().syncAttribute().isEmpty()) {
+                    fetchUploadedFileSyncAttribute(uploadAction, job->targetPath());
+                    return;
+                }
+                auto entry = makeSyncStateEntry(uploadAction->path, uploadAction->lastModified,
+                                                job->fileInfo().syncAttribute());
+                if (!entry.fingerprint().isEmpty()) {
+                    // We hashed the file when deciding to copy it, so we know its checksum:
+                    entry.setFingerprint(copyAction->fingerprint);
+                }
+                if (!syncStateDatabase->addEntry(entry)) {
+                    setError(SynchronizerError::SyncStateDatabaseWriteFailed,
+                             tr("Failed to write to the sync state database"), JobError::NoError);
+                    return;
+                }
+                break;
+            }
+            case JobError::ResourceNotFound:
+            case JobError::ResourceExists:
+            case JobError::ServerContentConflict:
+                // The remote changed in the meantime - upload the file instead:
+                qCDebug(log) << "Copying" << copyAction->sourcePath << "to" << action->path
+                             << "failed:" << job->errorString() << "- falling back to upload";
+                enqueueRemoteActions({ uploadAction });
+                break;
+            default:
+                setError(SynchronizerError::FailedCopyingRemoteResource,
+                         tr("Failed to copy remote resource %1 to %2: %3")
+                                 .arg(copyAction->sourcePath, action->path, job->errorString()),
+                         job->error());
+                return;
+            }
+            runRemoteActions();
+        });
+        job->start();
+        break;
+    }
+    }
+}
+
+/**
+ * @brief Fetch the sync attribute of an uploaded file from the server.
+ *
+ * This is used if an upload job did not report the new sync attribute of the uploaded file. The
+ * attribute is fetched from the server and written to the sync state database afterwards.
+ */
+void DirectorySynchronizerPrivate::fetchUploadedFileSyncAttribute(
+        const QSharedPointer<UploadSyncAction>& uploadAction, const QString& remoteFilename)
+{
+    qCDebug(log) << "Didn't get a sync attribute on upload - fetching from server";
+    auto fileInfoJob = jobFactory->getFileInfo();
+    fileInfoJob->setPath(remoteFilename);
+    setupDefaultJobSignals(fileInfoJob);
+    fileInfoJob->start();
+    connect(fileInfoJob, &AbstractJob::finished, this, [=]() {
+        fileInfoJob->deleteLater();
+        if (fileInfoJob->error() == JobError::NoError) {
+            QString syncAttribute;
+            syncAttribute = fileInfoJob->fileInfo().syncAttribute();
+            qCDebug(log) << "Manually fetched sync attribute for" << fileInfoJob->path()
+                         << "from server:" << syncAttribute;
+            rememberRemoteFileId(uploadAction->path, fileInfoJob->fileInfo());
+            if (!syncStateDatabase->addEntry(
+                        makeSyncStateEntry(uploadAction->path, uploadAction->lastModified,
+                                           syncAttribute, fileInfoJob->fileInfo()))) {
+                setError(SynchronizerError::SyncStateDatabaseWriteFailed,
+                         tr("Failed to write to the sync state database"), JobError::NoError);
+                return;
+            }
+            runRemoteActions();
+            return;
+        } else {
+            setError(SynchronizerError::UploadFailed,
+                     tr("Failed to fetch file info from remote server: %1")
+                             .arg(fileInfoJob->errorString()),
+                     fileInfoJob->error());
+        }
+    });
+}
+
+/**
+ * @brief The maximum number of actions of the given @p type to run within a single batch.
+ *
+ * This returns 0 if actions of the given type cannot be batched using the current job factory.
+ */
+int DirectorySynchronizerPrivate::maxBatchSize(SyncActionType type) const
+{
+    if (!jobFactory) {
+        return 0;
+    }
+    switch (type) {
+    case Upload:
+        return jobFactory->maxBatchSize(JobType::UploadFileBatch);
+    case DeleteRemote:
+        return jobFactory->maxBatchSize(JobType::DeleteResourceBatch);
+    case MkDirRemote:
+        return jobFactory->maxBatchSize(JobType::CreateDirectoryBatch);
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Check if the @p action can be run as part of a batch.
+ *
+ * Uploads (of files not exceeding AbstractJobFactory::maxBatchFileSize()) and remote folder
+ * creations can be batched if the job factory supports it. Remote deletions are only batched if
+ * they refer to a file we synced before - folders are still deleted one by one, as we need to
+ * check they are empty before deleting them (see runRemoteAction()).
+ */
+bool DirectorySynchronizerPrivate::canBatchAction(const QSharedPointer<SyncAction>& action) const
+{
+    if (maxBatchSize(action->type) <= 0) {
+        return false;
+    }
+    switch (action->type) {
+    case Upload: {
+        auto maxFileSize = jobFactory->maxBatchFileSize();
+        return maxFileSize <= 0
+                || QFileInfo(localDirectoryPath + "/" + action->path).size() <= maxFileSize;
+    }
+    case MkDirRemote:
+        return true;
+    case DeleteRemote:
+        // Folders are stored without a modification time in the sync state database:
+        return qSharedPointerCast<DeleteRemoteSyncAction>(action)
+                ->previousSyncEntry.modificationTime()
+                .isValid();
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Run several remote actions of the same type within a single batch job.
+ *
+ * The batch must have been accounted for in the number of running jobs before calling this
+ * method. Upload batches additionally occupy the job slots which are still free (up to one per
+ * file), so backends uploading files one by one can run these uploads in parallel.
+ */
+void DirectorySynchronizerPrivate::runRemoteActionBatch(
+        const QVector<QSharedPointer<SyncAction>>& actions)
+{
+    switch (actions.first()->type) {
+    case Upload: {
+        qCDebug(log) << "Uploading" << actions.length() << "files in a batch";
+        auto job = jobFactory->uploadFileBatch(this);
+        // Files the backend cannot upload within a single request may use the job slots which are
+        // still free:
+        auto extraJobs = qBound(0, effectiveMaxJobs() - runningJobs, actions.length() - 1);
+        runningJobs += extraJobs;
+        job->setMaxParallelUploads(1 + extraJobs);
+        QVector<QSharedPointer<UploadSyncAction>> uploadActions;
+        qint64 expectedBytes = 0;
+        for (const auto& action : actions) {
+            reportAction(SynchronizerLogEntryType::Upload, action->path);
+            auto uploadAction = qSharedPointerCast<UploadSyncAction>(action);
+            QVariant syncAttribute;
+            if (uploadAction->previousSyncEntry.isValid()
+                && syncConflictStrategy != SyncConflictStrategy::LocalWins) {
+                syncAttribute = uploadAction->previousSyncEntry.syncProperty();
+            }
+            job->addFile(localDirectoryPath + "/" + action->path,
+                         remoteDirectoryPath + "/" + action->path, syncAttribute);
+            uploadActions << uploadAction;
+            expectedBytes += expectedTransferSize(action);
+        }
+        setupDefaultJobSignals(job);
+        trackTransfer(job, expectedBytes, true);
+        connect(job, &AbstractJob::finished, this, [=]() {
+            runningJobs -= 1 + extraJobs;
+            if (job->error() != JobError::NoError) {
+                setError(SynchronizerError::UploadFailed,
+                         tr("Uploading %1 files failed: %2")
+                                 .arg(uploadActions.length())
+                                 .arg(job->errorString()),
+                         job->error());
+                return;
+            }
+            for (const auto& uploadAction : uploadActions) {
+                auto remoteFilename = remoteDirectoryPath + "/" + uploadAction->path;
+                switch (job->entryError(remoteFilename)) {
+                case JobError::NoError: {
+                    rememberRemoteFileId(uploadAction->path, job->fileInfo(remoteFilename));
+                    auto syncAttribute = job->fileInfo(remoteFilename).syncAttribute();
+                    if (syncAttribute.isEmpty()) {
+                        fetchUploadedFileSyncAttribute(uploadAction, remoteFilename);
+                    } else if (!syncStateDatabase->addEntry(makeSyncStateEntry(
+                                       uploadAction->path, uploadAction->lastModified,
+                                       syncAttribute, job->fileInfo(remoteFilename)))) {
+                        setError(SynchronizerError::SyncStateDatabaseWriteFailed,
+                                 tr("Failed to write to the sync state database"),
+                                 JobError::NoError);
+                        return;
+                    }
+                    break;
+                }
+                case JobError::SyncAttributeMismatch:
+                    // There was a lost update (i.e. another client uploaded meanwhile).
+                    break;
+                default:
+                    setError(SynchronizerError::UploadFailed,
+                             tr("Uploading %1 failed: %2")
+                                     .arg(uploadAction->path,
+                                          job->entryErrorString(remoteFilename)),
+                             job->entryError(remoteFilename));
+                    return;
+                }
+            }
+            runRemoteActions();
+        });
+        job->start();
+        break;
+    }
+
+    case DeleteRemote: {
+        qCDebug(log) << "Deleting" << actions.length() << "remote files in a batch";
+        auto job = jobFactory->deleteResourceBatch(this);
+        for (const auto& action : actions) {
+            reportAction(SynchronizerLogEntryType::RemoteDelete, action->path);
+            job->addPath(remoteDirectoryPath + "/" + action->path);
+        }
+        setupDefaultJobSignals(job);
+        connect(job, &AbstractJob::finished, this, [=]() {
+            --runningJobs;
+            if (job->error() != JobError::NoError) {
+                setError(SynchronizerError::FailedDeletingRemoteResource,
+                         tr("Deleting %1 remote resources failed: %2")
+                                 .arg(actions.length())
+                                 .arg(job->errorString()),
+                         job->error());
+                return;
+            }
+            for (const auto& action : actions) {
+                auto remotePath = remoteDirectoryPath + "/" + action->path;
+                switch (job->entryError(remotePath)) {
+                case JobError::NoError:
+                case JobError::ResourceNotFound:
+                    syncStateDatabase->removeEntry(action->path);
+                    syncStateDatabase->removeEntries(action->path);
+                    remoteResourcesToDelete.removeAll(action->path);
+                    break;
+                default:
                     setError(SynchronizerError::FailedDeletingRemoteResource,
-                             tr("Remote resource %1 is not empty (it still contains %2)")
-                                     .arg(action->path, remoteEntryNames.join(", ")),
-                             JobError::NoError);
+                             tr("Failed deleting remote resource %1: %2")
+                                     .arg(action->path, job->entryErrorString(remotePath)),
+                             job->entryError(remotePath));
                     return;
                 }
-                auto job = jobFactory->deleteResource(this);
-                job->setPath(remoteDirectoryPath + "/" + action->path);
-                // Does not work, see comment above.
-                // job->setSyncAttribute(listJob->folder().syncAttribute());
-                setupDefaultJobSignals(job);
-                connect(job, &AbstractJob::finished, this, [=]() {
-                    --runningJobs;
-                    switch (job->error()) {
-                    case JobError::NoError:
-                    case JobError::ResourceNotFound:
-                        syncStateDatabase->removeEntry(action->path);
-                        syncStateDatabase->removeEntries(action->path);
-                        remoteResourcesToDelete.removeAll(action->path);
-                        break;
-                    case JobError::SyncAttributeMismatch:
-                        // The resource was updated meanwhile. This could be because we are
-                        // recursively deleting. In this case, re-run this action:
-                        if (action->retries < 5 && error == SynchronizerError::NoError) {
-                            action->retries += 1;
-                            runRemoteAction(action);
-                            break;
-                        } else {
-                            setError(SynchronizerError::FailedDeletingRemoteResource,
-                                     tr("Permanently failed to remove remote resource %1 after %2 "
-                                        "retries - it keeps being updated too fast | %3")
-                                             .arg(action->path)
-                                             .arg(action->retries)
-                                             .arg(job->syncAttribute().toString()),
-                                     job->error());
-                            return;
-                        }
-                    default:
-                        setError(SynchronizerError::FailedDeletingRemoteResource,
-                                 tr("Failed deleting remote resource %1: %2")
-                                         .arg(action->path, job->errorString()),
-                                 job->error());
-                        return;
-                    }
-                    runRemoteActions(); // Currently dead code - keep to ensure we "keep going" in
-                                        // case of future changes.
-                });
-                job->start();
-                break;
-            }
-            case JobError::ResourceNotFound:
-                // The resource is no longer present - fine!
-                --runningJobs;
-                remoteResourcesToDelete.removeAll(action->path);
-                runRemoteActions();
-                break;
-            default:
-                setError(SynchronizerError::FailedDeletingRemoteResource,
-                         tr("Failed to list remote resource %1: %2")
-                                 .arg(action->path, listJob->errorString()),
-                         listJob->error());
-                break;
             }
+            runRemoteActions();
         });
-        listJob->start();
+        job->start();
         break;
     }
 
     case MkDirRemote: {
-        qCDebug(log) << "Creating remote folder" << action->path;
-        emit q->logMessageAvailable(SynchronizerLogEntryType::RemoteMkDir, action->path);
-        ++runningJobs;
-        auto job = jobFactory->createDirectory(this);
-        job->setPath(remoteDirectoryPath + "/" + action->path);
+        qCDebug(log) << "Creating" << actions.length() << "remote folders in a batch";
+        auto job = jobFactory->createDirectoryBatch(this);
+        for (const auto& action : actions) {
+            reportAction(SynchronizerLogEntryType::RemoteMkDir, action->path);
+            job->addPath(remoteDirectoryPath + "/" + action->path);
+        }
         setupDefaultJobSignals(job);
         connect(job, &AbstractJob::finished, this, [=]() {
             --runningJobs;
-            switch (job->error()) {
-            case JobError::NoError:
-            case JobError::FolderExists: {
-                remoteFoldersToCreate.removeAll(action->path);
-                break;
-            }
-            default:
+            if (job->error() != JobError::NoError) {
                 setError(SynchronizerError::FailedCreatingRemoteFolder,
-                         tr("Failed to create remote folder %1: %2")
-                                 .arg(action->path, job->errorString()),
+                         tr("Creating %1 remote folders failed: %2")
+                                 .arg(actions.length())
+                                 .arg(job->errorString()),
                          job->error());
                 return;
             }
+            for (const auto& action : actions) {
+                auto remotePath = remoteDirectoryPath + "/" + action->path;
+                switch (job->entryError(remotePath)) {
+                case JobError::NoError:
+                case JobError::FolderExists:
+                    remoteFoldersToCreate.removeAll(action->path);
+                    break;
+                default:
+                    setError(SynchronizerError::FailedCreatingRemoteFolder,
+                             tr("Failed to create remote folder %1: %2")
+                                     .arg(action->path, job->entryErrorString(remotePath)),
+                             job->entryError(remotePath));
+                    return;
+                }
+            }
             runRemoteActions();
         });
         job->start();
         break;
     }
+
+    default:
+        // Other actions cannot be batched - run them one by one:
+        --runningJobs;
+        for (const auto& action : actions) {
+            runRemoteAction(action);
+        }
+        break;
+    }
+}
+
+/**
+ * @brief Add the @p actions to the sync plan used to calculate the progress.
+ *
+ * This counts the actions and adds the bytes they are expected to transfer to the total.
+ */
+void DirectorySynchronizerPrivate::addPlannedActions(
+        const QVector<QSharedPointer<SyncAction>>& actions)
+{
+    numTotalSyncActionsToRun += actions.length();
+    for (const auto& action : actions) {
+        plannedBytes += expectedTransferSize(action);
+    }
+}
+
+/**
+ * @brief The number of bytes running the @p action will transfer.
+ *
+ * For uploads, this is the size of the local file. For downloads, this is the size reported in
+ * the remote listing. If the size is not known, 0 is returned.
+ */
+qint64 DirectorySynchronizerPrivate::expectedTransferSize(const QSharedPointer<SyncAction>& action)
+{
+    switch (action->type) {
+    case Upload:
+        return qMax<qint64>(QFileInfo(localDirectoryPath + "/" + action->path).size(), 0);
+    case Download: {
+        auto node = remoteChangeTree.findNode(action->path);
+        if (node && node->size > 0) {
+            return node->size;
+        }
+        return 0;
+    }
+    default:
+        return 0;
     }
 }
 
+/**
+ * @brief Count the bytes transferred by the @p job towards the progress of the sync.
+ *
+ * The @p job is expected to transfer @p expectedBytes. Depending on @p upload, either the bytes
+ * sent or received are counted. Bytes beyond the expected ones (e.g. when a transfer is retried)
+ * are ignored, so the progress never exceeds the planned total. If the expected size is not
+ * known, the total is increased as the data comes in instead.
+ */
+void DirectorySynchronizerPrivate::trackTransfer(AbstractJob* job, qint64 expectedBytes,
+                                                 bool upload)
+{
+    auto counted = QSharedPointer<qint64>::create(0);
+    connect(job, &AbstractJob::transferProgress, this,
+            [=](qint64 bytesSent, qint64 bytesReceived) {
+                auto bytes = upload ? bytesSent : bytesReceived;
+                if (expectedBytes > 0) {
+                    bytes = qMin(bytes, expectedBytes);
+                }
+                if (bytes > *counted) {
+                    transferredBytes += bytes - *counted;
+                    if (expectedBytes <= 0) {
+                        plannedBytes += bytes - *counted;
+                    }
+                    *counted = bytes;
+                }
+            });
+}
+
+/**
+ * @brief Recalculate the overall progress of the sync.
+ *
+ * Each action is weighted by the bytes it transfers plus a constant for the action itself. Hence,
+ * large files account for a large part of the progress, while a sync of many tiny files still
+ * progresses steadily.
+ */
 void DirectorySynchronizerPrivate::updateProgress()
 {
-    Q_Q(DirectorySynchronizer);
     if (numTotalSyncActionsToRun > 0) {
-        auto numRemaining = syncActionsToRun.length();
-        progress = (numTotalSyncActionsToRun - numRemaining) * 100 / numTotalSyncActionsToRun;
+        qint64 numDone = numTotalSyncActionsToRun - syncActionsToRun.length();
+        auto total = numTotalSyncActionsToRun * ProgressActionWeight + plannedBytes;
+        auto done = numDone * ProgressActionWeight + qMin(transferredBytes, plannedBytes);
+        progress = static_cast<int>(done * 100 / total);
+    }
+}
+
+/**
+ * @brief Update the throughput estimate and report the progress, if it changed.
+ *
+ * This is called periodically (see DirectorySynchronizer::progressInterval()) while the sync is
+ * running, so the progress signals are emitted at a limited rate, no matter how many jobs finish.
+ */
+void DirectorySynchronizerPrivate::reportProgress()
+{
+    Q_Q(DirectorySynchronizer);
+    updateProgress();
+
+    if (rateTimer.isValid() && rateTimer.elapsed() >= MinRateSampleInterval) {
+        auto rate = (transferredBytes - rateSampleBytes) * 1000.0 / rateTimer.restart();
+        if (bytesPerSecond <= 0) {
+            bytesPerSecond = rate;
+        } else {
+            bytesPerSecond = RateSmoothing * rate + (1 - RateSmoothing) * bytesPerSecond;
+        }
+        rateSampleBytes = transferredBytes;
+    }
+
+    if (progress != reportedProgress || transferredBytes != reportedBytes) {
+        reportedProgress = progress;
+        reportedBytes = transferredBytes;
+        emit q->progress(progress);
+        emit q->progressAvailable(progressSnapshot());
+    }
+}
+
+/**
+ * @brief The current progress of the sync.
+ */
+SyncProgress DirectorySynchronizerPrivate::progressSnapshot() const
+{
+    SyncProgress result;
+    result.setProgress(progress);
+    result.setActionsTotal(numTotalSyncActionsToRun);
+    result.setActionsDone(numTotalSyncActionsToRun > 0
+                                  ? numTotalSyncActionsToRun - syncActionsToRun.length()
+                                  : 0);
+    result.setBytesTotal(plannedBytes);
+    result.setBytesDone(qMin(transferredBytes, plannedBytes));
+    result.setBytesPerSecond(bytesPerSecond);
+    auto remaining = qMax<qint64>(plannedBytes - transferredBytes, 0);
+    if (remaining == 0 && progress >= 0) {
+        result.setEta(0);
+    } else if (bytesPerSecond > 0) {
+        result.setEta(static_cast<qint64>(remaining * 1000 / bytesPerSecond));
     }
-    emit q->progress(progress);
+    return result;
 }
 
 void DirectorySynchronizerPrivate::finishLater()
@@ -1393,19 +2876,237 @@ void DirectorySynchronizerPrivate::finishLater()
     Q_Q(DirectorySynchronizer);
     QTimer::singleShot(0, q, [=] {
         if (state == SynchronizerState::Running) {
-            if (syncStateDatabase && syncStateDatabase->isOpen()
+            if (error != SynchronizerError::NoError) {
+                restoreLocalChangeWatcherState();
+            }
+            if (syncStateDatabase && syncStateDatabase->isOpen() && closeSyncStateDatabase
                 && !syncStateDatabase->closeDatabase()) {
                 if (error == SynchronizerError::NoError) {
                     setError(SynchronizerError::FailedClosingSyncStateDatabase,
                              tr("Failed to close the sync state database"), JobError::NoError);
                 }
             }
+            leavePhase();
+            reportProgress();
+            statistics.setFinishTime(QDateTime::currentDateTimeUtc());
             state = SynchronizerState::Finished;
+            emit q->statisticsAvailable(statistics);
             emit q->finished();
         }
     });
 }
 
+/**
+ * @brief Hand the local changes taken from the local change watcher back to it.
+ *
+ * This is called when the sync fails, so that the next sync picks up the changes again.
+ */
+void DirectorySynchronizerPrivate::restoreLocalChangeWatcherState()
+{
+    if (localChangeWatcherStateTaken && localChangeWatcher) {
+        if (localChangeWatcherFullScan) {
+            localChangeWatcher->requestFullScan();
+        }
+        for (const auto& path : qAsConst(localChangeWatcherDirtyPaths)) {
+            localChangeWatcher->markDirty(path);
+        }
+    }
+    localChangeWatcherStateTaken = false;
+}
+
+/**
+ * @brief The number of jobs that may run in parallel.
+ *
+ * This is the maxMultiplexedJobs limit if the job factory allows the use of HTTP/2 or
+ * maxJobs otherwise.
+ */
+int DirectorySynchronizerPrivate::effectiveMaxJobs() const
+{
+    if (jobFactory && jobFactory->http2Allowed()) {
+        return maxMultiplexedJobs;
+    }
+    return maxJobs;
+}
+
+/**
+ * @brief Record that the sync proceeds to the given @p phase.
+ *
+ * The time spent in the previous phase (if any) is added to the statistics.
+ */
+void DirectorySynchronizerPrivate::enterPhase(SynchronizerPhase phase)
+{
+    leavePhase();
+    currentPhase = phase;
+    inPhase = true;
+    phaseTimer.start();
+    phaseStartTime = QDateTime::currentDateTimeUtc();
+}
+
+/**
+ * @brief Add the time spent in the current phase to the statistics.
+ */
+void DirectorySynchronizerPrivate::leavePhase()
+{
+    if (inPhase) {
+        statistics.setPhaseDuration(currentPhase,
+                                    statistics.phaseDuration(currentPhase) + phaseTimer.elapsed());
+        inPhase = false;
+        if (tracer) {
+            auto name = QMetaEnum::fromType<SynchronizerPhase>().valueToKey(
+                    static_cast<int>(currentPhase));
+            tracer->addSpan("phase", name, phaseStartTime, QDateTime::currentDateTimeUtc(),
+                            QVariantMap(), PhaseTrack);
+        }
+    }
+}
+
+/**
+ * @brief The statistics including the time spent so far in the current phase.
+ */
+SyncStatistics DirectorySynchronizerPrivate::statisticsSnapshot() const
+{
+    auto result = statistics;
+    if (inPhase) {
+        result.setPhaseDuration(currentPhase,
+                                result.phaseDuration(currentPhase) + phaseTimer.elapsed());
+    }
+    return result;
+}
+
+/**
+ * @brief Record the finished @p job in the tracer.
+ *
+ * The job is recorded as a span from the time it started (or was created, if it failed before
+ * being started) until it finished, including the paths it operated on and its metrics.
+ */
+void DirectorySynchronizerPrivate::traceJob(AbstractJob* job)
+{
+    if (!tracer) {
+        return;
+    }
+    auto metrics = job->metrics();
+    QVariantMap args { { "type", job->metaObject()->className() },
+                       { "bytesSent", metrics.bytesSent() },
+                       { "bytesReceived", metrics.bytesReceived() },
+                       { "requests", metrics.requests() },
+                       { "retries", metrics.retries() },
+                       { "httpStatus", metrics.httpStatus() },
+                       { "timeToFirstByte", metrics.timeToFirstByte() } };
+    if (job->error() != JobError::NoError) {
+        args["error"] = job->errorString();
+    }
+
+    QString path;
+    QStringList paths;
+    if (auto upload = qobject_cast<UploadFileJob*>(job)) {
+        path = upload->remoteFilename();
+    } else if (auto download = qobject_cast<DownloadFileJob*>(job)) {
+        path = download->remoteFilename();
+    } else if (auto mkdir = qobject_cast<CreateDirectoryJob*>(job)) {
+        path = mkdir->path();
+    } else if (auto del = qobject_cast<DeleteJob*>(job)) {
+        path = del->path();
+    } else if (auto getFileInfo = qobject_cast<GetFileInfoJob*>(job)) {
+        path = getFileInfo->path();
+    } else if (auto listFiles = qobject_cast<ListFilesJob*>(job)) {
+        path = listFiles->path();
+    } else if (auto move = qobject_cast<MoveJob*>(job)) {
+        path = move->path();
+    } else if (auto copy = qobject_cast<CopyJob*>(job)) {
+        path = copy->path();
+    } else if (auto uploadBatch = qobject_cast<UploadFileBatchJob*>(job)) {
+        paths = uploadBatch->remoteFilenames();
+    } else if (auto mkdirBatch = qobject_cast<CreateDirectoryBatchJob*>(job)) {
+        paths = mkdirBatch->paths();
+    } else if (auto deleteBatch = qobject_cast<DeleteBatchJob*>(job)) {
+        paths = deleteBatch->paths();
+    }
+    if (!paths.isEmpty()) {
+        args["paths"] = paths;
+        path = paths.first();
+    }
+    if (!path.isEmpty()) {
+        args["path"] = path;
+    }
+
+    auto start = metrics.startedTime().isValid() ? metrics.startedTime() : metrics.queuedTime();
+    auto name = QString(job->metaObject()->className()).split("::").last();
+    if (!path.isEmpty()) {
+        name += " " + path;
+    }
+    tracer->addSpan("job", name, start, metrics.finishedTime(), args);
+}
+
+/**
+ * @brief Get the id used to refer to the @p path in sync events.
+ *
+ * Ids are assigned on first use, starting at 1.
+ */
+quint32 DirectorySynchronizerPrivate::eventPathId(const QString& path)
+{
+    auto id = eventPathIds.value(path, SyncEvent::NoPath);
+    if (id == SyncEvent::NoPath) {
+        eventPaths << path;
+        id = static_cast<quint32>(eventPaths.length());
+        eventPathIds.insert(path, id);
+    }
+    return id;
+}
+
+/**
+ * @brief Report that an action of the given @p type is carried out on the @p path.
+ *
+ * For moves and copies, the @p sourcePath is the path the resource is moved or copied from.
+ *
+ * The action is reported both as SyncEvent and as log message. As this is called for each file
+ * and folder which is synced, the events and messages are only created if the respective signal
+ * is connected.
+ */
+void DirectorySynchronizerPrivate::reportAction(SynchronizerLogEntryType type,
+                                                const QString& path, const QString& sourcePath)
+{
+    Q_Q(DirectorySynchronizer);
+    static const auto syncEventSignal =
+            QMetaMethod::fromSignal(&DirectorySynchronizer::syncEventAvailable);
+    static const auto logMessageSignal =
+            QMetaMethod::fromSignal(&DirectorySynchronizer::logMessageAvailable);
+    if (q->isSignalConnected(syncEventSignal)) {
+        emit q->syncEventAvailable(SyncEvent(
+                type, eventPathId(path),
+                sourcePath.isEmpty() ? SyncEvent::NoPath : eventPathId(sourcePath)));
+    }
+    if (q->isSignalConnected(logMessageSignal)) {
+        emit q->logMessageAvailable(
+                type, sourcePath.isEmpty() ? path : tr("%1 -> %2").arg(sourcePath, path));
+    }
+}
+
+/**
+ * @brief Record a pass of the remote action scheduler in the tracer.
+ *
+ * This records how many actions were @p started in the pass and how many had to wait, either
+ * because they depend on other actions (@p blockedByDependencies) or because all job slots were
+ * occupied (@p blockedByJobSlots).
+ */
+void DirectorySynchronizerPrivate::traceSchedule(int started, int blockedByDependencies,
+                                                 int blockedByJobSlots)
+{
+    if (!tracer) {
+        return;
+    }
+    auto now = QDateTime::currentDateTimeUtc();
+    tracer->addInstant("scheduler", "schedule", now,
+                       { { "started", started },
+                         { "blockedByDependencies", blockedByDependencies },
+                         { "blockedByJobSlots", blockedByJobSlots },
+                         { "runningJobs", runningJobs } },
+                       SchedulerTrack);
+    tracer->addCounter("sync actions", now,
+                       { { "running", runningJobs },
+                         { "blocked", blockedByDependencies },
+                         { "waiting", blockedByJobSlots } });
+}
+
 void DirectorySynchronizerPrivate::setError(SynchronizerError error, const QString& errorString,
                                             JobError jobError)
 {
@@ -1414,7 +3115,7 @@ void DirectorySynchronizerPrivate::setError(SynchronizerError error, const QStri
     if (this->error == SynchronizerError::NoError) {
         // Check if this could be a server overload scenario - if so, check if we should retry
         // with fewer parallel jobs:
-        if (jobError == JobError::ServerClosedConnection && maxJobs > 1) {
+        if (jobError == JobError::ServerClosedConnection && effectiveMaxJobs() > 1) {
             this->retryWithFewerJobs = true;
         }
         this->error = error;
@@ -1429,6 +3130,7 @@ void DirectorySynchronizerPrivate::createRemoteFolder()
     qCDebug(log) << "Creating remote folder";
     emit q->logMessageAvailable(SynchronizerLogEntryType::Information,
                                 tr("Creating remote root folder"));
+    enterPhase(SynchronizerPhase::CreateRemoteFolder);
     remoteFolderPartsToCreate = remoteDirectoryPath.split("/", Qt::SkipEmptyParts);
     createdRemoteFolderParts.clear();
     createNextRemoteFolderPart();
@@ -1440,9 +3142,15 @@ void DirectorySynchronizerPrivate::createSyncPlan()
     qCDebug(log) << "Creating sync plan";
     qCDebug(log) << "Building local change tree";
     emit q->logMessageAvailable(SynchronizerLogEntryType::Information, tr("Creating sync plan"));
+    enterPhase(SynchronizerPhase::LocalScan);
+    // If we never synced before, files might exist on both sides already. Note that we cannot
+    // check for the root entry here: When creating the remote folder, a stub entry for it has
+    // been stored already. Hence, consider any sync an initial one which has no entries yet:
+    initialSync = syncStateDatabase->findEntries("/").isEmpty();
     localChangeTree = buildLocalChangeTree();
     if (error == SynchronizerError::NoError) {
         qCDebug(log) << "Building remote change tree";
+        enterPhase(SynchronizerPhase::RemoteListing);
         remoteFoldersToScan.enqueue("/");
         buildRemoteChangeTree();
     }
@@ -1459,27 +3167,20 @@ void DirectorySynchronizerPrivate::executeSyncPlan()
     }
 
     qCDebug(log) << "Running local sync actions";
+    enterPhase(SynchronizerPhase::LocalActions);
     runLocalActions();
 
     // Populate list of remote folders to be created and resources to be deleted:
-    for (const auto& action : syncActionsToRun) {
-        switch (action->type) {
-        case MkDirRemote:
-            remoteFoldersToCreate << action->path;
-            break;
-        case DeleteRemote:
-            remoteResourcesToDelete << action->path;
-            break;
-        default:
-            // nothing to do
-            break;
-        }
+    for (const auto& action : qAsConst(syncActionsToRun)) {
+        registerRemoteAction(action);
     }
 
     updateProgress();
 
     if (error == SynchronizerError::NoError) {
         qCDebug(log) << "Running remote sync actions";
+        enterPhase(SynchronizerPhase::Transfers);
+        rateTimer.start();
         runRemoteActions();
     } else {
         finishLater();
@@ -22,6 +22,8 @@
 
 #include <QCoreApplication>
 #include <QDateTime>
+#include <QElapsedTimer>
+#include <QHash>
 #include <QMap>
 #include <QObject>
 #include <QPointer>
@@ -32,8 +34,12 @@
 #include "SynqClient/abstractjob.h"
 #include "changetree.h"
 #include "SynqClient/directorysynchronizer.h"
+#include "SynqClient/fileinfo.h"
 #include "SynqClient/libsynqclient.h"
+#include "SynqClient/localchangewatcher.h"
+#include "SynqClient/syncprogress.h"
 #include "SynqClient/syncstateentry.h"
+#include "SynqClient/synctracer.h"
 #include "syncactions.h"
 
 namespace SynqClient {
@@ -49,21 +55,62 @@ public:
 
     QPointer<AbstractJobFactory> jobFactory;
     QPointer<SyncStateDatabase> syncStateDatabase;
+    bool closeSyncStateDatabase;
     QString localDirectoryPath;
     QString remoteDirectoryPath;
     DirectorySynchronizer::Filter filter;
+    QPointer<LocalChangeWatcher> localChangeWatcher;
     SynchronizerState state;
     SynchronizerError error;
     QString errorString;
     int maxJobs;
+    int maxMultiplexedJobs;
     bool retryWithFewerJobs;
     SyncConflictStrategy syncConflictStrategy;
     SynchronizerFlags flags;
     bool stopped;
     int progress;
     int numTotalSyncActionsToRun;
+    int progressInterval;
+    qint64 plannedBytes;
+    qint64 transferredBytes;
+    QElapsedTimer rateTimer;
+    qint64 rateSampleBytes;
+    double bytesPerSecond;
+    int reportedProgress;
+    qint64 reportedBytes;
+
+    // The weight (in bytes) of a single sync action when calculating the progress:
+    static const qint64 ProgressActionWeight = 4096;
+    // Minimum interval (in ms) in which the throughput estimate is updated and how much the latest
+    // sample contributes to the moving average:
+    static const qint64 MinRateSampleInterval = 250;
+    static constexpr double RateSmoothing = 0.3;
+    int statisticsInterval;
+    SyncStatistics statistics;
+    SynchronizerPhase currentPhase;
+    bool inPhase;
+    QElapsedTimer phaseTimer;
+    QPointer<SyncTracer> tracer;
+    QDateTime phaseStartTime;
+
+    QHash<QString, quint32> eventPathIds;
+    QVector<QString> eventPaths;
+
+    // Tracks used when recording the sync in the tracer:
+    static const int PhaseTrack = 1;
+    static const int SchedulerTrack = 2;
 
     void finishLater();
+    int effectiveMaxJobs() const;
+    void enterPhase(SynchronizerPhase phase);
+    void leavePhase();
+    SyncStatistics statisticsSnapshot() const;
+    void traceJob(AbstractJob* job);
+    quint32 eventPathId(const QString& path);
+    void reportAction(SynchronizerLogEntryType type, const QString& path,
+                      const QString& sourcePath = QString());
+    void traceSchedule(int started, int blockedByDependencies, int blockedByJobSlots);
     void setError(SynchronizerError error, const QString& errorString, JobError jobError);
 
     // Sync Stages:
@@ -76,6 +123,13 @@ public:
     int runningJobs;
     void setupDefaultJobSignals(AbstractJob* job);
     static QMap<QString, SyncStateEntry> syncStateListToMap(const QVector<SyncStateEntry>& list);
+    static QString localFileId(const QString& fileName);
+    static QString makeFingerprint(qint64 size, const FileInfo& fileInfo);
+    static bool parseFingerprint(const QString& fingerprint, qint64& size, QString& algorithm,
+                                 QString& checksum);
+    SyncStateEntry makeSyncStateEntry(const QString& path, const QDateTime& lastModified,
+                                      const QString& syncProperty,
+                                      const FileInfo& fileInfo = FileInfo()) const;
 
     // Create remote folder stage
     QStringList createdRemoteFolderParts;
@@ -88,16 +142,33 @@ public:
     void buildRemoteChangeTreeWebDAVLike();
     void buildRemoteChangeTreeDropboxLike();
     void mergeChangeTrees();
+    void reconcileInitialSync();
     void mergeChangeNodes(const QString& path, const ChangeTreeNode* localChange,
                           const ChangeTreeNode* remoteChange);
     void mergeChangeNodesLocalWins(const QString& path, const ChangeTreeNode& localChange,
                                    const ChangeTreeNode& remoteChange);
     void mergeChangeNodesRemoteWins(const QString& path, const ChangeTreeNode& localChange,
                                     const ChangeTreeNode& remoteChange);
+    void updateRemoteFileIds();
+    void detectLocalMoves();
+    void detectRemoteMoves();
+    void detectRemoteCopies();
+    QSharedPointer<MoveRemoteSyncAction>
+    planRemoteFolderMove(const QString& sourcePath, const QString& targetPath,
+                         const QMap<QString, QSharedPointer<SyncAction>>& targets, int& score);
+
+    void restoreLocalChangeWatcherState();
 
     ChangeTree localChangeTree;
     ChangeTree remoteChangeTree;
+    bool localChangeWatcherStateTaken;
+    bool localChangeWatcherFullScan;
+    QSet<QString> localChangeWatcherDirtyPaths;
     QQueue<QString> remoteFoldersToScan;
+    bool initialSync;
+    QHash<QString, FileInfo> remoteFilesToReconcile;
+    QHash<QString, QString> remoteFileIds;
+    QVector<SyncStateEntry> remoteFileIdUpdates;
 
     // Execute sync stage
     QVector<QSharedPointer<SyncAction>> syncActionsToRun;
@@ -105,13 +176,28 @@ public:
     QStringList remoteResourcesToDelete;
 
     void addSyncAction(SyncAction* action);
+    void registerRemoteAction(const QSharedPointer<SyncAction>& action);
+    void enqueueRemoteActions(const QVector<QSharedPointer<SyncAction>>& actions);
+    bool moveSyncStateEntries(const QString& sourcePath, const QString& targetPath,
+                              const QString& syncAttribute);
+    void rememberRemoteFileId(const QString& path, const FileInfo& fileInfo);
     void runLocalActions();
     void runRemoteActions();
     bool deleteLocally(const QString& path);
     bool canRunAction(const QSharedPointer<SyncAction>& action);
     void runRemoteAction(const QSharedPointer<SyncAction>& action);
-
+    void runRemoteActionBatch(const QVector<QSharedPointer<SyncAction>>& actions);
+    void fetchUploadedFileSyncAttribute(const QSharedPointer<UploadSyncAction>& uploadAction,
+                                        const QString& remoteFilename);
+    int maxBatchSize(SyncActionType type) const;
+    bool canBatchAction(const QSharedPointer<SyncAction>& action) const;
+
+    void addPlannedActions(const QVector<QSharedPointer<SyncAction>>& actions);
+    qint64 expectedTransferSize(const QSharedPointer<SyncAction>& action);
+    void trackTransfer(AbstractJob* job, qint64 expectedBytes, bool upload);
     void updateProgress();
+    void reportProgress();
+    SyncProgress progressSnapshot() const;
 
 signals:
 
@@ -19,6 +19,8 @@
 
 #include "downloadfilejobprivate.h"
 
+#include <QIODevice>
+
 namespace SynqClient {
 
 DownloadFileJobPrivate::DownloadFileJobPrivate(DownloadFileJob* q)
@@ -28,10 +30,182 @@ DownloadFileJobPrivate::DownloadFileJobPrivate(DownloadFileJob* q)
       data(),
       remoteFilename(),
       targetType(DownloadTarget::Data),
-      fileInfo()
+      fileInfo(),
+      checksumHasher(),
+      expectedChecksum(),
+      writer(),
+      downloadReply(),
+      finishCallback()
+{
+}
+
+DownloadFileJobPrivate::~DownloadFileJobPrivate()
 {
+    cancelDownload();
 }
 
-DownloadFileJobPrivate::~DownloadFileJobPrivate() {}
+/**
+ * @brief The maximum number of bytes buffered in a network reply.
+ *
+ * Together with the bounded queue of the AsyncDeviceWriter, this limits the memory used per
+ * download.
+ */
+const qint64 DownloadFileJobPrivate::ReadBufferSize = 4 * AsyncDeviceWriter::ChunkSize;
+
+/**
+ * @brief Verify the downloaded data against the @p checksum calculated with the @p algorithm.
+ *
+ * Concrete jobs call this as soon as they learn about the checksum of the file (usually from the
+ * response headers). Data read by readDownloadedData() afterwards is hashed on the fly. Calling
+ * this with an empty or unsupported algorithm disables verification.
+ */
+void DownloadFileJobPrivate::expectChecksum(const QString& algorithm, const QString& checksum)
+{
+    checksumHasher.reset(new ContentHasher(algorithm));
+    expectedChecksum = checksum.toLower();
+    if (!checksumHasher->isValid() || expectedChecksum.isEmpty()) {
+        checksumHasher.reset();
+        expectedChecksum.clear();
+    }
+}
+
+/**
+ * @brief Start streaming the data received via the @p reply into the @p device.
+ *
+ * The read buffer of the reply is limited, so the network layer stops receiving data if we cannot
+ * write it fast enough. Data is written to the device using an AsyncDeviceWriter, hence, the
+ * device must not be used until the download finished (see finishDownload()) or has been
+ * cancelled (see cancelDownload()).
+ */
+void DownloadFileJobPrivate::startDownload(QNetworkReply* reply, QIODevice* device)
+{
+    Q_Q(DownloadFileJob);
+    cancelDownload();
+    reply->setReadBufferSize(ReadBufferSize);
+    downloadReply = reply;
+    writer.reset(new AsyncDeviceWriter(device));
+    QObject::connect(reply, &QNetworkReply::readyRead, q, [=]() { readDownloadedData(reply); });
+    QObject::connect(writer.data(), &AsyncDeviceWriter::chunksWritten, q, [=]() {
+        if (!writer) {
+            // Notification from a writer which has been cancelled in the meantime:
+            return;
+        }
+        if (writer->hasError()) {
+            // No need to continue - the reply's finished handler will report the error:
+            if (downloadReply) {
+                downloadReply->abort();
+            }
+            downloadReply.clear();
+        } else if (downloadReply) {
+            readDownloadedData(downloadReply);
+        }
+        if (finishCallback && writer->isIdle()) {
+            auto callback = finishCallback;
+            finishCallback = nullptr;
+            callback();
+        }
+    });
+}
+
+/**
+ * @brief Read data received via the @p reply and queue it for writing.
+ *
+ * This reads data until the writer's queue is full. The remaining data is read once queued chunks
+ * have been written. If @p ignoreLimit is true, all available data is read.
+ */
+void DownloadFileJobPrivate::readDownloadedData(QNetworkReply* reply, bool ignoreLimit)
+{
+    if (!writer) {
+        return;
+    }
+    while (reply->bytesAvailable() > 0 && !writer->hasError()
+           && (ignoreLimit || writer->canWrite())) {
+        auto chunk = writer->takeBuffer();
+        auto size = reply->read(chunk.data(), chunk.length());
+        if (size <= 0) {
+            break;
+        }
+        chunk.resize(static_cast<int>(size));
+        if (checksumHasher) {
+            checksumHasher->addData(chunk.constData(), size);
+        }
+        writer->write(chunk);
+    }
+}
+
+/**
+ * @brief Finish the download after the @p reply finished successfully.
+ *
+ * This queues the remaining data of the reply (which is at most ReadBufferSize bytes) and runs the
+ * @p callback once all data has been written to the device. The reply is not used afterwards, so
+ * it may be deleted right away.
+ */
+void DownloadFileJobPrivate::finishDownload(QNetworkReply* reply,
+                                            const std::function<void()>& callback)
+{
+    readDownloadedData(reply, true);
+    downloadReply.clear();
+    if (writer && !writer->isIdle()) {
+        finishCallback = callback;
+    } else {
+        callback();
+    }
+}
+
+/**
+ * @brief Stop writing downloaded data.
+ *
+ * Data which has not yet been written is dropped. When this returns, the download device can be
+ * used again.
+ */
+void DownloadFileJobPrivate::cancelDownload()
+{
+    writer.reset();
+    downloadReply.clear();
+    finishCallback = nullptr;
+}
+
+/**
+ * @brief Check that all downloaded data has been written successfully.
+ *
+ * If writing failed, the error of the job is set to JobError::WriteFailed and false is returned.
+ */
+bool DownloadFileJobPrivate::checkWriteSucceeded()
+{
+    Q_Q(DownloadFileJob);
+    if (writer && writer->hasError()) {
+        q->setError(JobError::WriteFailed,
+                    QString("Failed to write downloaded data of %1: %2")
+                            .arg(remoteFilename, writer->errorString()));
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Check that the downloaded data matches the expected checksum.
+ *
+ * If the checksum differs, the error of the job is set to JobError::ChecksumMismatch and false is
+ * returned. Otherwise, the verified checksum is added to the @p fileInfo (which the concrete job
+ * reports for the downloaded file). If no checksum is known, this returns true.
+ */
+bool DownloadFileJobPrivate::verifyChecksum(FileInfo& fileInfo)
+{
+    Q_Q(DownloadFileJob);
+    if (!checksumHasher) {
+        return true;
+    }
+    auto algorithm = checksumHasher->algorithm();
+    auto checksum = checksumHasher->result();
+    checksumHasher.reset();
+    if (checksum != expectedChecksum) {
+        q->setError(JobError::ChecksumMismatch,
+                    QString("Checksum mismatch for %1: Expected %2 checksum %3, got %4")
+                            .arg(remoteFilename, algorithm, expectedChecksum, checksum));
+        return false;
+    }
+    fileInfo.setChecksum(algorithm, checksum);
+    return true;
+}
 
 } // namespace SynqClient
@@ -20,11 +20,17 @@
 #ifndef SYNQCLIENT_DOWNLOADFILEJOBPRIVATE_H
 #define SYNQCLIENT_DOWNLOADFILEJOBPRIVATE_H
 
+#include <functional>
+
+#include <QNetworkReply>
 #include <QPointer>
+#include <QSharedPointer>
 #include <QVariantMap>
 
 #include "abstractjobprivate.h"
 #include "SynqClient/downloadfilejob.h"
+#include "asyncdevicewriter.h"
+#include "contenthasher.h"
 
 namespace SynqClient {
 
@@ -44,6 +50,21 @@ public:
     QString remoteFilename;
     DownloadTarget targetType;
     FileInfo fileInfo;
+    QSharedPointer<ContentHasher> checksumHasher;
+    QString expectedChecksum;
+    QSharedPointer<AsyncDeviceWriter> writer;
+    QPointer<QNetworkReply> downloadReply;
+    std::function<void()> finishCallback;
+
+    static const qint64 ReadBufferSize;
+
+    void expectChecksum(const QString& algorithm, const QString& checksum);
+    void startDownload(QNetworkReply* reply, QIODevice* device);
+    void readDownloadedData(QNetworkReply* reply, bool ignoreLimit = false);
+    void finishDownload(QNetworkReply* reply, const std::function<void()>& callback);
+    void cancelDownload();
+    bool checkWriteSucceeded();
+    bool verifyChecksum(FileInfo& fileInfo);
 };
 
 } // namespace SynqClient
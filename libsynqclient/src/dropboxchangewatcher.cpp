@@ -0,0 +1,227 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../inc/SynqClient/dropboxchangewatcher.h"
+
+#include <QNetworkReply>
+#include <QTimer>
+
+#include "dropboxchangewatcherprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @class DropboxChangeWatcher
+ * @brief Get notified about changes in a Dropbox.
+ *
+ * This class uses the `/files/list_folder/longpoll` endpoint of the Dropbox API to wait for
+ * changes in a remote folder. Instead of running syncs periodically, client code can use it to
+ * only run a sync if there actually are remote changes:
+ *
+ * @code
+ * auto watcher = new SynqClient::DropboxChangeWatcher(this);
+ * watcher->setNetworkAccessManager(nam);
+ * watcher->setSyncStateDatabase(db);
+ * connect(watcher, &SynqClient::DropboxChangeWatcher::remoteChanged, [=]() {
+ *     runSync();
+ * });
+ * watcher->start();
+ * @endcode
+ *
+ * The watcher requires a cursor, which identifies the folder and the state it has been seen
+ * last. By default, the cursor is read from the syncStateDatabase(), where the
+ * DirectorySynchronizer stores it after a sync. Alternatively, it can be set explicitly via
+ * setCursor().
+ *
+ * If no cursor is available yet, the watcher emits remoteChanged() once, as a sync is required to
+ * obtain one.
+ */
+
+/**
+ * @brief Constructor.
+ */
+DropboxChangeWatcher::DropboxChangeWatcher(QObject* parent)
+    : QObject(parent), d_ptr(new DropboxChangeWatcherPrivate(this))
+{
+}
+
+/**
+ * @brief Destructor.
+ */
+DropboxChangeWatcher::~DropboxChangeWatcher()
+{
+    Q_D(DropboxChangeWatcher);
+    d->running = false;
+    if (d->reply) {
+        d->reply->abort();
+    }
+}
+
+/**
+ * @brief Indicates if the watcher is currently running.
+ */
+bool DropboxChangeWatcher::running() const
+{
+    Q_D(const DropboxChangeWatcher);
+    return d->running;
+}
+
+/**
+ * @brief The network access manager used by the watcher.
+ */
+QNetworkAccessManager* DropboxChangeWatcher::networkAccessManager() const
+{
+    Q_D(const DropboxChangeWatcher);
+    return d->networkAccessManager;
+}
+
+/**
+ * @brief Set the @p networkAccessManager to be used by the watcher.
+ */
+void DropboxChangeWatcher::setNetworkAccessManager(QNetworkAccessManager* networkAccessManager)
+{
+    Q_D(DropboxChangeWatcher);
+    d->networkAccessManager = networkAccessManager;
+}
+
+/**
+ * @brief The user agent used when talking to the Dropbox API.
+ */
+QString DropboxChangeWatcher::userAgent() const
+{
+    Q_D(const DropboxChangeWatcher);
+    return d->userAgent;
+}
+
+/**
+ * @brief Set the @p userAgent used when talking to the Dropbox API.
+ */
+void DropboxChangeWatcher::setUserAgent(const QString& userAgent)
+{
+    Q_D(DropboxChangeWatcher);
+    d->userAgent = userAgent;
+}
+
+/**
+ * @brief The sync state database to read the cursor from.
+ *
+ * If set, the cursor is read from the sync property of the root entry of this database. This is
+ * the place where the DirectorySynchronizer stores the cursor after syncing with a Dropbox.
+ */
+SyncStateDatabase* DropboxChangeWatcher::syncStateDatabase() const
+{
+    Q_D(const DropboxChangeWatcher);
+    return d->syncStateDatabase;
+}
+
+/**
+ * @brief Set the @p syncStateDatabase to read the cursor from.
+ */
+void DropboxChangeWatcher::setSyncStateDatabase(SyncStateDatabase* syncStateDatabase)
+{
+    Q_D(DropboxChangeWatcher);
+    d->syncStateDatabase = syncStateDatabase;
+}
+
+/**
+ * @brief The cursor to use to watch for changes.
+ *
+ * If this is set to a non-empty string, it takes precedence over the cursor stored in the
+ * syncStateDatabase().
+ */
+QString DropboxChangeWatcher::cursor() const
+{
+    Q_D(const DropboxChangeWatcher);
+    return d->cursor;
+}
+
+/**
+ * @brief Set the @p cursor to use to watch for changes.
+ */
+void DropboxChangeWatcher::setCursor(const QString& cursor)
+{
+    Q_D(DropboxChangeWatcher);
+    d->cursor = cursor;
+}
+
+/**
+ * @brief The timeout of a single longpoll request (in seconds).
+ *
+ * The Dropbox API accepts values between 30 and 480 seconds. The default is 30 seconds.
+ */
+int DropboxChangeWatcher::timeout() const
+{
+    Q_D(const DropboxChangeWatcher);
+    return d->timeout;
+}
+
+/**
+ * @brief Set the @p timeout of a single longpoll request (in seconds).
+ *
+ * Values outside of the range accepted by Dropbox are clamped.
+ */
+void DropboxChangeWatcher::setTimeout(int timeout)
+{
+    Q_D(DropboxChangeWatcher);
+    d->timeout = qBound(30, timeout, 480);
+}
+
+/**
+ * @brief Start watching for changes.
+ */
+void DropboxChangeWatcher::start()
+{
+    Q_D(DropboxChangeWatcher);
+    if (d->running) {
+        return;
+    }
+    d->running = true;
+    d->waitingForCursorChange = false;
+    d->numFailures = 0;
+    d->lastCursor.clear();
+    emit runningChanged();
+    d->scheduleLongpoll(0);
+}
+
+/**
+ * @brief Stop watching for changes.
+ */
+void DropboxChangeWatcher::stop()
+{
+    Q_D(DropboxChangeWatcher);
+    if (!d->running) {
+        return;
+    }
+    d->running = false;
+    d->timer->stop();
+    if (d->reply) {
+        d->reply->abort();
+    }
+    emit runningChanged();
+}
+
+/**
+ * @brief Constructor.
+ */
+DropboxChangeWatcher::DropboxChangeWatcher(DropboxChangeWatcherPrivate* d, QObject* parent)
+    : QObject(parent), d_ptr(d)
+{
+}
+
+} // namespace SynqClient
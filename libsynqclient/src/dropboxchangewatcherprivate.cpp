@@ -0,0 +1,196 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "dropboxchangewatcherprivate.h"
+
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QLoggingCategory>
+#include <QNetworkAccessManager>
+#include <QTimer>
+
+#include "abstractwebdavjobprivate.h"
+
+namespace SynqClient {
+
+static Q_LOGGING_CATEGORY(log, "SynqClient.DropboxChangeWatcher", QtWarningMsg);
+
+const QString DropboxChangeWatcherPrivate::NotifyAPIv2 = "https://notify.dropboxapi.com/2";
+
+DropboxChangeWatcherPrivate::DropboxChangeWatcherPrivate(DropboxChangeWatcher* q)
+    : QObject(),
+      q_ptr(q),
+      networkAccessManager(nullptr),
+      userAgent(AbstractWebDAVJobPrivate::DefaultUserAgent),
+      syncStateDatabase(nullptr),
+      cursor(),
+      lastCursor(),
+      timeout(30),
+      running(false),
+      waitingForCursorChange(false),
+      numFailures(0),
+      timer(new QTimer(this)),
+      reply(nullptr)
+{
+    timer->setSingleShot(true);
+    connect(timer, &QTimer::timeout, this, &DropboxChangeWatcherPrivate::longpoll);
+}
+
+/**
+ * @brief Get the cursor to use for the next longpoll.
+ *
+ * If a cursor has been set explicitly, this one is used. Otherwise, the cursor is read from the
+ * sync state database, where the DirectorySynchronizer stores it as sync property of the root
+ * entry.
+ */
+QString DropboxChangeWatcherPrivate::currentCursor()
+{
+    if (!cursor.isEmpty()) {
+        return cursor;
+    }
+    if (!syncStateDatabase) {
+        return QString();
+    }
+    if (syncStateDatabase->isOpen()) {
+        return syncStateDatabase->getEntry("/").syncProperty();
+    }
+    if (!syncStateDatabase->openDatabase()) {
+        qCWarning(log) << "Failed to open the sync state database to read the cursor";
+        return QString();
+    }
+    auto result = syncStateDatabase->getEntry("/").syncProperty();
+    syncStateDatabase->closeDatabase();
+    return result;
+}
+
+void DropboxChangeWatcherPrivate::scheduleLongpoll(int delay)
+{
+    timer->start(delay);
+}
+
+void DropboxChangeWatcherPrivate::longpoll()
+{
+    Q_Q(DropboxChangeWatcher);
+    if (!running || reply) {
+        return;
+    }
+
+    auto currentCursor_ = currentCursor();
+    if (currentCursor_.isEmpty()) {
+        // We cannot watch without a cursor - a sync is required to get one:
+        if (!waitingForCursorChange) {
+            qCDebug(log) << "No cursor available - requesting a sync";
+            waitingForCursorChange = true;
+            lastCursor.clear();
+            emit q->remoteChanged();
+        }
+        scheduleLongpoll(CursorCheckInterval);
+        return;
+    }
+
+    if (waitingForCursorChange) {
+        if (currentCursor_ == lastCursor) {
+            // Changes have not been fetched yet - check again later:
+            scheduleLongpoll(CursorCheckInterval);
+            return;
+        }
+        waitingForCursorChange = false;
+    }
+    lastCursor = currentCursor_;
+
+    if (!networkAccessManager) {
+        emit q->errorOccurred(tr("No QNetworkAccessManager is set"));
+        scheduleLongpoll(RetryInterval);
+        return;
+    }
+
+    QNetworkRequest req;
+    req.setUrl(NotifyAPIv2 + "/files/list_folder/longpoll");
+    req.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
+    req.setHeader(QNetworkRequest::UserAgentHeader, userAgent);
+    // Dropbox adds up to 90 seconds of random jitter to the timeout:
+    req.setTransferTimeout((timeout + 90) * 1000);
+    // Note: The longpoll endpoint does not require (and does not accept) authentication.
+    QVariantMap data { { "cursor", currentCursor_ }, { "timeout", timeout } };
+    reply = networkAccessManager->post(
+            req, QJsonDocument::fromVariant(data).toJson(QJsonDocument::Compact));
+    if (reply) {
+        connect(reply, &QNetworkReply::finished, this,
+                &DropboxChangeWatcherPrivate::onLongpollFinished);
+    } else {
+        emit q->errorOccurred(tr("Received null network reply"));
+        scheduleLongpoll(RetryInterval);
+    }
+}
+
+void DropboxChangeWatcherPrivate::onLongpollFinished()
+{
+    Q_Q(DropboxChangeWatcher);
+    auto finishedReply = reply;
+    reply.clear();
+    if (!finishedReply) {
+        return;
+    }
+    finishedReply->deleteLater();
+    if (!running) {
+        return;
+    }
+
+    auto code = finishedReply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    if (finishedReply->error() != QNetworkReply::NoError) {
+        if (code == 409) {
+            // The cursor has been reset - a sync is required to get a new one:
+            qCDebug(log) << "Cursor has been reset - requesting a sync";
+            numFailures = 0;
+            waitingForCursorChange = true;
+            emit q->remoteChanged();
+            scheduleLongpoll(CursorCheckInterval);
+        } else {
+            numFailures += 1;
+            emit q->errorOccurred(finishedReply->errorString() + " "
+                                  + finishedReply->readAll());
+            scheduleLongpoll(qMin(RetryInterval * numFailures, MaxRetryInterval));
+        }
+        return;
+    }
+
+    QJsonParseError error;
+    auto doc = QJsonDocument::fromJson(finishedReply->readAll(), &error);
+    if (error.error != QJsonParseError::NoError) {
+        numFailures += 1;
+        emit q->errorOccurred(tr("Failed to parse JSON response: %1").arg(error.errorString()));
+        scheduleLongpoll(qMin(RetryInterval * numFailures, MaxRetryInterval));
+        return;
+    }
+
+    numFailures = 0;
+    auto obj = doc.object();
+    // If the server asks us to back off, we must not call longpoll again before the given number
+    // of seconds passed:
+    auto delay = obj.value("backoff").toInt(0) * 1000;
+    if (obj.value("changes").toBool()) {
+        qCDebug(log) << "Remote folder has changed";
+        waitingForCursorChange = true;
+        emit q->remoteChanged();
+        delay = qMax(delay, CursorCheckInterval);
+    }
+    scheduleLongpoll(delay);
+}
+
+} // namespace SynqClient
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_DROPBOXCHANGEWATCHERPRIVATE_H
+#define SYNQCLIENT_DROPBOXCHANGEWATCHERPRIVATE_H
+
+#include <QNetworkReply>
+#include <QPointer>
+
+#include "SynqClient/dropboxchangewatcher.h"
+#include "SynqClient/syncstatedatabase.h"
+
+class QNetworkAccessManager;
+class QTimer;
+
+namespace SynqClient {
+
+class DropboxChangeWatcherPrivate : public QObject
+{
+    Q_OBJECT
+public:
+    static const QString NotifyAPIv2;
+
+    explicit DropboxChangeWatcherPrivate(DropboxChangeWatcher* q);
+
+    DropboxChangeWatcher* q_ptr;
+    Q_DECLARE_PUBLIC(DropboxChangeWatcher);
+
+    QPointer<QNetworkAccessManager> networkAccessManager;
+    QString userAgent;
+    QPointer<SyncStateDatabase> syncStateDatabase;
+    QString cursor;
+    QString lastCursor;
+    int timeout;
+    bool running;
+    bool waitingForCursorChange;
+    int numFailures;
+    QTimer* timer;
+    QPointer<QNetworkReply> reply;
+
+    const int CursorCheckInterval = 1000;
+    const int RetryInterval = 5000;
+    const int MaxRetryInterval = 300000;
+
+    QString currentCursor();
+    void scheduleLongpoll(int delay);
+
+public slots:
+
+    void longpoll();
+    void onLongpollFinished();
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_DROPBOXCHANGEWATCHERPRIVATE_H
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../inc/SynqClient/dropboxcopyjob.h"
+
+#include "abstractdropboxjobprivate.h"
+#include "dropboxcopyjobprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @class DropboxCopyJob
+ * @brief Implementation of the CopyJob for Dropbox.
+ *
+ * This job uses the `files/copy_v2` endpoint. As Dropbox cannot replace existing resources when
+ * moving, an existing target is deleted first if overwrite() is set.
+ */
+
+/**
+ * @brief Constructor.
+ */
+DropboxCopyJob::DropboxCopyJob(QObject* parent)
+    : CopyJob(new DropboxCopyJobPrivate(this), parent), AbstractDropboxJob()
+{
+}
+
+/**
+ * @brief Destructor.
+ */
+DropboxCopyJob::~DropboxCopyJob() {}
+
+/**
+ * @brief Implementation of AbstractJob::start().
+ */
+void DropboxCopyJob::start()
+{
+    Q_D(DropboxCopyJob);
+    d->request.start(d_ptr2.data());
+}
+
+/**
+ * @brief Implementation of AbstractJob::stop().
+ */
+void DropboxCopyJob::stop()
+{
+    Q_D(DropboxCopyJob);
+    d->request.stop(d_ptr2.data());
+}
+
+/**
+ * @brief Constructor.
+ */
+DropboxCopyJob::DropboxCopyJob(DropboxCopyJobPrivate* d, QObject* parent)
+    : CopyJob(d, parent), AbstractDropboxJob()
+{
+}
+
+} // namespace SynqClient
@@ -0,0 +1,208 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "dropboxcopymoverequest.h"
+
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTimer>
+
+#include "abstractcopymovejobprivate.h"
+#include "abstractdropboxjobprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @class DropboxCopyMoveRequest
+ * @brief Implementation of the DropboxMoveJob and DropboxCopyJob.
+ *
+ * The `files/move_v2` and `files/copy_v2` endpoints take the same parameters and report the same
+ * errors. Hence, both jobs delegate to this class. As Dropbox cannot replace existing resources
+ * when moving or copying, an existing target is deleted first if the job shall overwrite it.
+ */
+
+/**
+ * @brief Constructor.
+ *
+ * The request is sent on behalf of the @p job to the given Dropbox API @p endpoint.
+ */
+DropboxCopyMoveRequest::DropboxCopyMoveRequest(AbstractCopyMoveJobPrivate* job,
+                                               const QString& endpoint)
+    : m_job(job), m_endpoint(endpoint), m_targetDeleted(false)
+{
+}
+
+/**
+ * @brief Send the request.
+ */
+void DropboxCopyMoveRequest::start(AbstractDropboxJobPrivate* dropbox)
+{
+    auto q = m_job->q_func();
+    m_job->setState(JobState::Running);
+
+    if (!checkParameters(dropbox)) {
+        m_job->finishLater();
+        return;
+    }
+
+    QVariantMap data { { "from_path", AbstractDropboxJobPrivate::fixPath(m_job->path) },
+                       { "to_path", AbstractDropboxJobPrivate::fixPath(m_job->targetPath) },
+                       { "autorename", false } };
+
+    auto reply = dropbox->post(m_endpoint, data, q);
+
+    if (reply) {
+        QObject::connect(reply, &QNetworkReply::finished, q,
+                         [=]() { handleRequestFinished(dropbox, reply); });
+        dropbox->reply = reply;
+    } else {
+        m_job->setError(JobError::InvalidResponse,
+                        AbstractCopyMoveJob::tr("Received null network reply"));
+        m_job->finishLater();
+    }
+}
+
+/**
+ * @brief Abort a running request.
+ */
+void DropboxCopyMoveRequest::stop(AbstractDropboxJobPrivate* dropbox)
+{
+    if (m_job->state == JobState::Running) {
+        auto reply = dropbox->reply;
+        if (reply) {
+            reply->abort();
+            delete reply;
+        }
+        m_job->setError(JobError::Stopped, "The job has been stopped");
+        m_job->finishLater();
+    }
+}
+
+bool DropboxCopyMoveRequest::checkParameters(AbstractDropboxJobPrivate* dropbox)
+{
+    auto error = dropbox->checkDefaultParameters();
+    auto code = std::get<0>(error);
+    if (code != JobError::NoError) {
+        m_job->setError(code, std::get<1>(error));
+        return false;
+    }
+
+    if (m_job->path.isEmpty()) {
+        m_job->setError(JobError::MissingParameter, AbstractCopyMoveJob::tr("No path specified"));
+        return false;
+    }
+
+    if (m_job->targetPath.isEmpty()) {
+        m_job->setError(JobError::MissingParameter,
+                        AbstractCopyMoveJob::tr("No target path specified"));
+        return false;
+    }
+    return true;
+}
+
+void DropboxCopyMoveRequest::handleRequestFinished(AbstractDropboxJobPrivate* dropbox,
+                                                   QNetworkReply* reply)
+{
+    auto q = m_job->q_func();
+    reply->deleteLater();
+    if (dropbox->checkIfRequestShallBeRetried(reply)) {
+        dropbox->numRetries += 1;
+        QTimer::singleShot(dropbox->getRetryDelayInMilliseconds(reply), q, [=]() { q->start(); });
+        return;
+    }
+    if (reply->error() == QNetworkReply::NoError) {
+        QJsonParseError error;
+        auto doc = QJsonDocument::fromJson(reply->readAll(), &error);
+        if (error.error == QJsonParseError::NoError) {
+            m_job->fileInfo = dropbox->fileInfoFromJson(doc.object().value("metadata").toObject());
+        } else {
+            m_job->setError(JobError::InvalidResponse,
+                            AbstractCopyMoveJob::tr("Failed to parse %1 result: %2")
+                                    .arg(m_job->operation, error.errorString()));
+        }
+    } else {
+        auto targetExists = false;
+        dropbox->tryHandleKnownError(
+                reply->readAll(),
+                { { { { "error", "from_lookup", ".tag" }, "not_found" },
+                    [=](const QJsonDocument&) {
+                        m_job->setError(JobError::ResourceNotFound,
+                                        AbstractCopyMoveJob::tr("The resource %1 does not exist")
+                                                .arg(m_job->path));
+                    } },
+                  { { { "error", "to", ".tag" }, "conflict" },
+                    [&](const QJsonDocument&) { targetExists = true; } } });
+        if (targetExists) {
+            if (m_job->overwrite && !m_targetDeleted) {
+                deleteTarget(dropbox);
+                return;
+            }
+            m_job->setError(JobError::ResourceExists,
+                            AbstractCopyMoveJob::tr("The %1 target %2 already exists")
+                                    .arg(m_job->operation, m_job->targetPath));
+        }
+        if (m_job->error == JobError::NoError) {
+            // Unrecognized error - "fail generically"
+            m_job->setError(JobError::NetworkRequestFailed, reply->errorString());
+        }
+    }
+    m_job->finishLater();
+}
+
+/**
+ * @brief Delete the target of the operation.
+ *
+ * Dropbox cannot replace existing targets when moving or copying. Hence, if the job shall
+ * overwrite the target, we delete it first and afterwards restart the operation.
+ */
+void DropboxCopyMoveRequest::deleteTarget(AbstractDropboxJobPrivate* dropbox)
+{
+    auto q = m_job->q_func();
+    QVariantMap data { { "path", AbstractDropboxJobPrivate::fixPath(m_job->targetPath) } };
+    auto reply = dropbox->post("/files/delete_v2", data, q);
+    if (reply) {
+        QObject::connect(reply, &QNetworkReply::finished, q, [=]() {
+            reply->deleteLater();
+            if (dropbox->checkIfRequestShallBeRetried(reply)) {
+                dropbox->numRetries += 1;
+                QTimer::singleShot(dropbox->getRetryDelayInMilliseconds(reply), q,
+                                   [=]() { deleteTarget(dropbox); });
+                return;
+            }
+            if (reply->error() == QNetworkReply::NoError) {
+                m_targetDeleted = true;
+                q->start();
+            } else {
+                m_job->setError(JobError::NetworkRequestFailed,
+                                AbstractCopyMoveJob::tr("Failed to remove %1 target %2: %3")
+                                        .arg(m_job->operation, m_job->targetPath,
+                                             reply->errorString()));
+                m_job->finishLater();
+            }
+        });
+        dropbox->reply = reply;
+    } else {
+        m_job->setError(JobError::InvalidResponse,
+                        AbstractCopyMoveJob::tr("Received null network reply"));
+        m_job->finishLater();
+    }
+}
+
+} // namespace SynqClient
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef SYNQCLIENT_DROPBOXCOPYMOVEREQUEST_H
+#define SYNQCLIENT_DROPBOXCOPYMOVEREQUEST_H
+
+#include <QString>
+
+class QNetworkReply;
+
+namespace SynqClient {
+
+class AbstractCopyMoveJobPrivate;
+class AbstractDropboxJobPrivate;
+
+class DropboxCopyMoveRequest
+{
+public:
+    DropboxCopyMoveRequest(AbstractCopyMoveJobPrivate* job, const QString& endpoint);
+
+    void start(AbstractDropboxJobPrivate* dropbox);
+    void stop(AbstractDropboxJobPrivate* dropbox);
+
+private:
+    AbstractCopyMoveJobPrivate* m_job;
+    QString m_endpoint;
+    bool m_targetDeleted;
+
+    bool checkParameters(AbstractDropboxJobPrivate* dropbox);
+    void handleRequestFinished(AbstractDropboxJobPrivate* dropbox, QNetworkReply* reply);
+    void deleteTarget(AbstractDropboxJobPrivate* dropbox);
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_DROPBOXCOPYMOVEREQUEST_H
@@ -0,0 +1,158 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../inc/SynqClient/dropboxcreatedirectorybatchjob.h"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include "abstractdropboxjobprivate.h"
+#include "dropboxcreatedirectorybatchjobprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @class DropboxCreateDirectoryBatchJob
+ * @brief Implementation of the CreateDirectoryBatchJob for Dropbox.
+ *
+ * This job uses the `/files/create_folder_batch` endpoint to create all folders within a single
+ * request. If Dropbox decides to process the batch asynchronously, the job polls the status of
+ * the batch until it completed.
+ *
+ * As with the DropboxCreateDirectoryJob, missing parent folders are created implicitly.
+ */
+
+/**
+ * @brief Constructor.
+ */
+DropboxCreateDirectoryBatchJob::DropboxCreateDirectoryBatchJob(QObject* parent)
+    : CreateDirectoryBatchJob(new DropboxCreateDirectoryBatchJobPrivate(this), parent),
+      AbstractDropboxJob()
+{
+}
+
+/**
+ * @brief Destructor.
+ */
+DropboxCreateDirectoryBatchJob::~DropboxCreateDirectoryBatchJob() {}
+
+/**
+ * @brief Implementation of AbstractJob::start().
+ */
+void DropboxCreateDirectoryBatchJob::start()
+{
+    Q_D(DropboxCreateDirectoryBatchJob);
+    setState(JobState::Running);
+    clearEntryResults();
+
+    {
+        auto error = d_ptr2->checkDefaultParameters();
+        auto code = std::get<0>(error);
+        if (code != JobError::NoError) {
+            setError(code, std::get<1>(error));
+            finishLater();
+            return;
+        }
+    }
+
+    if (d->paths.isEmpty()) {
+        setError(JobError::MissingParameter, tr("No folders to create given"));
+        finishLater();
+        return;
+    }
+
+    QVariantList paths;
+    for (const auto& path : qAsConst(d->paths)) {
+        paths << AbstractDropboxJobPrivate::fixPath(path);
+    }
+    QVariantMap data { { "paths", paths }, { "autorename", false }, { "force_async", false } };
+
+    d_ptr2->runBatch(
+            "/files/create_folder_batch", data, this,
+            [=](const QJsonObject& result) {
+                auto entries = result.value("entries").toArray();
+                for (int i = 0; i < d->paths.length(); ++i) {
+                    auto path = d->paths.at(i);
+                    if (i >= entries.size()) {
+                        setEntryError(path, JobError::InvalidResponse,
+                                      tr("Missing result for folder %1").arg(path));
+                        continue;
+                    }
+                    auto entry = entries.at(i).toObject();
+                    if (entry.value(".tag").toString() == "success") {
+                        setEntryFileInfo(path,
+                                         d_ptr2->fileInfoFromJson(
+                                                 entry.value("metadata").toObject(), QString(),
+                                                 "folder"));
+                    } else {
+                        // {".tag": "failure", "failure": {".tag": "path", "path": {".tag":
+                        // "conflict", "conflict": {".tag": "folder"}}}}
+                        d_ptr2->tryHandleKnownError(
+                                QJsonDocument(entry).toJson(),
+                                { { { { "failure", "path", "conflict", ".tag" }, "folder" },
+                                    [=](const QJsonDocument&) {
+                                        setEntryError(path, JobError::FolderExists,
+                                                      tr("The remote folder %1 already exists")
+                                                              .arg(path));
+                                    } } });
+                        if (entryError(path) == JobError::NoError) {
+                            setEntryError(path, JobError::NetworkRequestFailed,
+                                          tr("Failed to create folder %1: %2")
+                                                  .arg(path,
+                                                       QString::fromUtf8(
+                                                               QJsonDocument(entry).toJson(
+                                                                       QJsonDocument::Compact))));
+                        }
+                    }
+                }
+                finishLater();
+            },
+            [=](JobError error, const QString& errorString) {
+                setError(error, errorString);
+                finishLater();
+            });
+}
+
+/**
+ * @brief Implementation of AbstractJob::stop().
+ */
+void DropboxCreateDirectoryBatchJob::stop()
+{
+    if (state() == JobState::Running) {
+        auto reply = d_ptr2->reply;
+        if (reply) {
+            reply->abort();
+            delete reply;
+        }
+        setError(JobError::Stopped, "The job has been stopped");
+        finishLater();
+    }
+}
+
+/**
+ * @brief Constructor.
+ */
+DropboxCreateDirectoryBatchJob::DropboxCreateDirectoryBatchJob(
+        DropboxCreateDirectoryBatchJobPrivate* d, QObject* parent)
+    : CreateDirectoryBatchJob(d, parent), AbstractDropboxJob()
+{
+}
+
+} // namespace SynqClient
@@ -57,7 +57,7 @@ DropboxCreateDirectoryJob::~DropboxCreateDirectoryJob() {}
 void DropboxCreateDirectoryJob::start()
 {
     Q_D(DropboxCreateDirectoryJob);
-    d->state = JobState::Running;
+    setState(JobState::Running);
 
     {
         auto error = d_ptr2->checkDefaultParameters();
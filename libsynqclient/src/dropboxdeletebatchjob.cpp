@@ -0,0 +1,154 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../inc/SynqClient/dropboxdeletebatchjob.h"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include "abstractdropboxjobprivate.h"
+#include "dropboxdeletebatchjobprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @class DropboxDeleteBatchJob
+ * @brief Implementation of the DeleteBatchJob for Dropbox.
+ *
+ * This job uses the `/files/delete_batch` endpoint to delete all resources within a single
+ * request. Dropbox processes such batches asynchronously, hence the job polls the status of the
+ * batch until it completed.
+ */
+
+/**
+ * @brief Constructor.
+ */
+DropboxDeleteBatchJob::DropboxDeleteBatchJob(QObject* parent)
+    : DeleteBatchJob(new DropboxDeleteBatchJobPrivate(this), parent), AbstractDropboxJob()
+{
+}
+
+/**
+ * @brief Destructor.
+ */
+DropboxDeleteBatchJob::~DropboxDeleteBatchJob() {}
+
+/**
+ * @brief Implementation of AbstractJob::start().
+ */
+void DropboxDeleteBatchJob::start()
+{
+    Q_D(DropboxDeleteBatchJob);
+    setState(JobState::Running);
+    clearEntryResults();
+
+    {
+        auto error = d_ptr2->checkDefaultParameters();
+        auto code = std::get<0>(error);
+        if (code != JobError::NoError) {
+            setError(code, std::get<1>(error));
+            finishLater();
+            return;
+        }
+    }
+
+    if (d->paths.isEmpty()) {
+        setError(JobError::MissingParameter, tr("No resources to delete given"));
+        finishLater();
+        return;
+    }
+
+    QVariantList entries;
+    for (const auto& path : qAsConst(d->paths)) {
+        entries << QVariantMap { { "path", AbstractDropboxJobPrivate::fixPath(path) } };
+    }
+    QVariantMap data { { "entries", entries } };
+
+    d_ptr2->runBatch(
+            "/files/delete_batch", data, this,
+            [=](const QJsonObject& result) {
+                auto entries = result.value("entries").toArray();
+                for (int i = 0; i < d->paths.length(); ++i) {
+                    auto path = d->paths.at(i);
+                    if (i >= entries.size()) {
+                        setEntryError(path, JobError::InvalidResponse,
+                                      tr("Missing result for resource %1").arg(path));
+                        continue;
+                    }
+                    auto entry = entries.at(i).toObject();
+                    if (entry.value(".tag").toString() == "success") {
+                        auto fileInfo =
+                                d_ptr2->fileInfoFromJson(entry.value("metadata").toObject());
+                        fileInfo.setDeleted(true);
+                        setEntryFileInfo(path, fileInfo);
+                    } else {
+                        // {".tag": "failure", "failure": {".tag": "path_lookup", "path_lookup":
+                        // {".tag": "not_found"}}}
+                        d_ptr2->tryHandleKnownError(
+                                QJsonDocument(entry).toJson(),
+                                { { { { "failure", "path_lookup", ".tag" }, "not_found" },
+                                    [=](const QJsonDocument&) {
+                                        setEntryError(path, JobError::ResourceNotFound,
+                                                      tr("The remote resource %1 does not exist")
+                                                              .arg(path));
+                                    } } });
+                        if (entryError(path) == JobError::NoError) {
+                            setEntryError(path, JobError::NetworkRequestFailed,
+                                          tr("Failed to delete %1: %2")
+                                                  .arg(path,
+                                                       QString::fromUtf8(
+                                                               QJsonDocument(entry).toJson(
+                                                                       QJsonDocument::Compact))));
+                        }
+                    }
+                }
+                finishLater();
+            },
+            [=](JobError error, const QString& errorString) {
+                setError(error, errorString);
+                finishLater();
+            });
+}
+
+/**
+ * @brief Implementation of AbstractJob::stop().
+ */
+void DropboxDeleteBatchJob::stop()
+{
+    if (state() == JobState::Running) {
+        auto reply = d_ptr2->reply;
+        if (reply) {
+            reply->abort();
+            delete reply;
+        }
+        setError(JobError::Stopped, "The job has been stopped");
+        finishLater();
+    }
+}
+
+/**
+ * @brief Constructor.
+ */
+DropboxDeleteBatchJob::DropboxDeleteBatchJob(DropboxDeleteBatchJobPrivate* d, QObject* parent)
+    : DeleteBatchJob(d, parent), AbstractDropboxJob()
+{
+}
+
+} // namespace SynqClient
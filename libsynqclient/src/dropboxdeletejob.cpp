@@ -50,7 +50,7 @@ DropboxDeleteJob::~DropboxDeleteJob() {}
 void DropboxDeleteJob::start()
 {
     Q_D(DropboxDeleteJob);
-    d->state = JobState::Running;
+    setState(JobState::Running);
 
     {
         auto error = d_ptr2->checkDefaultParameters();
@@ -24,6 +24,7 @@
 #include <QTimer>
 
 #include "abstractdropboxjobprivate.h"
+#include "contenthasher.h"
 #include "dropboxdownloadfilejobprivate.h"
 
 namespace SynqClient {
@@ -52,7 +53,7 @@ DropboxDownloadFileJob::~DropboxDownloadFileJob() {}
 void DropboxDownloadFileJob::start()
 {
     Q_D(DropboxDownloadFileJob);
-    d->state = JobState::Running;
+    setState(JobState::Running);
 
     {
         auto error = d_ptr2->checkDefaultParameters();
@@ -64,6 +65,8 @@ void DropboxDownloadFileJob::start()
         }
     }
 
+    // Make sure no data of a previous attempt is written any longer before reusing the device:
+    d->cancelDownload();
     if (d->downloadDevice) {
         if (d->downloadDevice != d->output) {
             delete d->downloadDevice;
@@ -80,13 +83,17 @@ void DropboxDownloadFileJob::start()
     QVariantMap data { { "path", AbstractDropboxJobPrivate::fixPath(d->remoteFilename) } };
 
     d->downloadDevice->seek(0);
+    d->expectChecksum(QString(), QString());
     auto reply = d_ptr2->postData("/files/download", data, nullptr, this);
 
     if (reply) {
-        connect(reply, &QNetworkReply::readyRead, this, [=]() {
-            if (d->downloadDevice) {
-                d->downloadDevice->write(reply->readAll());
-            }
+        d->startDownload(reply, d->downloadDevice);
+        connect(reply, &QNetworkReply::metaDataChanged, this, [=]() {
+            // The file's meta data (including its content hash) is sent as header, so we can
+            // verify the data while it is downloaded:
+            auto doc = QJsonDocument::fromJson(reply->rawHeader("Dropbox-API-Result"));
+            d->expectChecksum(ContentHasher::Dropbox,
+                              doc.object().value("content_hash").toString());
         });
         connect(reply, &QNetworkReply::finished, this, [=]() {
             reply->deleteLater();
@@ -96,18 +103,27 @@ void DropboxDownloadFileJob::start()
                                    &DropboxDownloadFileJob::start);
                 return;
             }
+            if (!d->checkWriteSucceeded()) {
+                // The download has been aborted because writing the received data failed:
+                finishLater();
+                return;
+            }
             if (reply->error() == QNetworkReply::NoError) {
                 QJsonParseError error;
                 auto doc = QJsonDocument::fromJson(reply->rawHeader("Dropbox-API-Result"), &error);
                 if (error.error == QJsonParseError::NoError) {
-                    setFileInfo(d_ptr2->fileInfoFromJson(doc.object(), QString(), "file"));
-                    if (d->downloadDevice) {
-                        d->downloadDevice->write(reply->readAll());
-                    }
-                } else {
-                    setError(JobError::InvalidResponse,
-                             tr("Failed to parse JSON response: %s").arg(error.errorString()));
+                    auto fileInfo = d_ptr2->fileInfoFromJson(doc.object(), QString(), "file");
+                    d->finishDownload(reply, [=]() {
+                        auto info = fileInfo;
+                        if (d->checkWriteSucceeded() && d->verifyChecksum(info)) {
+                            setFileInfo(info);
+                        }
+                        finishLater();
+                    });
+                    return;
                 }
+                setError(JobError::InvalidResponse,
+                         tr("Failed to parse JSON response: %s").arg(error.errorString()));
             } else {
                 // Unrecognized error - "fail generically"
                 setError(JobError::NetworkRequestFailed,
@@ -127,7 +143,9 @@ void DropboxDownloadFileJob::start()
  */
 void DropboxDownloadFileJob::stop()
 {
+    Q_D(DropboxDownloadFileJob);
     if (state() == JobState::Running) {
+        d->cancelDownload();
         auto reply = d_ptr2->reply;
         if (reply) {
             reply->abort();
@@ -58,7 +58,7 @@ DropboxGetFileInfoJob::~DropboxGetFileInfoJob() {}
 void DropboxGetFileInfoJob::start()
 {
     Q_D(DropboxGetFileInfoJob);
-    d->state = JobState::Running;
+    setState(JobState::Running);
 
     {
         auto error = d_ptr2->checkDefaultParameters();
@@ -20,11 +20,16 @@
 #include "../inc/SynqClient/dropboxjobfactory.h"
 
 #include "dropboxjobfactoryprivate.h"
+#include "SynqClient/DropboxCreateDirectoryBatchJob"
 #include "SynqClient/DropboxCreateDirectoryJob"
+#include "SynqClient/DropboxDeleteBatchJob"
 #include "SynqClient/DropboxDeleteJob"
 #include "SynqClient/DropboxDownloadFileJob"
 #include "SynqClient/DropboxGetFileInfoJob"
 #include "SynqClient/DropboxListFilesJob"
+#include "SynqClient/DropboxMoveJob"
+#include "SynqClient/DropboxCopyJob"
+#include "SynqClient/DropboxUploadFileBatchJob"
 #include "SynqClient/DropboxUploadFileJob"
 
 namespace SynqClient {
@@ -36,6 +41,15 @@ DropboxJobFactory::DropboxJobFactory(QObject* parent)
     : AbstractJobFactory(new DropboxJobFactoryPrivate(this), parent)
 {
     setRemoteChangeDetectionMode(RemoteChangeDetectionMode::RootFolderSyncStream);
+
+    // Dropbox accepts up to 1000 entries per batch. For uploads, we use smaller batches, as
+    // the file content is transferred before the batch is committed:
+    setMaxBatchSize(JobType::CreateDirectoryBatch, 1000);
+    setMaxBatchSize(JobType::DeleteResourceBatch, 1000);
+    setMaxBatchSize(JobType::UploadFileBatch, 100);
+
+    // Upload sessions are filled with a single request, which is limited to 150MB:
+    setMaxBatchFileSize(150 * 1024 * 1024);
 }
 
 /**
@@ -149,6 +163,16 @@ AbstractJob* DropboxJobFactory::createJob(JobType type, QObject* parent)
         return d->createJob<DropboxGetFileInfoJob>(parent);
     case JobType::ListFiles:
         return d->createJob<DropboxListFilesJob>(parent);
+    case JobType::CreateDirectoryBatch:
+        return d->createJob<DropboxCreateDirectoryBatchJob>(parent);
+    case JobType::DeleteResourceBatch:
+        return d->createJob<DropboxDeleteBatchJob>(parent);
+    case JobType::UploadFileBatch:
+        return d->createJob<DropboxUploadFileBatchJob>(parent);
+    case JobType::MoveResource:
+        return d->createJob<DropboxMoveJob>(parent);
+    case JobType::CopyResource:
+        return d->createJob<DropboxCopyJob>(parent);
     default:
         return nullptr;
     }
@@ -47,6 +47,7 @@ public:
         result->setUserAgent(userAgent);
         result->setToken(token);
         result->setTransferTimeout(transferTimeout);
+        result->setHttp2Allowed(http2Allowed);
         return result;
     }
 };
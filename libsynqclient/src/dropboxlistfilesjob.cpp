@@ -60,7 +60,7 @@ DropboxListFilesJob::~DropboxListFilesJob() {}
 void DropboxListFilesJob::start()
 {
     Q_D(DropboxListFilesJob);
-    d->state = JobState::Running;
+    setState(JobState::Running);
 
     {
         auto error = d_ptr2->checkDefaultParameters();
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../inc/SynqClient/dropboxmovejob.h"
+
+#include "abstractdropboxjobprivate.h"
+#include "dropboxmovejobprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @class DropboxMoveJob
+ * @brief Implementation of the MoveJob for Dropbox.
+ *
+ * This job uses the `files/move_v2` endpoint. As Dropbox cannot replace existing resources when
+ * moving, an existing target is deleted first if overwrite() is set.
+ */
+
+/**
+ * @brief Constructor.
+ */
+DropboxMoveJob::DropboxMoveJob(QObject* parent)
+    : MoveJob(new DropboxMoveJobPrivate(this), parent), AbstractDropboxJob()
+{
+}
+
+/**
+ * @brief Destructor.
+ */
+DropboxMoveJob::~DropboxMoveJob() {}
+
+/**
+ * @brief Implementation of AbstractJob::start().
+ */
+void DropboxMoveJob::start()
+{
+    Q_D(DropboxMoveJob);
+    d->request.start(d_ptr2.data());
+}
+
+/**
+ * @brief Implementation of AbstractJob::stop().
+ */
+void DropboxMoveJob::stop()
+{
+    Q_D(DropboxMoveJob);
+    d->request.stop(d_ptr2.data());
+}
+
+/**
+ * @brief Constructor.
+ */
+DropboxMoveJob::DropboxMoveJob(DropboxMoveJobPrivate* d, QObject* parent)
+    : MoveJob(d, parent), AbstractDropboxJob()
+{
+}
+
+} // namespace SynqClient
@@ -0,0 +1,295 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../inc/SynqClient/dropboxuploadfilebatchjob.h"
+
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTimer>
+
+#include "abstractdropboxjobprivate.h"
+#include "dropboxuploadfilebatchjobprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @class DropboxUploadFileBatchJob
+ * @brief Implementation of the UploadFileBatchJob for Dropbox.
+ *
+ * This job uploads the content of each file into an upload session (using the
+ * `/files/upload_session/start` endpoint) and afterwards commits all files within a single
+ * request via `/files/upload_session/finish_batch_v2`. This avoids the namespace lock contention
+ * which occurs when lots of files are uploaded to the same Dropbox in parallel.
+ *
+ * Uploading into sessions does not take the lock, so up to
+ * UploadFileBatchJob::maxParallelUploads() sessions are uploaded at the same time.
+ *
+ * Like the DropboxUploadFileJob, this job currently is limited to files with a size of up to
+ * 150MB each.
+ */
+
+/**
+ * @brief Constructor.
+ */
+DropboxUploadFileBatchJob::DropboxUploadFileBatchJob(QObject* parent)
+    : UploadFileBatchJob(new DropboxUploadFileBatchJobPrivate(this), parent), AbstractDropboxJob()
+{
+}
+
+/**
+ * @brief Destructor.
+ */
+DropboxUploadFileBatchJob::~DropboxUploadFileBatchJob() {}
+
+/**
+ * @brief Implementation of AbstractJob::start().
+ */
+void DropboxUploadFileBatchJob::start()
+{
+    Q_D(DropboxUploadFileBatchJob);
+    setState(JobState::Running);
+    clearEntryResults();
+
+    {
+        auto error = d_ptr2->checkDefaultParameters();
+        auto code = std::get<0>(error);
+        if (code != JobError::NoError) {
+            setError(code, std::get<1>(error));
+            finishLater();
+            return;
+        }
+    }
+
+    if (d->remoteFilenames.isEmpty()) {
+        setError(JobError::MissingParameter, tr("No files to upload given"));
+        finishLater();
+        return;
+    }
+
+    d->pendingUploads = d->remoteFilenames;
+    d->finishedUploads.clear();
+    d->sessionIds.clear();
+    d->sessionSizes.clear();
+    d->uploadReplies.clear();
+    d->runningUploads = 0;
+    startNextUploads();
+}
+
+/**
+ * @brief Implementation of AbstractJob::stop().
+ */
+void DropboxUploadFileBatchJob::stop()
+{
+    Q_D(DropboxUploadFileBatchJob);
+    if (state() == JobState::Running) {
+        // Note: Set the error first - this prevents the job from uploading further files when the
+        // currently running requests finish due to being aborted.
+        setError(JobError::Stopped, "The job has been stopped");
+        auto reply = d_ptr2->reply;
+        if (reply) {
+            reply->abort();
+            delete reply;
+            d_ptr2->reply = nullptr;
+        }
+        auto uploadReplies = d->uploadReplies;
+        d->uploadReplies.clear();
+        for (const auto& uploadReply : uploadReplies) {
+            if (uploadReply) {
+                uploadReply->abort();
+                delete uploadReply;
+            }
+        }
+        finishLater();
+    }
+}
+
+/**
+ * @brief Constructor.
+ */
+DropboxUploadFileBatchJob::DropboxUploadFileBatchJob(DropboxUploadFileBatchJobPrivate* d,
+                                                     QObject* parent)
+    : UploadFileBatchJob(d, parent), AbstractDropboxJob()
+{
+}
+
+/**
+ * @brief Start uploading pending files until maxParallelUploads() uploads are running.
+ *
+ * If all files have been uploaded, the batch is committed.
+ */
+void DropboxUploadFileBatchJob::startNextUploads()
+{
+    Q_D(DropboxUploadFileBatchJob);
+    while (!d->pendingUploads.isEmpty() && d->runningUploads < maxParallelUploads()) {
+        d->runningUploads += 1;
+        uploadFile(d->pendingUploads.takeFirst());
+        if (error() != JobError::NoError) {
+            return;
+        }
+    }
+    if (d->pendingUploads.isEmpty() && d->runningUploads == 0) {
+        if (d->sessionIds.isEmpty()) {
+            // Nothing left to commit - each file failed individually.
+            finishLater();
+        } else {
+            finishBatch();
+        }
+    }
+}
+
+/**
+ * @brief Upload the content of the file to be stored as @p remoteFilename into an upload session.
+ *
+ * The upload must have been accounted for in the number of running uploads before calling this
+ * method.
+ */
+void DropboxUploadFileBatchJob::uploadFile(const QString& remoteFilename)
+{
+    Q_D(DropboxUploadFileBatchJob);
+    auto file = new QFile(d->localFilenames.value(remoteFilename), this);
+    if (!file->open(QIODevice::ReadOnly)) {
+        setEntryError(remoteFilename, JobError::InvalidParameter,
+                      tr("Failed to open %1 for reading: %2")
+                              .arg(file->fileName(), file->errorString()));
+        delete file;
+        d->runningUploads -= 1;
+        return;
+    }
+
+    auto reply = d_ptr2->postData("/files/upload_session/start",
+                                  QVariantMap { { "close", true } }, file, this);
+    if (!reply) {
+        delete file;
+        setError(JobError::InvalidResponse, tr("Received null network reply"));
+        finishLater();
+        return;
+    }
+    d->uploadReplies << reply;
+    connect(reply, &QNetworkReply::finished, this, [=]() {
+        reply->deleteLater();
+        file->deleteLater();
+        if (error() != JobError::NoError) {
+            return;
+        }
+        d->uploadReplies.removeAll(reply);
+        if (d_ptr2->checkIfRequestShallBeRetried(reply)) {
+            d_ptr2->numRetries += 1;
+            QTimer::singleShot(d_ptr2->getRetryDelayInMilliseconds(reply), this, [=]() {
+                if (error() == JobError::NoError) {
+                    uploadFile(remoteFilename);
+                    startNextUploads();
+                }
+            });
+            return;
+        }
+        if (reply->error() == QNetworkReply::NoError) {
+            QJsonParseError error;
+            auto doc = QJsonDocument::fromJson(reply->readAll(), &error);
+            auto sessionId = doc.object().value("session_id").toString();
+            if (error.error == QJsonParseError::NoError && !sessionId.isEmpty()) {
+                d->sessionIds[remoteFilename] = sessionId;
+                d->sessionSizes[remoteFilename] = file->size();
+            } else {
+                setEntryError(remoteFilename, JobError::InvalidResponse,
+                              tr("Failed to parse JSON response: %1").arg(error.errorString()));
+            }
+        } else {
+            setEntryError(remoteFilename, JobError::NetworkRequestFailed,
+                          reply->errorString() + " " + reply->readAll());
+        }
+        d->runningUploads -= 1;
+        startNextUploads();
+    });
+}
+
+/**
+ * @brief Commit all files uploaded into upload sessions.
+ */
+void DropboxUploadFileBatchJob::finishBatch()
+{
+    Q_D(DropboxUploadFileBatchJob);
+    // Commit the files in the order they have been added, no matter when their upload finished:
+    d->finishedUploads.clear();
+    for (const auto& remoteFilename : qAsConst(d->remoteFilenames)) {
+        if (d->sessionIds.contains(remoteFilename)) {
+            d->finishedUploads << remoteFilename;
+        }
+    }
+
+    QVariantList entries;
+    for (const auto& remoteFilename : qAsConst(d->finishedUploads)) {
+        QVariantMap commit { { "path", AbstractDropboxJobPrivate::fixPath(remoteFilename) },
+                             { "mode", "overwrite" },
+                             { "autorename", false },
+                             { "mute", true } };
+        auto syncAttr = d->syncAttributes.value(remoteFilename);
+        if (!syncAttr.isNull()) {
+            commit["mode"] = QVariantMap { { ".tag", "update" }, { "update", syncAttr } };
+        }
+        QVariantMap cursor { { "session_id", d->sessionIds.value(remoteFilename) },
+                             { "offset", d->sessionSizes.value(remoteFilename) } };
+        entries << QVariantMap { { "cursor", cursor }, { "commit", commit } };
+    }
+    QVariantMap data { { "entries", entries } };
+
+    d_ptr2->runBatch(
+            "/files/upload_session/finish_batch_v2", data, this,
+            [=](const QJsonObject& result) {
+                auto entries = result.value("entries").toArray();
+                for (int i = 0; i < d->finishedUploads.length(); ++i) {
+                    auto path = d->finishedUploads.at(i);
+                    if (i >= entries.size()) {
+                        setEntryError(path, JobError::InvalidResponse,
+                                      tr("Missing result for file %1").arg(path));
+                        continue;
+                    }
+                    auto entry = entries.at(i).toObject();
+                    if (entry.value(".tag").toString() == "success") {
+                        setEntryFileInfo(path, d_ptr2->fileInfoFromJson(entry, QString(), "file"));
+                    } else {
+                        // {".tag": "failure", "failure": {".tag": "path", "path": {".tag":
+                        // "conflict", "conflict": {".tag": "file"}}}}
+                        d_ptr2->tryHandleKnownError(
+                                QJsonDocument(entry).toJson(),
+                                { { { { "failure", "path", "conflict", ".tag" }, "file" },
+                                    [=](const QJsonDocument&) {
+                                        setEntryError(path, JobError::SyncAttributeMismatch,
+                                                      tr("The file on the server was updated"));
+                                    } } });
+                        if (entryError(path) == JobError::NoError) {
+                            setEntryError(path, JobError::NetworkRequestFailed,
+                                          tr("Failed to upload %1: %2")
+                                                  .arg(path,
+                                                       QString::fromUtf8(
+                                                               QJsonDocument(entry).toJson(
+                                                                       QJsonDocument::Compact))));
+                        }
+                    }
+                }
+                finishLater();
+            },
+            [=](JobError error, const QString& errorString) {
+                setError(error, errorString);
+                finishLater();
+            });
+}
+
+} // namespace SynqClient
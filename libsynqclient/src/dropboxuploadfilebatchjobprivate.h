@@ -0,0 +1,51 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_DROPBOXUPLOADFILEBATCHJOBPRIVATE_H
+#define SYNQCLIENT_DROPBOXUPLOADFILEBATCHJOBPRIVATE_H
+
+#include <QList>
+#include <QMap>
+#include <QNetworkReply>
+#include <QPointer>
+#include <QStringList>
+
+#include "uploadfilebatchjobprivate.h"
+#include "SynqClient/dropboxuploadfilebatchjob.h"
+
+namespace SynqClient {
+
+class DropboxUploadFileBatchJobPrivate : public UploadFileBatchJobPrivate
+{
+public:
+    explicit DropboxUploadFileBatchJobPrivate(DropboxUploadFileBatchJob* q);
+
+    Q_DECLARE_PUBLIC(DropboxUploadFileBatchJob);
+
+    QStringList pendingUploads;
+    QStringList finishedUploads;
+    QMap<QString, QString> sessionIds;
+    QMap<QString, qint64> sessionSizes;
+    QList<QPointer<QNetworkReply>> uploadReplies;
+    int runningUploads;
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_DROPBOXUPLOADFILEBATCHJOBPRIVATE_H
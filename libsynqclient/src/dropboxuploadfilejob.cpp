@@ -24,6 +24,7 @@
 #include <QTimer>
 
 #include "abstractdropboxjobprivate.h"
+#include "contenthasher.h"
 #include "dropboxuploadfilejobprivate.h"
 
 namespace SynqClient {
@@ -60,7 +61,7 @@ DropboxUploadFileJob::~DropboxUploadFileJob() {}
 void DropboxUploadFileJob::start()
 {
     Q_D(DropboxUploadFileJob);
-    d->state = JobState::Running;
+    setState(JobState::Running);
 
     {
         auto error = d_ptr2->checkDefaultParameters();
@@ -86,7 +87,11 @@ void DropboxUploadFileJob::start()
         data["mode"] = QVariantMap { { ".tag", "update" }, { "update", syncAttr } };
     }
 
-    auto reply = d_ptr2->postData("/files/upload", data, d->uploadDevice.data(), this);
+    QIODevice* uploadDevice = nullptr;
+    if (d->uploadDevice) {
+        uploadDevice = d->hashUploadDevice(d->uploadDevice, ContentHasher::Dropbox);
+    }
+    auto reply = d_ptr2->postData("/files/upload", data, uploadDevice, this);
 
     if (reply) {
         connect(reply, &QNetworkReply::finished, this, [=]() {
@@ -101,7 +106,10 @@ void DropboxUploadFileJob::start()
                 QJsonParseError error;
                 auto doc = QJsonDocument::fromJson(reply->readAll(), &error);
                 if (error.error == QJsonParseError::NoError) {
-                    setFileInfo(d_ptr2->fileInfoFromJson(doc.object(), QString(), "file"));
+                    auto fileInfo = d_ptr2->fileInfoFromJson(doc.object(), QString(), "file");
+                    if (d->verifyChecksum(fileInfo)) {
+                        setFileInfo(fileInfo);
+                    }
                 } else {
                     setError(JobError::InvalidResponse,
                              tr("Failed to parse JSON response: %s").arg(error.errorString()));
@@ -210,6 +210,97 @@ void FileInfo::setDeleted(bool deleted)
     d->isDeleted = deleted;
 }
 
+/**
+ * @brief The size of the file in bytes.
+ *
+ * If the size is not known, this is -1. For folders, some servers report the accumulated size of
+ * their content, otherwise the size of folders is -1, too.
+ */
+qint64 FileInfo::size() const
+{
+    return d->size;
+}
+
+/**
+ * @brief Set the size of the file.
+ */
+void FileInfo::setSize(qint64 size)
+{
+    d->size = size;
+}
+
+/**
+ * @brief The time the file or folder was last modified.
+ *
+ * For remote files, this is the modification time reported by the server. If it is not known, an
+ * invalid QDateTime is returned.
+ */
+QDateTime FileInfo::lastModified() const
+{
+    return d->lastModified;
+}
+
+/**
+ * @brief Set the last modification time of the file or folder.
+ */
+void FileInfo::setLastModified(const QDateTime& lastModified)
+{
+    d->lastModified = lastModified;
+}
+
+/**
+ * @brief A stable, server side identifier of the file or folder.
+ *
+ * Some backends assign IDs to files and folders which do not change when the resource is moved or
+ * renamed (e.g. the `oc:fileid` property of NextCloud and ownCloud or the `id` of entries on
+ * Dropbox). If the backend does not provide such IDs, this is an empty string.
+ */
+QString FileInfo::fileId() const
+{
+    return d->fileId;
+}
+
+/**
+ * @brief Set the server side ID of the file or folder.
+ */
+void FileInfo::setFileId(const QString& fileId)
+{
+    d->fileId = fileId;
+}
+
+/**
+ * @brief Checksums of the content of the file.
+ *
+ * Some backends report checksums of the file content. This returns all known checksums, mapping
+ * the name of the algorithm to the checksum (as lower case hex string). Algorithms are identified
+ * by their upper case names, e.g. `SHA1`, `MD5` or `SHA256`. The Dropbox content hash is
+ * reported as `DROPBOX`.
+ */
+QMap<QString, QString> FileInfo::checksums() const
+{
+    return d->checksums;
+}
+
+/**
+ * @brief The checksum of the file content using the given @p algorithm.
+ *
+ * If no such checksum is known, an empty string is returned.
+ *
+ * @sa checksums()
+ */
+QString FileInfo::checksum(const QString& algorithm) const
+{
+    return d->checksums.value(algorithm.toUpper());
+}
+
+/**
+ * @brief Set the @p checksum of the file content using the given @p algorithm.
+ */
+void FileInfo::setChecksum(const QString& algorithm, const QString& checksum)
+{
+    d->checksums[algorithm.toUpper()] = checksum.toLower();
+}
+
 /**
  * @brief Retrieve custom properties called @p name.
  *
@@ -249,6 +340,10 @@ FileInfo FileInfo::fromLocalFile(const QString& path)
             result.setIsDirectory();
         }
         result.setName(fi.fileName());
+        if (fi.isFile()) {
+            result.setSize(fi.size());
+        }
+        result.setLastModified(fi.lastModified());
     }
     return result;
 }
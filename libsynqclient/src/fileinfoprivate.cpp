@@ -22,7 +22,17 @@
 namespace SynqClient {
 
 FileInfoPrivate::FileInfoPrivate()
-    : type(Invalid), name(), path(), syncAttribute(), url(), isDeleted(false), customProperties()
+    : type(Invalid),
+      name(),
+      path(),
+      syncAttribute(),
+      url(),
+      isDeleted(false),
+      size(-1),
+      lastModified(),
+      fileId(),
+      checksums(),
+      customProperties()
 {
 }
 
@@ -34,6 +44,10 @@ FileInfoPrivate::FileInfoPrivate(const FileInfoPrivate& other)
       syncAttribute(other.syncAttribute),
       url(other.url),
       isDeleted(other.isDeleted),
+      size(other.size),
+      lastModified(other.lastModified),
+      fileId(other.fileId),
+      checksums(other.checksums),
       customProperties(other.customProperties)
 {
 }
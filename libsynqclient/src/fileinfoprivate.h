@@ -20,6 +20,8 @@
 #ifndef SYNQCLIENT_FILEINFOPRIVATE_H
 #define SYNQCLIENT_FILEINFOPRIVATE_H
 
+#include <QDateTime>
+#include <QMap>
 #include <QSharedData>
 #include <QString>
 #include <QUrl>
@@ -44,6 +46,10 @@ public:
     QString syncAttribute;
     QUrl url;
     bool isDeleted;
+    qint64 size;
+    QDateTime lastModified;
+    QString fileId;
+    QMap<QString, QString> checksums;
     QVariantMap customProperties;
 };
 
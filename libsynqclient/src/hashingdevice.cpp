@@ -0,0 +1,130 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "hashingdevice.h"
+
+namespace SynqClient {
+
+/**
+ * @class HashingDevice
+ * @brief A read-only device calculating a checksum of the data read from another device.
+ *
+ * This class wraps a @p source device. Data read from it is passed through unchanged, while a
+ * checksum is calculated on the fly. This allows verifying uploads without a second pass over the
+ * data.
+ *
+ * The device may be seeked (as e.g. QNetworkAccessManager does when peeking data or restarting a
+ * request). Each byte is hashed only once, when it is read for the first time. If the data is not
+ * read from the start to the end without gaps, no checksum is available.
+ */
+
+/**
+ * @brief Constructor.
+ *
+ * The device is opened for reading right away. The @p source device must already be open.
+ */
+HashingDevice::HashingDevice(const QSharedPointer<QIODevice>& source, const QString& algorithm,
+                             QObject* parent)
+    : QIODevice(parent), m_source(source), m_hasher(algorithm), m_hashedBytes(0), m_complete(true)
+{
+    open(QIODevice::ReadOnly | QIODevice::Unbuffered);
+    if (m_source) {
+        if (!m_source->isSequential()) {
+            m_source->seek(0);
+        }
+        // The source might not have all data available right away (see ReadAheadDevice):
+        connect(m_source.data(), &QIODevice::readyRead, this, &QIODevice::readyRead);
+    }
+}
+
+/**
+ * @brief Destructor.
+ */
+HashingDevice::~HashingDevice() {}
+
+bool HashingDevice::isSequential() const
+{
+    return m_source.isNull() || m_source->isSequential();
+}
+
+qint64 HashingDevice::size() const
+{
+    return m_source ? m_source->size() : 0;
+}
+
+bool HashingDevice::seek(qint64 pos)
+{
+    return QIODevice::seek(pos) && m_source && m_source->seek(pos);
+}
+
+bool HashingDevice::atEnd() const
+{
+    return m_source.isNull() || m_source->atEnd();
+}
+
+/**
+ * @brief The algorithm used to calculate the checksum.
+ */
+QString HashingDevice::algorithm() const
+{
+    return m_hasher.algorithm();
+}
+
+/**
+ * @brief The checksum of the data read from the device.
+ *
+ * If not all data has been read (or the data has not been read continuously), an empty string is
+ * returned.
+ */
+QString HashingDevice::result()
+{
+    if (!m_complete || m_source.isNull() || m_hashedBytes != m_source->size()) {
+        return QString();
+    }
+    return m_hasher.result();
+}
+
+qint64 HashingDevice::readData(char* data, qint64 maxSize)
+{
+    if (!m_source) {
+        return -1;
+    }
+    auto offset = m_source->pos();
+    auto result = m_source->read(data, maxSize);
+    if (result > 0) {
+        if (offset > m_hashedBytes) {
+            // We skipped some data - we cannot calculate a valid checksum any more:
+            m_complete = false;
+        } else if (offset + result > m_hashedBytes) {
+            auto skip = m_hashedBytes - offset;
+            m_hasher.addData(data + skip, result - skip);
+            m_hashedBytes = offset + result;
+        }
+    }
+    return result;
+}
+
+qint64 HashingDevice::writeData(const char* data, qint64 maxSize)
+{
+    Q_UNUSED(data);
+    Q_UNUSED(maxSize);
+    return -1;
+}
+
+} // namespace SynqClient
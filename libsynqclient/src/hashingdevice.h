@@ -0,0 +1,58 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_HASHINGDEVICE_H
+#define SYNQCLIENT_HASHINGDEVICE_H
+
+#include <QIODevice>
+#include <QSharedPointer>
+
+#include "contenthasher.h"
+
+namespace SynqClient {
+
+class HashingDevice : public QIODevice
+{
+public:
+    explicit HashingDevice(const QSharedPointer<QIODevice>& source, const QString& algorithm,
+                           QObject* parent = nullptr);
+    ~HashingDevice() override;
+
+    bool isSequential() const override;
+    qint64 size() const override;
+    bool seek(qint64 pos) override;
+    bool atEnd() const override;
+
+    QString algorithm() const;
+    QString result();
+
+protected:
+    qint64 readData(char* data, qint64 maxSize) override;
+    qint64 writeData(const char* data, qint64 maxSize) override;
+
+private:
+    QSharedPointer<QIODevice> m_source;
+    ContentHasher m_hasher;
+    qint64 m_hashedBytes;
+    bool m_complete;
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_HASHINGDEVICE_H
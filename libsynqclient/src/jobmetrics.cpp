@@ -0,0 +1,250 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SynqClient/jobmetrics.h"
+
+#include "jobmetricsprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @class JobMetrics
+ * @brief Timing and transfer information collected while running a job.
+ *
+ * Each AbstractJob records when it has been created (i.e. queued), when it was started, when the
+ * first byte of a response has been received and when it finished. In addition, the number of
+ * network requests sent, the number of retries and the number of payload bytes sent and received
+ * are counted. Use AbstractJob::metrics() to get these values.
+ *
+ * Time points which have not been reached (e.g. the first byte time of a job which did not
+ * receive any data) are invalid QDateTime objects.
+ */
+
+/**
+ * @brief Constructor.
+ */
+JobMetrics::JobMetrics() : d(new JobMetricsPrivate) {}
+
+/**
+ * @brief Copy constructor.
+ */
+JobMetrics::JobMetrics(const JobMetrics& other) : d(other.d) {}
+
+/**
+ * @brief Destructor.
+ */
+JobMetrics::~JobMetrics() {}
+
+/**
+ * @brief Assignment operator.
+ */
+JobMetrics& JobMetrics::operator=(const JobMetrics& other)
+{
+    d = other.d;
+    return *this;
+}
+
+/**
+ * @brief The time at which the job has been created.
+ */
+QDateTime JobMetrics::queuedTime() const
+{
+    return d->queuedTime;
+}
+
+/**
+ * @brief Set the time at which the job has been created.
+ */
+void JobMetrics::setQueuedTime(const QDateTime& queuedTime)
+{
+    d->queuedTime = queuedTime;
+}
+
+/**
+ * @brief The time at which the job has been started.
+ */
+QDateTime JobMetrics::startedTime() const
+{
+    return d->startedTime;
+}
+
+/**
+ * @brief Set the time at which the job has been started.
+ */
+void JobMetrics::setStartedTime(const QDateTime& startedTime)
+{
+    d->startedTime = startedTime;
+}
+
+/**
+ * @brief The time at which the first response from the server has been received.
+ */
+QDateTime JobMetrics::firstByteTime() const
+{
+    return d->firstByteTime;
+}
+
+/**
+ * @brief Set the time at which the first response from the server has been received.
+ */
+void JobMetrics::setFirstByteTime(const QDateTime& firstByteTime)
+{
+    d->firstByteTime = firstByteTime;
+}
+
+/**
+ * @brief The time at which the job finished.
+ */
+QDateTime JobMetrics::finishedTime() const
+{
+    return d->finishedTime;
+}
+
+/**
+ * @brief Set the time at which the job finished.
+ */
+void JobMetrics::setFinishedTime(const QDateTime& finishedTime)
+{
+    d->finishedTime = finishedTime;
+}
+
+/**
+ * @brief The number of payload bytes sent to the server.
+ */
+qint64 JobMetrics::bytesSent() const
+{
+    return d->bytesSent;
+}
+
+/**
+ * @brief Set the number of payload bytes sent to the server.
+ */
+void JobMetrics::setBytesSent(qint64 bytesSent)
+{
+    d->bytesSent = bytesSent;
+}
+
+/**
+ * @brief The number of payload bytes received from the server.
+ */
+qint64 JobMetrics::bytesReceived() const
+{
+    return d->bytesReceived;
+}
+
+/**
+ * @brief Set the number of payload bytes received from the server.
+ */
+void JobMetrics::setBytesReceived(qint64 bytesReceived)
+{
+    d->bytesReceived = bytesReceived;
+}
+
+/**
+ * @brief The number of network requests the job sent.
+ *
+ * This includes requests which have been repeated, e.g. because the server asked us to slow down.
+ */
+int JobMetrics::requests() const
+{
+    return d->requests;
+}
+
+/**
+ * @brief Set the number of network requests the job sent.
+ */
+void JobMetrics::setRequests(int requests)
+{
+    d->requests = requests;
+}
+
+/**
+ * @brief The number of times the job retried a failed request.
+ */
+int JobMetrics::retries() const
+{
+    return d->retries;
+}
+
+/**
+ * @brief Set the number of times the job retried a failed request.
+ */
+void JobMetrics::setRetries(int retries)
+{
+    d->retries = retries;
+}
+
+/**
+ * @brief The HTTP status code of the last response the job received.
+ *
+ * This is 0 if the job did not receive any HTTP response.
+ */
+int JobMetrics::httpStatus() const
+{
+    return d->httpStatus;
+}
+
+/**
+ * @brief Set the HTTP status code of the last response the job received.
+ */
+void JobMetrics::setHttpStatus(int httpStatus)
+{
+    d->httpStatus = httpStatus;
+}
+
+/**
+ * @brief The time in milliseconds between creating and starting the job.
+ *
+ * Returns -1 if the job has not been started yet.
+ */
+qint64 JobMetrics::queueDuration() const
+{
+    if (!d->queuedTime.isValid() || !d->startedTime.isValid()) {
+        return -1;
+    }
+    return d->queuedTime.msecsTo(d->startedTime);
+}
+
+/**
+ * @brief The time in milliseconds between starting the job and receiving the first response.
+ *
+ * Returns -1 if no response has been received.
+ */
+qint64 JobMetrics::timeToFirstByte() const
+{
+    if (!d->startedTime.isValid() || !d->firstByteTime.isValid()) {
+        return -1;
+    }
+    return d->startedTime.msecsTo(d->firstByteTime);
+}
+
+/**
+ * @brief The time in milliseconds between starting and finishing the job.
+ *
+ * Returns -1 if the job has not finished yet.
+ */
+qint64 JobMetrics::duration() const
+{
+    if (!d->startedTime.isValid() || !d->finishedTime.isValid()) {
+        return -1;
+    }
+    return d->startedTime.msecsTo(d->finishedTime);
+}
+
+} // namespace SynqClient
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "jobmetricsprivate.h"
+
+namespace SynqClient {
+
+JobMetricsPrivate::JobMetricsPrivate()
+    : queuedTime(),
+      startedTime(),
+      firstByteTime(),
+      finishedTime(),
+      bytesSent(0),
+      bytesReceived(0),
+      requests(0),
+      retries(0),
+      httpStatus(0)
+{
+}
+
+JobMetricsPrivate::JobMetricsPrivate(const JobMetricsPrivate& other)
+    : QSharedData(other),
+      queuedTime(other.queuedTime),
+      startedTime(other.startedTime),
+      firstByteTime(other.firstByteTime),
+      finishedTime(other.finishedTime),
+      bytesSent(other.bytesSent),
+      bytesReceived(other.bytesReceived),
+      requests(other.requests),
+      retries(other.retries),
+      httpStatus(other.httpStatus)
+{
+}
+
+JobMetricsPrivate::~JobMetricsPrivate() {}
+
+} // namespace SynqClient
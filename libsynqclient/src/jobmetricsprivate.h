@@ -0,0 +1,50 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_JOBMETRICSPRIVATE_H
+#define SYNQCLIENT_JOBMETRICSPRIVATE_H
+
+#include "SynqClient/jobmetrics.h"
+
+#include <QDateTime>
+#include <QSharedData>
+
+namespace SynqClient {
+
+class JobMetricsPrivate : public QSharedData
+{
+public:
+    JobMetricsPrivate();
+    JobMetricsPrivate(const JobMetricsPrivate& other);
+    ~JobMetricsPrivate();
+
+    QDateTime queuedTime;
+    QDateTime startedTime;
+    QDateTime firstByteTime;
+    QDateTime finishedTime;
+    qint64 bytesSent;
+    qint64 bytesReceived;
+    int requests;
+    int retries;
+    int httpStatus;
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_JOBMETRICSPRIVATE_H
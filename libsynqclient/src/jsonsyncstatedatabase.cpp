@@ -26,7 +26,6 @@
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QLoggingCategory>
-#include <QSaveFile>
 
 #include "jsonsyncstatedatabaseprivate.h"
 
@@ -175,32 +174,24 @@ bool JSONSyncStateDatabase::closeDatabase()
         return false;
     }
     setOpen(false);
-    if (d->filename.isEmpty()) {
-        qCWarning(log) << "No JSON sync state database filename set";
-        return false;
-    }
-
-    QVariantMap data = d->nodeToJson(d->data);
-    data[JSONSyncStateDatabasePrivate::VersionProperty] =
-            JSONSyncStateDatabasePrivate::CurrentVersion;
+    auto result = d->save();
     d->data.clear();
+    return result;
+}
 
-    QSaveFile file(d->filename);
-    if (file.open(QIODevice::WriteOnly)) {
-        auto doc = QJsonDocument::fromVariant(data);
-        auto json = doc.toJson(QJsonDocument::Compact);
-        file.write(json);
-        if (file.commit()) {
-            return true;
-        } else {
-            qCWarning(log) << "Failed to commit changes to JSON sync state database:"
-                           << file.errorString();
-        }
-    } else {
-        qCWarning(log) << "Failed to open JSON sync state database for writing:"
-                       << file.errorString();
+/**
+ * @brief Implementation of SyncStateDatabase::flushDatabase().
+ *
+ * This writes the current state to the file while keeping the database open.
+ */
+bool JSONSyncStateDatabase::flushDatabase()
+{
+    Q_D(JSONSyncStateDatabase);
+    if (!isOpen()) {
+        qCWarning(log) << "JSON sync state database is not open";
+        return false;
     }
-    return false;
+    return d->save();
 }
 
 /**
@@ -254,6 +245,9 @@ QVector<SyncStateEntry> JSONSyncStateDatabase::findEntries(const QString& parent
                 entry.setPath(dir.absoluteFilePath(childName));
                 entry.setModificationTime(child.entry.modificationTime());
                 entry.setSyncProperty(child.entry.syncProperty());
+                entry.setLocalFileId(child.entry.localFileId());
+                entry.setFingerprint(child.entry.fingerprint());
+                entry.setRemoteFileId(child.entry.remoteFileId());
                 entry.setValid(true);
                 result << entry;
             }
@@ -22,8 +22,10 @@
 #include <QDateTime>
 #include <QLoggingCategory>
 #include <QJsonArray>
+#include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonValue>
+#include <QSaveFile>
 #include <QVersionNumber>
 
 namespace SynqClient {
@@ -34,6 +36,9 @@ const char* JSONSyncStateDatabasePrivate::EntryProperty = "entry";
 const char* JSONSyncStateDatabasePrivate::ChildrenProperty = "children";
 const char* JSONSyncStateDatabasePrivate::ModificationTimeProperty = "modificationTime";
 const char* JSONSyncStateDatabasePrivate::SyncPropertyProperty = "syncProperty";
+const char* JSONSyncStateDatabasePrivate::LocalFileIdProperty = "localFileId";
+const char* JSONSyncStateDatabasePrivate::FingerprintProperty = "fingerprint";
+const char* JSONSyncStateDatabasePrivate::RemoteFileIdProperty = "remoteFileId";
 const char* JSONSyncStateDatabasePrivate::VersionProperty = "version";
 
 const char* JSONSyncStateDatabasePrivate::Version_1_0 = "1.0";
@@ -93,6 +98,11 @@ bool JSONSyncStateDatabasePrivate::jsonToNode(const QJsonObject& object,
                 entry.setModificationTime(
                         QDateTime::fromString(modificationTimeValue.toString(), Qt::ISODateWithMs));
                 entry.setSyncProperty(syncPropertyValue.toString());
+                // The local and remote file IDs and the fingerprint are optional (and not
+                // present in older databases):
+                entry.setLocalFileId(entryData.value(LocalFileIdProperty).toString());
+                entry.setFingerprint(entryData.value(FingerprintProperty).toString());
+                entry.setRemoteFileId(entryData.value(RemoteFileIdProperty).toString());
                 entry.setValid(true);
                 node.entry = entry;
             } else {
@@ -140,6 +150,15 @@ QVariantMap JSONSyncStateDatabasePrivate::nodeToJson(const JSONSyncStateDatabase
         QVariantMap entry { { ModificationTimeProperty,
                               node.entry.modificationTime().toString(Qt::ISODateWithMs) },
                             { SyncPropertyProperty, node.entry.syncProperty() } };
+        if (!node.entry.localFileId().isEmpty()) {
+            entry[LocalFileIdProperty] = node.entry.localFileId();
+        }
+        if (!node.entry.fingerprint().isEmpty()) {
+            entry[FingerprintProperty] = node.entry.fingerprint();
+        }
+        if (!node.entry.remoteFileId().isEmpty()) {
+            entry[RemoteFileIdProperty] = node.entry.remoteFileId();
+        }
         result[EntryProperty] = entry;
     }
     if (!node.children.isEmpty()) {
@@ -174,4 +193,34 @@ bool JSONSyncStateDatabasePrivate::checkCanHandleVersion(const QJsonObject& obje
     return true;
 }
 
+/**
+ * @brief Write the database contents to the file.
+ */
+bool JSONSyncStateDatabasePrivate::save()
+{
+    if (filename.isEmpty()) {
+        qCWarning(log) << "No JSON sync state database filename set";
+        return false;
+    }
+
+    QVariantMap json = nodeToJson(data);
+    json[VersionProperty] = CurrentVersion;
+
+    QSaveFile file(filename);
+    if (file.open(QIODevice::WriteOnly)) {
+        auto doc = QJsonDocument::fromVariant(json);
+        file.write(doc.toJson(QJsonDocument::Compact));
+        if (file.commit()) {
+            return true;
+        } else {
+            qCWarning(log) << "Failed to commit changes to JSON sync state database:"
+                           << file.errorString();
+        }
+    } else {
+        qCWarning(log) << "Failed to open JSON sync state database for writing:"
+                       << file.errorString();
+    }
+    return false;
+}
+
 } // namespace SynqClient
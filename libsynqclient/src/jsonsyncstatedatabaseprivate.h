@@ -50,6 +50,9 @@ public:
     static const char* ChildrenProperty;
     static const char* ModificationTimeProperty;
     static const char* SyncPropertyProperty;
+    static const char* LocalFileIdProperty;
+    static const char* FingerprintProperty;
+    static const char* RemoteFileIdProperty;
     static const char* VersionProperty;
 
     static const char* Version_1_0;
@@ -68,6 +71,7 @@ public:
     bool jsonToNode(const QJsonObject& object, Node& node);
     QVariantMap nodeToJson(const Node& node);
     bool checkCanHandleVersion(const QJsonObject& object);
+    bool save();
 };
 
 } // namespace SynqClient
@@ -0,0 +1,297 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../inc/SynqClient/localchangewatcher.h"
+
+#include <QDir>
+#include <QFileInfo>
+#include <QLoggingCategory>
+
+#include "localchangewatcherprivate.h"
+#include "SynqClient/syncstateentry.h"
+
+namespace SynqClient {
+
+static Q_LOGGING_CATEGORY(log, "SynqClient.LocalChangeWatcher", QtWarningMsg);
+
+/**
+ * @class LocalChangeWatcher
+ * @brief Track changes in a local directory between syncs.
+ *
+ * By default, the DirectorySynchronizer scans the complete local directory on each run to find
+ * local changes. For large directories, this is costly - even if nothing changed at all. The
+ * watcher observes the local directory (using inotify on Linux and a QFileSystemWatcher on other
+ * platforms) and records the folders in which changes happened. When set on a synchronizer via
+ * DirectorySynchronizer::setLocalChangeWatcher(), the local scan only descends into these
+ * folders:
+ *
+ * @code
+ * auto watcher = new SynqClient::LocalChangeWatcher(this);
+ * watcher->setDirectory(localDir);
+ * watcher->setStateFile(appDataDir + "/local-changes.json");
+ * watcher->start();
+ *
+ * auto sync = new SynqClient::DirectorySynchronizer(this);
+ * sync->setLocalChangeWatcher(watcher);
+ * // ...
+ * @endcode
+ *
+ * If the watcher loses track of changes (e.g. because the kernel dropped events or because the
+ * system limit of watches is reached), it requires a full scan, see fullScanRequired().
+ *
+ * Where inotify is not available, the QFileSystemWatcher has to watch each file as well. To not
+ * run out of file descriptors, only a limited number of paths is watched - for larger
+ * directories, a full scan stays required on each sync.
+ *
+ * The set of dirty paths is persisted in the stateFile(). Note that changes happening while the
+ * watcher is not running cannot be observed. Hence, the first sync after starting the watcher
+ * does a full scan, unless exclusiveAccess() is set.
+ *
+ * @note The watcher should use the same filter() as the synchronizer. In particular, if the sync
+ * state database is stored inside the watched directory, it should be excluded - otherwise, each
+ * sync would mark the directory as dirty.
+ */
+
+/**
+ * @brief Constructor.
+ */
+LocalChangeWatcher::LocalChangeWatcher(QObject* parent)
+    : QObject(parent), d_ptr(new LocalChangeWatcherPrivate(this))
+{
+}
+
+/**
+ * @brief Destructor.
+ */
+LocalChangeWatcher::~LocalChangeWatcher()
+{
+    Q_D(LocalChangeWatcher);
+    if (d->running) {
+        d->running = false;
+        d->saveState();
+    }
+}
+
+/**
+ * @brief Indicates if the watcher is currently running.
+ */
+bool LocalChangeWatcher::running() const
+{
+    Q_D(const LocalChangeWatcher);
+    return d->running;
+}
+
+/**
+ * @brief The local directory to watch.
+ */
+QString LocalChangeWatcher::directory() const
+{
+    Q_D(const LocalChangeWatcher);
+    return d->directory;
+}
+
+/**
+ * @brief Set the local @p directory to watch.
+ *
+ * Changing the directory takes effect the next time the watcher is started.
+ */
+void LocalChangeWatcher::setDirectory(const QString& directory)
+{
+    Q_D(LocalChangeWatcher);
+    if (directory.isEmpty()) {
+        d->directory.clear();
+    } else {
+        d->directory = QDir::cleanPath(QFileInfo(directory).absoluteFilePath());
+    }
+}
+
+/**
+ * @brief The file used to persist the dirty state.
+ *
+ * If set, the watcher stores the set of dirty paths in this file, such that they are not lost
+ * when the application is restarted before they have been synchronized.
+ */
+QString LocalChangeWatcher::stateFile() const
+{
+    Q_D(const LocalChangeWatcher);
+    return d->stateFile;
+}
+
+/**
+ * @brief Set the @p stateFile used to persist the dirty state.
+ */
+void LocalChangeWatcher::setStateFile(const QString& stateFile)
+{
+    Q_D(LocalChangeWatcher);
+    d->stateFile = stateFile;
+}
+
+/**
+ * @brief Assume that only the application modifies the local directory.
+ *
+ * If this is set, the watcher assumes that there are no changes in the local directory while it
+ * is not running. In this case, the dirty state restored from the stateFile() is used as is when
+ * starting the watcher. Otherwise (the default), a full scan is required after starting the
+ * watcher.
+ */
+bool LocalChangeWatcher::exclusiveAccess() const
+{
+    Q_D(const LocalChangeWatcher);
+    return d->exclusiveAccess;
+}
+
+/**
+ * @brief Set if the application has @p exclusiveAccess to the local directory.
+ */
+void LocalChangeWatcher::setExclusiveAccess(bool exclusiveAccess)
+{
+    Q_D(LocalChangeWatcher);
+    d->exclusiveAccess = exclusiveAccess;
+}
+
+/**
+ * @brief A filter to exclude files and folders.
+ *
+ * Changes to entries for which the filter returns false are ignored.
+ *
+ * @sa DirectorySynchronizer::filter()
+ */
+DirectorySynchronizer::Filter LocalChangeWatcher::filter() const
+{
+    Q_D(const LocalChangeWatcher);
+    return d->filter;
+}
+
+/**
+ * @brief Set the @p filter used to exclude files and folders.
+ */
+void LocalChangeWatcher::setFilter(const DirectorySynchronizer::Filter& filter)
+{
+    Q_D(LocalChangeWatcher);
+    d->filter = filter;
+}
+
+/**
+ * @brief Indicates if the complete local directory needs to be scanned.
+ *
+ * This is the case if the watcher lost track of changes, e.g. because it was not running, the
+ * operating system dropped events or the watcher could not watch all folders.
+ */
+bool LocalChangeWatcher::fullScanRequired() const
+{
+    Q_D(const LocalChangeWatcher);
+    return d->fullScanRequired;
+}
+
+/**
+ * @brief The folders in which changes happened.
+ *
+ * This returns the paths (relative to the directory() and in the format used by the
+ * SyncStateDatabase) of folders in which entries have been created, changed or deleted since
+ * the last call to clear().
+ */
+QSet<QString> LocalChangeWatcher::dirtyPaths() const
+{
+    Q_D(const LocalChangeWatcher);
+    return d->dirtyPaths;
+}
+
+/**
+ * @brief Manually mark the folder with the given @p path as dirty.
+ */
+void LocalChangeWatcher::markDirty(const QString& path)
+{
+    Q_D(LocalChangeWatcher);
+    d->markDirty(SyncStateEntry::makePath(path));
+}
+
+/**
+ * @brief Require a full scan of the local directory on the next sync.
+ */
+void LocalChangeWatcher::requestFullScan()
+{
+    Q_D(LocalChangeWatcher);
+    d->markOverflow();
+}
+
+/**
+ * @brief Reset the dirty state.
+ *
+ * This is called by the DirectorySynchronizer when it starts scanning for local changes. If the
+ * watcher is not able to watch all folders, a full scan stays required.
+ */
+void LocalChangeWatcher::clear()
+{
+    Q_D(LocalChangeWatcher);
+    d->dirtyPaths.clear();
+    d->fullScanRequired = d->watchesIncomplete;
+    d->scheduleSaveState();
+}
+
+/**
+ * @brief Start watching for changes.
+ */
+void LocalChangeWatcher::start()
+{
+    Q_D(LocalChangeWatcher);
+    if (d->running) {
+        return;
+    }
+    if (d->directory.isEmpty() || !QDir(d->directory).exists()) {
+        qCWarning(log) << "Cannot watch" << d->directory << "- directory does not exist";
+        return;
+    }
+    d->dirtyPaths.clear();
+    d->fullScanRequired = true;
+    d->watchesIncomplete = false;
+    if (!d->loadState() || !d->exclusiveAccess) {
+        d->fullScanRequired = true;
+    }
+    if (!d->startInotify()) {
+        d->startFileSystemWatcher();
+    }
+    d->running = true;
+    d->saveState();
+    emit runningChanged();
+}
+
+/**
+ * @brief Stop watching for changes.
+ */
+void LocalChangeWatcher::stop()
+{
+    Q_D(LocalChangeWatcher);
+    if (!d->running) {
+        return;
+    }
+    d->stopWatching();
+    d->running = false;
+    d->saveState();
+    emit runningChanged();
+}
+
+/**
+ * @brief Constructor.
+ */
+LocalChangeWatcher::LocalChangeWatcher(LocalChangeWatcherPrivate* d, QObject* parent)
+    : QObject(parent), d_ptr(d)
+{
+}
+
+} // namespace SynqClient
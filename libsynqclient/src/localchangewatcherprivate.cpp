@@ -0,0 +1,476 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "localchangewatcherprivate.h"
+
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+#include <QFileSystemWatcher>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QLoggingCategory>
+#include <QSaveFile>
+#include <QSocketNotifier>
+#include <QTimer>
+
+#ifdef Q_OS_LINUX
+#    include <sys/inotify.h>
+#    include <errno.h>
+#    include <string.h>
+#    include <unistd.h>
+#endif
+
+#include "SynqClient/fileinfo.h"
+#include "SynqClient/syncstateentry.h"
+
+namespace SynqClient {
+
+static Q_LOGGING_CATEGORY(log, "SynqClient.LocalChangeWatcher", QtWarningMsg);
+
+#ifdef Q_OS_LINUX
+static const uint32_t InotifyWatchMask = IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE
+        | IN_ATTRIB | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+#endif
+
+LocalChangeWatcherPrivate::LocalChangeWatcherPrivate(LocalChangeWatcher* q)
+    : QObject(),
+      q_ptr(q),
+      directory(),
+      stateFile(),
+      exclusiveAccess(false),
+      filter(),
+      running(false),
+      fullScanRequired(true),
+      watchesIncomplete(false),
+      dirtyPaths(),
+      saveTimer(new QTimer(this)),
+      fileSystemWatcher(nullptr),
+      inotifyFd(-1),
+      inotifyNotifier(nullptr),
+      inotifyWatches()
+{
+    saveTimer->setSingleShot(true);
+    saveTimer->setInterval(SaveDelay);
+    connect(saveTimer, &QTimer::timeout, this, &LocalChangeWatcherPrivate::saveState);
+}
+
+LocalChangeWatcherPrivate::~LocalChangeWatcherPrivate()
+{
+    stopWatching();
+}
+
+/**
+ * @brief Restore the dirty state from the stateFile.
+ *
+ * Returns true if the state could be restored, false otherwise.
+ */
+bool LocalChangeWatcherPrivate::loadState()
+{
+    if (stateFile.isEmpty()) {
+        return false;
+    }
+    QFile file(stateFile);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    QJsonParseError error;
+    auto doc = QJsonDocument::fromJson(file.readAll(), &error);
+    if (error.error != QJsonParseError::NoError || !doc.isObject()) {
+        qCWarning(log) << "Failed to parse local change watcher state from" << stateFile << ":"
+                       << error.errorString();
+        return false;
+    }
+    auto state = doc.object();
+    fullScanRequired = state.value("fullScanRequired").toBool(true);
+    const auto paths = state.value("dirtyPaths").toArray();
+    for (const auto& path : paths) {
+        dirtyPaths.insert(path.toString());
+    }
+    return true;
+}
+
+void LocalChangeWatcherPrivate::scheduleSaveState()
+{
+    if (!stateFile.isEmpty() && !saveTimer->isActive()) {
+        saveTimer->start();
+    }
+}
+
+/**
+ * @brief Write the dirty state to the stateFile.
+ */
+void LocalChangeWatcherPrivate::saveState()
+{
+    saveTimer->stop();
+    if (stateFile.isEmpty()) {
+        return;
+    }
+    QJsonArray paths;
+    for (const auto& path : qAsConst(dirtyPaths)) {
+        paths.append(path);
+    }
+    QJsonObject state;
+    state["fullScanRequired"] = fullScanRequired;
+    state["dirtyPaths"] = paths;
+    QSaveFile file(stateFile);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(log) << "Failed to open" << stateFile << "for writing:" << file.errorString();
+        return;
+    }
+    file.write(QJsonDocument(state).toJson(QJsonDocument::Compact));
+    if (!file.commit()) {
+        qCWarning(log) << "Failed to write local change watcher state to" << stateFile << ":"
+                       << file.errorString();
+    }
+}
+
+/**
+ * @brief Convert the @p absolutePath of a local file to a sync entry path.
+ */
+QString LocalChangeWatcherPrivate::makePath(const QString& absolutePath) const
+{
+    return SyncStateEntry::makePath(QDir(directory), absolutePath);
+}
+
+/**
+ * @brief Convert the sync entry @p path to an absolute path.
+ */
+QString LocalChangeWatcherPrivate::makeAbsolutePath(const QString& path) const
+{
+    return QDir::cleanPath(directory + "/" + path);
+}
+
+/**
+ * @brief Check if changes to the @p absolutePath shall be ignored.
+ *
+ * This is the case for the stateFile itself (and temporary files created when saving it) as well
+ * as for any path rejected by the filter.
+ */
+bool LocalChangeWatcherPrivate::shallIgnore(const QString& absolutePath) const
+{
+    if (!stateFile.isEmpty()) {
+        auto absoluteStateFile = QFileInfo(stateFile).absoluteFilePath();
+        if (absolutePath == absoluteStateFile || absolutePath.startsWith(absoluteStateFile + ".")) {
+            return true;
+        }
+    }
+    if (filter) {
+        return !filter(makePath(absolutePath), FileInfo::fromLocalFile(absolutePath));
+    }
+    return false;
+}
+
+/**
+ * @brief Mark the folder with the sync entry @p path as dirty.
+ */
+void LocalChangeWatcherPrivate::markDirty(const QString& path)
+{
+    Q_Q(LocalChangeWatcher);
+    if (!dirtyPaths.contains(path)) {
+        qCDebug(log) << "Marking" << path << "as dirty";
+        dirtyPaths.insert(path);
+        scheduleSaveState();
+        emit q->localChanged();
+    }
+}
+
+/**
+ * @brief We lost track of changes - require a full scan.
+ */
+void LocalChangeWatcherPrivate::markOverflow()
+{
+    Q_Q(LocalChangeWatcher);
+    if (!fullScanRequired) {
+        qCDebug(log) << "Lost track of local changes - requiring a full scan";
+        fullScanRequired = true;
+        scheduleSaveState();
+        emit q->localChanged();
+    }
+}
+
+/**
+ * @brief Start watching the directory using inotify.
+ *
+ * Returns false if inotify is not available.
+ */
+bool LocalChangeWatcherPrivate::startInotify()
+{
+#ifdef Q_OS_LINUX
+    if (usePolling()) {
+        return false;
+    }
+    inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotifyFd < 0) {
+        qCWarning(log) << "Failed to initialize inotify:" << strerror(errno);
+        return false;
+    }
+    inotifyNotifier = new QSocketNotifier(inotifyFd, QSocketNotifier::Read, this);
+    connect(inotifyNotifier, &QSocketNotifier::activated, this,
+            &LocalChangeWatcherPrivate::onInotifyActivated);
+    addInotifyWatches("/");
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Add inotify watches for the folder with the sync entry @p path and its sub-folders.
+ */
+void LocalChangeWatcherPrivate::addInotifyWatches(const QString& path)
+{
+#ifdef Q_OS_LINUX
+    QStringList folders { path };
+    QDirIterator it(makeAbsolutePath(path), QDir::Dirs | QDir::NoDotAndDotDot | QDir::Hidden,
+                    QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        auto absolutePath = QDir::cleanPath(it.next());
+        if (!shallIgnore(absolutePath)) {
+            folders << makePath(absolutePath);
+        }
+    }
+    for (const auto& folder : qAsConst(folders)) {
+        auto wd = inotify_add_watch(inotifyFd, QFile::encodeName(makeAbsolutePath(folder)),
+                                    InotifyWatchMask);
+        if (wd < 0) {
+            // Most likely, we ran out of watches (ENOSPC). We cannot reliably track changes, so
+            // fall back to full scans:
+            qCWarning(log) << "Failed to watch" << folder << ":" << strerror(errno);
+            watchesIncomplete = true;
+            markOverflow();
+            continue;
+        }
+        inotifyWatches.insert(wd, folder);
+    }
+#else
+    Q_UNUSED(path);
+#endif
+}
+
+/**
+ * @brief Remove the inotify watches for the folder with the sync entry @p path and its sub-folders.
+ */
+void LocalChangeWatcherPrivate::removeInotifyWatches(const QString& path)
+{
+#ifdef Q_OS_LINUX
+    auto it = inotifyWatches.begin();
+    while (it != inotifyWatches.end()) {
+        if (it.value() == path || it.value().startsWith(path + "/")) {
+            inotify_rm_watch(inotifyFd, it.key());
+            it = inotifyWatches.erase(it);
+        } else {
+            ++it;
+        }
+    }
+#else
+    Q_UNUSED(path);
+#endif
+}
+
+/**
+ * @brief Start watching the directory using a QFileSystemWatcher.
+ *
+ * This is used on platforms where inotify is not available.
+ */
+void LocalChangeWatcherPrivate::startFileSystemWatcher()
+{
+    fileSystemWatcher = new QFileSystemWatcher(this);
+    if (usePolling()) {
+        // Let Qt use its polling engine, which reports nothing but what it is asked to watch:
+        fileSystemWatcher->setObjectName("_qt_autotest_force_engine_poller");
+    }
+    connect(fileSystemWatcher, &QFileSystemWatcher::directoryChanged, this,
+            &LocalChangeWatcherPrivate::onDirectoryChanged);
+    connect(fileSystemWatcher, &QFileSystemWatcher::fileChanged, this,
+            &LocalChangeWatcherPrivate::onFileChanged);
+    addFileSystemWatcherPaths("/");
+}
+
+/**
+ * @brief Watch the folder with the sync entry @p path and all files and folders in it.
+ *
+ * Depending on the platform, changing the contents of a file does not trigger a change of the
+ * folder it is in. Hence, we also need to watch all files. As each watch might use up a file
+ * descriptor or handle, at most MaxFileSystemWatches paths are watched. Beyond that, folders are
+ * preferred over files and a full scan is required on each sync.
+ */
+void LocalChangeWatcherPrivate::addFileSystemWatcherPaths(const QString& path)
+{
+    const auto watchedDirectories = fileSystemWatcher->directories();
+    const auto watchedFiles = fileSystemWatcher->files();
+    QStringList newDirectories;
+    QStringList newFiles;
+    auto absolutePath = makeAbsolutePath(path);
+    if (!watchedDirectories.contains(absolutePath)) {
+        newDirectories << absolutePath;
+    }
+    QDirIterator it(absolutePath, QDir::Dirs | QDir::Files | QDir::NoDotAndDotDot | QDir::Hidden,
+                    QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        auto entryPath = QDir::cleanPath(it.next());
+        if (shallIgnore(entryPath)) {
+            continue;
+        }
+        if (it.fileInfo().isDir()) {
+            if (!watchedDirectories.contains(entryPath)) {
+                newDirectories << entryPath;
+            }
+        } else if (!watchedFiles.contains(entryPath)) {
+            newFiles << entryPath;
+        }
+    }
+    auto newPaths = newDirectories + newFiles;
+    auto numAvailable = MaxFileSystemWatches - watchedDirectories.length() - watchedFiles.length();
+    if (newPaths.length() > numAvailable) {
+        qCWarning(log) << "Too many local paths to watch - falling back to full scans";
+        newPaths = newPaths.mid(0, qMax(numAvailable, 0));
+        watchesIncomplete = true;
+        markOverflow();
+    }
+    if (!newPaths.isEmpty()) {
+        auto failedPaths = fileSystemWatcher->addPaths(newPaths);
+        if (!failedPaths.isEmpty()) {
+            qCWarning(log) << "Failed to watch" << failedPaths.length() << "local paths";
+            watchesIncomplete = true;
+            markOverflow();
+        }
+    }
+}
+
+void LocalChangeWatcherPrivate::stopWatching()
+{
+#ifdef Q_OS_LINUX
+    if (inotifyNotifier) {
+        delete inotifyNotifier;
+        inotifyNotifier = nullptr;
+    }
+    if (inotifyFd >= 0) {
+        ::close(inotifyFd);
+        inotifyFd = -1;
+    }
+    inotifyWatches.clear();
+#endif
+    if (fileSystemWatcher) {
+        delete fileSystemWatcher;
+        fileSystemWatcher = nullptr;
+    }
+}
+
+void LocalChangeWatcherPrivate::onInotifyActivated()
+{
+#ifdef Q_OS_LINUX
+    alignas(struct inotify_event) char buffer[16 * 1024];
+    while (true) {
+        auto length = ::read(inotifyFd, buffer, sizeof(buffer));
+        if (length <= 0) {
+            break;
+        }
+        for (char* ptr = buffer; ptr < buffer + length;) {
+            auto event = reinterpret_cast<const struct inotify_event*>(ptr);
+            ptr += sizeof(struct inotify_event) + event->len;
+
+            if (event->mask & IN_Q_OVERFLOW) {
+                // The kernel dropped events:
+                markOverflow();
+                continue;
+            }
+            if (!inotifyWatches.contains(event->wd)) {
+                continue;
+            }
+            auto folder = inotifyWatches.value(event->wd);
+            if (event->mask & IN_IGNORED) {
+                inotifyWatches.remove(event->wd);
+                continue;
+            }
+            if (event->mask & (IN_DELETE_SELF | IN_MOVE_SELF)) {
+                if (folder == "/") {
+                    // The directory itself is gone:
+                    markOverflow();
+                }
+                continue;
+            }
+            auto name = event->len > 0 ? QFile::decodeName(event->name) : QString();
+            auto absolutePath = makeAbsolutePath(folder + "/" + name);
+            if (shallIgnore(absolutePath)) {
+                continue;
+            }
+            if (event->mask & IN_ISDIR) {
+                auto path = makePath(absolutePath);
+                if (event->mask & (IN_CREATE | IN_MOVED_TO)) {
+                    // Watch the new folder. Entries might have been created before the watch is
+                    // in place, so mark it dirty as well:
+                    addInotifyWatches(path);
+                    markDirty(path);
+                } else if (event->mask & IN_MOVED_FROM) {
+                    removeInotifyWatches(path);
+                }
+            }
+            markDirty(folder);
+        }
+    }
+#endif
+}
+
+void LocalChangeWatcherPrivate::onDirectoryChanged(const QString& path)
+{
+    auto absolutePath = QDir::cleanPath(path);
+    if (shallIgnore(absolutePath)) {
+        return;
+    }
+    if (!QDir(absolutePath).exists()) {
+        if (makePath(absolutePath) == "/") {
+            markOverflow();
+        }
+        return;
+    }
+    auto syncPath = makePath(absolutePath);
+    addFileSystemWatcherPaths(syncPath);
+    markDirty(syncPath);
+}
+
+void LocalChangeWatcherPrivate::onFileChanged(const QString& path)
+{
+    auto absolutePath = QDir::cleanPath(path);
+    if (shallIgnore(absolutePath)) {
+        return;
+    }
+    if (QFile::exists(absolutePath) && !fileSystemWatcher->files().contains(absolutePath)) {
+        // Files which are replaced (e.g. by saving them atomically) are no longer watched:
+        fileSystemWatcher->addPath(absolutePath);
+    }
+    markDirty(makePath(QFileInfo(absolutePath).absolutePath()));
+}
+
+/**
+ * @brief Indicates if changes shall be detected by polling.
+ *
+ * This is for testing the QFileSystemWatcher fallback: If the
+ * SYNQCLIENT_LOCALCHANGEWATCHER_POLL environment variable is set, inotify is not used and the
+ * QFileSystemWatcher is forced to poll, which - like the watchers on some platforms - does not
+ * report changes of files as changes of their folder.
+ */
+bool LocalChangeWatcherPrivate::usePolling()
+{
+    return qEnvironmentVariableIsSet("SYNQCLIENT_LOCALCHANGEWATCHER_POLL");
+}
+
+} // namespace SynqClient
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_LOCALCHANGEWATCHERPRIVATE_H
+#define SYNQCLIENT_LOCALCHANGEWATCHERPRIVATE_H
+
+#include <QHash>
+#include <QObject>
+#include <QSet>
+
+#include "SynqClient/localchangewatcher.h"
+
+class QFileSystemWatcher;
+class QSocketNotifier;
+class QTimer;
+
+namespace SynqClient {
+
+class LocalChangeWatcherPrivate : public QObject
+{
+    Q_OBJECT
+public:
+    explicit LocalChangeWatcherPrivate(LocalChangeWatcher* q);
+    ~LocalChangeWatcherPrivate() override;
+
+    LocalChangeWatcher* q_ptr;
+    Q_DECLARE_PUBLIC(LocalChangeWatcher);
+
+    QString directory;
+    QString stateFile;
+    bool exclusiveAccess;
+    DirectorySynchronizer::Filter filter;
+    bool running;
+    bool fullScanRequired;
+    bool watchesIncomplete;
+    QSet<QString> dirtyPaths;
+    QTimer* saveTimer;
+    QFileSystemWatcher* fileSystemWatcher;
+    int inotifyFd;
+    QSocketNotifier* inotifyNotifier;
+    QHash<int, QString> inotifyWatches;
+
+    const int SaveDelay = 1000;
+    const int MaxFileSystemWatches = 1024;
+
+    bool loadState();
+    void scheduleSaveState();
+    QString makePath(const QString& absolutePath) const;
+    QString makeAbsolutePath(const QString& path) const;
+    bool shallIgnore(const QString& absolutePath) const;
+    void markDirty(const QString& path);
+    void markOverflow();
+    bool startInotify();
+    void addInotifyWatches(const QString& path);
+    void removeInotifyWatches(const QString& path);
+    void startFileSystemWatcher();
+    void addFileSystemWatcherPaths(const QString& path);
+    void stopWatching();
+
+    static bool usePolling();
+
+public slots:
+
+    void saveState();
+    void onInotifyActivated();
+    void onDirectoryChanged(const QString& path);
+    void onFileChanged(const QString& path);
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_LOCALCHANGEWATCHERPRIVATE_H
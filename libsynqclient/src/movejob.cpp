@@ -0,0 +1,64 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../inc/SynqClient/movejob.h"
+
+#include "movejobprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @class MoveJob
+ * @brief Move or rename remote files or folders.
+ *
+ * This class is an abstract base for jobs which move a remote resource from its path() to a new
+ * targetPath(). Moving is done on the server side, so no file contents need to be transferred.
+ * If the resource is a folder, it is moved including all of its contents.
+ *
+ * The parent folder of the target path must exist. By default, the move fails if the target
+ * already exists. Set overwrite() to true to replace it instead.
+ *
+ * After the job finished successfully, fileInfo() holds information about the moved resource
+ * (as far as the server reports it).
+ *
+ * # Error Handling
+ *
+ * Besides the usual error handling, the following error codes are used to indicate non-fatal
+ * errors:
+ *
+ * - JobError::ResourceNotFound: The resource to move does not (or no longer) exist.
+ * - JobError::ResourceExists: The target already exists and overwrite() is false.
+ */
+
+/**
+ * @brief Constructor.
+ */
+MoveJob::MoveJob(QObject* parent) : AbstractCopyMoveJob(new MoveJobPrivate(this), parent) {}
+
+/**
+ * @brief Destructor.
+ */
+MoveJob::~MoveJob() {}
+
+/**
+ * @brief Constructor.
+ */
+MoveJob::MoveJob(MoveJobPrivate* d, QObject* parent) : AbstractCopyMoveJob(d, parent) {}
+
+} // namespace SynqClient
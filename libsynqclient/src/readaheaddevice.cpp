@@ -0,0 +1,266 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "readaheaddevice.h"
+
+#include <QFileDevice>
+#include <QMutexLocker>
+#include <QThreadPool>
+
+namespace SynqClient {
+
+namespace {
+
+/**
+ * @brief The pool running the thread reading ahead for all devices.
+ */
+class ReaderThreadPool : public QThreadPool
+{
+public:
+    ReaderThreadPool() : QThreadPool() { setMaxThreadCount(1); }
+};
+
+Q_GLOBAL_STATIC(ReaderThreadPool, readerThreadPool)
+
+} // namespace
+
+/**
+ * @class ReadAheadDevice
+ * @brief A read-only device which prefetches the data of another device in a worker thread.
+ *
+ * This class wraps a @p source device, usually a local file which shall be uploaded. The data of
+ * the source is read in a dedicated reader thread into a ring of NumBuffers reusable buffers of
+ * BufferSize bytes each. Reading from the device only copies data from these buffers and hence
+ * never blocks on disk I/O. If no data has been prefetched yet, reading returns no data and the
+ * readyRead() signal is emitted as soon as more data is available.
+ *
+ * The device supports seeking (as e.g. QNetworkAccessManager does when restarting a request). In
+ * this case, any prefetched data is dropped and reading ahead restarts at the new position.
+ *
+ * @note The source device is used from the reader thread. Hence, it must not be used otherwise
+ * while the read-ahead device exists. Use canReadAhead() to check if a device can be used as
+ * source.
+ */
+
+/**
+ * @brief The size of the buffers to read the source data into in bytes.
+ */
+const qint64 ReadAheadDevice::BufferSize = 256 * 1024;
+
+/**
+ * @brief The number of buffers to prefetch data into.
+ */
+const int ReadAheadDevice::NumBuffers = 4;
+
+/**
+ * @brief Constructor.
+ *
+ * The device is opened for reading right away and starts prefetching data from the current
+ * position of the @p source, which must already be open.
+ */
+ReadAheadDevice::ReadAheadDevice(const QSharedPointer<QIODevice>& source, QObject* parent)
+    : QIODevice(parent),
+      m_source(source),
+      m_size(source ? source->size() : 0),
+      m_mutex(),
+      m_idle(),
+      m_filledBuffers(),
+      m_freeBuffers(),
+      m_readOffset(0),
+      m_sourcePos(source ? source->pos() : 0),
+      m_generation(0),
+      m_sourceAtEnd(source.isNull()),
+      m_running(false),
+      m_stopped(false),
+      m_sourceError()
+{
+    for (int i = 0; i < NumBuffers; ++i) {
+        m_freeBuffers << QByteArray();
+    }
+    open(QIODevice::ReadOnly | QIODevice::Unbuffered);
+    QIODevice::seek(m_sourcePos);
+    QMutexLocker locker(&m_mutex);
+    startPrefetching();
+}
+
+/**
+ * @brief Destructor.
+ *
+ * This waits for the reader thread to stop using the source device.
+ */
+ReadAheadDevice::~ReadAheadDevice()
+{
+    QMutexLocker locker(&m_mutex);
+    m_stopped = true;
+    while (m_running) {
+        m_idle.wait(&m_mutex);
+    }
+}
+
+/**
+ * @brief Check if the @p device can be read ahead from a worker thread.
+ *
+ * This is the case for random access file devices. Other devices (like in-memory buffers) either
+ * don't benefit from reading ahead or might rely on being used from the thread they live in.
+ */
+bool ReadAheadDevice::canReadAhead(QIODevice* device)
+{
+    return qobject_cast<QFileDevice*>(device) != nullptr && !device->isSequential()
+            && device->isReadable();
+}
+
+bool ReadAheadDevice::isSequential() const
+{
+    return false;
+}
+
+qint64 ReadAheadDevice::size() const
+{
+    return m_size;
+}
+
+bool ReadAheadDevice::seek(qint64 pos)
+{
+    if (pos < 0 || pos > m_size || !QIODevice::seek(pos)) {
+        return false;
+    }
+    QMutexLocker locker(&m_mutex);
+    // Drop any prefetched data - it is not at the right position:
+    while (!m_filledBuffers.isEmpty()) {
+        m_freeBuffers << m_filledBuffers.dequeue();
+    }
+    m_readOffset = 0;
+    m_sourcePos = pos;
+    m_sourceAtEnd = false;
+    m_sourceError.clear();
+    ++m_generation;
+    startPrefetching();
+    return true;
+}
+
+bool ReadAheadDevice::atEnd() const
+{
+    return pos() >= m_size;
+}
+
+qint64 ReadAheadDevice::readData(char* data, qint64 maxSize)
+{
+    QMutexLocker locker(&m_mutex);
+    qint64 result = 0;
+    while (result < maxSize && !m_filledBuffers.isEmpty()) {
+        const auto& buffer = m_filledBuffers.head();
+        auto size = qMin(maxSize - result, buffer.length() - m_readOffset);
+        memcpy(data + result, buffer.constData() + m_readOffset, static_cast<size_t>(size));
+        result += size;
+        m_readOffset += size;
+        if (m_readOffset >= buffer.length()) {
+            m_freeBuffers << m_filledBuffers.dequeue();
+            m_readOffset = 0;
+        }
+    }
+    startPrefetching();
+    if (result == 0) {
+        if (!m_sourceError.isEmpty()) {
+            setErrorString(m_sourceError);
+            return -1;
+        }
+        if (m_sourceAtEnd) {
+            return -1;
+        }
+        // Nothing prefetched yet - readyRead() is emitted once data is available.
+    }
+    return result;
+}
+
+qint64 ReadAheadDevice::writeData(const char* data, qint64 maxSize)
+{
+    Q_UNUSED(data);
+    Q_UNUSED(maxSize);
+    return -1;
+}
+
+/**
+ * @brief Start reading ahead in the reader thread, unless already running or not needed.
+ *
+ * The mutex must be locked when calling this method.
+ */
+void ReadAheadDevice::startPrefetching()
+{
+    if (!m_running && !m_stopped && !m_sourceAtEnd && m_sourceError.isEmpty()
+        && !m_freeBuffers.isEmpty()) {
+        m_running = true;
+        readerThreadPool->start([=]() { prefetch(); });
+    }
+}
+
+/**
+ * @brief Fill free buffers with data from the source.
+ *
+ * This runs in the reader thread until all buffers are filled or the end of the source is reached.
+ */
+void ReadAheadDevice::prefetch()
+{
+    forever {
+        QByteArray buffer;
+        qint64 pos;
+        quint64 generation;
+        {
+            QMutexLocker locker(&m_mutex);
+            if (m_stopped || m_sourceAtEnd || !m_sourceError.isEmpty()
+                || m_freeBuffers.isEmpty()) {
+                m_running = false;
+                m_idle.wakeAll();
+                return;
+            }
+            buffer = m_freeBuffers.takeLast();
+            pos = m_sourcePos;
+            generation = m_generation;
+        }
+
+        buffer.resize(static_cast<int>(BufferSize));
+        qint64 size = -1;
+        if (m_source->pos() == pos || m_source->seek(pos)) {
+            size = m_source->read(buffer.data(), BufferSize);
+        }
+
+        QMutexLocker locker(&m_mutex);
+        if (generation != m_generation) {
+            // The device has been seeked in the meantime - drop the data:
+            m_freeBuffers << buffer;
+            continue;
+        }
+        if (size < 0) {
+            m_sourceError = m_source->errorString();
+            m_freeBuffers << buffer;
+        } else if (size == 0) {
+            m_sourceAtEnd = true;
+            m_freeBuffers << buffer;
+        } else {
+            buffer.resize(static_cast<int>(size));
+            m_filledBuffers.enqueue(buffer);
+            m_sourcePos += size;
+            m_sourceAtEnd = m_sourcePos >= m_size;
+        }
+        // Notify readers in the thread the device lives in:
+        QMetaObject::invokeMethod(this, &QIODevice::readyRead, Qt::QueuedConnection);
+    }
+}
+
+} // namespace SynqClient
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef SYNQCLIENT_READAHEADDEVICE_H
+#define SYNQCLIENT_READAHEADDEVICE_H
+
+#include <QIODevice>
+#include <QMutex>
+#include <QQueue>
+#include <QSharedPointer>
+#include <QVector>
+#include <QWaitCondition>
+
+namespace SynqClient {
+
+class ReadAheadDevice : public QIODevice
+{
+public:
+    static const qint64 BufferSize;
+    static const int NumBuffers;
+
+    explicit ReadAheadDevice(const QSharedPointer<QIODevice>& source, QObject* parent = nullptr);
+    ~ReadAheadDevice() override;
+
+    static bool canReadAhead(QIODevice* device);
+
+    bool isSequential() const override;
+    qint64 size() const override;
+    bool seek(qint64 pos) override;
+    bool atEnd() const override;
+
+protected:
+    qint64 readData(char* data, qint64 maxSize) override;
+    qint64 writeData(const char* data, qint64 maxSize) override;
+
+private:
+    QSharedPointer<QIODevice> m_source;
+    qint64 m_size;
+    mutable QMutex m_mutex;
+    QWaitCondition m_idle;
+    QQueue<QByteArray> m_filledBuffers;
+    QVector<QByteArray> m_freeBuffers;
+    qint64 m_readOffset;
+    qint64 m_sourcePos;
+    quint64 m_generation;
+    bool m_sourceAtEnd;
+    bool m_running;
+    bool m_stopped;
+    QString m_sourceError;
+
+    void startPrefetching();
+    void prefetch();
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_READAHEADDEVICE_H
@@ -159,7 +159,9 @@ bool SQLSyncStateDatabase::openDatabase()
             return false;
         }
     }
-    if (!d->initializeDbV1()) {
+    // Every later schema version adds a column to the files table:
+    if (!d->initializeDbV1() || !d->addColumn(2, "localFileId") || !d->addColumn(3, "fingerprint")
+        || !d->addColumn(4, "remoteFileId")) {
         return false;
     }
     setOpen(true);
@@ -180,8 +182,9 @@ bool SQLSyncStateDatabase::addEntry(const SyncStateEntry& entry)
     auto db = d->getDb();
     QSqlQuery query(db);
     if (!query.prepare("INSERT OR REPLACE INTO files "
-                       "(parent, entry, modificationDate, etag) "
-                       "VALUES (?, ?, ?, ?);")) {
+                       "(parent, entry, modificationDate, etag, localFileId, fingerprint, "
+                       "remoteFileId) "
+                       "VALUES (?, ?, ?, ?, ?, ?, ?);")) {
         qCWarning(log) << "Failed to prepare query:" << query.lastError().text();
         return false;
     }
@@ -197,6 +200,21 @@ bool SQLSyncStateDatabase::addEntry(const SyncStateEntry& entry)
     } else {
         query.addBindValue(entry.syncProperty());
     }
+    if (entry.localFileId().isEmpty()) {
+        query.addBindValue("");
+    } else {
+        query.addBindValue(entry.localFileId());
+    }
+    if (entry.fingerprint().isEmpty()) {
+        query.addBindValue("");
+    } else {
+        query.addBindValue(entry.fingerprint());
+    }
+    if (entry.remoteFileId().isEmpty()) {
+        query.addBindValue("");
+    } else {
+        query.addBindValue(entry.remoteFileId());
+    }
     if (!query.exec()) {
         qCWarning(log) << "Failed to insert SyncDB entry:" << query.lastError().text();
         return false;
@@ -218,7 +236,8 @@ SyncStateEntry SQLSyncStateDatabase::getEntry(const QString& path)
     auto dbPath = d->splitPath(path);
     auto parent = std::get<0>(dbPath);
     auto name = std::get<1>(dbPath);
-    if (!query.prepare("SELECT parent, entry, modificationDate, etag "
+    if (!query.prepare("SELECT parent, entry, modificationDate, etag, localFileId, fingerprint, "
+                       "remoteFileId "
                        "FROM files WHERE parent = ? and entry = ?;")) {
         qCWarning(log) << "Failed to prepare query:" << query.lastError().text();
         return result;
@@ -233,6 +252,9 @@ SyncStateEntry SQLSyncStateDatabase::getEntry(const QString& path)
                            + record.value("entry").toString());
             result.setModificationTime(record.value("modificationDate").toDateTime());
             result.setSyncProperty(record.value("etag").toString());
+            result.setLocalFileId(record.value("localFileId").toString());
+            result.setFingerprint(record.value("fingerprint").toString());
+            result.setRemoteFileId(record.value("remoteFileId").toString());
             result.setValid(true);
             break;
         }
@@ -253,7 +275,8 @@ QVector<SyncStateEntry> SQLSyncStateDatabase::findEntries(const QString& parent,
     QVector<SyncStateEntry> result;
     auto db = d->getDb();
     QSqlQuery query(db);
-    if (!query.prepare("SELECT parent, entry, modificationDate, etag "
+    if (!query.prepare("SELECT parent, entry, modificationDate, etag, localFileId, fingerprint, "
+                       "remoteFileId "
                        "FROM files WHERE parent = ?;")) {
         qCWarning(log) << "Failed to prepare query:" << query.lastError().text();
         if (ok) {
@@ -271,6 +294,9 @@ QVector<SyncStateEntry> SQLSyncStateDatabase::findEntries(const QString& parent,
                           + record.value("entry").toString());
             entry.setModificationTime(record.value("modificationDate").toDateTime());
             entry.setSyncProperty(record.value("etag").toString());
+            entry.setLocalFileId(record.value("localFileId").toString());
+            entry.setFingerprint(record.value("fingerprint").toString());
+            entry.setRemoteFileId(record.value("remoteFileId").toString());
             entry.setValid(true);
 
             // Exclude the root node. Internally, it has the same "parent" in the DB as a
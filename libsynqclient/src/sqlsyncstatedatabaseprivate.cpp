@@ -93,6 +93,66 @@ bool SQLSyncStateDatabasePrivate::initializeDbV1()
     return true;
 }
 
+/**
+ * @brief Upgrade the database to the given @p version by adding a @p column to the files table.
+ *
+ * Each schema version after the first one adds a single (string) column, which defaults to an
+ * empty string for existing entries. If the database already is at @p version or later, nothing
+ * is done.
+ */
+bool SQLSyncStateDatabasePrivate::addColumn(int version, const QString& column)
+{
+    int currentVersion = 0;
+    if (!getVersion(currentVersion)) {
+        return false;
+    }
+    if (currentVersion < version) {
+        QSqlQuery query(getDb());
+        if (!query.prepare(QString("ALTER TABLE files "
+                                   "ADD COLUMN `%1` string not null default '';")
+                                   .arg(column))) {
+            qCWarning(log) << "Failed to prepare query:" << query.lastError().text();
+            return false;
+        }
+        if (!query.exec()) {
+            qCWarning(log) << "Failed to add" << column << "column:" << query.lastError().text();
+            return false;
+        }
+        if (!query.prepare("INSERT OR REPLACE INTO version(key, value) "
+                           "VALUES ('version', ?);")) {
+            qCWarning(log) << "Failed to prepare query:" << query.lastError().text();
+            return false;
+        }
+        query.addBindValue(version);
+        if (!query.exec()) {
+            qCWarning(log) << "Failed to insert version into DB:" << query.lastError().text();
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Read the schema version of the database into @p version.
+ */
+bool SQLSyncStateDatabasePrivate::getVersion(int& version)
+{
+    QSqlQuery query(getDb());
+    if (!query.prepare("SELECT value FROM version WHERE key == 'version';")) {
+        qCWarning(log) << "Failed to prepare query:" << query.lastError().text();
+        return false;
+    }
+    if (!query.exec()) {
+        qCWarning(log) << "Failed to get version of sync DB:" << query.lastError().text();
+        return false;
+    }
+    version = 0;
+    if (query.first()) {
+        version = query.record().value("value").toInt();
+    }
+    return true;
+}
+
 void SQLSyncStateDatabasePrivate::removeOldConnection()
 {
     if (removeDb) {
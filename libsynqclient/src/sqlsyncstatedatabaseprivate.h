@@ -50,6 +50,8 @@ public:
     bool removeDb;
 
     bool initializeDbV1();
+    bool addColumn(int version, const QString& column);
+    bool getVersion(int& version);
     void removeOldConnection();
     QSqlDatabase getDb() const;
 
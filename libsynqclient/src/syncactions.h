@@ -20,12 +20,24 @@
 #define SYNQCLIENT_SYNCACTIONS_H
 
 #include <QDateTime>
+#include <QSharedPointer>
+#include <QVector>
 
 #include "SynqClient/syncstateentry.h"
 
 namespace SynqClient {
 
-enum SyncActionType { Upload, Download, DeleteLocal, DeleteRemote, MkDirLocal, MkDirRemote };
+enum SyncActionType {
+    Upload,
+    Download,
+    DeleteLocal,
+    DeleteRemote,
+    MkDirLocal,
+    MkDirRemote,
+    MoveRemote,
+    CopyRemote,
+    MoveLocal
+};
 
 struct SyncAction
 {
@@ -98,6 +110,79 @@ struct MkDirRemoteSyncAction : SyncAction
     explicit MkDirRemoteSyncAction(const QString& path) : SyncAction(MkDirRemote, path) {}
 };
 
+/**
+ * @brief Move a remote file or folder to the path of the action.
+ *
+ * This action replaces a DeleteRemote of the sourcePath and the upload of the same data to the
+ * action's path. The followUpActions are run once the move succeeded (e.g. to upload files
+ * inside a moved folder which have been changed locally). If the move cannot be carried out, the
+ * fallbackActions (i.e. the actions the move replaces) are run instead.
+ */
+struct MoveRemoteSyncAction : SyncAction
+{
+    QString sourcePath;
+    SyncStateEntry previousSyncEntry;
+    QVector<QSharedPointer<SyncAction>> followUpActions;
+    QVector<QSharedPointer<SyncAction>> fallbackActions;
+
+    MoveRemoteSyncAction(const QString& sourcePath, const QString& path,
+                         const SyncStateEntry& entry)
+        : SyncAction(MoveRemote, path),
+          sourcePath(SyncStateEntry::makePath(sourcePath)),
+          previousSyncEntry(entry),
+          followUpActions(),
+          fallbackActions()
+    {
+    }
+};
+
+/**
+ * @brief Copy a remote file with identical content to the path of the action.
+ *
+ * This action replaces the upload of a new local file, if a file with the same content has
+ * been synced before. The fingerprint of the (new) file is stored in its sync state entry once the
+ * copy succeeded. If the copy cannot be carried out, the original uploadAction is run instead.
+ */
+struct CopyRemoteSyncAction : SyncAction
+{
+    QString sourcePath;
+    QString fingerprint;
+    QSharedPointer<UploadSyncAction> uploadAction;
+
+    CopyRemoteSyncAction(const QString& sourcePath, const QString& fingerprint,
+                         const QSharedPointer<UploadSyncAction>& uploadAction)
+        : SyncAction(CopyRemote, uploadAction->path),
+          sourcePath(SyncStateEntry::makePath(sourcePath)),
+          fingerprint(fingerprint),
+          uploadAction(uploadAction)
+    {
+    }
+};
+
+/**
+ * @brief Move a local file or folder to the path of the action.
+ *
+ * This action is used if a resource has been moved or renamed on the server. It replaces the
+ * local deletion of the sourcePath and the download of the same data to the action's path. If
+ * the local resource cannot be moved, the fallbackActions (i.e. the actions the move replaces) are
+ * run instead.
+ */
+struct MoveLocalSyncAction : SyncAction
+{
+    QString sourcePath;
+    SyncStateEntry previousSyncEntry;
+    QVector<QSharedPointer<SyncAction>> fallbackActions;
+
+    MoveLocalSyncAction(const QString& sourcePath, const QString& path,
+                        const SyncStateEntry& entry)
+        : SyncAction(MoveLocal, path),
+          sourcePath(SyncStateEntry::makePath(sourcePath)),
+          previousSyncEntry(entry),
+          fallbackActions()
+    {
+    }
+};
+
 }
 
 #endif // SYNQCLIENT_SYNCACTIONS_H
@@ -0,0 +1,97 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SynqClient/syncevent.h"
+
+namespace SynqClient {
+
+/**
+ * @class SyncEvent
+ * @brief An action carried out by a DirectorySynchronizer.
+ *
+ * Sync events are emitted via the DirectorySynchronizer::syncEventAvailable() signal for each
+ * file or folder the synchronizer creates, deletes, moves, copies, uploads or downloads. In
+ * contrast to the messages reported via DirectorySynchronizer::logMessageAvailable(), they do not
+ * carry formatted strings: The type() tells what happened and the paths involved are referred to
+ * by numeric ids, which can be resolved using DirectorySynchronizer::eventPath(). Hence, events
+ * are cheap to create, copy and filter, even for syncs involving huge numbers of files.
+ *
+ * As this class is meant to be used on hot paths, it intentionally is a plain value type without
+ * a d-pointer.
+ */
+
+/**
+ * @brief Used as path id if an event does not refer to a path.
+ */
+const quint32 SyncEvent::NoPath;
+
+/**
+ * @brief Constructor.
+ *
+ * Creates an informational event without any paths.
+ */
+SyncEvent::SyncEvent()
+    : m_type(SynchronizerLogEntryType::Information), m_pathId(NoPath), m_sourcePathId(NoPath)
+{
+}
+
+/**
+ * @brief Constructor.
+ *
+ * Creates an event of the given @p type, which refers to the path with the id @p pathId. For
+ * moves and copies, the @p sourcePathId refers to the path the resource is moved or copied from.
+ */
+SyncEvent::SyncEvent(SynchronizerLogEntryType type, quint32 pathId, quint32 sourcePathId)
+    : m_type(type), m_pathId(pathId), m_sourcePathId(sourcePathId)
+{
+}
+
+/**
+ * @brief The kind of action carried out.
+ */
+SynchronizerLogEntryType SyncEvent::type() const
+{
+    return m_type;
+}
+
+/**
+ * @brief The id of the path the action is carried out on.
+ *
+ * For moves and copies, this is the target path.
+ *
+ * @sa DirectorySynchronizer::eventPath()
+ */
+quint32 SyncEvent::pathId() const
+{
+    return m_pathId;
+}
+
+/**
+ * @brief The id of the path a resource is moved or copied from.
+ *
+ * For all other events, this is NoPath.
+ *
+ * @sa DirectorySynchronizer::eventPath()
+ */
+quint32 SyncEvent::sourcePathId() const
+{
+    return m_sourcePathId;
+}
+
+} // namespace SynqClient
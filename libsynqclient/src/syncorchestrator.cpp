@@ -0,0 +1,405 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SynqClient/syncorchestrator.h"
+
+#include <QNetworkAccessManager>
+#include <QTimer>
+
+#include "syncorchestratorprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @class SyncOrchestrator
+ * @brief Run the syncs of many folders while sharing one job budget.
+ *
+ * Applications syncing many folders (or accounts) at once can use this class instead of running
+ * one DirectorySynchronizer per folder on their own. Each folder is registered as a *root* using
+ * addRoot(). Runs of the roots are requested via schedule() or scheduleAll() and the orchestrator
+ * decides when they actually run:
+ *
+ * - At most maxJobs() jobs run in parallel in total and at most maxJobsPerHost() against a
+ *   single host. A root is only started if it can get at least one job slot.
+ * - The slots are split fairly between the running roots. Whenever a root starts or finishes,
+ *   the limits of all running synchronizers are adjusted.
+ * - Queued roots are started by priority first. Among roots with the same priority, the one
+ *   which has not been synced successfully for the longest time comes first.
+ * - All roots talking to the same host using the same account share one QNetworkAccessManager,
+ *   so they can reuse each other's connections. Accounts are told apart by the user name in the
+ *   URL passed to addRoot(). Roots of different accounts use separate managers, so cookies and
+ *   cached credentials never leak from one account to another. If accounts authenticate
+ *   otherwise (e.g. using OAuth2 bearer tokens), add a user name to the URL anyway to separate
+ *   them.
+ *
+ * A new DirectorySynchronizer is created for each run of a root. It is configured by the setup
+ * function passed to addRoot(), which also receives the network access manager shared by the
+ * account of the root:
+ *
+ * @code
+ * auto orchestrator = new SynqClient::SyncOrchestrator(this);
+ * auto root = orchestrator->addRoot(url, [=](SynqClient::DirectorySynchronizer* synchronizer,
+ *                                            QNetworkAccessManager* nam) {
+ *     auto factory = new SynqClient::WebDAVJobFactory(synchronizer);
+ *     factory->setNetworkAccessManager(nam);
+ *     factory->setUrl(url);
+ *     synchronizer->setJobFactory(factory);
+ *     synchronizer->setSyncStateDatabase(db);
+ *     synchronizer->setLocalDirectoryPath(localDir);
+ *     synchronizer->setRemoteDirectoryPath(remoteDir);
+ * });
+ * orchestrator->schedule(root);
+ * @endcode
+ *
+ * The setup function must neither set the maximum number of jobs of the synchronizer (these
+ * are controlled by the orchestrator) nor start it.
+ */
+
+/**
+ * @brief Constructor.
+ */
+SyncOrchestrator::SyncOrchestrator(QObject* parent)
+    : QObject(parent), d_ptr(new SyncOrchestratorPrivate(this))
+{
+}
+
+/**
+ * @brief Destructor.
+ *
+ * Running synchronizers are deleted and hence aborted.
+ */
+SyncOrchestrator::~SyncOrchestrator() {}
+
+/**
+ * @brief The maximum number of jobs to run in parallel over all roots.
+ *
+ * This also is the maximum number of roots which run at the same time. By default, this is 24.
+ */
+int SyncOrchestrator::maxJobs() const
+{
+    Q_D(const SyncOrchestrator);
+    return d->maxJobs;
+}
+
+/**
+ * @brief Set the maximum number of jobs to run in parallel over all roots.
+ */
+void SyncOrchestrator::setMaxJobs(int maxJobs)
+{
+    Q_D(SyncOrchestrator);
+    if (d->maxJobs != maxJobs) {
+        d->maxJobs = maxJobs;
+        d->distributeJobs();
+        d->scheduleTimer->start();
+    }
+}
+
+/**
+ * @brief The maximum number of jobs to run in parallel against a single host.
+ *
+ * Hosts are identified by the host name and port of the URL passed to addRoot(). By default,
+ * this is 6, which matches the number of connections QNetworkAccessManager opens per host.
+ */
+int SyncOrchestrator::maxJobsPerHost() const
+{
+    Q_D(const SyncOrchestrator);
+    return d->maxJobsPerHost;
+}
+
+/**
+ * @brief Set the maximum number of jobs to run in parallel against a single host.
+ */
+void SyncOrchestrator::setMaxJobsPerHost(int maxJobsPerHost)
+{
+    Q_D(SyncOrchestrator);
+    if (d->maxJobsPerHost != maxJobsPerHost) {
+        d->maxJobsPerHost = maxJobsPerHost;
+        d->distributeJobs();
+        d->scheduleTimer->start();
+    }
+}
+
+/**
+ * @brief Register a new root.
+ *
+ * The root talks to the server at the given @p url, which is used to group roots by host and
+ * account. Each time the root runs, the @p setup function is called to configure a new
+ * DirectorySynchronizer.
+ * Roots with a higher @p priority are started first.
+ *
+ * Returns the id of the new root. The root is not scheduled yet.
+ */
+int SyncOrchestrator::addRoot(const QUrl& url, const Setup& setup, int priority)
+{
+    Q_D(SyncOrchestrator);
+    auto id = d->nextRootId++;
+    SyncOrchestratorPrivate::Root root;
+    root.url = url;
+    root.host = SyncOrchestratorPrivate::hostKey(url);
+    root.setup = setup;
+    root.priority = priority;
+    d->roots.insert(id, root);
+    return id;
+}
+
+/**
+ * @brief Remove the given @p root.
+ *
+ * If the root currently runs, its synchronizer is stopped.
+ */
+void SyncOrchestrator::removeRoot(int root)
+{
+    Q_D(SyncOrchestrator);
+    auto it = d->roots.find(root);
+    if (it == d->roots.end() || it->removed) {
+        return;
+    }
+    if (it->running()) {
+        it->removed = true;
+        it->queued = false;
+        it->synchronizer->stop();
+    } else {
+        d->roots.erase(it);
+    }
+}
+
+/**
+ * @brief The ids of all registered roots.
+ */
+QList<int> SyncOrchestrator::roots() const
+{
+    Q_D(const SyncOrchestrator);
+    QList<int> result;
+    for (auto it = d->roots.cbegin(); it != d->roots.cend(); ++it) {
+        if (!it->removed) {
+            result << it.key();
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief The URL of the server the @p root talks to.
+ */
+QUrl SyncOrchestrator::url(int root) const
+{
+    Q_D(const SyncOrchestrator);
+    auto r = d->findRoot(root);
+    return r ? r->url : QUrl();
+}
+
+/**
+ * @brief The priority of the given @p root.
+ */
+int SyncOrchestrator::priority(int root) const
+{
+    Q_D(const SyncOrchestrator);
+    auto r = d->findRoot(root);
+    return r ? r->priority : 0;
+}
+
+/**
+ * @brief Set the @p priority of the given @p root.
+ *
+ * This affects the order in which queued roots are started as well as which roots get slots
+ * left over when splitting the job budget.
+ */
+void SyncOrchestrator::setPriority(int root, int priority)
+{
+    Q_D(SyncOrchestrator);
+    if (d->findRoot(root)) {
+        d->roots[root].priority = priority;
+        d->distributeJobs();
+    }
+}
+
+/**
+ * @brief The time the given @p root has been synced successfully the last time.
+ *
+ * This is an invalid date time if the root has not been synced successfully yet.
+ */
+QDateTime SyncOrchestrator::lastSync(int root) const
+{
+    Q_D(const SyncOrchestrator);
+    auto r = d->findRoot(root);
+    return r ? r->lastSync : QDateTime();
+}
+
+/**
+ * @brief The error of the last run of the given @p root.
+ */
+SynchronizerError SyncOrchestrator::lastError(int root) const
+{
+    Q_D(const SyncOrchestrator);
+    auto r = d->findRoot(root);
+    return r ? r->lastError : SynchronizerError::NoError;
+}
+
+/**
+ * @brief A textual description of the error of the last run of the given @p root.
+ */
+QString SyncOrchestrator::lastErrorString(int root) const
+{
+    Q_D(const SyncOrchestrator);
+    auto r = d->findRoot(root);
+    return r ? r->lastErrorString : QString();
+}
+
+/**
+ * @brief Check if the given @p root waits to be run.
+ */
+bool SyncOrchestrator::isQueued(int root) const
+{
+    Q_D(const SyncOrchestrator);
+    auto r = d->findRoot(root);
+    return r && r->queued;
+}
+
+/**
+ * @brief Check if the given @p root currently runs.
+ */
+bool SyncOrchestrator::isRunning(int root) const
+{
+    Q_D(const SyncOrchestrator);
+    auto r = d->findRoot(root);
+    return r && r->running();
+}
+
+/**
+ * @brief The number of jobs the given @p root currently may run in parallel.
+ *
+ * This is 0 if the root does not run.
+ */
+int SyncOrchestrator::jobLimit(int root) const
+{
+    Q_D(const SyncOrchestrator);
+    auto r = d->findRoot(root);
+    return r ? r->jobLimit : 0;
+}
+
+/**
+ * @brief The number of roots waiting to be run.
+ */
+int SyncOrchestrator::numQueued() const
+{
+    Q_D(const SyncOrchestrator);
+    return d->queuedRoots().length();
+}
+
+/**
+ * @brief The number of roots currently running.
+ */
+int SyncOrchestrator::numRunning() const
+{
+    Q_D(const SyncOrchestrator);
+    return d->runningRoots().length();
+}
+
+/**
+ * @brief The network access manager shared by all roots using the account of the @p url.
+ *
+ * Roots share a manager if they talk to the same host and the user names in their URLs match.
+ * The manager is created on first use and owned by the orchestrator.
+ */
+QNetworkAccessManager* SyncOrchestrator::networkAccessManager(const QUrl& url)
+{
+    Q_D(SyncOrchestrator);
+    auto account = SyncOrchestratorPrivate::accountKey(url);
+    auto nam = d->networkAccessManagers.value(account);
+    if (!nam) {
+        nam = new QNetworkAccessManager(this);
+        d->networkAccessManagers.insert(account, nam);
+    }
+    return nam;
+}
+
+/**
+ * @brief Request a run of the given @p root.
+ *
+ * The root is queued and started as soon as the budget allows it. If the root currently runs, it
+ * is queued again and runs once more after the current run has finished.
+ */
+void SyncOrchestrator::schedule(int root)
+{
+    Q_D(SyncOrchestrator);
+    if (d->findRoot(root) && !d->roots[root].queued) {
+        auto& r = d->roots[root];
+        r.queued = true;
+        r.queuedSequence = d->nextQueuedSequence++;
+        d->scheduleTimer->start();
+    }
+}
+
+/**
+ * @brief Request a run of all roots.
+ */
+void SyncOrchestrator::scheduleAll()
+{
+    const auto ids = roots();
+    for (auto root : ids) {
+        schedule(root);
+    }
+}
+
+/**
+ * @brief Stop all running roots and clear the queue.
+ *
+ * The rootFinished() signal is emitted for each stopped root once it has finished.
+ */
+void SyncOrchestrator::stop()
+{
+    Q_D(SyncOrchestrator);
+    for (auto it = d->roots.begin(); it != d->roots.end(); ++it) {
+        it->queued = false;
+    }
+    const auto running = d->runningRoots();
+    for (auto root : running) {
+        auto sync = d->roots[root].synchronizer;
+        if (sync) {
+            sync->stop();
+        }
+    }
+}
+
+/**
+ * @brief Constructor.
+ */
+SyncOrchestrator::SyncOrchestrator(SyncOrchestratorPrivate* d, QObject* parent)
+    : QObject(parent), d_ptr(d)
+{
+}
+
+/**
+ * @fn SyncOrchestrator::rootStarted(int root)
+ * @brief A run of the given @p root has been started.
+ */
+
+/**
+ * @fn SyncOrchestrator::rootFinished(int root)
+ * @brief A run of the given @p root has finished.
+ *
+ * Use lastError() to check if the run was successful.
+ */
+
+/**
+ * @fn SyncOrchestrator::idle()
+ * @brief All runs have finished and no root is queued anymore.
+ */
+
+} // namespace SynqClient
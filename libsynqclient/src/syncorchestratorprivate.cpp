@@ -0,0 +1,318 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "syncorchestratorprivate.h"
+
+#include <algorithm>
+
+#include <QLoggingCategory>
+#include <QTimer>
+
+namespace SynqClient {
+
+static Q_LOGGING_CATEGORY(log, "SynqClient.SyncOrchestrator", QtWarningMsg);
+
+SyncOrchestratorPrivate::SyncOrchestratorPrivate(SyncOrchestrator* q)
+    : QObject(),
+      q_ptr(q),
+      maxJobs(24),
+      maxJobsPerHost(6),
+      roots(),
+      nextRootId(1),
+      nextQueuedSequence(0),
+      networkAccessManagers(),
+      scheduleTimer(new QTimer(this))
+{
+    scheduleTimer->setSingleShot(true);
+    scheduleTimer->setInterval(0);
+    connect(scheduleTimer, &QTimer::timeout, this, &SyncOrchestratorPrivate::scheduleRoots);
+}
+
+/**
+ * @brief The key used to group roots by the server they talk to.
+ */
+QString SyncOrchestratorPrivate::hostKey(const QUrl& url)
+{
+    auto defaultPort = url.scheme() == "http" ? 80 : 443;
+    return url.host().toLower() + ":" + QString::number(url.port(defaultPort));
+}
+
+/**
+ * @brief The key used to group roots by the account they use on a server.
+ *
+ * This is the user name of the @p url in addition to its hostKey().
+ */
+QString SyncOrchestratorPrivate::accountKey(const QUrl& url)
+{
+    return url.userName(QUrl::FullyEncoded) + "@" + hostKey(url);
+}
+
+/**
+ * @brief Get the root with the given id or nullptr if there is no such root.
+ *
+ * Roots which have been removed but are still running are not returned.
+ */
+const SyncOrchestratorPrivate::Root* SyncOrchestratorPrivate::findRoot(int root) const
+{
+    auto it = roots.constFind(root);
+    if (it == roots.constEnd() || it->removed) {
+        return nullptr;
+    }
+    return &it.value();
+}
+
+/**
+ * @brief Check if the @p left root should be served before the @p right one.
+ *
+ * Roots with a higher priority come first. Among roots with the same priority, the one which has
+ * not been synced successfully for the longest time (or never) comes first. Finally, roots are
+ * served in the order they have been queued.
+ */
+bool SyncOrchestratorPrivate::isBefore(int left, int right) const
+{
+    const auto& l = roots.constFind(left).value();
+    const auto& r = roots.constFind(right).value();
+    if (l.priority != r.priority) {
+        return l.priority > r.priority;
+    }
+    if (l.lastSync != r.lastSync) {
+        if (!l.lastSync.isValid()) {
+            return true;
+        }
+        if (!r.lastSync.isValid()) {
+            return false;
+        }
+        return l.lastSync < r.lastSync;
+    }
+    return l.queuedSequence < r.queuedSequence;
+}
+
+/**
+ * @brief The roots waiting to be run, in the order they shall be served.
+ *
+ * Roots which have been queued again while running are not included until their current run
+ * has finished.
+ */
+QList<int> SyncOrchestratorPrivate::queuedRoots() const
+{
+    QList<int> result;
+    for (auto it = roots.cbegin(); it != roots.cend(); ++it) {
+        if (it->queued && !it->removed && !it->running()) {
+            result << it.key();
+        }
+    }
+    std::sort(result.begin(), result.end(), [=](int l, int r) { return isBefore(l, r); });
+    return result;
+}
+
+/**
+ * @brief The roots which currently run, in the order of their priority.
+ *
+ * This includes roots which have been removed but did not finish yet, as they still occupy job
+ * slots.
+ */
+QList<int> SyncOrchestratorPrivate::runningRoots() const
+{
+    QList<int> result;
+    for (auto it = roots.cbegin(); it != roots.cend(); ++it) {
+        if (it->running()) {
+            result << it.key();
+        }
+    }
+    std::sort(result.begin(), result.end(), [=](int l, int r) { return isBefore(l, r); });
+    return result;
+}
+
+/**
+ * @brief Create and set up the synchronizer for the given @p root.
+ *
+ * The synchronizer is not started yet.
+ */
+void SyncOrchestratorPrivate::startRoot(int root)
+{
+    Q_Q(SyncOrchestrator);
+    auto r = roots[root];
+    auto sync = new DirectorySynchronizer(this);
+    if (r.setup) {
+        r.setup(sync, q->networkAccessManager(r.url));
+    }
+    connect(sync, &DirectorySynchronizer::finished, this,
+            [=]() { onSynchronizerFinished(root); });
+    roots[root].queued = false;
+    roots[root].synchronizer = sync;
+}
+
+/**
+ * @brief Split the job budget between the running roots.
+ *
+ * First, the per host budget is split evenly between the roots talking to the same host. Then,
+ * the global budget is split in a max-min fair way: Roots which cannot use their even share
+ * (because their host is busy) leave the rest to others. Slots lost to rounding go to the roots
+ * with the highest priority. Each root gets at least one slot.
+ *
+ * The limits are applied to the synchronizers via DirectorySynchronizer::setMaxJobs() and
+ * DirectorySynchronizer::setMaxMultiplexedJobs(). A synchronizer which has been granted fewer
+ * slots does not start new jobs until it is below its new limit; one which has been granted more
+ * slots uses them as soon as one of its jobs finishes.
+ */
+void SyncOrchestratorPrivate::distributeJobs()
+{
+    auto running = runningRoots();
+    if (running.isEmpty()) {
+        return;
+    }
+    auto budget = qMax(1, maxJobs);
+    auto hostBudget = qMax(1, maxJobsPerHost);
+
+    QHash<QString, QList<int>> rootsPerHost;
+    for (auto root : qAsConst(running)) {
+        rootsPerHost[roots[root].host] << root;
+    }
+    QHash<int, int> caps;
+    for (auto it = rootsPerHost.cbegin(); it != rootsPerHost.cend(); ++it) {
+        const auto& hostRoots = it.value();
+        auto share = hostBudget / hostRoots.length();
+        auto extra = hostBudget % hostRoots.length();
+        for (int i = 0; i < hostRoots.length(); ++i) {
+            caps[hostRoots[i]] = qMax(1, share + (i < extra ? 1 : 0));
+        }
+    }
+
+    auto byCap = running;
+    std::stable_sort(byCap.begin(), byCap.end(),
+                     [&](int l, int r) { return caps.value(l) < caps.value(r); });
+    QHash<int, int> limits;
+    auto remaining = budget;
+    for (int i = 0; i < byCap.length(); ++i) {
+        auto root = byCap[i];
+        auto fairShare = qMax(1, remaining / (byCap.length() - i));
+        auto limit = qMin(caps.value(root), fairShare);
+        limits[root] = limit;
+        remaining -= limit;
+    }
+    for (auto root : qAsConst(running)) {
+        if (remaining <= 0) {
+            break;
+        }
+        if (limits[root] < caps.value(root)) {
+            ++limits[root];
+            --remaining;
+        }
+    }
+
+    for (auto root : qAsConst(running)) {
+        auto& r = roots[root];
+        auto limit = limits.value(root);
+        if (r.jobLimit != limit) {
+            qCDebug(log) << "Granting" << limit << "jobs to root" << root << "on" << r.host;
+            r.jobLimit = limit;
+            r.synchronizer->setMaxJobs(limit);
+            r.synchronizer->setMaxMultiplexedJobs(limit);
+        }
+    }
+}
+
+/**
+ * @brief Start queued roots as long as the budget allows it.
+ *
+ * Roots are started in the order given by isBefore(). A root whose host already is busy is
+ * skipped, so it does not block roots talking to other hosts.
+ */
+void SyncOrchestratorPrivate::scheduleRoots()
+{
+    Q_Q(SyncOrchestrator);
+    auto running = runningRoots();
+    auto budget = qMax(1, maxJobs);
+    auto hostBudget = qMax(1, maxJobsPerHost);
+    QHash<QString, int> runningPerHost;
+    for (auto root : qAsConst(running)) {
+        ++runningPerHost[roots[root].host];
+    }
+
+    QList<int> started;
+    auto queued = queuedRoots();
+    for (auto root : qAsConst(queued)) {
+        if (running.length() + started.length() >= budget) {
+            break;
+        }
+        const auto& host = roots[root].host;
+        if (runningPerHost.value(host) >= hostBudget) {
+            continue;
+        }
+        ++runningPerHost[host];
+        startRoot(root);
+        started << root;
+    }
+    if (started.isEmpty()) {
+        return;
+    }
+
+    // Grant the job slots before starting, so the new roots start within their share:
+    distributeJobs();
+    for (auto root : qAsConst(started)) {
+        auto sync = roots[root].synchronizer;
+        if (sync) {
+            qCDebug(log) << "Starting root" << root << "with" << roots[root].jobLimit << "jobs";
+            emit q->rootStarted(root);
+            sync->start();
+        }
+    }
+}
+
+/**
+ * @brief Book keeping once the synchronizer of the given @p root has finished.
+ *
+ * The slots of the root are handed to the other running roots and further queued roots are
+ * started.
+ */
+void SyncOrchestratorPrivate::onSynchronizerFinished(int root)
+{
+    Q_Q(SyncOrchestrator);
+    auto it = roots.find(root);
+    if (it == roots.end()) {
+        return;
+    }
+    auto sync = it->synchronizer;
+    it->synchronizer = nullptr;
+    it->jobLimit = 0;
+    auto removed = it->removed;
+    if (removed) {
+        roots.erase(it);
+    } else if (sync) {
+        it->lastError = sync->error();
+        it->lastErrorString = sync->errorString();
+        if (it->lastError == SynchronizerError::NoError) {
+            it->lastSync = QDateTime::currentDateTimeUtc();
+        }
+    }
+    if (sync) {
+        sync->deleteLater();
+    }
+
+    distributeJobs();
+    scheduleTimer->start();
+    if (!removed) {
+        emit q->rootFinished(root);
+    }
+    if (runningRoots().isEmpty() && queuedRoots().isEmpty()) {
+        emit q->idle();
+    }
+}
+
+} // namespace SynqClient
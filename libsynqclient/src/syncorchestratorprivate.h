@@ -0,0 +1,88 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_SYNCORCHESTRATORPRIVATE_H
+#define SYNQCLIENT_SYNCORCHESTRATORPRIVATE_H
+
+#include <QHash>
+#include <QMap>
+#include <QObject>
+#include <QPointer>
+
+#include "SynqClient/directorysynchronizer.h"
+#include "SynqClient/syncorchestrator.h"
+
+class QTimer;
+
+namespace SynqClient {
+
+class SyncOrchestratorPrivate : public QObject
+{
+    Q_OBJECT
+public:
+    struct Root
+    {
+        QUrl url;
+        QString host;
+        SyncOrchestrator::Setup setup;
+        int priority = 0;
+        QDateTime lastSync;
+        SynchronizerError lastError = SynchronizerError::NoError;
+        QString lastErrorString;
+        bool queued = false;
+        bool removed = false;
+        quint64 queuedSequence = 0;
+        int jobLimit = 0;
+        QPointer<DirectorySynchronizer> synchronizer;
+
+        bool running() const { return !synchronizer.isNull(); }
+    };
+
+    explicit SyncOrchestratorPrivate(SyncOrchestrator* q);
+
+    SyncOrchestrator* q_ptr;
+    Q_DECLARE_PUBLIC(SyncOrchestrator);
+
+    int maxJobs;
+    int maxJobsPerHost;
+    QMap<int, Root> roots;
+    int nextRootId;
+    quint64 nextQueuedSequence;
+    QHash<QString, QNetworkAccessManager*> networkAccessManagers;
+    QTimer* scheduleTimer;
+
+    static QString hostKey(const QUrl& url);
+    static QString accountKey(const QUrl& url);
+
+    const Root* findRoot(int root) const;
+    bool isBefore(int left, int right) const;
+    QList<int> queuedRoots() const;
+    QList<int> runningRoots() const;
+    void startRoot(int root);
+    void distributeJobs();
+
+public slots:
+
+    void scheduleRoots();
+    void onSynchronizerFinished(int root);
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_SYNCORCHESTRATORPRIVATE_H
@@ -0,0 +1,202 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SynqClient/syncprogress.h"
+
+#include "syncprogressprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @class SyncProgress
+ * @brief Detailed progress of a synchronization run.
+ *
+ * This class describes how far a DirectorySynchronizer got. In contrast to a plain percentage, it
+ * holds the number of sync actions and the number of bytes to be transferred in total as well as
+ * how much of them are done. In addition, it includes an estimate of the current throughput and
+ * the time remaining until the sync is done.
+ *
+ * Use DirectorySynchronizer::currentProgress() to get the progress at any time or connect to the
+ * DirectorySynchronizer::progressAvailable() signal to be notified about changes.
+ */
+
+/**
+ * @brief Constructor.
+ */
+SyncProgress::SyncProgress() : d(new SyncProgressPrivate) {}
+
+/**
+ * @brief Copy constructor.
+ */
+SyncProgress::SyncProgress(const SyncProgress& other) : d(other.d) {}
+
+/**
+ * @brief Destructor.
+ */
+SyncProgress::~SyncProgress() {}
+
+/**
+ * @brief Assignment operator.
+ */
+SyncProgress& SyncProgress::operator=(const SyncProgress& other)
+{
+    d = other.d;
+    return *this;
+}
+
+/**
+ * @brief The overall progress in percent.
+ *
+ * This is a value between 0 and 100. Each sync action is weighted by the number of bytes it
+ * transfers (plus a small constant for the action itself), so a single huge file accounts for a
+ * correspondingly large part of the progress. A negative value indicates that the progress is not
+ * known yet (e.g. while the sync plan is being created).
+ */
+int SyncProgress::progress() const
+{
+    return d->progress;
+}
+
+/**
+ * @brief Set the overall progress in percent.
+ */
+void SyncProgress::setProgress(int progress)
+{
+    d->progress = progress;
+}
+
+/**
+ * @brief The number of sync actions which have been carried out or are in progress.
+ */
+int SyncProgress::actionsDone() const
+{
+    return d->actionsDone;
+}
+
+/**
+ * @brief Set the number of sync actions which have been carried out or are in progress.
+ */
+void SyncProgress::setActionsDone(int actionsDone)
+{
+    d->actionsDone = actionsDone;
+}
+
+/**
+ * @brief The total number of sync actions in the sync plan.
+ */
+int SyncProgress::actionsTotal() const
+{
+    return d->actionsTotal;
+}
+
+/**
+ * @brief Set the total number of sync actions in the sync plan.
+ */
+void SyncProgress::setActionsTotal(int actionsTotal)
+{
+    d->actionsTotal = actionsTotal;
+}
+
+/**
+ * @brief The number of bytes uploaded and downloaded so far.
+ */
+qint64 SyncProgress::bytesDone() const
+{
+    return d->bytesDone;
+}
+
+/**
+ * @brief Set the number of bytes uploaded and downloaded so far.
+ */
+void SyncProgress::setBytesDone(qint64 bytesDone)
+{
+    d->bytesDone = bytesDone;
+}
+
+/**
+ * @brief The total number of bytes to upload and download.
+ *
+ * If the size of a file to be downloaded is not known up front, it is added once the server
+ * reports it.
+ */
+qint64 SyncProgress::bytesTotal() const
+{
+    return d->bytesTotal;
+}
+
+/**
+ * @brief Set the total number of bytes to upload and download.
+ */
+void SyncProgress::setBytesTotal(qint64 bytesTotal)
+{
+    d->bytesTotal = bytesTotal;
+}
+
+/**
+ * @brief The estimated current throughput in bytes per second.
+ *
+ * This is a moving average over the recent transfer rate of all running jobs.
+ */
+double SyncProgress::bytesPerSecond() const
+{
+    return d->bytesPerSecond;
+}
+
+/**
+ * @brief Set the estimated current throughput in bytes per second.
+ */
+void SyncProgress::setBytesPerSecond(double bytesPerSecond)
+{
+    d->bytesPerSecond = bytesPerSecond;
+}
+
+/**
+ * @brief The estimated time in milliseconds until all data is transferred.
+ *
+ * This is based on the bytes remaining and the bytesPerSecond(). If no estimate can be given
+ * (yet), -1 is returned.
+ */
+qint64 SyncProgress::eta() const
+{
+    return d->eta;
+}
+
+/**
+ * @brief Set the estimated time in milliseconds until all data is transferred.
+ */
+void SyncProgress::setEta(qint64 eta)
+{
+    d->eta = eta;
+}
+
+/**
+ * @brief Convert the progress to a variant map.
+ */
+QVariantMap SyncProgress::toVariantMap() const
+{
+    return { { "progress", d->progress },
+             { "actionsDone", d->actionsDone },
+             { "actionsTotal", d->actionsTotal },
+             { "bytesDone", d->bytesDone },
+             { "bytesTotal", d->bytesTotal },
+             { "bytesPerSecond", d->bytesPerSecond },
+             { "eta", d->eta } };
+}
+
+} // namespace SynqClient
@@ -0,0 +1,49 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "syncprogressprivate.h"
+
+namespace SynqClient {
+
+SyncProgressPrivate::SyncProgressPrivate()
+    : progress(-1),
+      actionsDone(0),
+      actionsTotal(0),
+      bytesDone(0),
+      bytesTotal(0),
+      bytesPerSecond(0.0),
+      eta(-1)
+{
+}
+
+SyncProgressPrivate::SyncProgressPrivate(const SyncProgressPrivate& other)
+    : QSharedData(other),
+      progress(other.progress),
+      actionsDone(other.actionsDone),
+      actionsTotal(other.actionsTotal),
+      bytesDone(other.bytesDone),
+      bytesTotal(other.bytesTotal),
+      bytesPerSecond(other.bytesPerSecond),
+      eta(other.eta)
+{
+}
+
+SyncProgressPrivate::~SyncProgressPrivate() {}
+
+} // namespace SynqClient
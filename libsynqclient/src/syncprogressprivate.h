@@ -0,0 +1,47 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_SYNCPROGRESSPRIVATE_H
+#define SYNQCLIENT_SYNCPROGRESSPRIVATE_H
+
+#include "SynqClient/syncprogress.h"
+
+#include <QSharedData>
+
+namespace SynqClient {
+
+class SyncProgressPrivate : public QSharedData
+{
+public:
+    SyncProgressPrivate();
+    SyncProgressPrivate(const SyncProgressPrivate& other);
+    ~SyncProgressPrivate();
+
+    int progress;
+    int actionsDone;
+    int actionsTotal;
+    qint64 bytesDone;
+    qint64 bytesTotal;
+    double bytesPerSecond;
+    qint64 eta;
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_SYNCPROGRESSPRIVATE_H
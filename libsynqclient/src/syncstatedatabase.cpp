@@ -136,6 +136,22 @@ bool SyncStateDatabase::removeEntry(const QString& path)
     return false;
 }
 
+/**
+ * @brief Write pending changes to persistent storage.
+ *
+ * This is called when the database is kept open over several sync runs (e.g. by the
+ * ContinuousSynchronizer) to ensure the state of a finished sync is persisted without closing the
+ * database. On success, it shall return true, on error, false.
+ *
+ * The default implementation has nothing to write; it only returns whether the database is open.
+ *
+ * @sa closeDatabase()
+ */
+bool SyncStateDatabase::flushDatabase()
+{
+    return isOpen();
+}
+
 /**
  * @brief Close the database.
  *
@@ -23,4 +23,6 @@ namespace SynqClient {
 
 SyncStateDatabasePrivate::SyncStateDatabasePrivate(SyncStateDatabase* q) : q_ptr(q), open(false) {}
 
+SyncStateDatabasePrivate::~SyncStateDatabasePrivate() {}
+
 } // namespace SynqClient
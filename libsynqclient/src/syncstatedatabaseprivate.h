@@ -28,6 +28,7 @@ class SyncStateDatabasePrivate
 {
 public:
     explicit SyncStateDatabasePrivate(SyncStateDatabase* q);
+    virtual ~SyncStateDatabasePrivate();
 
     SyncStateDatabase* q_ptr;
     Q_DECLARE_PUBLIC(SyncStateDatabase);
@@ -163,6 +163,68 @@ void SyncStateEntry::setSyncProperty(const QString& syncProperty)
     d->syncProperty = syncProperty;
 }
 
+/**
+ * @brief An identifier of the local file or folder.
+ *
+ * This property holds an identifier which identifies the local file or folder independently
+ * of its path, e.g. the inode number on Unix-like systems. It is used to detect local moves and
+ * renames. The property is empty if the identifier is not known.
+ */
+QString SyncStateEntry::localFileId() const
+{
+    return d->localFileId;
+}
+
+/**
+ * @brief Set the identifier of the local file or folder.
+ */
+void SyncStateEntry::setLocalFileId(const QString& localFileId)
+{
+    d->localFileId = localFileId;
+}
+
+/**
+ * @brief A fingerprint of the content of the file.
+ *
+ * This property holds a fingerprint of the file content as it was at the time the file has been
+ * synced. It is used to find files with identical content, which then can be copied on the server
+ * side instead of being uploaded again. The property is empty for folders and if the fingerprint
+ * is not known.
+ */
+QString SyncStateEntry::fingerprint() const
+{
+    return d->fingerprint;
+}
+
+/**
+ * @brief Set the fingerprint of the content of the file.
+ */
+void SyncStateEntry::setFingerprint(const QString& fingerprint)
+{
+    d->fingerprint = fingerprint;
+}
+
+/**
+ * @brief The ID of the remote file or folder.
+ *
+ * This property holds the stable ID the server assigned to the remote resource (see
+ * FileInfo::fileId()) when it has been synced. As these IDs don't change when a resource is moved
+ * or renamed on the server, they are used to apply such moves locally instead of deleting and
+ * downloading the resource again. The property is empty if the backend does not provide such IDs.
+ */
+QString SyncStateEntry::remoteFileId() const
+{
+    return d->remoteFileId;
+}
+
+/**
+ * @brief Set the ID of the remote file or folder.
+ */
+void SyncStateEntry::setRemoteFileId(const QString& remoteFileId)
+{
+    d->remoteFileId = remoteFileId;
+}
+
 /**
  * @brief Convert a path to a sync entry path.
  *
@@ -22,7 +22,13 @@
 namespace SynqClient {
 
 SyncStateEntryPrivate::SyncStateEntryPrivate()
-    : path(), modificationTime(), syncProperty(), valid(false)
+    : path(),
+      modificationTime(),
+      syncProperty(),
+      localFileId(),
+      fingerprint(),
+      remoteFileId(),
+      valid(false)
 {
 }
 
@@ -31,6 +37,9 @@ SyncStateEntryPrivate::SyncStateEntryPrivate(const SyncStateEntryPrivate& other)
       path(other.path),
       modificationTime(other.modificationTime),
       syncProperty(other.syncProperty),
+      localFileId(other.localFileId),
+      fingerprint(other.fingerprint),
+      remoteFileId(other.remoteFileId),
       valid(other.valid)
 {
 }
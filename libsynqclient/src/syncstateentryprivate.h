@@ -38,6 +38,9 @@ public:
     QString path;
     QDateTime modificationTime;
     QString syncProperty;
+    QString localFileId;
+    QString fingerprint;
+    QString remoteFileId;
     bool valid;
 };
 
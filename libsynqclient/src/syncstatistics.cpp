@@ -0,0 +1,295 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SynqClient/syncstatistics.h"
+
+#include <algorithm>
+
+#include <QMetaEnum>
+#include <QVariantList>
+
+#include "SynqClient/jobmetrics.h"
+#include "syncstatisticsprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @class SyncStatistics
+ * @brief Aggregated metrics of a synchronization run.
+ *
+ * This class holds statistics about a single run of a DirectorySynchronizer. It records how much
+ * time has been spent in each of the phases of the sync (see SynchronizerPhase) and aggregates the
+ * JobMetrics of all jobs run: The number of jobs, requests and retries, the bytes transferred and a
+ * histogram of the time it took until the server responded to a job.
+ *
+ * Use DirectorySynchronizer::statistics() to get the statistics of a run or connect to the
+ * DirectorySynchronizer::statisticsAvailable() signal to receive periodic snapshots. Use
+ * toVariantMap() to convert the statistics e.g. to JSON.
+ */
+
+/**
+ * @brief Constructor.
+ */
+SyncStatistics::SyncStatistics() : d(new SyncStatisticsPrivate) {}
+
+/**
+ * @brief Copy constructor.
+ */
+SyncStatistics::SyncStatistics(const SyncStatistics& other) : d(other.d) {}
+
+/**
+ * @brief Destructor.
+ */
+SyncStatistics::~SyncStatistics() {}
+
+/**
+ * @brief Assignment operator.
+ */
+SyncStatistics& SyncStatistics::operator=(const SyncStatistics& other)
+{
+    d = other.d;
+    return *this;
+}
+
+/**
+ * @brief The time the synchronization has been started.
+ */
+QDateTime SyncStatistics::startTime() const
+{
+    return d->startTime;
+}
+
+/**
+ * @brief Set the time the synchronization has been started.
+ */
+void SyncStatistics::setStartTime(const QDateTime& startTime)
+{
+    d->startTime = startTime;
+}
+
+/**
+ * @brief The time the synchronization finished.
+ *
+ * This is invalid as long as the synchronization is running.
+ */
+QDateTime SyncStatistics::finishTime() const
+{
+    return d->finishTime;
+}
+
+/**
+ * @brief Set the time the synchronization finished.
+ */
+void SyncStatistics::setFinishTime(const QDateTime& finishTime)
+{
+    d->finishTime = finishTime;
+}
+
+/**
+ * @brief The duration of the synchronization in milliseconds.
+ *
+ * If the synchronization is still running, this is the time elapsed since it has been started.
+ * If it has not been started, this returns 0.
+ */
+qint64 SyncStatistics::duration() const
+{
+    if (!d->startTime.isValid()) {
+        return 0;
+    }
+    if (!d->finishTime.isValid()) {
+        return d->startTime.msecsTo(QDateTime::currentDateTimeUtc());
+    }
+    return d->startTime.msecsTo(d->finishTime);
+}
+
+/**
+ * @brief The time in milliseconds spent in the given @p phase.
+ */
+qint64 SyncStatistics::phaseDuration(SynchronizerPhase phase) const
+{
+    return d->phaseDurations.value(phase, 0);
+}
+
+/**
+ * @brief Set the time in milliseconds spent in the given @p phase to @p duration.
+ */
+void SyncStatistics::setPhaseDuration(SynchronizerPhase phase, qint64 duration)
+{
+    d->phaseDurations[phase] = duration;
+}
+
+/**
+ * @brief The number of jobs which have been run.
+ */
+int SyncStatistics::jobs() const
+{
+    return d->jobs;
+}
+
+/**
+ * @brief The number of jobs which finished with an error.
+ *
+ * Note that not all of these errors are fatal; e.g. a job creating a folder which already
+ * exists on the server fails, but the synchronization carries on.
+ */
+int SyncStatistics::failedJobs() const
+{
+    return d->failedJobs;
+}
+
+/**
+ * @brief The number of network requests sent by all jobs.
+ */
+int SyncStatistics::requests() const
+{
+    return d->requests;
+}
+
+/**
+ * @brief The number of times a job retried a failed request.
+ */
+int SyncStatistics::retries() const
+{
+    return d->retries;
+}
+
+/**
+ * @brief The number of payload bytes sent to the server.
+ */
+qint64 SyncStatistics::bytesSent() const
+{
+    return d->bytesSent;
+}
+
+/**
+ * @brief The number of payload bytes received from the server.
+ */
+qint64 SyncStatistics::bytesReceived() const
+{
+    return d->bytesReceived;
+}
+
+/**
+ * @brief The average number of bytes per second sent during the SynchronizerPhase::Transfers phase.
+ */
+double SyncStatistics::uploadRate() const
+{
+    auto duration = phaseDuration(SynchronizerPhase::Transfers);
+    if (duration <= 0) {
+        return 0.0;
+    }
+    return d->bytesSent * 1000.0 / duration;
+}
+
+/**
+ * @brief The average number of bytes per second received during the SynchronizerPhase::Transfers
+ * phase.
+ */
+double SyncStatistics::downloadRate() const
+{
+    auto duration = phaseDuration(SynchronizerPhase::Transfers);
+    if (duration <= 0) {
+        return 0.0;
+    }
+    return d->bytesReceived * 1000.0 / duration;
+}
+
+/**
+ * @brief A histogram of the time to first byte of the jobs.
+ *
+ * The entry at index `i` holds the number of jobs for which the time between starting the job and
+ * receiving the first response was less than or equal to `latencyHistogramBounds()[i]`
+ * milliseconds (and larger than the previous bound). The last entry counts all jobs exceeding the
+ * largest bound. Jobs which did not receive any response are not counted.
+ */
+QVector<int> SyncStatistics::latencyHistogram() const
+{
+    return d->latencyHistogram;
+}
+
+/**
+ * @brief Add the @p metrics of a finished job to the statistics.
+ *
+ * The @p error is used to count failed jobs.
+ */
+void SyncStatistics::addJob(const JobMetrics& metrics, JobError error)
+{
+    d->jobs += 1;
+    if (error != JobError::NoError) {
+        d->failedJobs += 1;
+    }
+    d->requests += metrics.requests();
+    d->retries += metrics.retries();
+    d->bytesSent += metrics.bytesSent();
+    d->bytesReceived += metrics.bytesReceived();
+    auto latency = metrics.timeToFirstByte();
+    if (latency >= 0) {
+        auto bounds = latencyHistogramBounds();
+        auto bucket = std::lower_bound(bounds.cbegin(), bounds.cend(), latency) - bounds.cbegin();
+        d->latencyHistogram[static_cast<int>(bucket)] += 1;
+    }
+}
+
+/**
+ * @brief Convert the statistics to a variant map.
+ *
+ * The result can be converted e.g. to JSON using QJsonObject::fromVariantMap(). Durations are
+ * given in milliseconds, rates in bytes per second.
+ */
+QVariantMap SyncStatistics::toVariantMap() const
+{
+    QVariantMap phases;
+    auto phaseEnum = QMetaEnum::fromType<SynchronizerPhase>();
+    for (int i = 0; i < phaseEnum.keyCount(); ++i) {
+        phases[phaseEnum.key(i)] =
+                phaseDuration(static_cast<SynchronizerPhase>(phaseEnum.value(i)));
+    }
+
+    QVariantList histogram;
+    auto bounds = latencyHistogramBounds();
+    for (int i = 0; i < d->latencyHistogram.length(); ++i) {
+        histogram << QVariantMap { { "le", i < bounds.length() ? QVariant(bounds.at(i))
+                                                               : QVariant("inf") },
+                                   { "count", d->latencyHistogram.at(i) } };
+    }
+
+    return { { "startTime", d->startTime.toString(Qt::ISODateWithMs) },
+             { "finishTime", d->finishTime.toString(Qt::ISODateWithMs) },
+             { "duration", duration() },
+             { "phases", phases },
+             { "jobs", d->jobs },
+             { "failedJobs", d->failedJobs },
+             { "requests", d->requests },
+             { "retries", d->retries },
+             { "bytesSent", d->bytesSent },
+             { "bytesReceived", d->bytesReceived },
+             { "uploadRate", uploadRate() },
+             { "downloadRate", downloadRate() },
+             { "latencyHistogram", histogram } };
+}
+
+/**
+ * @brief The upper bounds in milliseconds of the buckets of the latencyHistogram().
+ */
+QVector<int> SyncStatistics::latencyHistogramBounds()
+{
+    return { 10, 25, 50, 100, 250, 500, 1000, 2500, 5000, 10000 };
+}
+
+} // namespace SynqClient
@@ -0,0 +1,55 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "syncstatisticsprivate.h"
+
+namespace SynqClient {
+
+SyncStatisticsPrivate::SyncStatisticsPrivate()
+    : startTime(),
+      finishTime(),
+      phaseDurations(),
+      jobs(0),
+      failedJobs(0),
+      requests(0),
+      retries(0),
+      bytesSent(0),
+      bytesReceived(0),
+      latencyHistogram(SyncStatistics::latencyHistogramBounds().length() + 1, 0)
+{
+}
+
+SyncStatisticsPrivate::SyncStatisticsPrivate(const SyncStatisticsPrivate& other)
+    : QSharedData(other),
+      startTime(other.startTime),
+      finishTime(other.finishTime),
+      phaseDurations(other.phaseDurations),
+      jobs(other.jobs),
+      failedJobs(other.failedJobs),
+      requests(other.requests),
+      retries(other.retries),
+      bytesSent(other.bytesSent),
+      bytesReceived(other.bytesReceived),
+      latencyHistogram(other.latencyHistogram)
+{
+}
+
+SyncStatisticsPrivate::~SyncStatisticsPrivate() {}
+
+} // namespace SynqClient
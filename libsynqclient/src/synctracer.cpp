@@ -0,0 +1,230 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SynqClient/synctracer.h"
+
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include "synctracerprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @class SyncTracer
+ * @brief Records what happens during a sync in Chrome trace-event format.
+ *
+ * A tracer collects spans (things which happen over a period of time, like a sync phase or a
+ * job), instant events and counters. Assign it to a DirectorySynchronizer via
+ * DirectorySynchronizer::setTracer() to record the phases of a sync, every job run (including the
+ * path it operates on, its type, the bytes transferred and the HTTP status) and the decisions of
+ * the scheduler which runs the remote actions.
+ *
+ * Use toJson() or save() to get the recorded events in the JSON based Chrome trace-event format.
+ * Such files can be opened in [Perfetto](https://ui.perfetto.dev) or `chrome://tracing` to see
+ * how a sync run actually spent its time.
+ *
+ * Events are put on tracks (shown as threads in the viewers). Spans can be put on a specific
+ * track or on AutoTrack; in the latter case, they are distributed on as many tracks as needed so
+ * that no two overlapping spans share one track. Hence, it is easy to see how many jobs ran in
+ * parallel at any time.
+ */
+
+/**
+ * @brief Constructor.
+ */
+SyncTracer::SyncTracer(QObject* parent) : QObject(parent), d_ptr(new SyncTracerPrivate(this)) {}
+
+/**
+ * @brief Destructor.
+ */
+SyncTracer::~SyncTracer() {}
+
+/**
+ * @brief Indicates if no events have been recorded so far.
+ */
+bool SyncTracer::isEmpty() const
+{
+    Q_D(const SyncTracer);
+    return d->events.isEmpty();
+}
+
+/**
+ * @brief Remove all recorded events and track names.
+ */
+void SyncTracer::clear()
+{
+    Q_D(SyncTracer);
+    d->events.clear();
+    d->trackNames.clear();
+}
+
+/**
+ * @brief Set the name shown for the given @p track.
+ */
+void SyncTracer::setTrackName(int track, const QString& name)
+{
+    Q_D(SyncTracer);
+    d->trackNames[track] = name;
+}
+
+/**
+ * @brief Record a span.
+ *
+ * This records something named @p name in the given @p category which lasted from @p start to
+ * @p end. The @p args are shown when the span is selected in the viewer. If @p track is
+ * AutoTrack, the span is put on the first automatically created track where it does not overlap
+ * with other spans.
+ */
+void SyncTracer::addSpan(const QString& category, const QString& name, const QDateTime& start,
+                         const QDateTime& end, const QVariantMap& args, int track)
+{
+    Q_D(SyncTracer);
+    if (!start.isValid()) {
+        return;
+    }
+    auto duration = end.isValid() ? qMax<qint64>(start.msecsTo(end), 0) : 0;
+    d->events << SyncTracerPrivate::Event { 'X', category, name, start, duration, track, args };
+}
+
+/**
+ * @brief Record an instant event.
+ *
+ * This records that something named @p name in the given @p category happened at @p time on the
+ * given @p track.
+ */
+void SyncTracer::addInstant(const QString& category, const QString& name, const QDateTime& time,
+                            const QVariantMap& args, int track)
+{
+    Q_D(SyncTracer);
+    if (!time.isValid()) {
+        return;
+    }
+    d->events << SyncTracerPrivate::Event { 'i', category, name, time, 0, track, args };
+}
+
+/**
+ * @brief Record the value of a counter.
+ *
+ * This records the @p values (which must be numbers) of the counter named @p name at @p time.
+ * Counters are shown as graphs in the viewer, one series per key in @p values.
+ */
+void SyncTracer::addCounter(const QString& name, const QDateTime& time, const QVariantMap& values)
+{
+    Q_D(SyncTracer);
+    if (!time.isValid()) {
+        return;
+    }
+    d->events << SyncTracerPrivate::Event { 'C', QString(), name, time, 0, 0, values };
+}
+
+/**
+ * @brief Get the recorded events as Chrome trace-event JSON.
+ *
+ * Timestamps are written relative to the earliest recorded event.
+ */
+QByteArray SyncTracer::toJson() const
+{
+    Q_D(const SyncTracer);
+    auto events = d->events;
+    int numAutoTracks = 0;
+    d->assignAutoTracks(events, numAutoTracks);
+
+    QDateTime origin;
+    for (const auto& event : qAsConst(events)) {
+        if (!origin.isValid() || event.time < origin) {
+            origin = event.time;
+        }
+    }
+
+    QJsonArray traceEvents;
+    auto addMetadata = [&](const QString& name, int track, const QJsonObject& args) {
+        traceEvents.append(QJsonObject { { "name", name },
+                                         { "ph", "M" },
+                                         { "pid", 1 },
+                                         { "tid", track },
+                                         { "args", args } });
+    };
+    addMetadata("process_name", 0, { { "name", "SynqClient" } });
+    auto trackNames = d->trackNames;
+    for (int i = 0; i < numAutoTracks; ++i) {
+        auto track = SyncTracerPrivate::FirstAutoTrack + i;
+        if (!trackNames.contains(track)) {
+            trackNames[track] = QString("Jobs #%1").arg(i + 1);
+        }
+    }
+    for (auto it = trackNames.cbegin(); it != trackNames.cend(); ++it) {
+        addMetadata("thread_name", it.key(), { { "name", it.value() } });
+        addMetadata("thread_sort_index", it.key(), { { "sort_index", it.key() } });
+    }
+
+    for (const auto& event : qAsConst(events)) {
+        QJsonObject object { { "name", event.name },
+                             { "ph", QString(QLatin1Char(event.type)) },
+                             { "ts", origin.msecsTo(event.time) * 1000 },
+                             { "pid", 1 },
+                             { "tid", event.track } };
+        if (!event.category.isEmpty()) {
+            object["cat"] = event.category;
+        }
+        switch (event.type) {
+        case 'X':
+            object["dur"] = event.duration * 1000;
+            break;
+        case 'i':
+            object["s"] = "t";
+            break;
+        default:
+            break;
+        }
+        if (!event.args.isEmpty()) {
+            object["args"] = QJsonObject::fromVariantMap(event.args);
+        }
+        traceEvents.append(object);
+    }
+
+    QJsonObject result { { "traceEvents", traceEvents }, { "displayTimeUnit", "ms" } };
+    return QJsonDocument(result).toJson(QJsonDocument::Compact);
+}
+
+/**
+ * @brief Write the recorded events to the file @p fileName.
+ *
+ * Returns true if the file has been written successfully.
+ *
+ * @sa toJson()
+ */
+bool SyncTracer::save(const QString& fileName) const
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+    auto data = toJson();
+    return file.write(data) == data.length();
+}
+
+/**
+ * @brief Constructor.
+ */
+SyncTracer::SyncTracer(SyncTracerPrivate* d, QObject* parent) : QObject(parent), d_ptr(d) {}
+
+} // namespace SynqClient
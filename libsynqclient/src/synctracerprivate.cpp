@@ -0,0 +1,66 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "synctracerprivate.h"
+
+#include <algorithm>
+
+namespace SynqClient {
+
+SyncTracerPrivate::SyncTracerPrivate(SyncTracer* q) : q_ptr(q), events(), trackNames() {}
+
+SyncTracerPrivate::~SyncTracerPrivate() {}
+
+/**
+ * @brief Place all spans on the SyncTracer::AutoTrack on concrete tracks.
+ *
+ * Spans are processed in the order they started. Each one is put on the first track on which the
+ * previous span already ended, so that parallel spans (e.g. jobs) end up on separate tracks. The
+ * number of tracks used is returned in @p numAutoTracks.
+ */
+void SyncTracerPrivate::assignAutoTracks(QVector<Event>& events, int& numAutoTracks) const
+{
+    QVector<int> indexes;
+    for (int i = 0; i < events.length(); ++i) {
+        if (events.at(i).track == SyncTracer::AutoTrack) {
+            indexes << i;
+        }
+    }
+    std::stable_sort(indexes.begin(), indexes.end(),
+                     [&](int a, int b) { return events.at(a).time < events.at(b).time; });
+
+    QVector<QDateTime> trackEnds;
+    for (auto index : qAsConst(indexes)) {
+        auto& event = events[index];
+        auto end = event.time.addMSecs(event.duration);
+        int track = 0;
+        while (track < trackEnds.length() && trackEnds.at(track) > event.time) {
+            ++track;
+        }
+        if (track == trackEnds.length()) {
+            trackEnds << end;
+        } else {
+            trackEnds[track] = end;
+        }
+        event.track = FirstAutoTrack + track;
+    }
+    numAutoTracks = trackEnds.length();
+}
+
+} // namespace SynqClient
@@ -0,0 +1,64 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_SYNCTRACERPRIVATE_H
+#define SYNQCLIENT_SYNCTRACERPRIVATE_H
+
+#include <QDateTime>
+#include <QMap>
+#include <QString>
+#include <QVariantMap>
+#include <QVector>
+
+#include "SynqClient/synctracer.h"
+
+namespace SynqClient {
+
+class SyncTracerPrivate
+{
+public:
+    struct Event
+    {
+        char type;
+        QString category;
+        QString name;
+        QDateTime time;
+        qint64 duration;
+        int track;
+        QVariantMap args;
+    };
+
+    // Tracks used for spans placed using SyncTracer::AutoTrack:
+    static const int FirstAutoTrack = 100;
+
+    explicit SyncTracerPrivate(SyncTracer* q);
+    virtual ~SyncTracerPrivate();
+
+    SyncTracer* q_ptr;
+    Q_DECLARE_PUBLIC(SyncTracer);
+
+    QVector<Event> events;
+    QMap<int, QString> trackNames;
+
+    void assignAutoTracks(QVector<Event>& events, int& numAutoTracks) const;
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_SYNCTRACERPRIVATE_H
@@ -0,0 +1,307 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SynqClient/threadedsynchronizer.h"
+
+#include <QDeadlineTimer>
+#include <QMetaObject>
+#include <QMutexLocker>
+
+#include "threadedsynchronizerprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @class ThreadedSynchronizer
+ * @brief Run a DirectorySynchronizer on a dedicated worker thread.
+ *
+ * A DirectorySynchronizer does all of its work - scanning the local folder, querying the sync
+ * state database, parsing server responses and writing files - in the thread it lives in. If that
+ * is the GUI thread of an application, large syncs cause the user interface to freeze.
+ *
+ * This class is a thread-safe facade which runs synchronizers on a worker thread with its own
+ * event loop. As the job factory (including its QNetworkAccessManager) and the sync state
+ * database must live in the same thread as the synchronizer, they are not passed in directly.
+ * Instead, a setup() function is set, which is called in the worker thread for each run to
+ * create and configure them:
+ *
+ * @code
+ * auto sync = new SynqClient::ThreadedSynchronizer(this);
+ * sync->setSetup([=](SynqClient::DirectorySynchronizer* synchronizer) {
+ *     // Runs in the worker thread - create all objects as children of the synchronizer:
+ *     auto nam = new QNetworkAccessManager(synchronizer);
+ *     auto factory = new SynqClient::WebDAVJobFactory(synchronizer);
+ *     factory->setNetworkAccessManager(nam);
+ *     factory->setUrl(url);
+ *     auto db = new SynqClient::SQLSyncStateDatabase(synchronizer);
+ *     db->setDatabase(dbPath);
+ *     synchronizer->setJobFactory(factory);
+ *     synchronizer->setSyncStateDatabase(db);
+ *     synchronizer->setLocalDirectoryPath(localDir);
+ *     synchronizer->setRemoteDirectoryPath(remoteDir);
+ * });
+ * connect(sync, &SynqClient::ThreadedSynchronizer::finished, this, &MyClass::onSyncFinished);
+ * sync->start();
+ * @endcode
+ *
+ * The start(), stop() and waitForFinished() methods as well as all getters can be called from
+ * any thread. The signals are emitted in the thread the ThreadedSynchronizer lives in. Unlike a
+ * DirectorySynchronizer, a ThreadedSynchronizer can be started again once a run has finished; a
+ * new DirectorySynchronizer is created for each run.
+ */
+
+/**
+ * @brief Constructor.
+ */
+ThreadedSynchronizer::ThreadedSynchronizer(QObject* parent)
+    : QObject(parent), d_ptr(new ThreadedSynchronizerPrivate(this))
+{
+    qRegisterMetaType<SynchronizerLogEntryType>();
+    qRegisterMetaType<SyncProgress>();
+    qRegisterMetaType<SyncStatistics>();
+}
+
+/**
+ * @brief Destructor.
+ *
+ * This stops the worker thread. A synchronizer which still is running is aborted.
+ */
+ThreadedSynchronizer::~ThreadedSynchronizer() {}
+
+/**
+ * @brief The function used to set up a synchronizer.
+ */
+ThreadedSynchronizer::Setup ThreadedSynchronizer::setup() const
+{
+    Q_D(const ThreadedSynchronizer);
+    QMutexLocker locker(&d->mutex);
+    return d->setup;
+}
+
+/**
+ * @brief Set the function used to set up a synchronizer.
+ *
+ * The @p setup function is called in the worker thread with a new DirectorySynchronizer each time
+ * the sync is started. It must configure the synchronizer. All objects used by the synchronizer
+ * (in particular the job factory, its network access manager and the sync state database) must be
+ * created within the function, ideally as children of the synchronizer. They are deleted together
+ * with the synchronizer once the run has finished.
+ *
+ * Changing the function only affects runs started afterwards.
+ */
+void ThreadedSynchronizer::setSetup(const Setup& setup)
+{
+    Q_D(ThreadedSynchronizer);
+    QMutexLocker locker(&d->mutex);
+    d->setup = setup;
+}
+
+/**
+ * @brief The state of the current or last run.
+ */
+SynchronizerState ThreadedSynchronizer::state() const
+{
+    Q_D(const ThreadedSynchronizer);
+    QMutexLocker locker(&d->mutex);
+    return d->state;
+}
+
+/**
+ * @brief The error of the last run.
+ */
+SynchronizerError ThreadedSynchronizer::error() const
+{
+    Q_D(const ThreadedSynchronizer);
+    QMutexLocker locker(&d->mutex);
+    return d->error;
+}
+
+/**
+ * @brief A textual description of the error of the last run.
+ */
+QString ThreadedSynchronizer::errorString() const
+{
+    Q_D(const ThreadedSynchronizer);
+    QMutexLocker locker(&d->mutex);
+    return d->errorString;
+}
+
+/**
+ * @brief The last progress reported by the current or last run.
+ */
+SyncProgress ThreadedSynchronizer::currentProgress() const
+{
+    Q_D(const ThreadedSynchronizer);
+    QMutexLocker locker(&d->mutex);
+    return d->progress;
+}
+
+/**
+ * @brief The last statistics reported by the current or last run.
+ *
+ * While a sync is running, this is updated whenever the synchronizer reports statistics (see
+ * DirectorySynchronizer::statisticsInterval()). Once it finished, the final statistics are
+ * returned.
+ */
+SyncStatistics ThreadedSynchronizer::statistics() const
+{
+    Q_D(const ThreadedSynchronizer);
+    QMutexLocker locker(&d->mutex);
+    return d->statistics;
+}
+
+/**
+ * @brief Start a sync run.
+ *
+ * This creates a new DirectorySynchronizer in the worker thread, sets it up using the setup()
+ * function and starts it. The method returns immediately; once the run is done, the finished()
+ * signal is emitted.
+ *
+ * If a sync already is running, this has no effect and false is returned.
+ */
+bool ThreadedSynchronizer::start()
+{
+    Q_D(ThreadedSynchronizer);
+    QMutexLocker locker(&d->mutex);
+    if (d->state == SynchronizerState::Running) {
+        return false;
+    }
+    d->state = SynchronizerState::Running;
+    d->error = SynchronizerError::NoError;
+    d->errorString = QString();
+    d->progress = SyncProgress();
+    d->statistics = SyncStatistics();
+    d->stopRequested = false;
+    auto setup = d->setup;
+    locker.unlock();
+
+    QMetaObject::invokeMethod(
+            d->worker, [=]() { d->runSynchronizer(setup); }, Qt::QueuedConnection);
+    return true;
+}
+
+/**
+ * @brief Stop the running sync.
+ *
+ * This requests the synchronizer to stop. It will finish with the SynchronizerError::Stopped
+ * error soon after. This also works if the run has just been started and the synchronizer has not
+ * yet been created in the worker thread. If no sync is running, this has no effect.
+ */
+void ThreadedSynchronizer::stop()
+{
+    Q_D(ThreadedSynchronizer);
+    {
+        QMutexLocker locker(&d->mutex);
+        if (d->state != SynchronizerState::Running) {
+            return;
+        }
+        d->stopRequested = true;
+    }
+    QMetaObject::invokeMethod(
+            d->worker,
+            [=]() {
+                // Ignore requests which were queued for a previous run:
+                QMutexLocker locker(&d->mutex);
+                auto stop = d->stopRequested;
+                locker.unlock();
+                if (stop && d->synchronizer) {
+                    d->synchronizer->stop();
+                }
+            },
+            Qt::QueuedConnection);
+}
+
+/**
+ * @brief Block until the current run has finished.
+ *
+ * This waits for at most @p timeout milliseconds (or forever if it is negative) and returns true
+ * if no sync is running (anymore). This is mainly useful when using the class from threads
+ * without an event loop.
+ *
+ * @note The finished() signal is delivered asynchronously in the thread the ThreadedSynchronizer
+ * lives in, so it might not have been emitted yet when this method returns.
+ */
+bool ThreadedSynchronizer::waitForFinished(int timeout) const
+{
+    Q_D(const ThreadedSynchronizer);
+    QDeadlineTimer deadline(timeout);
+    QMutexLocker locker(&d->mutex);
+    while (d->state == SynchronizerState::Running) {
+        if (!d->finishedCondition.wait(&d->mutex, deadline)) {
+            return d->state != SynchronizerState::Running;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Constructor.
+ */
+ThreadedSynchronizer::ThreadedSynchronizer(ThreadedSynchronizerPrivate* d, QObject* parent)
+    : QObject(parent), d_ptr(d)
+{
+}
+
+/**
+ * @fn ThreadedSynchronizer::finished()
+ * @brief A sync run has finished.
+ *
+ * Use error() to check if the run was successful.
+ */
+
+/**
+ * @fn ThreadedSynchronizer::logMessageAvailable()
+ * @brief A message from the running sync is available.
+ *
+ * @sa DirectorySynchronizer::logMessageAvailable()
+ */
+
+/**
+ * @fn ThreadedSynchronizer::progress(int value)
+ * @brief Progress of the running sync.
+ *
+ * @sa DirectorySynchronizer::progress()
+ */
+
+/**
+ * @fn ThreadedSynchronizer::progressAvailable(const SyncProgress& progress)
+ * @brief Detailed progress of the running sync.
+ *
+ * @sa DirectorySynchronizer::progressAvailable()
+ */
+
+/**
+ * @fn ThreadedSynchronizer::statisticsAvailable(const SyncStatistics& statistics)
+ * @brief Statistics of the running sync are available.
+ *
+ * @sa DirectorySynchronizer::statisticsAvailable()
+ */
+
+/**
+ * @fn ThreadedSynchronizer::syncEventAvailable()
+ * @brief An action of the given @p type is carried out on the @p path.
+ *
+ * For moves and copies, the @p sourcePath is the path the resource is moved or copied from;
+ * otherwise, it is empty. Unlike DirectorySynchronizer::syncEventAvailable(), the paths are
+ * passed directly, as the synchronizer resolving path ids only lives as long as the run.
+ *
+ * @sa DirectorySynchronizer::syncEventAvailable()
+ */
+
+} // namespace SynqClient
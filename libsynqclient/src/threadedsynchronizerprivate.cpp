@@ -0,0 +1,142 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "threadedsynchronizerprivate.h"
+
+#include <QMetaMethod>
+#include <QMutexLocker>
+#include <QThread>
+
+namespace SynqClient {
+
+ThreadedSynchronizerPrivate::ThreadedSynchronizerPrivate(ThreadedSynchronizer* q)
+    : q_ptr(q),
+      mutex(),
+      finishedCondition(),
+      setup(),
+      state(SynchronizerState::Ready),
+      error(SynchronizerError::NoError),
+      errorString(),
+      progress(),
+      statistics(),
+      stopRequested(false),
+      thread(new QThread),
+      worker(new QObject),
+      synchronizer(nullptr)
+{
+    thread->setObjectName("SynqClientSyncThread");
+    worker->moveToThread(thread);
+    QObject::connect(thread, &QThread::finished, worker, &QObject::deleteLater);
+    thread->start();
+}
+
+/**
+ * @brief Destructor.
+ *
+ * This stops the worker thread. Any synchronizer which still is running is deleted (and hence
+ * aborted) together with the worker.
+ */
+ThreadedSynchronizerPrivate::~ThreadedSynchronizerPrivate()
+{
+    thread->quit();
+    thread->wait();
+    delete thread;
+}
+
+/**
+ * @brief Create and run a new synchronizer.
+ *
+ * This is run in the worker thread. The synchronizer is created as a child of the worker, the
+ * @p setup function is called to configure it and finally, it is started. If the run has been
+ * stopped before (i.e. while this call still was queued), the synchronizer is stopped right away.
+ */
+void ThreadedSynchronizerPrivate::runSynchronizer(const ThreadedSynchronizer::Setup& setup)
+{
+    Q_Q(ThreadedSynchronizer);
+    auto sync = new DirectorySynchronizer(worker);
+    synchronizer = sync;
+    if (setup) {
+        setup(sync);
+    }
+
+    // Keep the snapshots returned by the facade up to date. These run in the worker thread:
+    QObject::connect(sync, &DirectorySynchronizer::progressAvailable, sync,
+                     [=](const SyncProgress& progress) {
+                         QMutexLocker locker(&mutex);
+                         this->progress = progress;
+                     });
+    QObject::connect(sync, &DirectorySynchronizer::statisticsAvailable, sync,
+                     [=](const SyncStatistics& statistics) {
+                         QMutexLocker locker(&mutex);
+                         this->statistics = statistics;
+                     });
+    QObject::connect(sync, &DirectorySynchronizer::finished, sync, [=]() {
+        {
+            QMutexLocker locker(&mutex);
+            state = SynchronizerState::Finished;
+            error = sync->error();
+            errorString = sync->errorString();
+            progress = sync->currentProgress();
+            statistics = sync->statistics();
+            finishedCondition.wakeAll();
+        }
+        sync->deleteLater();
+    });
+
+    // Forward the signals. They are delivered in the thread the facade lives in:
+    QObject::connect(sync, &DirectorySynchronizer::logMessageAvailable, q,
+                     &ThreadedSynchronizer::logMessageAvailable);
+    QObject::connect(sync, &DirectorySynchronizer::progress, q, &ThreadedSynchronizer::progress);
+    QObject::connect(sync, &DirectorySynchronizer::progressAvailable, q,
+                     &ThreadedSynchronizer::progressAvailable);
+    QObject::connect(sync, &DirectorySynchronizer::statisticsAvailable, q,
+                     &ThreadedSynchronizer::statisticsAvailable);
+    QObject::connect(sync, &DirectorySynchronizer::finished, q, &ThreadedSynchronizer::finished);
+
+    // Path ids of sync events can only be resolved by the synchronizer, which is gone once the
+    // event is delivered - so forward the paths instead. As for the synchronizer itself, events
+    // are only created if someone listens:
+    static const auto syncEventSignal =
+            QMetaMethod::fromSignal(&ThreadedSynchronizer::syncEventAvailable);
+    if (q->isSignalConnected(syncEventSignal)) {
+        QObject::connect(sync, &DirectorySynchronizer::syncEventAvailable, sync,
+                         [=](const SyncEvent& event) {
+                             auto type = event.type();
+                             auto path = sync->eventPath(event.pathId());
+                             auto sourcePath = sync->eventPath(event.sourcePathId());
+                             QMetaObject::invokeMethod(
+                                     q,
+                                     [=]() { emit q->syncEventAvailable(type, path, sourcePath); },
+                                     Qt::QueuedConnection);
+                         });
+    }
+
+    sync->start();
+
+    // Stopping might finish the synchronizer right away, which requires the mutex, so release it
+    // before:
+    QMutexLocker locker(&mutex);
+    auto stop = stopRequested;
+    locker.unlock();
+    if (stop) {
+        sync->stop();
+    }
+}
+
+} // namespace SynqClient
@@ -0,0 +1,64 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SYNQCLIENT_THREADEDSYNCHRONIZERPRIVATE_H
+#define SYNQCLIENT_THREADEDSYNCHRONIZERPRIVATE_H
+
+#include <QMutex>
+#include <QPointer>
+#include <QWaitCondition>
+
+#include "SynqClient/threadedsynchronizer.h"
+
+class QThread;
+
+namespace SynqClient {
+
+class ThreadedSynchronizerPrivate
+{
+public:
+    explicit ThreadedSynchronizerPrivate(ThreadedSynchronizer* q);
+    virtual ~ThreadedSynchronizerPrivate();
+
+    ThreadedSynchronizer* q_ptr;
+    Q_DECLARE_PUBLIC(ThreadedSynchronizer);
+
+    // Shared between the calling threads and the worker thread - guarded by the mutex:
+    mutable QMutex mutex;
+    QWaitCondition finishedCondition;
+    ThreadedSynchronizer::Setup setup;
+    SynchronizerState state;
+    SynchronizerError error;
+    QString errorString;
+    SyncProgress progress;
+    SyncStatistics statistics;
+    bool stopRequested;
+
+    QThread* thread;
+
+    // Objects living in the worker thread - only to be accessed from there:
+    QObject* worker;
+    QPointer<DirectorySynchronizer> synchronizer;
+
+    void runSynchronizer(const ThreadedSynchronizer::Setup& setup);
+};
+
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_THREADEDSYNCHRONIZERPRIVATE_H
@@ -0,0 +1,137 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../inc/SynqClient/uploadfilebatchjob.h"
+
+#include "uploadfilebatchjobprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @class UploadFileBatchJob
+ * @brief Upload several files at once.
+ *
+ * This class is an abstract base for jobs which upload several local files to the remote within a
+ * single operation. Files to be uploaded are added via addFile(). Results are reported per remote
+ * file name, i.e. after the job finished, BatchJob::fileInfo() can be used to retrieve the new
+ * sync attribute of each uploaded file.
+ *
+ * # Error Handling
+ *
+ * Per entry, the following error codes are used to indicate non-fatal errors:
+ *
+ * - JobError::SyncAttributeMismatch: The file was not uploaded because its sync attribute on the
+ *   server does not match the one set, i.e. there was a *lost update*.
+ *
+ * @sa UploadFileJob
+ */
+
+/**
+ * @brief Constructor.
+ */
+UploadFileBatchJob::UploadFileBatchJob(QObject* parent)
+    : BatchJob(new UploadFileBatchJobPrivate(this), parent)
+{
+}
+
+/**
+ * @brief Destructor.
+ */
+UploadFileBatchJob::~UploadFileBatchJob() {}
+
+/**
+ * @brief Add a file to be uploaded.
+ *
+ * The local file @p localFilename will be uploaded to the @p remoteFilename. If a valid
+ * @p syncAttribute is given, the upload of this file shall only succeed if the remote file's sync
+ * attribute still matches.
+ */
+void UploadFileBatchJob::addFile(const QString& localFilename, const QString& remoteFilename,
+                                 const QVariant& syncAttribute)
+{
+    Q_D(UploadFileBatchJob);
+    if (!d->remoteFilenames.contains(remoteFilename)) {
+        d->remoteFilenames << remoteFilename;
+    }
+    d->localFilenames[remoteFilename] = localFilename;
+    d->syncAttributes[remoteFilename] = syncAttribute;
+}
+
+/**
+ * @brief The remote names of all files to be uploaded.
+ */
+QStringList UploadFileBatchJob::remoteFilenames() const
+{
+    Q_D(const UploadFileBatchJob);
+    return d->remoteFilenames;
+}
+
+/**
+ * @brief The local file which shall be uploaded to @p remoteFilename.
+ */
+QString UploadFileBatchJob::localFilename(const QString& remoteFilename) const
+{
+    Q_D(const UploadFileBatchJob);
+    return d->localFilenames.value(remoteFilename);
+}
+
+/**
+ * @brief The sync attribute expected on the remote file @p remoteFilename.
+ */
+QVariant UploadFileBatchJob::syncAttribute(const QString& remoteFilename) const
+{
+    Q_D(const UploadFileBatchJob);
+    return d->syncAttributes.value(remoteFilename);
+}
+
+/**
+ * @brief The maximum number of requests uploading file data the job runs in parallel.
+ *
+ * Depending on the backend, files cannot always be combined into a single request. In this case,
+ * the job uploads them using several requests, running up to this number of them at once. As a
+ * batch job is usually accounted for as a single job, this defaults to 1, i.e. such requests run
+ * one after the other. The DirectorySynchronizer raises this limit to the number of job slots it
+ * reserved for the batch.
+ */
+int UploadFileBatchJob::maxParallelUploads() const
+{
+    Q_D(const UploadFileBatchJob);
+    return d->maxParallelUploads;
+}
+
+/**
+ * @brief Set the maximum number of requests uploading file data the job runs in parallel.
+ *
+ * Values less than 1 are treated as 1.
+ */
+void UploadFileBatchJob::setMaxParallelUploads(int maxParallelUploads)
+{
+    Q_D(UploadFileBatchJob);
+    d->maxParallelUploads = qMax(1, maxParallelUploads);
+}
+
+/**
+ * @brief Constructor.
+ */
+UploadFileBatchJob::UploadFileBatchJob(UploadFileBatchJobPrivate* d, QObject* parent)
+    : BatchJob(d, parent)
+{
+}
+
+} // namespace SynqClient
@@ -23,6 +23,7 @@
 #include <QFile>
 #include <QIODevice>
 
+#include "readaheaddevice.h"
 #include "uploadfilejobprivate.h"
 
 namespace SynqClient {
@@ -222,6 +223,11 @@ UploadFileJob::UploadFileJob(UploadFileJobPrivate* d, QObject* parent) : Abstrac
  * upload device). Instead, store it and only call this method another time when you e.g. need to
  * retry an upload.
  *
+ * Local files (either set via a path or as input device) are read ahead in a worker thread, so
+ * sending data never blocks on disk I/O. In this case, the returned device might have no data
+ * available temporarily and emits readyRead() once more data is available. Data set via
+ * setData() is uploaded directly from memory.
+ *
  * @sa error()
  */
 QSharedPointer<QIODevice> UploadFileJob::getUploadDevice()
@@ -241,16 +247,18 @@ QSharedPointer<QIODevice> UploadFileJob::getUploadDevice()
             setError(JobError::InvalidParameter, "Input device set to nullptr");
         }
         d->input->seek(0);
+        if (ReadAheadDevice::canReadAhead(d->input.data())) {
+            return QSharedPointer<QIODevice>(new ReadAheadDevice(d->input));
+        }
         return d->input;
     case UploadFileJobPrivate::UploadSource::Path:
-        QFile* file = new QFile(d->localFilename);
+        QSharedPointer<QIODevice> file(new QFile(d->localFilename));
         if (file->open(QIODevice::ReadOnly)) {
-            return QSharedPointer<QIODevice>(file);
+            return QSharedPointer<QIODevice>(new ReadAheadDevice(file));
         } else {
             setError(JobError::InvalidParameter,
                      QString("Failed to open %1 for reading: %2")
                              .arg(d->localFilename, file->errorString()));
-            delete file;
             return nullptr;
         }
         break;
@@ -31,10 +31,54 @@ UploadFileJobPrivate::UploadFileJobPrivate(UploadFileJob* q)
       remoteFilename(),
       sourceType(UploadSource::Invalid),
       fileInfo(),
-      syncAttribute()
+      syncAttribute(),
+      hashingDevice()
 {
 }
 
 UploadFileJobPrivate::~UploadFileJobPrivate() {}
 
+/**
+ * @brief Wrap the upload @p device to calculate a checksum of the data while it is sent.
+ *
+ * Returns the device to pass to the network request instead of the original one.
+ */
+QIODevice* UploadFileJobPrivate::hashUploadDevice(const QSharedPointer<QIODevice>& device,
+                                                  const QString& algorithm)
+{
+    hashingDevice.reset(new HashingDevice(device, algorithm));
+    return hashingDevice.data();
+}
+
+/**
+ * @brief Check the checksum of the sent data against the one reported by the server.
+ *
+ * If the @p fileInfo (as reported by the server after the upload) contains a checksum using the
+ * same algorithm as the one used to hash the upload device and the checksums differ, the error of
+ * the job is set to JobError::ChecksumMismatch and false is returned. Otherwise, the calculated
+ * checksum is added to the @p fileInfo.
+ */
+bool UploadFileJobPrivate::verifyChecksum(FileInfo& fileInfo)
+{
+    Q_Q(UploadFileJob);
+    if (!hashingDevice) {
+        return true;
+    }
+    auto algorithm = hashingDevice->algorithm();
+    auto checksum = hashingDevice->result();
+    hashingDevice.clear();
+    if (checksum.isEmpty()) {
+        return true;
+    }
+    auto reportedChecksum = fileInfo.checksum(algorithm);
+    if (!reportedChecksum.isEmpty() && reportedChecksum != checksum) {
+        q->setError(JobError::ChecksumMismatch,
+                    QString("Checksum mismatch for %1: Server reported %2 checksum %3, sent %4")
+                            .arg(remoteFilename, algorithm, reportedChecksum, checksum));
+        return false;
+    }
+    fileInfo.setChecksum(algorithm, checksum);
+    return true;
+}
+
 } // namespace SynqClient
@@ -26,6 +26,7 @@
 
 #include "abstractjobprivate.h"
 #include "SynqClient/uploadfilejob.h"
+#include "hashingdevice.h"
 
 class QIODevice;
 
@@ -48,6 +49,11 @@ public:
     UploadSource sourceType;
     FileInfo fileInfo;
     QVariant syncAttribute;
+    QSharedPointer<HashingDevice> hashingDevice;
+
+    QIODevice* hashUploadDevice(const QSharedPointer<QIODevice>& device,
+                                const QString& algorithm);
+    bool verifyChecksum(FileInfo& fileInfo);
 };
 
 } // namespace SynqClient
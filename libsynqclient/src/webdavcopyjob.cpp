@@ -0,0 +1,74 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../inc/SynqClient/webdavcopyjob.h"
+
+#include "abstractwebdavjobprivate.h"
+#include "webdavcopyjobprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @class WebDAVCopyJob
+ * @brief Implementation of the CopyJob for WebDAV.
+ *
+ * This job uses the WebDAV `COPY` method. The target is passed via the `Destination` header and
+ * the `Overwrite` header is set according to the overwrite() property.
+ */
+
+/**
+ * @brief Constructor.
+ */
+WebDAVCopyJob::WebDAVCopyJob(QObject* parent)
+    : CopyJob(new WebDAVCopyJobPrivate(this), parent), AbstractWebDAVJob()
+{
+}
+
+/**
+ * @brief Destructor.
+ */
+WebDAVCopyJob::~WebDAVCopyJob() {}
+
+/**
+ * @brief Implementation of AbstractJob::start().
+ */
+void WebDAVCopyJob::start()
+{
+    Q_D(WebDAVCopyJob);
+    d->request.start(d_ptr2.data());
+}
+
+/**
+ * @brief Implementation of AbstractJob::stop().
+ */
+void WebDAVCopyJob::stop()
+{
+    Q_D(WebDAVCopyJob);
+    d->request.stop(d_ptr2.data());
+}
+
+/**
+ * @brief Constructor.
+ */
+WebDAVCopyJob::WebDAVCopyJob(WebDAVCopyJobPrivate* d, QObject* parent)
+    : CopyJob(d, parent), AbstractWebDAVJob()
+{
+}
+
+} // namespace SynqClient
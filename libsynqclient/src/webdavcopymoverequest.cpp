@@ -0,0 +1,203 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "webdavcopymoverequest.h"
+
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QTimer>
+
+#include "abstractcopymovejobprivate.h"
+#include "abstractwebdavjobprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @class WebDAVCopyMoveRequest
+ * @brief Implementation of the WebDAVMoveJob and WebDAVCopyJob.
+ *
+ * The WebDAV `MOVE` and `COPY` methods only differ in what the server does with the source
+ * resource. Hence, both jobs delegate to this class, which sends the request with the target
+ * passed via the `Destination` header and the `Overwrite` header set according to the job's
+ * overwrite property.
+ */
+
+/**
+ * @brief Constructor.
+ *
+ * The request is sent on behalf of the @p job using the given WebDAV @p method.
+ */
+WebDAVCopyMoveRequest::WebDAVCopyMoveRequest(AbstractCopyMoveJobPrivate* job, const char* method)
+    : m_job(job), m_method(method)
+{
+}
+
+/**
+ * @brief Send the request.
+ */
+void WebDAVCopyMoveRequest::start(AbstractWebDAVJobPrivate* webdav)
+{
+    auto q = m_job->q_func();
+    m_job->setState(JobState::Running);
+
+    // Check for missing parameters:
+    if (!checkParameters(webdav)) {
+        m_job->finishLater();
+        return;
+    }
+
+    auto url = webdav->urlFromPath(m_job->path);
+    QNetworkRequest req;
+    webdav->prepareNetworkRequest(req, q);
+    req.setUrl(url);
+    req.setAttribute(QNetworkRequest::RedirectPolicyAttribute,
+                     QNetworkRequest::ManualRedirectPolicy); // WA for QTBUG-92909, handle redirects
+                                                             // manually in client code
+    req.setRawHeader("Destination", destinationUrl(webdav).toEncoded());
+    req.setRawHeader("Overwrite", m_job->overwrite ? "T" : "F");
+    auto reply = webdav->networkAccessManager->sendCustomRequest(req, m_method);
+    if (reply) {
+        reply->setParent(q);
+        m_job->trackReply(reply);
+        QObject::connect(reply, &QNetworkReply::finished, q,
+                         [=]() { handleRequestFinished(webdav); });
+        webdav->reply = reply;
+    } else {
+        m_job->setError(JobError::InvalidResponse, "Received null network reply");
+        m_job->finishLater();
+    }
+}
+
+/**
+ * @brief Abort a running request.
+ */
+void WebDAVCopyMoveRequest::stop(AbstractWebDAVJobPrivate* webdav)
+{
+    if (m_job->state == JobState::Running) {
+        auto reply = webdav->reply;
+        if (reply) {
+            reply->abort();
+            delete reply;
+            webdav->reply = nullptr;
+        }
+        m_job->setError(JobError::Stopped, "The job has been stopped");
+        m_job->finishLater();
+    }
+}
+
+bool WebDAVCopyMoveRequest::checkParameters(AbstractWebDAVJobPrivate* webdav)
+{
+    if (!webdav->networkAccessManager) {
+        m_job->setError(JobError::MissingParameter, "No QNetworkAccessManager set");
+    }
+    if (!webdav->url.isValid()) {
+        m_job->setError(JobError::MissingParameter, "No URL set");
+    }
+    if (m_job->path.isEmpty()) {
+        m_job->setError(JobError::MissingParameter, "No path set");
+    }
+    if (m_job->targetPath.isEmpty()) {
+        m_job->setError(JobError::MissingParameter, "No target path set");
+    }
+    return m_job->error == JobError::NoError;
+}
+
+/**
+ * @brief The URL to send as `Destination` header.
+ *
+ * This is the URL of the target path on the configured server. In contrast to the URL the request
+ * itself is sent to, this must not be subject to manual redirect handling.
+ */
+QUrl WebDAVCopyMoveRequest::destinationUrl(AbstractWebDAVJobPrivate* webdav)
+{
+    auto nextUrl = webdav->nextUrl;
+    webdav->nextUrl = QUrl();
+    auto result = webdav->urlFromPath(m_job->targetPath);
+    webdav->nextUrl = nextUrl;
+    result.setUserName(QString());
+    result.setPassword(QString());
+    return result;
+}
+
+void WebDAVCopyMoveRequest::handleRequestFinished(AbstractWebDAVJobPrivate* webdav)
+{
+    auto q = m_job->q_func();
+    auto reply = webdav->reply;
+    webdav->reply = nullptr;
+    if (reply) {
+        reply->deleteLater();
+        if (webdav->checkIfRequestShallBeRetried(reply)) {
+            webdav->numRetries += 1;
+            QTimer::singleShot(webdav->getRetryDelayInMilliseconds(reply), q,
+                               [=]() { q->start(); });
+            return;
+        }
+        auto code = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+        if (reply->error() != QNetworkReply::NoError) {
+            switch (code) {
+            case AbstractWebDAVJobPrivate::HTTPPreconditionFailed:
+                m_job->setError(JobError::ResourceExists,
+                                QString("The %1 target %2 already exists")
+                                        .arg(m_job->operation, m_job->targetPath));
+                break;
+            case AbstractWebDAVJobPrivate::HTTPNotFound:
+                m_job->setError(JobError::ResourceNotFound,
+                                QString("The resource %1 does not exist").arg(m_job->path));
+                break;
+            case AbstractWebDAVJobPrivate::HTTPConflict:
+                m_job->setError(JobError::ServerContentConflict,
+                                QString("The parent folder of %1 does not exist")
+                                        .arg(m_job->targetPath));
+                break;
+            default:
+                m_job->setError(m_job->fromNetworkError(*reply), reply->errorString());
+                break;
+            }
+            m_job->finishLater();
+        } else if (webdav->shouldFollowUnhandledRedirect(reply)) {
+            // Encountered redirect not handled by Qt, follow:
+            q->start();
+            return;
+        } else {
+            if (code == AbstractWebDAVJobPrivate::HTTPCreated
+                || code == AbstractWebDAVJobPrivate::HTTPNoContent) {
+                // Some servers report the etag of the resulting resource:
+                FileInfo info;
+                info.setPath(m_job->targetPath);
+                info.setName(m_job->targetPath.split("/", Qt::SkipEmptyParts).value(-1));
+                auto etag = reply->header(QNetworkRequest::ETagHeader);
+                if (etag.isValid()) {
+                    info.setSyncAttribute(etag.toString());
+                }
+                m_job->fileInfo = info;
+            } else if (code == AbstractWebDAVJobPrivate::HTTPForbidden) {
+                m_job->setError(JobError::Forbidden,
+                                QString("The %1 operation is forbidden for user on that resource")
+                                        .arg(m_job->operation));
+            } else {
+                m_job->setError(JobError::InvalidResponse,
+                                QString("Received invalid response from server: %1").arg(code));
+            }
+            m_job->finishLater();
+        }
+    }
+}
+
+} // namespace SynqClient
@@ -48,7 +48,7 @@ WebDAVCreateDirectoryJob::~WebDAVCreateDirectoryJob() {}
 void WebDAVCreateDirectoryJob::start()
 {
     Q_D(WebDAVCreateDirectoryJob);
-    d->state = JobState::Running;
+    setState(JobState::Running);
 
     // Check for missing parameters:
     d->checkParameters();
@@ -78,6 +78,7 @@ void WebDAVCreateDirectoryJob::start()
     auto reply = networkAccessManager()->sendCustomRequest(req, d_ptr2->MKCOL);
     if (reply) {
         reply->setParent(this);
+        d->trackReply(reply);
         connect(reply, &QNetworkReply::finished, [=]() { d->handleRequestFinished(); });
         d_ptr2->reply = reply;
     } else {
@@ -50,7 +50,7 @@ WebDAVDeleteJob::~WebDAVDeleteJob() {}
 void WebDAVDeleteJob::start()
 {
     Q_D(WebDAVDeleteJob);
-    d->state = JobState::Running;
+    setState(JobState::Running);
 
     // Check for missing parameters:
     d->checkParameters();
@@ -76,6 +76,7 @@ void WebDAVDeleteJob::start()
     auto reply = networkAccessManager()->deleteResource(req);
     if (reply) {
         reply->setParent(this);
+        d->trackReply(reply);
         connect(reply, &QNetworkReply::finished, [=]() { d->handleRequestFinished(); });
         d_ptr2->reply = reply;
     } else {
@@ -20,6 +20,7 @@
 #include "SynqClient/webdavdownloadfilejob.h"
 
 #include "abstractwebdavjobprivate.h"
+#include "contenthasher.h"
 #include "webdavdownloadfilejobprivate.h"
 
 namespace SynqClient {
@@ -48,7 +49,7 @@ WebDAVDownloadFileJob::~WebDAVDownloadFileJob() {}
 void WebDAVDownloadFileJob::start()
 {
     Q_D(WebDAVDownloadFileJob);
-    d->state = JobState::Running;
+    setState(JobState::Running);
 
     // Check for missing parameters:
     d->checkParameters();
@@ -65,6 +66,8 @@ void WebDAVDownloadFileJob::start()
     // Turn server side compression off. This is required because some servers tend to modify
     // etags. In that case, we get different etags via the list method and after downloading.
     req.setRawHeader("Accept-Encoding", "identity");
+    // Make sure no data of a previous attempt is written any longer before reusing the device:
+    d->cancelDownload();
     if (d->downloadDevice) {
         if (d->downloadDevice != d->output) {
             delete d->downloadDevice;
@@ -78,16 +81,21 @@ void WebDAVDownloadFileJob::start()
         return;
     }
 
-    auto downloadDevice = d->downloadDevice;
     d->downloadDevice->seek(0);
+    d->expectChecksum(QString(), QString());
     req.setHeader(QNetworkRequest::ContentTypeHeader, d_ptr2->OctetStreamEncoding);
     auto reply = networkAccessManager()->get(req);
     if (reply) {
         reply->setParent(this);
-        connect(reply, &QNetworkReply::readyRead, this, [=]() {
-            if (downloadDevice) {
-                downloadDevice->write(reply->readAll());
-            }
+        d->trackReply(reply);
+        d->startDownload(reply, d->downloadDevice);
+        connect(reply, &QNetworkReply::metaDataChanged, this, [=]() {
+            // NextCloud and ownCloud report checksums stored for a file via the OC-Checksum
+            // header. Verify the data against them while downloading:
+            auto checksums =
+                    AbstractWebDAVJobPrivate::parseChecksums(reply->rawHeader("OC-Checksum"));
+            auto algorithm = ContentHasher::preferredAlgorithm(checksums.keys());
+            d->expectChecksum(algorithm, checksums.value(algorithm));
         });
         connect(reply, &QNetworkReply::finished, [=]() { d->handleRequestFinished(); });
         d_ptr2->reply = reply;
@@ -102,7 +110,9 @@ void WebDAVDownloadFileJob::start()
  */
 void WebDAVDownloadFileJob::stop()
 {
+    Q_D(WebDAVDownloadFileJob);
     if (state() == JobState::Running) {
+        d->cancelDownload();
         auto reply = d_ptr2->reply;
         if (reply) {
             reply->abort();
@@ -61,7 +61,10 @@ void WebDAVDownloadFileJobPrivate::handleRequestFinished()
                                &WebDAVDownloadFileJob::start);
             return;
         }
-        if (reply->error() != QNetworkReply::NoError) {
+        if (!checkWriteSucceeded()) {
+            // The download has been aborted because writing the received data failed:
+            q->finishLater();
+        } else if (reply->error() != QNetworkReply::NoError) {
             q->setError(q->fromNetworkError(*reply), reply->errorString());
             q->finishLater();
         } else if (q->d_ptr2->shouldFollowUnhandledRedirect(reply)) {
@@ -71,9 +74,6 @@ void WebDAVDownloadFileJobPrivate::handleRequestFinished()
         } else {
             auto code = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
             if (code == q->d_ptr2->HTTPOkay) {
-                if (downloadDevice) {
-                    downloadDevice->write(reply->readAll());
-                }
                 auto etag = reply->header(QNetworkRequest::ETagHeader);
                 FileInfo fileInfo;
                 fileInfo.setIsFile();
@@ -106,12 +106,18 @@ void WebDAVDownloadFileJobPrivate::handleRequestFinished()
 
                     fileInfo.setSyncAttribute(etagString);
                 }
-                q->setFileInfo(fileInfo);
+                finishDownload(reply, [=]() {
+                    auto info = fileInfo;
+                    if (checkWriteSucceeded() && verifyChecksum(info)) {
+                        q->setFileInfo(info);
+                    }
+                    q->finishLater();
+                });
             } else {
                 q->setError(JobError::InvalidResponse,
                             QString("Received invalid response from server: %1").arg(code));
+                q->finishLater();
             }
-            q->finishLater();
         }
     }
 }
@@ -58,7 +58,7 @@ WebDAVGetFileInfoJob::WebDAVGetFileInfoJob(WebDAVGetFileInfoJobPrivate* d, QObje
 void WebDAVGetFileInfoJob::start()
 {
     Q_D(WebDAVGetFileInfoJob);
-    d->state = JobState::Running;
+    setState(JobState::Running);
 
     // Check for missing parameters:
     d->checkParameters();
@@ -76,13 +76,13 @@ void WebDAVGetFileInfoJob::start()
     req.setAttribute(QNetworkRequest::RedirectPolicyAttribute,
                      QNetworkRequest::ManualRedirectPolicy); // WA for QTBUG-92909, handle redirects
                                                              // manually in client code
-    req.setHeader(QNetworkRequest::ContentLengthHeader,
-                  AbstractWebDAVJobPrivate::PropFindRequestData.size());
+    auto requestData = d_ptr2->propFindRequestData();
+    req.setHeader(QNetworkRequest::ContentLengthHeader, requestData.size());
     req.setHeader(QNetworkRequest::ContentTypeHeader, d_ptr2->DefaultEncoding);
-    auto reply = networkAccessManager()->sendCustomRequest(
-            req, d_ptr2->PROPFIND, AbstractWebDAVJobPrivate::PropFindRequestData);
+    auto reply = networkAccessManager()->sendCustomRequest(req, d_ptr2->PROPFIND, requestData);
     if (reply) {
         reply->setParent(this);
+        d->trackReply(reply);
         connect(reply, &QNetworkReply::finished, [=]() { d->handleRequestFinished(); });
         d_ptr2->reply = reply;
     } else {
@@ -26,9 +26,12 @@
 #include "SynqClient/webdavcreatedirectoryjob.h"
 #include "SynqClient/webdavdeletejob.h"
 #include "SynqClient/webdavdownloadfilejob.h"
+#include "SynqClient/webdavuploadfilebatchjob.h"
 #include "SynqClient/webdavuploadfilejob.h"
 #include "SynqClient/webdavgetfileinfojob.h"
 #include "SynqClient/webdavlistfilesjob.h"
+#include "SynqClient/webdavmovejob.h"
+#include "SynqClient/webdavcopyjob.h"
 
 namespace SynqClient {
 
@@ -53,6 +56,9 @@ WebDAVJobFactory::WebDAVJobFactory(QObject* parent)
 
     // Detect changes by checking sync attributes of folders:
     setRemoteChangeDetectionMode(RemoteChangeDetectionMode::FoldersWithSyncAttributes);
+
+    // Bulk uploads are only worth it for small files (and the server processes them in memory):
+    setMaxBatchFileSize(1024 * 1024);
 }
 
 /**
@@ -125,11 +131,19 @@ WebDAVServerType WebDAVJobFactory::serverType() const
 
 /**
  * @brief Set the type of WebDAV server to connect to.
+ *
+ * For NextCloud servers, this enables batch uploads (see WebDAVUploadFileBatchJob).
  */
 void WebDAVJobFactory::setServerType(WebDAVServerType serverType)
 {
     Q_D(WebDAVJobFactory);
     d->serverType = serverType;
+
+    if (serverType == WebDAVServerType::NextCloud) {
+        setMaxBatchSize(JobType::UploadFileBatch, 100);
+    } else {
+        setMaxBatchSize(JobType::UploadFileBatch, 0);
+    }
 }
 
 /**
@@ -177,6 +191,51 @@ void WebDAVJobFactory::setTransferTimeout(int transferTimeout)
     d->transferTimeout = transferTimeout;
 }
 
+/**
+ * @brief Use sync-collection reports to detect remote changes.
+ *
+ * If this property is true, the factory reports RemoteChangeDetectionMode::SyncCollection as
+ * remote change detection mode. In this case, a synchronization uses sync-collection reports (see
+ * RFC 6578) to only fetch the changes since the previous run instead of walking all folders whose
+ * ETag changed. This requires the server to support such reports.
+ *
+ * The property is false by default. Use testServer() to find out if the server supports
+ * sync-collection reports (see syncCollectionSupported()) and enable the mode if it does.
+ */
+bool WebDAVJobFactory::syncCollectionEnabled() const
+{
+    return remoteChangeDetectionMode() == RemoteChangeDetectionMode::SyncCollection;
+}
+
+/**
+ * @brief Set if sync-collection reports shall be used to detect remote changes.
+ *
+ * This is a shortcut for setting the remoteChangeDetectionMode() to either
+ * RemoteChangeDetectionMode::SyncCollection or
+ * RemoteChangeDetectionMode::FoldersWithSyncAttributes.
+ */
+void WebDAVJobFactory::setSyncCollectionEnabled(bool syncCollectionEnabled)
+{
+    if (syncCollectionEnabled) {
+        setRemoteChangeDetectionMode(RemoteChangeDetectionMode::SyncCollection);
+    } else {
+        setRemoteChangeDetectionMode(RemoteChangeDetectionMode::FoldersWithSyncAttributes);
+    }
+}
+
+/**
+ * @brief Indicates if the server supports sync-collection reports.
+ *
+ * This is set by testServer(). It is false until a test has finished successfully.
+ *
+ * @sa setSyncCollectionEnabled()
+ */
+bool WebDAVJobFactory::syncCollectionSupported() const
+{
+    Q_D(const WebDAVJobFactory);
+    return d->syncCollectionSupported;
+}
+
 /**
  * @brief Test the server.
  *
@@ -187,7 +246,12 @@ void WebDAVJobFactory::setTransferTimeout(int transferTimeout)
  * functions that are needed to run a successful sync.
  *
  * Once the tests finish, the serverTestFinished() signal is emitted. The results of the tests are
- * stored in the workarounds() property and can be saved and later on restored.
+ * stored in the workarounds() property and can be saved and later on restored. In addition,
+ * syncCollectionSupported() tells if the server supports sync-collection reports. The test does not
+ * change the remote change detection mode - use setSyncCollectionEnabled() to opt in.
+ *
+ * The temporary files and folders created on the server are removed again, no matter if the test
+ * succeeds or fails.
  *
  * The optional @p path argument is the path on the server, where (temporary) files and folders
  * will be created in. Note that the remote path must exist, otherwise, the tests will fail.
@@ -203,6 +267,7 @@ void WebDAVJobFactory::testServer(const QString& path)
     }
 
     // Start a new test sequence:
+    d->syncCollectionSupported = false;
     auto testJob = new CompositeJob(this);
     testJob->setMaxJobs(1);
     testJob->setErrorMode(CompositeJobErrorMode::StopOnFirstError);
@@ -283,13 +348,6 @@ void WebDAVJobFactory::testServer(const QString& path)
         testJob->addJob(job);
     }
 
-    {
-        // Delete the remote folder
-        auto job = deleteResource(testJob);
-        job->setPath(rootPath);
-        testJob->addJob(job);
-    }
-
     d->currentServerTestData.clear();
     d->serverTestJob = testJob;
 
@@ -335,8 +393,21 @@ void WebDAVJobFactory::testServer(const QString& path)
             }
 
             setWorkarounds(workarounds);
+
+            // Check if the server supports sync-collection reports. This is optional, i.e. a
+            // failure of the check does not fail the test. Afterwards, clean up:
+            auto syncCollectionJob = listFiles(this);
+            syncCollectionJob->setPath(rootPath);
+            syncCollectionJob->setRecursive(true);
+            connect(syncCollectionJob, &ListFilesJob::finished, this, [=]() {
+                syncCollectionJob->deleteLater();
+                d->syncCollectionSupported = syncCollectionJob->error() == JobError::NoError;
+                d->finishServerTest(rootPath, true);
+            });
+            syncCollectionJob->start();
+            return;
         }
-        emit serverTestFinished(testJob->error() == JobError::NoError);
+        d->finishServerTest(rootPath, false);
     });
     connect(testJob, &CompositeJob::finished, testJob, &QObject::deleteLater);
 
@@ -370,6 +441,20 @@ AbstractJob* WebDAVJobFactory::createJob(JobType type, QObject* parent)
         return d->createJob<WebDAVGetFileInfoJob>(parent);
     case JobType::ListFiles:
         return d->createJob<WebDAVListFilesJob>(parent);
+    case JobType::MoveResource:
+        return d->createJob<WebDAVMoveJob>(parent);
+    case JobType::CopyResource:
+        return d->createJob<WebDAVCopyJob>(parent);
+    case JobType::UploadFileBatch: {
+        auto job = d->createJob<WebDAVUploadFileBatchJob>(parent);
+        connect(job, &AbstractJob::finished, this, [=]() {
+            if (!job->bulkUploadSupported()) {
+                // The server does not support bulk uploads - stop creating batch jobs:
+                setMaxBatchSize(JobType::UploadFileBatch, 0);
+            }
+        });
+        return job;
+    }
     default:
         return nullptr;
     }
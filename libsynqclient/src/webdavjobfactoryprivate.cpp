@@ -22,6 +22,7 @@
 #include <QNetworkReply>
 
 #include "abstractwebdavjobprivate.h"
+#include "SynqClient/DeleteJob"
 
 namespace SynqClient {
 
@@ -34,8 +35,28 @@ WebDAVJobFactoryPrivate::WebDAVJobFactoryPrivate(WebDAVJobFactory* q)
       workarounds(WebDAVWorkaround::NoWorkarounds),
       transferTimeout(QNetworkRequest::DefaultTransferTimeoutConstant),
       currentServerTestData(),
+      syncCollectionSupported(false),
       serverTestJob()
 {
 }
 
+/**
+ * @brief Remove the temporary folder used by a server test and report the result.
+ *
+ * The folder at @p rootPath is deleted no matter if the test was a @p success or not. Afterwards,
+ * WebDAVJobFactory::serverTestFinished() is emitted. The test only succeeds if the cleanup
+ * succeeded as well.
+ */
+void WebDAVJobFactoryPrivate::finishServerTest(const QString& rootPath, bool success)
+{
+    Q_Q(WebDAVJobFactory);
+    auto deleteJob = q->deleteResource(q);
+    deleteJob->setPath(rootPath);
+    QObject::connect(deleteJob, &DeleteJob::finished, q, [=]() {
+        deleteJob->deleteLater();
+        emit q->serverTestFinished(success && deleteJob->error() == JobError::NoError);
+    });
+    deleteJob->start();
+}
+
 } // namespace SynqClient
@@ -43,9 +43,12 @@ public:
     WebDAVWorkarounds workarounds;
     int transferTimeout;
     QVariantMap currentServerTestData;
+    bool syncCollectionSupported;
 
     QPointer<CompositeJob> serverTestJob;
 
+    void finishServerTest(const QString& rootPath, bool success);
+
     template<typename T>
     T* createJob(QObject* parent)
     {
@@ -56,6 +59,7 @@ public:
         result->setServerType(serverType);
         result->setWorkarounds(workarounds);
         result->setTransferTimeout(transferTimeout);
+        result->setHttp2Allowed(http2Allowed);
         return result;
     }
 };
@@ -27,6 +27,16 @@ namespace SynqClient {
 /**
  * @class WebDAVListFilesJob
  * @brief Implementation of the ListFilesJob for WebDAV.
+ *
+ * By default, the job lists the direct children of a folder using a PROPFIND request. If the job
+ * is set to be recursive(), it instead uses a sync-collection REPORT (see RFC 6578) to retrieve
+ * all members of the folder. In this mode, the job supports cursors: The sync token returned by
+ * the server is available as cursor() after the job finished. Setting it on a later job causes
+ * only the changes since then (including deletions) to be listed. If the server no longer accepts
+ * the token, the job falls back to a full listing.
+ *
+ * @note Recursive listing requires the server to support sync-collection reports. This is the case
+ * e.g. for NextCloud and ownCloud.
  */
 
 /**
@@ -48,7 +58,7 @@ WebDAVListFilesJob::~WebDAVListFilesJob() {}
 void WebDAVListFilesJob::start()
 {
     Q_D(WebDAVListFilesJob);
-    d->state = JobState::Running;
+    setState(JobState::Running);
 
     // Check for missing parameters:
     d->checkParameters();
@@ -57,6 +67,14 @@ void WebDAVListFilesJob::start()
         return;
     }
 
+    if (d->recursive) {
+        d->syncToken = d->cursor;
+        d->syncCollectionEntries.clear();
+        d->syncCollectionIncremental = !d->cursor.isEmpty();
+        d->startSyncCollection();
+        return;
+    }
+
     auto url = d_ptr2->urlFromPath(d->path);
     if (!d_ptr2->nextUrl.isValid()) {
         // This is the initial try to create the directory (after redirection).
@@ -81,13 +99,13 @@ void WebDAVListFilesJob::start()
     req.setAttribute(QNetworkRequest::RedirectPolicyAttribute,
                      QNetworkRequest::ManualRedirectPolicy); // WA for QTBUG-92909, handle redirects
                                                              // manually in client code
-    req.setHeader(QNetworkRequest::ContentLengthHeader,
-                  AbstractWebDAVJobPrivate::PropFindRequestData.size());
+    auto requestData = d_ptr2->propFindRequestData();
+    req.setHeader(QNetworkRequest::ContentLengthHeader, requestData.size());
     req.setHeader(QNetworkRequest::ContentTypeHeader, d_ptr2->DefaultEncoding);
-    auto reply = networkAccessManager()->sendCustomRequest(
-            req, d_ptr2->PROPFIND, AbstractWebDAVJobPrivate::PropFindRequestData);
+    auto reply = networkAccessManager()->sendCustomRequest(req, d_ptr2->PROPFIND, requestData);
     if (reply) {
         reply->setParent(this);
+        d->trackReply(reply);
         connect(reply, &QNetworkReply::finished, [=]() { d->handleRequestFinished(); });
         d_ptr2->reply = reply;
     } else {
@@ -19,15 +19,22 @@
 
 #include "webdavlistfilesjobprivate.h"
 
+#include <QSet>
 #include <QTimer>
 #include <QVariant>
+#include <QXmlStreamWriter>
 
 #include "abstractwebdavjobprivate.h"
 
 namespace SynqClient {
 
 WebDAVListFilesJobPrivate::WebDAVListFilesJobPrivate(WebDAVListFilesJob* q)
-    : ListFilesJobPrivate(q), retryWithoutTrailingSlash(false), retryWithDepthZero(false)
+    : ListFilesJobPrivate(q),
+      retryWithoutTrailingSlash(false),
+      retryWithDepthZero(false),
+      syncToken(),
+      syncCollectionEntries(),
+      syncCollectionIncremental(false)
 {
 }
 
@@ -112,4 +119,133 @@ void WebDAVListFilesJobPrivate::handleRequestFinished()
     }
 }
 
+/**
+ * @brief Send a sync-collection REPORT for the folder to list.
+ *
+ * This is used for recursive listings. If a syncToken is set, the server only reports the members
+ * which changed since the token has been issued.
+ */
+void WebDAVListFilesJobPrivate::startSyncCollection()
+{
+    Q_Q(WebDAVListFilesJob);
+
+    auto url = q->d_ptr2->urlFromPath(path);
+    if (!q->d_ptr2->nextUrl.isValid()) {
+        auto urlPath = url.path();
+        if (!urlPath.endsWith("/")) {
+            urlPath.append("/");
+            url.setPath(urlPath);
+        }
+    }
+
+    QByteArray data;
+    {
+        QXmlStreamWriter writer(&data);
+        writer.writeStartDocument();
+        writer.writeNamespace("DAV:", "d");
+        writer.writeNamespace(AbstractWebDAVJobPrivate::OwnCloudNamespace, "oc");
+        writer.writeStartElement("DAV:", "sync-collection");
+        writer.writeTextElement("DAV:", "sync-token", syncToken);
+        writer.writeTextElement("DAV:", "sync-level", "infinite");
+        q->d_ptr2->writeRequestedProperties(writer);
+        writer.writeEndElement();
+        writer.writeEndDocument();
+    }
+
+    QNetworkRequest req;
+    q->d_ptr2->prepareNetworkRequest(req, q);
+    q->d_ptr2->disableCaching(req);
+    req.setUrl(url);
+    req.setRawHeader("Depth", "0");
+    req.setAttribute(QNetworkRequest::RedirectPolicyAttribute,
+                     QNetworkRequest::ManualRedirectPolicy); // WA for QTBUG-92909, handle redirects
+                                                             // manually in client code
+    req.setHeader(QNetworkRequest::ContentLengthHeader, data.size());
+    req.setHeader(QNetworkRequest::ContentTypeHeader, q->d_ptr2->DefaultEncoding);
+    auto reply = q->networkAccessManager()->sendCustomRequest(req, q->d_ptr2->REPORT, data);
+    if (reply) {
+        reply->setParent(q);
+        trackReply(reply);
+        QObject::connect(reply, &QNetworkReply::finished,
+                         [=]() { handleSyncCollectionFinished(); });
+        q->d_ptr2->reply = reply;
+    } else {
+        q->setError(JobError::InvalidResponse, "Received null network reply");
+        q->finishLater();
+    }
+}
+
+void WebDAVListFilesJobPrivate::handleSyncCollectionFinished()
+{
+    Q_Q(WebDAVListFilesJob);
+    auto reply = q->d_ptr2->reply;
+    q->d_ptr2->reply = nullptr;
+    if (!reply) {
+        return;
+    }
+    reply->deleteLater();
+    if (q->d_ptr2->checkIfRequestShallBeRetried(reply)) {
+        q->d_ptr2->numRetries += 1;
+        QTimer::singleShot(q->d_ptr2->getRetryDelayInMilliseconds(reply), q,
+                           [=]() { startSyncCollection(); });
+        return;
+    }
+    auto code = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    if (reply->error() != QNetworkReply::NoError) {
+        if (!syncToken.isEmpty()
+            && (code == q->d_ptr2->HTTPForbidden || code == q->d_ptr2->HTTPConflict)) {
+            // The server no longer accepts the sync token (valid-sync-token precondition, see
+            // RFC 6578 section 3.2). Start over with a full listing:
+            syncToken.clear();
+            syncCollectionEntries.clear();
+            syncCollectionIncremental = false;
+            q->d_ptr2->nextUrl.clear();
+            startSyncCollection();
+            return;
+        }
+        q->setError(q->fromNetworkError(*reply), reply->errorString());
+        q->finishLater();
+    } else if (q->d_ptr2->shouldFollowUnhandledRedirect(reply)) {
+        // Encountered redirect not handled by Qt, follow:
+        startSyncCollection();
+    } else if (code == q->d_ptr2->WebDAVMultiStatus) {
+        bool ok;
+        bool truncated;
+        QString newSyncToken;
+        auto entries = q->d_ptr2->parseSyncCollection(reply->url(), reply->readAll(),
+                                                      newSyncToken, truncated, ok);
+        if (!ok || newSyncToken.isEmpty()) {
+            q->setError(JobError::InvalidResponse,
+                        "sync-collection REPORT response from server is not valid");
+            q->finishLater();
+            return;
+        }
+        syncCollectionEntries << entries;
+        if (truncated && newSyncToken != syncToken) {
+            // The server did not report all changes at once - continue with the new token:
+            syncToken = newSyncToken;
+            startSyncCollection();
+            return;
+        }
+        // Only report the latest state of each entry:
+        QSet<QString> seenPaths;
+        FileInfos result;
+        for (auto it = syncCollectionEntries.crbegin(); it != syncCollectionEntries.crend();
+             ++it) {
+            if (!seenPaths.contains(it->path())) {
+                seenPaths.insert(it->path());
+                result.prepend(*it);
+            }
+        }
+        q->setEntries(result);
+        q->setIncremental(syncCollectionIncremental);
+        q->setCursor(newSyncToken);
+        q->finishLater();
+    } else {
+        q->setError(JobError::InvalidResponse,
+                    QString("Received invalid response from server: %1").arg(code));
+        q->finishLater();
+    }
+}
+
 } // namespace SynqClient
@@ -34,9 +34,14 @@ public:
 
     void checkParameters();
     void handleRequestFinished();
+    void startSyncCollection();
+    void handleSyncCollectionFinished();
 
     bool retryWithoutTrailingSlash;
     bool retryWithDepthZero;
+    QString syncToken;
+    FileInfos syncCollectionEntries;
+    bool syncCollectionIncremental;
 };
 
 } // namespace SynqClient
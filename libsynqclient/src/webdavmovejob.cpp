@@ -0,0 +1,74 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../inc/SynqClient/webdavmovejob.h"
+
+#include "abstractwebdavjobprivate.h"
+#include "webdavmovejobprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @class WebDAVMoveJob
+ * @brief Implementation of the MoveJob for WebDAV.
+ *
+ * This job uses the WebDAV `MOVE` method. The target is passed via the `Destination` header and
+ * the `Overwrite` header is set according to the overwrite() property.
+ */
+
+/**
+ * @brief Constructor.
+ */
+WebDAVMoveJob::WebDAVMoveJob(QObject* parent)
+    : MoveJob(new WebDAVMoveJobPrivate(this), parent), AbstractWebDAVJob()
+{
+}
+
+/**
+ * @brief Destructor.
+ */
+WebDAVMoveJob::~WebDAVMoveJob() {}
+
+/**
+ * @brief Implementation of AbstractJob::start().
+ */
+void WebDAVMoveJob::start()
+{
+    Q_D(WebDAVMoveJob);
+    d->request.start(d_ptr2.data());
+}
+
+/**
+ * @brief Implementation of AbstractJob::stop().
+ */
+void WebDAVMoveJob::stop()
+{
+    Q_D(WebDAVMoveJob);
+    d->request.stop(d_ptr2.data());
+}
+
+/**
+ * @brief Constructor.
+ */
+WebDAVMoveJob::WebDAVMoveJob(WebDAVMoveJobPrivate* d, QObject* parent)
+    : MoveJob(d, parent), AbstractWebDAVJob()
+{
+}
+
+} // namespace SynqClient
@@ -0,0 +1,371 @@
+/*
+ * Copyright 2026 Martin Hoeher <martin@rpdev.net>
+ *
+ * This file is part of SynqClient.
+ *
+ * SynqClient is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * SynqClient is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SynqClient.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SynqClient/webdavuploadfilebatchjob.h"
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QHttpMultiPart>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QTimer>
+
+#include "abstractwebdavjobprivate.h"
+#include "contenthasher.h"
+#include "webdavuploadfilebatchjobprivate.h"
+
+namespace SynqClient {
+
+/**
+ * @class WebDAVUploadFileBatchJob
+ * @brief Implementation of the UploadFileBatchJob for WebDAV.
+ *
+ * When talking to a NextCloud server, this job uses the bulk upload endpoint (available since
+ * NextCloud 23) to upload new files within a single multipart request. This greatly reduces the
+ * per file overhead when uploading lots of small files.
+ *
+ * The bulk upload endpoint does not support conditional uploads. Hence, files for which a sync
+ * attribute is set are uploaded one by one, using the `If-Match` header to detect lost updates.
+ * The same fallback is used for other servers and if the server turns out to not support bulk
+ * uploads. In the latter case, bulkUploadSupported() returns false once the job finished.
+ *
+ * The MD5 sums required by the bulk upload endpoint are calculated in a worker thread before the
+ * request is sent. Individual uploads run one after the other unless
+ * UploadFileBatchJob::maxParallelUploads() allows to run more of them in parallel.
+ */
+
+/**
+ * @brief Constructor.
+ */
+WebDAVUploadFileBatchJob::WebDAVUploadFileBatchJob(QObject* parent)
+    : UploadFileBatchJob(new WebDAVUploadFileBatchJobPrivate(this), parent), AbstractWebDAVJob()
+{
+}
+
+/**
+ * @brief Destructor.
+ */
+WebDAVUploadFileBatchJob::~WebDAVUploadFileBatchJob() {}
+
+/**
+ * @brief Indicates if the server supports bulk uploads.
+ *
+ * This is true by default. If the job detects that the server does not provide the bulk upload
+ * endpoint, this is set to false.
+ */
+bool WebDAVUploadFileBatchJob::bulkUploadSupported() const
+{
+    Q_D(const WebDAVUploadFileBatchJob);
+    return d->bulkUploadSupported;
+}
+
+/**
+ * @brief Implementation of AbstractJob::start().
+ */
+void WebDAVUploadFileBatchJob::start()
+{
+    Q_D(WebDAVUploadFileBatchJob);
+    setState(JobState::Running);
+    clearEntryResults();
+
+    // Check for missing parameters:
+    d->checkParameters();
+    if (error() != JobError::NoError) {
+        finishLater();
+        return;
+    }
+
+    QStringList bulkUploads;
+    d->individualUploads.clear();
+    for (const auto& remoteFilename : qAsConst(d->remoteFilenames)) {
+        auto syncAttr = d->syncAttributes.value(remoteFilename);
+        if (d->bulkUploadSupported && serverType() == WebDAVServerType::NextCloud
+            && (!syncAttr.isValid() || syncAttr.toString().isEmpty())) {
+            bulkUploads << remoteFilename;
+        } else {
+            d->individualUploads << remoteFilename;
+        }
+    }
+
+    if (bulkUploads.isEmpty()) {
+        runIndividualUploads();
+    } else {
+        hashBulkUploads(bulkUploads);
+    }
+}
+
+/**
+ * @brief Implementation of AbstractJob::stop().
+ */
+void WebDAVUploadFileBatchJob::stop()
+{
+    Q_D(WebDAVUploadFileBatchJob);
+    if (state() == JobState::Running) {
+        setError(JobError::Stopped, "The job has been stopped");
+        auto reply = d_ptr2->reply;
+        if (reply) {
+            reply->abort();
+            delete reply;
+            d_ptr2->reply = nullptr;
+        }
+        d->individualUploads.clear();
+        for (const auto& job : qAsConst(d->uploadJobs)) {
+            if (job) {
+                job->stop();
+            }
+        }
+        finishLater();
+    }
+}
+
+/**
+ * @brief Constructor.
+ */
+WebDAVUploadFileBatchJob::WebDAVUploadFileBatchJob(WebDAVUploadFileBatchJobPrivate* d,
+                                                   QObject* parent)
+    : UploadFileBatchJob(d, parent), AbstractWebDAVJob()
+{
+}
+
+/**
+ * @brief Calculate the MD5 sums of the given files and upload them afterwards in bulk.
+ *
+ * Hashing happens in a worker thread, so reading the files does not block the event loop.
+ */
+void WebDAVUploadFileBatchJob::hashBulkUploads(const QStringList& remoteFilenames)
+{
+    Q_D(WebDAVUploadFileBatchJob);
+    QStringList localFilenames;
+    for (const auto& remoteFilename : remoteFilenames) {
+        localFilenames << d->localFilenames.value(remoteFilename);
+    }
+    d->hasher.reset(new AsyncFileHasher(ContentHasher::MD5));
+    connect(d->hasher.data(), &AsyncFileHasher::finished, this, [=]() {
+        if (error() == JobError::NoError) {
+            runBulkUpload(remoteFilenames);
+        }
+    });
+    d->hasher->start(localFilenames);
+}
+
+/**
+ * @brief Upload the given files using the NextCloud bulk upload endpoint.
+ *
+ * The MD5 sums of the files must have been calculated before using hashBulkUploads().
+ */
+void WebDAVUploadFileBatchJob::runBulkUpload(const QStringList& remoteFilenames)
+{
+    Q_D(WebDAVUploadFileBatchJob);
+
+    auto multiPart = new QHttpMultiPart(QHttpMultiPart::RelatedType);
+    QStringList filesInRequest;
+    for (const auto& remoteFilename : remoteFilenames) {
+        auto file = new QFile(d->localFilenames.value(remoteFilename), multiPart);
+        if (!file->open(QIODevice::ReadOnly)) {
+            setEntryError(remoteFilename, JobError::InvalidParameter,
+                          QString("Failed to open %1 for reading: %2")
+                                  .arg(file->fileName(), file->errorString()));
+            continue;
+        }
+        auto md5 = d->hasher->result(file->fileName());
+        if (md5.isEmpty()) {
+            setEntryError(remoteFilename, JobError::InvalidParameter,
+                          QString("Failed to read %1").arg(file->fileName()));
+            continue;
+        }
+
+        // The path is relative to the user's home, which is what the WebDAV URL points to:
+        auto path = QDir::cleanPath("/" + remoteFilename);
+        QHttpPart part;
+        part.setHeader(QNetworkRequest::ContentLengthHeader, file->size());
+        part.setRawHeader("X-File-Path", path.toUtf8());
+        part.setRawHeader("X-File-MD5", md5.toLatin1());
+        part.setRawHeader(
+                "X-File-Mtime",
+                QByteArray::number(QFileInfo(*file).lastModified().toSecsSinceEpoch()));
+        part.setBodyDevice(file);
+        multiPart->append(part);
+        filesInRequest << remoteFilename;
+    }
+
+    if (filesInRequest.isEmpty()) {
+        delete multiPart;
+        runIndividualUploads();
+        return;
+    }
+
+    auto url = d_ptr2->url;
+    url.setPath(QDir::cleanPath(url.path() + "/remote.php/dav/bulk"));
+    QNetworkRequest req;
+    d_ptr2->prepareNetworkRequest(req, this);
+    d_ptr2->disableCaching(req);
+    req.setUrl(url);
+    auto reply = networkAccessManager()->post(req, multiPart);
+    if (reply) {
+        multiPart->setParent(reply);
+        reply->setParent(this);
+        d->trackReply(reply);
+        connect(reply, &QNetworkReply::finished, this,
+                [=]() { handleBulkUploadFinished(reply, filesInRequest); });
+        d_ptr2->reply = reply;
+    } else {
+        delete multiPart;
+        setError(JobError::InvalidResponse, "Received null network reply");
+        finishLater();
+    }
+}
+
+/**
+ * @brief Handle the result of a bulk upload request.
+ */
+void WebDAVUploadFileBatchJob::handleBulkUploadFinished(QNetworkReply* reply,
+                                                        const QStringList& remoteFilenames)
+{
+    Q_D(WebDAVUploadFileBatchJob);
+    reply->deleteLater();
+    d_ptr2->reply = nullptr;
+    if (error() != JobError::NoError) {
+        // The job has been stopped meanwhile.
+        return;
+    }
+    if (d_ptr2->checkIfRequestShallBeRetried(reply)) {
+        d_ptr2->numRetries += 1;
+        QTimer::singleShot(d_ptr2->getRetryDelayInMilliseconds(reply), this, [=]() {
+            if (error() == JobError::NoError) {
+                runBulkUpload(remoteFilenames);
+            }
+        });
+        return;
+    }
+    auto code = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    if (code == 404 || code == AbstractWebDAVJobPrivate::HTTPNotAllowed || code == 501) {
+        // The server does not provide the bulk upload endpoint - upload one by one:
+        d->bulkUploadSupported = false;
+        d->individualUploads = remoteFilenames + d->individualUploads;
+        runIndividualUploads();
+        return;
+    }
+    if (reply->error() != QNetworkReply::NoError) {
+        setError(fromNetworkError(*reply), reply->errorString());
+        finishLater();
+        return;
+    }
+
+    // The server returns an object which holds the result of each file, using the file path as
+    // key:
+    // {"/path/to/file": {"error": false, "etag": "\"...\"", "fileid": 123}, ...}
+    QJsonParseError parseError;
+    auto doc = QJsonDocument::fromJson(reply->readAll(), &parseError);
+    if (parseError.error != QJsonParseError::NoError) {
+        setError(JobError::InvalidResponse,
+                 QString("Failed to parse JSON response: %1").arg(parseError.errorString()));
+        finishLater();
+        return;
+    }
+    auto results = doc.object();
+    for (const auto& remoteFilename : remoteFilenames) {
+        auto path = QDir::cleanPath("/" + remoteFilename);
+        if (!results.contains(path)) {
+            setEntryError(remoteFilename, JobError::InvalidResponse,
+                          QString("Missing result for file %1").arg(remoteFilename));
+            continue;
+        }
+        auto result = results.value(path).toObject();
+        if (result.value("error").toBool()) {
+            setEntryError(remoteFilename, JobError::NetworkRequestFailed,
+                          QString("Failed to upload %1: %2")
+                                  .arg(remoteFilename, result.value("message").toString()));
+            continue;
+        }
+        auto etag = result.value("etag").toString();
+        if (!etag.isEmpty() && !etag.startsWith("\"")) {
+            // Use the same format as in ETag headers and PROPFIND responses:
+            etag = "\"" + etag + "\"";
+        }
+        FileInfo fileInfo;
+        fileInfo.setIsFile();
+        fileInfo.setSyncAttribute(etag);
+        setEntryFileInfo(remoteFilename, fileInfo);
+    }
+    runIndividualUploads();
+}
+
+/**
+ * @brief Upload all files which cannot be part of a bulk upload one by one.
+ */
+void WebDAVUploadFileBatchJob::runIndividualUploads()
+{
+    Q_D(WebDAVUploadFileBatchJob);
+    d->uploadJobs.clear();
+    d->runningUploads = 0;
+    if (d->individualUploads.isEmpty()) {
+        finishLater();
+        return;
+    }
+    startNextUploads();
+}
+
+/**
+ * @brief Start uploading pending files until maxParallelUploads() uploads are running.
+ */
+void WebDAVUploadFileBatchJob::startNextUploads()
+{
+    Q_D(WebDAVUploadFileBatchJob);
+    while (!d->individualUploads.isEmpty() && d->runningUploads < maxParallelUploads()) {
+        auto remoteFilename = d->individualUploads.takeFirst();
+        auto job = new WebDAVUploadFileJob(this);
+        job->setNetworkAccessManager(networkAccessManager());
+        job->setUrl(url());
+        job->setUserAgent(userAgent());
+        job->setServerType(serverType());
+        job->setWorkarounds(workarounds());
+        job->setTransferTimeout(transferTimeout());
+        job->setHttp2Allowed(http2Allowed());
+        job->setLocalFilename(d->localFilenames.value(remoteFilename));
+        job->setRemoteFilename(remoteFilename);
+        job->setSyncAttribute(d->syncAttributes.value(remoteFilename));
+        connect(job, &AbstractJob::finished, this, [=]() {
+            job->deleteLater();
+            if (error() != JobError::NoError) {
+                // The job has been stopped meanwhile.
+                return;
+            }
+            if (job->error() == JobError::NoError) {
+                setEntryFileInfo(remoteFilename, job->fileInfo());
+            } else {
+                setEntryError(remoteFilename, job->error(), job->errorString());
+            }
+            d->uploadJobs.removeAll(job);
+            d->runningUploads -= 1;
+            if (d->runningUploads == 0 && d->individualUploads.isEmpty()) {
+                finishLater();
+            } else {
+                startNextUploads();
+            }
+        });
+        d->uploadJobs << job;
+        d->runningUploads += 1;
+        job->start();
+    }
+}
+
+} // namespace SynqClient
@@ -19,9 +19,11 @@
 
 #include "SynqClient/webdavuploadfilejob.h"
 
+#include <QCryptographicHash>
 #include <QNetworkRequest>
 
 #include "abstractwebdavjobprivate.h"
+#include "contenthasher.h"
 #include "webdavuploadfilejobprivate.h"
 
 namespace SynqClient {
@@ -50,7 +52,7 @@ WebDAVUploadFileJob::~WebDAVUploadFileJob() {}
 void WebDAVUploadFileJob::start()
 {
     Q_D(WebDAVUploadFileJob);
-    d->state = JobState::Running;
+    setState(JobState::Running);
 
     // Check for missing parameters:
     d->checkParameters();
@@ -79,9 +81,18 @@ void WebDAVUploadFileJob::start()
     if (etag.isValid() && !etag.toString().isEmpty()) {
         req.setHeader(QNetworkRequest::IfMatchHeader, etag.toString());
     }
-    auto reply = networkAccessManager()->put(req, uploadDevice.data());
+    if (d->sourceType == UploadFileJobPrivate::UploadSource::Data
+        && serverType() != WebDAVServerType::Generic) {
+        // If the data is in memory anyways, let the server store (and - if supported - verify)
+        // its checksum:
+        auto checksum = QCryptographicHash::hash(d->data, QCryptographicHash::Sha1).toHex();
+        req.setRawHeader("OC-Checksum", "SHA1:" + checksum);
+    }
+    auto reply = networkAccessManager()->put(
+            req, d->hashUploadDevice(uploadDevice, ContentHasher::SHA1));
     if (reply) {
         reply->setParent(this);
+        d->trackReply(reply);
         connect(reply, &QNetworkReply::finished, [=]() { d->handleRequestFinished(); });
         d_ptr2->reply = reply;
     } else {
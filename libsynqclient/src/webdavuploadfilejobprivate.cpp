@@ -86,6 +86,15 @@ void WebDAVUploadFileJobPrivate::handleRequestFinished()
             } else {
                 qCDebug(log) << "Did not receive an eTag on upload";
             }
+            const auto checksums =
+                    AbstractWebDAVJobPrivate::parseChecksums(reply->rawHeader("OC-Checksum"));
+            for (auto it = checksums.cbegin(); it != checksums.cend(); ++it) {
+                fileInfo.setChecksum(it.key(), it.value());
+            }
+            if (!verifyChecksum(fileInfo)) {
+                q->finishLater();
+                return;
+            }
             q->setFileInfo(fileInfo);
             if (code == q->d_ptr2->HTTPOkay || code == q->d_ptr2->HTTPCreated
                 || code == q->d_ptr2->HTTPNoContent) {
@@ -7,6 +7,13 @@ SUBDIRS += libsynqclient
     tests.depends += libsynqclient
 }
 
+!synqclient_with_no_benchmarks {
+    SUBDIRS += benchmarks microbench
+    benchmarks.depends += libsynqclient
+    microbench.subdir = benchmarks/microbench
+    microbench.depends += libsynqclient
+}
+
 OTHER_FILES += \
     $$files(model/*) \
     .gitlab-ci.yml \
@@ -0,0 +1,2 @@
+TESTNAME = continuoussynchronizer
+include(../test.pri)
@@ -0,0 +1,240 @@
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <QtTest>
+
+// add necessary includes here
+#include "../shared/fakedropboxserver.h"
+#include "../shared/fakewebdavserver.h"
+#include "../shared/utils.h"
+#include "SynqClient/AbstractJobFactory"
+#include "SynqClient/ContinuousSynchronizer"
+#include "SynqClient/DirectorySynchronizer"
+#include "SynqClient/DropboxJobFactory"
+#include "SynqClient/JSONSyncStateDatabase"
+#include "SynqClient/LocalChangeWatcher"
+#include "SynqClient/WebDAVJobFactory"
+
+using SynqClient::AbstractJobFactory;
+using SynqClient::ContinuousSynchronizer;
+using SynqClient::DirectorySynchronizer;
+using SynqClient::DropboxJobFactory;
+using SynqClient::JSONSyncStateDatabase;
+using SynqClient::LocalChangeWatcher;
+using SynqClient::SynchronizerError;
+using SynqClient::WebDAVJobFactory;
+using SynqClient::WebDAVServerType;
+using SynqClient::UnitTest::FakeDropboxServer;
+using SynqClient::UnitTest::FakeWebDAVServer;
+using SynqClient::UnitTest::RedirectingNetworkAccessManager;
+
+class ContinuousSynchronizerTest : public QObject
+{
+    Q_OBJECT
+
+public:
+    ContinuousSynchronizerTest();
+    ~ContinuousSynchronizerTest();
+
+private slots:
+    void initTestCase();
+    void properties();
+    void missingParameters();
+    void continuousSync();
+    void continuousSync_data();
+    void cleanupTestCase();
+
+private:
+    static bool writeFile(const QString& fileName, const QByteArray& data);
+    static QByteArray readFile(const QString& fileName);
+};
+
+ContinuousSynchronizerTest::ContinuousSynchronizerTest() {}
+
+ContinuousSynchronizerTest::~ContinuousSynchronizerTest() {}
+
+void ContinuousSynchronizerTest::initTestCase() {}
+
+void ContinuousSynchronizerTest::properties()
+{
+    ContinuousSynchronizer sync;
+    QVERIFY(!sync.running());
+    QVERIFY(!sync.syncing());
+    QCOMPARE(sync.debounceInterval(), 1000);
+    QVERIFY(sync.pollInterval() > 0);
+    sync.setDebounceInterval(-1);
+    QCOMPARE(sync.debounceInterval(), 0);
+    sync.setPollInterval(0);
+    QCOMPARE(sync.pollInterval(), 0);
+    QCOMPARE(sync.lastError(), SynchronizerError::NoError);
+}
+
+void ContinuousSynchronizerTest::missingParameters()
+{
+    ContinuousSynchronizer sync;
+    QSignalSpy runningSpy(&sync, &ContinuousSynchronizer::runningChanged);
+    sync.start();
+    QVERIFY(!sync.running());
+    QCOMPARE(runningSpy.count(), 0);
+    QCOMPARE(sync.lastError(), SynchronizerError::MissingParameter);
+}
+
+void ContinuousSynchronizerTest::continuousSync()
+{
+    QFETCH(AbstractJobFactory*, jobFactory);
+
+    QTemporaryDir tmpDir1;
+    QTemporaryDir tmpDir2;
+    QTemporaryDir metaTmpDir;
+    auto remotePath = "ContinuousSynchronizerTest-continuousSync-" + QUuid::createUuid().toString();
+
+    LocalChangeWatcher watcher;
+    watcher.setDirectory(tmpDir1.path());
+    watcher.start();
+    QVERIFY(watcher.running());
+
+    JSONSyncStateDatabase db(metaTmpDir.path() + "/sync1.json");
+    ContinuousSynchronizer sync;
+    sync.setJobFactory(jobFactory);
+    sync.setSyncStateDatabase(&db);
+    sync.setLocalDirectoryPath(tmpDir1.path());
+    sync.setRemoteDirectoryPath(remotePath);
+    sync.setLocalChangeWatcher(&watcher);
+    sync.setDebounceInterval(100);
+    sync.setPollInterval(0);
+    QSignalSpy finishedSpy(&sync, &ContinuousSynchronizer::syncFinished);
+    sync.start();
+    QVERIFY(sync.running());
+    QVERIFY(db.isOpen());
+
+    // The initial sync runs right away:
+    QVERIFY(finishedSpy.wait(60000));
+    QCOMPARE(sync.lastError(), SynchronizerError::NoError);
+    QVERIFY(db.isOpen());
+    QVERIFY(!watcher.fullScanRequired());
+
+    // Local changes trigger a new sync cycle:
+    finishedSpy.clear();
+    QVERIFY(writeFile(tmpDir1.path() + "/sub/test.txt", "Hello World"));
+    QVERIFY(finishedSpy.wait(60000));
+    QCOMPARE(sync.lastError(), SynchronizerError::NoError);
+
+    // Check that the change made it to the server:
+    {
+        JSONSyncStateDatabase db2(metaTmpDir.path() + "/sync2.json");
+        DirectorySynchronizer sync2;
+        sync2.setJobFactory(jobFactory);
+        sync2.setSyncStateDatabase(&db2);
+        sync2.setLocalDirectoryPath(tmpDir2.path());
+        sync2.setRemoteDirectoryPath(remotePath);
+        QSignalSpy spy(&sync2, &DirectorySynchronizer::finished);
+        sync2.start();
+        QVERIFY(spy.wait(60000));
+        QCOMPARE(sync2.error(), SynchronizerError::NoError);
+        QCOMPARE(readFile(tmpDir2.path() + "/sub/test.txt"), QByteArray("Hello World"));
+    }
+
+    // Remote changes are picked up when requesting a sync:
+    QVERIFY(writeFile(tmpDir2.path() + "/sub/test.txt", "Hello Continuous Sync"));
+    {
+        JSONSyncStateDatabase db2(metaTmpDir.path() + "/sync2.json");
+        DirectorySynchronizer sync2;
+        sync2.setJobFactory(jobFactory);
+        sync2.setSyncStateDatabase(&db2);
+        sync2.setLocalDirectoryPath(tmpDir2.path());
+        sync2.setRemoteDirectoryPath(remotePath);
+        QSignalSpy spy(&sync2, &DirectorySynchronizer::finished);
+        sync2.start();
+        QVERIFY(spy.wait(60000));
+        QCOMPARE(sync2.error(), SynchronizerError::NoError);
+    }
+    QTRY_VERIFY_WITH_TIMEOUT(!sync.syncing(), 60000);
+    finishedSpy.clear();
+    sync.requestSync();
+    QVERIFY(finishedSpy.wait(60000));
+    QCOMPARE(sync.lastError(), SynchronizerError::NoError);
+    QCOMPARE(readFile(tmpDir1.path() + "/sub/test.txt"), QByteArray("Hello Continuous Sync"));
+
+    sync.stop();
+    QTRY_VERIFY_WITH_TIMEOUT(!sync.running(), 60000);
+    QVERIFY(!db.isOpen());
+}
+
+void ContinuousSynchronizerTest::continuousSync_data()
+{
+    QTest::addColumn<AbstractJobFactory*>("jobFactory");
+
+    auto nam = new QNetworkAccessManager(this);
+    nam->setRedirectPolicy(QNetworkRequest::NoLessSafeRedirectPolicy);
+
+    // The fake servers are always available, so the test also runs without live servers:
+    for (auto type : { WebDAVServerType::Generic, WebDAVServerType::NextCloud }) {
+        auto server = new FakeWebDAVServer(type, this);
+        server->setSyncCollectionSupported(type == WebDAVServerType::NextCloud);
+        QVERIFY(server->listen());
+        auto webdavJobFactory = new WebDAVJobFactory(this);
+        webdavJobFactory->setUrl(server->url());
+        webdavJobFactory->setServerType(type);
+        webdavJobFactory->setNetworkAccessManager(nam);
+        webdavJobFactory->setSyncCollectionEnabled(server->syncCollectionSupported());
+        QTest::newRow(type == WebDAVServerType::NextCloud ? "FakeNextCloud" : "FakeWebDAV")
+                << static_cast<AbstractJobFactory*>(webdavJobFactory);
+    }
+
+    {
+        auto server = new FakeDropboxServer(this);
+        QVERIFY(server->listen());
+        auto factory = new DropboxJobFactory(this);
+        factory->setNetworkAccessManager(
+                new RedirectingNetworkAccessManager(server->serverUrl(), this));
+        factory->setToken("fake-token");
+        QTest::newRow("FakeDropbox") << static_cast<AbstractJobFactory*>(factory);
+    }
+
+    for (const auto& tuple : SynqClient::UnitTest::enumerateWebDAVTestServers()) {
+        auto url = std::get<0>(tuple);
+        auto type = std::get<1>(tuple);
+        auto webdavJobFactory = new WebDAVJobFactory(this);
+        webdavJobFactory->setUrl(url);
+        webdavJobFactory->setServerType(type);
+        webdavJobFactory->setNetworkAccessManager(nam);
+        QTest::newRow(url.toString().toUtf8())
+                << static_cast<AbstractJobFactory*>(webdavJobFactory);
+    }
+
+    if (SynqClient::UnitTest::hasDropboxTokenFromEnv()) {
+        auto factory = new DropboxJobFactory(this);
+        factory->setNetworkAccessManager(nam);
+        factory->setToken(SynqClient::UnitTest::getDropboxTokenFromEnv());
+        QTest::newRow("Dropbox") << static_cast<AbstractJobFactory*>(factory);
+    }
+}
+
+void ContinuousSynchronizerTest::cleanupTestCase() {}
+
+bool ContinuousSynchronizerTest::writeFile(const QString& fileName, const QByteArray& data)
+{
+    QFileInfo fi(fileName);
+    if (!QDir(fi.absolutePath()).mkpath(".")) {
+        return false;
+    }
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    file.write(data);
+    file.close();
+    return true;
+}
+
+QByteArray ContinuousSynchronizerTest::readFile(const QString& fileName)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QByteArray();
+    }
+    return file.readAll();
+}
+
+QTEST_MAIN(ContinuousSynchronizerTest)
+
+#include "tst_continuoussynchronizer.moc"
@@ -1,6 +1,7 @@
 #include <QDirIterator>
 #include <QFile>
 #include <QMap>
+#include <QNetworkAccessManager>
 #include <QRandomGenerator>
 #include <QSharedPointer>
 #include <QSignalSpy>
@@ -8,6 +9,7 @@
 #include <QtTest>
 
 // add necessary includes here
+#include "../shared/fakewebdavserver.h"
 #include "../shared/utils.h"
 #include "SynqClient/AbstractJobFactory"
 #include "SynqClient/DirectorySynchronizer"
@@ -31,6 +33,9 @@ using SynqClient::SynchronizerFlag;
 using SynqClient::SynchronizerFlags;
 using SynqClient::SynchronizerState;
 using SynqClient::WebDAVJobFactory;
+using SynqClient::WebDAVServerType;
+using SynqClient::UnitTest::FakeWebDAVServer;
+using SynqClient::UnitTest::setupWebDAVSynchronizer;
 
 class DirectorySynchronizerTest : public QObject
 {
@@ -53,6 +58,16 @@ private slots:
     void simpleSyncAndConflictResolution_data() { prepareTestData(); }
     void editVsDeleteConflictResolution();
     void editVsDeleteConflictResolution_data() { prepareTestData(); }
+    void moveAndRename();
+    void moveAndRename_data() { prepareTestData(); }
+    void duplicateFiles();
+    void duplicateFiles_data() { prepareTestData(); }
+    void identicalFilesOnInitialSync();
+    void identicalFilesOnInitialSync_data() { prepareTestData(); }
+    void identicalFilesOnInitialSyncOffline();
+    void remoteMovesAndRenames();
+    void remoteMovesAndRenames_data();
+    void downloadChecksumMismatch();
 
     // More complex sync of larger directory
     void sync();
@@ -69,6 +84,7 @@ private:
     template<SyncConflictStrategy strategy = SyncConflictStrategy::RemoteWins>
     bool syncDir(const QString& localPath, const QString& remotePath, const QString& syncDbPath,
                  AbstractJobFactory* jobFactory);
+    bool syncDir(const QString& localPath, const QString& syncDbPath, FakeWebDAVServer* server);
 
     bool writeFile(const QString& fileName, const QByteArray& data) const;
     QByteArray readFile(const QString& fileName) const;
@@ -357,6 +373,143 @@ void DirectorySynchronizerTest::editVsDeleteConflictResolution()
     QVERIFY(!QDir(tmpDir2.path() + "/top").exists());
 }
 
+void DirectorySynchronizerTest::moveAndRename()
+{
+    if (!SynqClient::UnitTest::hasWebDAVServersFromEnv()
+        && !SynqClient::UnitTest::hasDropboxTokenFromEnv()) {
+        QSKIP("No servers configured - skipping test");
+    }
+
+    QFETCH(AbstractJobFactory*, jobFactory);
+
+    QTemporaryDir tmpDir1;
+    QTemporaryDir tmpDir2;
+    QTemporaryDir metaTmpDir;
+
+    auto uuid = QUuid::createUuid();
+    auto path = "DirectorySynchronizerTest-moveAndRename-" + uuid.toString();
+    auto dbPath1 = metaTmpDir.path() + "/syncdb1.json";
+    auto dbPath2 = metaTmpDir.path() + "/syncdb2.json";
+    QVERIFY(writeFile(tmpDir1.path() + "/top/sub/a.txt", "File A\n"));
+    QVERIFY(writeFile(tmpDir1.path() + "/top/sub/b.txt", "File B\n"));
+    QVERIFY(writeFile(tmpDir1.path() + "/top/c.txt", "File C\n"));
+    QVERIFY(writeFile(tmpDir1.path() + "/d.txt", "File D\n"));
+
+    QVERIFY(syncDir(tmpDir1.path(), path, dbPath1, jobFactory));
+    QVERIFY(syncDir(tmpDir2.path(), path, dbPath2, jobFactory));
+    QCOMPARE(readFile(tmpDir2.path() + "/top/sub/a.txt"), "File A\n");
+
+    // Rename a folder (and change some of its contents) as well as a single file:
+    QVERIFY(QDir(tmpDir1.path()).rename("top", "renamed"));
+    QVERIFY(QFile::rename(tmpDir1.path() + "/d.txt", tmpDir1.path() + "/e.txt"));
+    QVERIFY(QFile::remove(tmpDir1.path() + "/renamed/sub/b.txt"));
+    QVERIFY(writeFile(tmpDir1.path() + "/renamed/c.txt", "File C - edited\n"));
+    QVERIFY(writeFile(tmpDir1.path() + "/renamed/new.txt", "New File\n"));
+
+    QVERIFY(syncDir(tmpDir1.path(), path, dbPath1, jobFactory));
+    QVERIFY(syncDir(tmpDir2.path(), path, dbPath2, jobFactory));
+    QVERIFY(!QDir(tmpDir2.path() + "/top").exists());
+    QVERIFY(!QFile::exists(tmpDir2.path() + "/d.txt"));
+    QVERIFY(!QFile::exists(tmpDir2.path() + "/renamed/sub/b.txt"));
+    QCOMPARE(readFile(tmpDir2.path() + "/renamed/sub/a.txt"), "File A\n");
+    QCOMPARE(readFile(tmpDir2.path() + "/renamed/c.txt"), "File C - edited\n");
+    QCOMPARE(readFile(tmpDir2.path() + "/renamed/new.txt"), "New File\n");
+    QCOMPARE(readFile(tmpDir2.path() + "/e.txt"), "File D\n");
+
+    // Syncing again must not change anything:
+    QVERIFY(syncDir(tmpDir1.path(), path, dbPath1, jobFactory));
+    QCOMPARE(readFile(tmpDir1.path() + "/renamed/sub/a.txt"), "File A\n");
+    QCOMPARE(readFile(tmpDir1.path() + "/e.txt"), "File D\n");
+}
+
+void DirectorySynchronizerTest::duplicateFiles()
+{
+    if (!SynqClient::UnitTest::hasWebDAVServersFromEnv()
+        && !SynqClient::UnitTest::hasDropboxTokenFromEnv()) {
+        QSKIP("No servers configured - skipping test");
+    }
+
+    QFETCH(AbstractJobFactory*, jobFactory);
+
+    QTemporaryDir tmpDir1;
+    QTemporaryDir tmpDir2;
+    QTemporaryDir metaTmpDir;
+
+    auto uuid = QUuid::createUuid();
+    auto path = "DirectorySynchronizerTest-duplicateFiles-" + uuid.toString();
+    auto dbPath1 = metaTmpDir.path() + "/syncdb1.json";
+    auto dbPath2 = metaTmpDir.path() + "/syncdb2.json";
+
+    // Use a file large enough to be copied on the server side:
+    QByteArray data;
+    while (data.length() < 256 * 1024) {
+        data += QUuid::createUuid().toByteArray();
+    }
+    QVERIFY(writeFile(tmpDir1.path() + "/template/data.bin", data));
+    QVERIFY(syncDir(tmpDir1.path(), path, dbPath1, jobFactory));
+
+    // Duplicate the file locally:
+    QVERIFY(QDir(tmpDir1.path()).mkpath("project1"));
+    QVERIFY(QDir(tmpDir1.path()).mkpath("project2"));
+    QVERIFY(QFile::copy(tmpDir1.path() + "/template/data.bin",
+                        tmpDir1.path() + "/project1/data.bin"));
+    QVERIFY(QFile::copy(tmpDir1.path() + "/template/data.bin",
+                        tmpDir1.path() + "/project2/data.bin"));
+    QVERIFY(syncDir(tmpDir1.path(), path, dbPath1, jobFactory));
+
+    QVERIFY(syncDir(tmpDir2.path(), path, dbPath2, jobFactory));
+    QCOMPARE(readFile(tmpDir2.path() + "/template/data.bin"), data);
+    QCOMPARE(readFile(tmpDir2.path() + "/project1/data.bin"), data);
+    QCOMPARE(readFile(tmpDir2.path() + "/project2/data.bin"), data);
+}
+
+void DirectorySynchronizerTest::identicalFilesOnInitialSync()
+{
+    if (!SynqClient::UnitTest::hasWebDAVServersFromEnv()
+        && !SynqClient::UnitTest::hasDropboxTokenFromEnv()) {
+        QSKIP("No servers configured - skipping test");
+    }
+
+    QFETCH(AbstractJobFactory*, jobFactory);
+
+    QTemporaryDir tmpDir1;
+    QTemporaryDir tmpDir2;
+    QTemporaryDir metaTmpDir;
+
+    auto uuid = QUuid::createUuid();
+    auto path = "DirectorySynchronizerTest-identicalFilesOnInitialSync-" + uuid.toString();
+    auto dbPath1 = metaTmpDir.path() + "/syncdb1.json";
+    auto dbPath2 = metaTmpDir.path() + "/syncdb2.json";
+
+    QVERIFY(writeFile(tmpDir1.path() + "/docs/readme.txt", "Hello World!\n"));
+    QVERIFY(syncDir(tmpDir1.path(), path, dbPath1, jobFactory));
+
+    // The second folder already contains the same file (e.g. restored from a backup):
+    auto fileName = tmpDir2.path() + "/docs/readme.txt";
+    QVERIFY(writeFile(fileName, "Hello World!\n"));
+    auto lastModified = QDateTime::currentDateTime().addDays(-7);
+    {
+        QFile file(fileName);
+        QVERIFY(file.open(QIODevice::ReadWrite));
+        QVERIFY(file.setFileTime(lastModified, QFileDevice::FileModificationTime));
+    }
+    QVERIFY(syncDir(tmpDir2.path(), path, dbPath2, jobFactory));
+    QCOMPARE(readFile(fileName), "Hello World!\n");
+
+    JSONSyncStateDatabase db(dbPath2);
+    QVERIFY(db.open());
+    auto entry = db.getEntry("/docs/readme.txt");
+    QVERIFY(entry.isValid());
+    QVERIFY(!entry.syncProperty().isEmpty());
+    QVERIFY(db.close());
+
+    if (qobject_cast<SynqClient::DropboxJobFactory*>(jobFactory)) {
+        // Dropbox always reports a content hash, so the file must not have been downloaded:
+        QCOMPARE(QFileInfo(fileName).lastModified().toSecsSinceEpoch(),
+                 lastModified.toSecsSinceEpoch());
+    }
+}
+
 void DirectorySynchronizerTest::sync()
 {
     if (!SynqClient::UnitTest::hasWebDAVServersFromEnv()
@@ -552,6 +705,142 @@ void DirectorySynchronizerTest::sync()
     }
 }
 
+void DirectorySynchronizerTest::identicalFilesOnInitialSyncOffline()
+{
+    FakeWebDAVServer server(WebDAVServerType::NextCloud);
+    QVERIFY(server.listen());
+    server.putFile("/sync/docs/readme.txt", "Hello World!\n");
+
+    // The local folder already contains the same file (e.g. restored from a backup). Sync with
+    // the default flags, i.e. the remote folder is created first:
+    QTemporaryDir tmpDir;
+    QTemporaryDir metaTmpDir;
+    auto fileName = tmpDir.filePath("docs/readme.txt");
+    QVERIFY(writeFile(fileName, "Hello World!\n"));
+    auto dbPath = metaTmpDir.filePath("syncdb.json");
+    QVERIFY(syncDir(tmpDir.path(), dbPath, &server));
+
+    QCOMPARE(server.numRequests("PUT"), 0);
+    QCOMPARE(server.numRequests("GET"), 0);
+    QCOMPARE(readFile(fileName), "Hello World!\n");
+    QCOMPARE(QDir(tmpDir.filePath("docs")).entryList(QDir::Files), QStringList({ "readme.txt" }));
+    QCOMPARE(server.fileData("/sync/docs/readme.txt"), QByteArray("Hello World!\n"));
+
+    JSONSyncStateDatabase db(dbPath);
+    QVERIFY(db.open());
+    QVERIFY(db.getEntry("/docs/readme.txt").isValid());
+}
+
+void DirectorySynchronizerTest::remoteMovesAndRenames()
+{
+    QFETCH(WebDAVServerType, serverType);
+    QFETCH(QString, change);
+    QFETCH(bool, moved);
+    QFETCH(QStringList, expectedFiles);
+
+    FakeWebDAVServer server(serverType);
+    QVERIFY(server.listen());
+    server.putFile("/sync/top/sub/a.txt", "File A\n");
+    server.putFile("/sync/top/sub/b.txt", "File B\n");
+    server.putFile("/sync/top/c.txt", "File C\n");
+    server.putFile("/sync/d.txt", "File D\n");
+
+    QTemporaryDir tmpDir;
+    QTemporaryDir metaTmpDir;
+    auto dbPath = metaTmpDir.filePath("syncdb.json");
+    QVERIFY(syncDir(tmpDir.path(), dbPath, &server));
+    QCOMPARE(readFile(tmpDir.filePath("top/sub/a.txt")), "File A\n");
+
+    if (change == "renameFile") {
+        server.move("/sync/d.txt", "/sync/e.txt");
+    } else {
+        server.move("/sync/top", "/sync/renamed");
+        if (change == "renameFolderAndDelete") {
+            server.remove("/sync/renamed/c.txt");
+            server.remove("/sync/renamed/sub/b.txt");
+        }
+    }
+
+    // A single sync is enough to apply the changes:
+    server.resetStatistics();
+    QVERIFY(syncDir(tmpDir.path(), dbPath, &server));
+    QCOMPARE(QStringList(readDirectory(tmpDir.path()).keys()), expectedFiles);
+    for (const auto& path : qAsConst(expectedFiles)) {
+        QCOMPARE(readFile(tmpDir.filePath(path)), server.fileData("/sync/" + path));
+    }
+    if (change != "renameFile") {
+        QVERIFY(!QFileInfo::exists(tmpDir.filePath("top")));
+    }
+
+    // Moved resources are not downloaded again:
+    QCOMPARE(server.numRequests("GET") == 0, moved);
+
+    // Nothing is left to do:
+    server.resetStatistics();
+    QVERIFY(syncDir(tmpDir.path(), dbPath, &server));
+    QCOMPARE(QStringList(readDirectory(tmpDir.path()).keys()), expectedFiles);
+    QCOMPARE(server.numRequests("GET"), 0);
+    QCOMPARE(server.numRequests("PUT"), 0);
+    QCOMPARE(server.numRequests("DELETE"), 0);
+    QCOMPARE(server.numRequests("MKCOL"), 0);
+}
+
+void DirectorySynchronizerTest::remoteMovesAndRenames_data()
+{
+    QTest::addColumn<WebDAVServerType>("serverType");
+    QTest::addColumn<QString>("change");
+    QTest::addColumn<bool>("moved");
+    QTest::addColumn<QStringList>("expectedFiles");
+
+    QTest::newRow("File rename")
+            << WebDAVServerType::NextCloud << "renameFile" << true
+            << QStringList({ "e.txt", "top/c.txt", "top/sub/a.txt", "top/sub/b.txt" });
+    QTest::newRow("Folder rename")
+            << WebDAVServerType::NextCloud << "renameFolder" << true
+            << QStringList({ "d.txt", "renamed/c.txt", "renamed/sub/a.txt", "renamed/sub/b.txt" });
+    QTest::newRow("Folder rename without file IDs")
+            << WebDAVServerType::Generic << "renameFolder" << false
+            << QStringList({ "d.txt", "renamed/c.txt", "renamed/sub/a.txt", "renamed/sub/b.txt" });
+    QTest::newRow("Folder rename with deletions")
+            << WebDAVServerType::NextCloud << "renameFolderAndDelete" << true
+            << QStringList({ "d.txt", "renamed/sub/a.txt" });
+}
+
+void DirectorySynchronizerTest::downloadChecksumMismatch()
+{
+    FakeWebDAVServer server(WebDAVServerType::NextCloud);
+    QVERIFY(server.listen());
+    server.putFile("/sync/a.txt", "Version 1\n");
+
+    QTemporaryDir tmpDir;
+    QTemporaryDir metaTmpDir;
+    auto dbPath = metaTmpDir.filePath("syncdb.json");
+    QVERIFY(syncDir(tmpDir.path(), dbPath, &server));
+    QCOMPARE(readFile(tmpDir.filePath("a.txt")), "Version 1\n");
+
+    // Data corrupted in transit is detected before the local file is replaced:
+    server.putFile("/sync/a.txt", "Version 2\n");
+    server.setCorruptDownloads(true);
+    {
+        QNetworkAccessManager nam;
+        DirectorySynchronizer sync_;
+        setupWebDAVSynchronizer(&sync_, &nam, server.url(), tmpDir.path(), "/sync", dbPath);
+        qobject_cast<WebDAVJobFactory*>(sync_.jobFactory())->setServerType(server.serverType());
+        sync_.start();
+        QSignalSpy spy(&sync_, &DirectorySynchronizer::finished);
+        QVERIFY(spy.wait());
+        QCOMPARE(sync_.error(), SynchronizerError::DownloadFailed);
+        QVERIFY(sync_.errorString().contains("Checksum mismatch"));
+    }
+    QCOMPARE(readFile(tmpDir.filePath("a.txt")), "Version 1\n");
+    QTRY_COMPARE(QDir(tmpDir.path()).entryList(QDir::Files), QStringList({ "a.txt" }));
+
+    // Once the data arrives intact, the file is updated:
+    server.setCorruptDownloads(false);
+    QVERIFY(syncDir(tmpDir.path(), dbPath, &server));
+    QCOMPARE(readFile(tmpDir.filePath("a.txt")), "Version 2\n");
+}
+
 void DirectorySynchronizerTest::cleanupTestCase() {}
 
 void DirectorySynchronizerTest::prepareTestData()
@@ -750,6 +1039,24 @@ bool DirectorySynchronizerTest::syncDir(const QString& localPath, const QString&
     return true;
 }
 
+bool DirectorySynchronizerTest::syncDir(const QString& localPath, const QString& syncDbPath,
+                                        FakeWebDAVServer* server)
+{
+    QNetworkAccessManager nam;
+    DirectorySynchronizer sync_;
+    setupWebDAVSynchronizer(&sync_, &nam, server->url(), localPath, "/sync", syncDbPath);
+    auto jobFactory = qobject_cast<WebDAVJobFactory*>(sync_.jobFactory());
+    SQ_VERIFY(jobFactory != nullptr);
+    jobFactory->setServerType(server->serverType());
+    sync_.start();
+    QSignalSpy spy(&sync_, &DirectorySynchronizer::finished);
+    SQ_VERIFY(spy.wait());
+    SQ_COMPARE(sync_.state(), SynchronizerState::Finished);
+    SQ_COMPARE(sync_.errorString(), QString());
+    SQ_COMPARE(sync_.error(), SynchronizerError::NoError);
+    return true;
+}
+
 QTEST_MAIN(DirectorySynchronizerTest)
 
 #include "tst_directorysynchronizer.moc"
@@ -0,0 +1,2 @@
+TESTNAME = dropboxchangewatcher
+include(../test.pri)
@@ -0,0 +1,150 @@
+#include <QtTest>
+
+// add necessary includes here
+#include "../shared/utils.h"
+#include "SynqClient/DropboxChangeWatcher"
+#include "SynqClient/DropboxCreateDirectoryJob"
+#include "SynqClient/DropboxDeleteJob"
+#include "SynqClient/DropboxListFilesJob"
+#include "SynqClient/DropboxUploadFileJob"
+
+using SynqClient::DropboxChangeWatcher;
+using SynqClient::DropboxCreateDirectoryJob;
+using SynqClient::DropboxDeleteJob;
+using SynqClient::DropboxListFilesJob;
+using SynqClient::DropboxUploadFileJob;
+using SynqClient::JobError;
+
+class DropboxChangeWatcherTest : public QObject
+{
+    Q_OBJECT
+
+public:
+    DropboxChangeWatcherTest();
+    ~DropboxChangeWatcherTest();
+
+private slots:
+    void initTestCase();
+    void properties();
+    void noCursor();
+    void watchForChanges();
+    void cleanupTestCase();
+};
+
+DropboxChangeWatcherTest::DropboxChangeWatcherTest() {}
+
+DropboxChangeWatcherTest::~DropboxChangeWatcherTest() {}
+
+void DropboxChangeWatcherTest::initTestCase() {}
+
+void DropboxChangeWatcherTest::properties()
+{
+    DropboxChangeWatcher watcher;
+    QCOMPARE(watcher.timeout(), 30);
+    watcher.setTimeout(10);
+    QCOMPARE(watcher.timeout(), 30);
+    watcher.setTimeout(1000);
+    QCOMPARE(watcher.timeout(), 480);
+    watcher.setTimeout(120);
+    QCOMPARE(watcher.timeout(), 120);
+    QVERIFY(!watcher.running());
+}
+
+void DropboxChangeWatcherTest::noCursor()
+{
+    // Without a cursor, the watcher must request a sync (exactly once):
+    QNetworkAccessManager nam;
+    DropboxChangeWatcher watcher;
+    watcher.setNetworkAccessManager(&nam);
+    QSignalSpy changedSpy(&watcher, &DropboxChangeWatcher::remoteChanged);
+    QSignalSpy runningSpy(&watcher, &DropboxChangeWatcher::runningChanged);
+    watcher.start();
+    QVERIFY(watcher.running());
+    QCOMPARE(runningSpy.count(), 1);
+    QVERIFY(changedSpy.wait());
+    QTest::qWait(3000);
+    QCOMPARE(changedSpy.count(), 1);
+    watcher.stop();
+    QVERIFY(!watcher.running());
+    QCOMPARE(runningSpy.count(), 2);
+}
+
+void DropboxChangeWatcherTest::watchForChanges()
+{
+    if (!SynqClient::UnitTest::hasDropboxTokenFromEnv()) {
+        QSKIP("No Dropbox token configured - skipping test");
+    }
+
+    QNetworkAccessManager nam;
+    nam.setRedirectPolicy(QNetworkRequest::NoLessSafeRedirectPolicy);
+
+    auto testDirUid = QUuid::createUuid();
+    auto remotePath = "/DropboxChangeWatcherTest-watchForChanges-" + testDirUid.toString();
+
+    {
+        DropboxCreateDirectoryJob job;
+        job.setNetworkAccessManager(&nam);
+        job.setToken(SynqClient::UnitTest::getDropboxTokenFromEnv());
+        job.setPath(remotePath);
+        job.start();
+        QSignalSpy spy(&job, &DropboxCreateDirectoryJob::finished);
+        QVERIFY(spy.wait());
+        QCOMPARE(job.error(), JobError::NoError);
+    }
+
+    QString cursor;
+    {
+        DropboxListFilesJob job;
+        job.setNetworkAccessManager(&nam);
+        job.setToken(SynqClient::UnitTest::getDropboxTokenFromEnv());
+        job.setPath(remotePath);
+        job.setRecursive(true);
+        job.start();
+        QSignalSpy spy(&job, &DropboxListFilesJob::finished);
+        QVERIFY(spy.wait());
+        QCOMPARE(job.error(), JobError::NoError);
+        cursor = job.cursor();
+        QVERIFY(!cursor.isEmpty());
+    }
+
+    DropboxChangeWatcher watcher;
+    watcher.setNetworkAccessManager(&nam);
+    watcher.setCursor(cursor);
+    QSignalSpy changedSpy(&watcher, &DropboxChangeWatcher::remoteChanged);
+    watcher.start();
+
+    // Nothing changed so far:
+    QVERIFY(!changedSpy.wait(5000));
+
+    {
+        DropboxUploadFileJob job;
+        job.setNetworkAccessManager(&nam);
+        job.setToken(SynqClient::UnitTest::getDropboxTokenFromEnv());
+        job.setRemoteFilename(remotePath + "/file1.txt");
+        job.setData("Hello World!");
+        job.start();
+        QSignalSpy spy(&job, &DropboxUploadFileJob::finished);
+        QVERIFY(spy.wait());
+        QCOMPARE(job.error(), JobError::NoError);
+    }
+
+    QVERIFY(changedSpy.count() > 0 || changedSpy.wait(120000));
+    watcher.stop();
+
+    {
+        DropboxDeleteJob job;
+        job.setNetworkAccessManager(&nam);
+        job.setToken(SynqClient::UnitTest::getDropboxTokenFromEnv());
+        job.setPath(remotePath);
+        job.start();
+        QSignalSpy spy(&job, &DropboxDeleteJob::finished);
+        QVERIFY(spy.wait());
+        QCOMPARE(job.error(), JobError::NoError);
+    }
+}
+
+void DropboxChangeWatcherTest::cleanupTestCase() {}
+
+QTEST_MAIN(DropboxChangeWatcherTest)
+
+#include "tst_dropboxchangewatcher.moc"
@@ -0,0 +1,2 @@
+TESTNAME = dropboxcopyjob
+include(../test.pri)
@@ -0,0 +1,154 @@
+#include <QSignalSpy>
+#include <QtTest>
+
+// add necessary includes here
+#include "../shared/fakedropboxserver.h"
+#include "../shared/utils.h"
+#include "SynqClient/DropboxCopyJob"
+
+using SynqClient::DropboxCopyJob;
+using SynqClient::JobError;
+using SynqClient::UnitTest::FakeDropboxServer;
+using SynqClient::UnitTest::RedirectingNetworkAccessManager;
+
+class DropboxCopyJobTest : public QObject
+{
+    Q_OBJECT
+
+public:
+    DropboxCopyJobTest();
+    ~DropboxCopyJobTest();
+
+private slots:
+    void initTestCase();
+    void missingParameters();
+    void copyFile();
+    void copyFolder();
+    void errors();
+    void overwrite();
+    void cleanupTestCase();
+
+private:
+    static bool runJob(DropboxCopyJob& job, JobError expectedError = JobError::NoError);
+};
+
+DropboxCopyJobTest::DropboxCopyJobTest() {}
+
+DropboxCopyJobTest::~DropboxCopyJobTest() {}
+
+void DropboxCopyJobTest::initTestCase() {}
+
+void DropboxCopyJobTest::missingParameters()
+{
+    FakeDropboxServer server;
+    QVERIFY(server.listen());
+    RedirectingNetworkAccessManager nam(server.serverUrl());
+
+    DropboxCopyJob job;
+    job.setNetworkAccessManager(&nam);
+    job.setToken("fake-token");
+    job.setPath("/foo.txt");
+    QVERIFY(runJob(job, JobError::MissingParameter));
+    QCOMPARE(server.numRequests(), 0);
+}
+
+void DropboxCopyJobTest::copyFile()
+{
+    FakeDropboxServer server;
+    QVERIFY(server.listen());
+    server.putFile("/dir/hello.txt", "Hello World!\n");
+    RedirectingNetworkAccessManager nam(server.serverUrl());
+
+    DropboxCopyJob job;
+    job.setNetworkAccessManager(&nam);
+    job.setToken("fake-token");
+    job.setPath("/dir/hello.txt");
+    job.setTargetPath("/other/copy.txt");
+    QVERIFY(runJob(job));
+    QCOMPARE(server.fileData("/dir/hello.txt"), QByteArray("Hello World!\n"));
+    QCOMPARE(server.fileData("/other/copy.txt"), QByteArray("Hello World!\n"));
+    QCOMPARE(job.fileInfo().name(), QString("copy.txt"));
+    QVERIFY(!job.fileInfo().syncAttribute().isEmpty());
+}
+
+void DropboxCopyJobTest::copyFolder()
+{
+    FakeDropboxServer server;
+    QVERIFY(server.listen());
+    server.putFile("/dir/sub/a.txt", "A");
+    server.putFile("/dir/b.txt", "B");
+    RedirectingNetworkAccessManager nam(server.serverUrl());
+
+    DropboxCopyJob job;
+    job.setNetworkAccessManager(&nam);
+    job.setToken("fake-token");
+    job.setPath("/dir");
+    job.setTargetPath("/copy");
+    QVERIFY(runJob(job));
+    QCOMPARE(server.fileData("/dir/sub/a.txt"), QByteArray("A"));
+    QCOMPARE(server.fileData("/dir/b.txt"), QByteArray("B"));
+    QVERIFY(server.isDirectory("/copy/sub"));
+    QCOMPARE(server.fileData("/copy/sub/a.txt"), QByteArray("A"));
+    QCOMPARE(server.fileData("/copy/b.txt"), QByteArray("B"));
+}
+
+void DropboxCopyJobTest::errors()
+{
+    FakeDropboxServer server;
+    QVERIFY(server.listen());
+    server.putFile("/a.txt", "A");
+    server.putFile("/b.txt", "B");
+    RedirectingNetworkAccessManager nam(server.serverUrl());
+
+    auto copy = [&](const QString& path, const QString& targetPath, JobError expectedError) {
+        DropboxCopyJob job;
+        job.setNetworkAccessManager(&nam);
+        job.setToken("fake-token");
+        job.setPath(path);
+        job.setTargetPath(targetPath);
+        return runJob(job, expectedError);
+    };
+
+    QVERIFY(copy("/missing.txt", "/c.txt", JobError::ResourceNotFound));
+    QVERIFY(copy("/a.txt", "/b.txt", JobError::ResourceExists));
+
+    // Nothing has been changed by the failed copies:
+    QCOMPARE(server.fileData("/a.txt"), QByteArray("A"));
+    QCOMPARE(server.fileData("/b.txt"), QByteArray("B"));
+    QVERIFY(!server.exists("/c.txt"));
+}
+
+void DropboxCopyJobTest::overwrite()
+{
+    FakeDropboxServer server;
+    QVERIFY(server.listen());
+    server.putFile("/a.txt", "A");
+    server.putFile("/b.txt", "B");
+    RedirectingNetworkAccessManager nam(server.serverUrl());
+
+    // Dropbox cannot replace targets, so the job removes the target first:
+    DropboxCopyJob job;
+    job.setNetworkAccessManager(&nam);
+    job.setToken("fake-token");
+    job.setPath("/a.txt");
+    job.setTargetPath("/b.txt");
+    job.setOverwrite(true);
+    QVERIFY(runJob(job));
+    QCOMPARE(server.fileData("/a.txt"), QByteArray("A"));
+    QCOMPARE(server.fileData("/b.txt"), QByteArray("A"));
+}
+
+void DropboxCopyJobTest::cleanupTestCase() {}
+
+bool DropboxCopyJobTest::runJob(DropboxCopyJob& job, JobError expectedError)
+{
+    QSignalSpy finished(&job, &DropboxCopyJob::finished);
+    job.start();
+    SQ_VERIFY(finished.wait());
+    SQ_COMPARE(job.error(), expectedError);
+    return true;
+}
+
+QTEST_MAIN(DropboxCopyJobTest)
+
+#include "tst_dropboxcopyjob.moc"
@@ -1,21 +1,28 @@
 #include <QtTest>
 
 // add necessary includes here
+#include "SynqClient/DropboxCreateDirectoryBatchJob"
 #include "SynqClient/DropboxCreateDirectoryJob"
+#include "SynqClient/DropboxDeleteBatchJob"
 #include "SynqClient/DropboxDeleteJob"
 #include "SynqClient/DropboxDownloadFileJob"
 #include "SynqClient/DropboxGetFileInfoJob"
 #include "SynqClient/DropboxJobFactory"
 #include "SynqClient/DropboxListFilesJob"
+#include "SynqClient/DropboxUploadFileBatchJob"
 #include "SynqClient/DropboxUploadFileJob"
 
+using SynqClient::DropboxCreateDirectoryBatchJob;
 using SynqClient::DropboxCreateDirectoryJob;
+using SynqClient::DropboxDeleteBatchJob;
 using SynqClient::DropboxDeleteJob;
 using SynqClient::DropboxDownloadFileJob;
 using SynqClient::DropboxGetFileInfoJob;
 using SynqClient::DropboxJobFactory;
 using SynqClient::DropboxListFilesJob;
+using SynqClient::DropboxUploadFileBatchJob;
 using SynqClient::DropboxUploadFileJob;
+using SynqClient::JobType;
 
 class DropboxJobFactoryTest : public QObject
 {
@@ -44,6 +51,8 @@ void DropboxJobFactoryTest::createJobs()
     factory.setNetworkAccessManager(&nam);
     factory.setUserAgent("Unit Test");
     factory.setToken("12345");
+    QVERIFY(!factory.http2Allowed());
+    factory.setHttp2Allowed(true);
 
     {
         auto job = factory.createDirectory(&factory);
@@ -52,6 +61,7 @@ void DropboxJobFactoryTest::createJobs()
         QCOMPARE(davJob->networkAccessManager(), &nam);
         QCOMPARE(davJob->userAgent(), "Unit Test");
         QCOMPARE(davJob->token(), "12345");
+        QVERIFY(davJob->http2Allowed());
     }
 
     {
@@ -61,6 +71,7 @@ void DropboxJobFactoryTest::createJobs()
         QCOMPARE(davJob->networkAccessManager(), &nam);
         QCOMPARE(davJob->userAgent(), "Unit Test");
         QCOMPARE(davJob->token(), "12345");
+        QVERIFY(davJob->http2Allowed());
     }
 
     {
@@ -70,6 +81,7 @@ void DropboxJobFactoryTest::createJobs()
         QCOMPARE(davJob->networkAccessManager(), &nam);
         QCOMPARE(davJob->userAgent(), "Unit Test");
         QCOMPARE(davJob->token(), "12345");
+        QVERIFY(davJob->http2Allowed());
     }
 
     {
@@ -79,6 +91,7 @@ void DropboxJobFactoryTest::createJobs()
         QCOMPARE(davJob->networkAccessManager(), &nam);
         QCOMPARE(davJob->userAgent(), "Unit Test");
         QCOMPARE(davJob->token(), "12345");
+        QVERIFY(davJob->http2Allowed());
     }
 
     {
@@ -88,6 +101,7 @@ void DropboxJobFactoryTest::createJobs()
         QCOMPARE(davJob->networkAccessManager(), &nam);
         QCOMPARE(davJob->userAgent(), "Unit Test");
         QCOMPARE(davJob->token(), "12345");
+        QVERIFY(davJob->http2Allowed());
     }
 
     {
@@ -97,6 +111,40 @@ void DropboxJobFactoryTest::createJobs()
         QCOMPARE(davJob->networkAccessManager(), &nam);
         QCOMPARE(davJob->userAgent(), "Unit Test");
         QCOMPARE(davJob->token(), "12345");
+        QVERIFY(davJob->http2Allowed());
+    }
+
+    {
+        QVERIFY(factory.maxBatchSize(JobType::CreateDirectoryBatch) > 0);
+        auto job = factory.createDirectoryBatch(&factory);
+        auto davJob = qobject_cast<DropboxCreateDirectoryBatchJob*>(job);
+        QVERIFY(davJob != nullptr);
+        QCOMPARE(davJob->networkAccessManager(), &nam);
+        QCOMPARE(davJob->userAgent(), "Unit Test");
+        QCOMPARE(davJob->token(), "12345");
+        QVERIFY(davJob->http2Allowed());
+    }
+
+    {
+        QVERIFY(factory.maxBatchSize(JobType::DeleteResourceBatch) > 0);
+        auto job = factory.deleteResourceBatch(&factory);
+        auto davJob = qobject_cast<DropboxDeleteBatchJob*>(job);
+        QVERIFY(davJob != nullptr);
+        QCOMPARE(davJob->networkAccessManager(), &nam);
+        QCOMPARE(davJob->userAgent(), "Unit Test");
+        QCOMPARE(davJob->token(), "12345");
+        QVERIFY(davJob->http2Allowed());
+    }
+
+    {
+        QVERIFY(factory.maxBatchSize(JobType::UploadFileBatch) > 0);
+        auto job = factory.uploadFileBatch(&factory);
+        auto davJob = qobject_cast<DropboxUploadFileBatchJob*>(job);
+        QVERIFY(davJob != nullptr);
+        QCOMPARE(davJob->networkAccessManager(), &nam);
+        QCOMPARE(davJob->userAgent(), "Unit Test");
+        QCOMPARE(davJob->token(), "12345");
+        QVERIFY(davJob->http2Allowed());
     }
 }
 
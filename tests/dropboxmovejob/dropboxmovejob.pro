@@ -0,0 +1,2 @@
+TESTNAME = dropboxmovejob
+include(../test.pri)
@@ -0,0 +1,153 @@
+#include <QSignalSpy>
+#include <QtTest>
+
+// add necessary includes here
+#include "../shared/fakedropboxserver.h"
+#include "../shared/utils.h"
+#include "SynqClient/DropboxMoveJob"
+
+using SynqClient::DropboxMoveJob;
+using SynqClient::JobError;
+using SynqClient::UnitTest::FakeDropboxServer;
+using SynqClient::UnitTest::RedirectingNetworkAccessManager;
+
+class DropboxMoveJobTest : public QObject
+{
+    Q_OBJECT
+
+public:
+    DropboxMoveJobTest();
+    ~DropboxMoveJobTest();
+
+private slots:
+    void initTestCase();
+    void missingParameters();
+    void moveFile();
+    void moveFolder();
+    void errors();
+    void overwrite();
+    void cleanupTestCase();
+
+private:
+    static bool runJob(DropboxMoveJob& job, JobError expectedError = JobError::NoError);
+};
+
+DropboxMoveJobTest::DropboxMoveJobTest() {}
+
+DropboxMoveJobTest::~DropboxMoveJobTest() {}
+
+void DropboxMoveJobTest::initTestCase() {}
+
+void DropboxMoveJobTest::missingParameters()
+{
+    FakeDropboxServer server;
+    QVERIFY(server.listen());
+    RedirectingNetworkAccessManager nam(server.serverUrl());
+
+    DropboxMoveJob job;
+    job.setNetworkAccessManager(&nam);
+    job.setToken("fake-token");
+    job.setPath("/foo.txt");
+    QVERIFY(runJob(job, JobError::MissingParameter));
+    QCOMPARE(server.numRequests(), 0);
+}
+
+void DropboxMoveJobTest::moveFile()
+{
+    FakeDropboxServer server;
+    QVERIFY(server.listen());
+    server.putFile("/dir/hello.txt", "Hello World!\n");
+    RedirectingNetworkAccessManager nam(server.serverUrl());
+
+    DropboxMoveJob job;
+    job.setNetworkAccessManager(&nam);
+    job.setToken("fake-token");
+    job.setPath("/dir/hello.txt");
+    job.setTargetPath("/other/renamed.txt");
+    QVERIFY(runJob(job));
+    QVERIFY(!server.exists("/dir/hello.txt"));
+    QCOMPARE(server.fileData("/other/renamed.txt"), QByteArray("Hello World!\n"));
+    QCOMPARE(job.fileInfo().name(), QString("renamed.txt"));
+    QVERIFY(!job.fileInfo().syncAttribute().isEmpty());
+}
+
+void DropboxMoveJobTest::moveFolder()
+{
+    FakeDropboxServer server;
+    QVERIFY(server.listen());
+    server.putFile("/dir/sub/a.txt", "A");
+    server.putFile("/dir/b.txt", "B");
+    RedirectingNetworkAccessManager nam(server.serverUrl());
+
+    DropboxMoveJob job;
+    job.setNetworkAccessManager(&nam);
+    job.setToken("fake-token");
+    job.setPath("/dir");
+    job.setTargetPath("/renamed");
+    QVERIFY(runJob(job));
+    QVERIFY(!server.exists("/dir"));
+    QVERIFY(server.isDirectory("/renamed/sub"));
+    QCOMPARE(server.fileData("/renamed/sub/a.txt"), QByteArray("A"));
+    QCOMPARE(server.fileData("/renamed/b.txt"), QByteArray("B"));
+}
+
+void DropboxMoveJobTest::errors()
+{
+    FakeDropboxServer server;
+    QVERIFY(server.listen());
+    server.putFile("/a.txt", "A");
+    server.putFile("/b.txt", "B");
+    RedirectingNetworkAccessManager nam(server.serverUrl());
+
+    auto move = [&](const QString& path, const QString& targetPath, JobError expectedError) {
+        DropboxMoveJob job;
+        job.setNetworkAccessManager(&nam);
+        job.setToken("fake-token");
+        job.setPath(path);
+        job.setTargetPath(targetPath);
+        return runJob(job, expectedError);
+    };
+
+    QVERIFY(move("/missing.txt", "/c.txt", JobError::ResourceNotFound));
+    QVERIFY(move("/a.txt", "/b.txt", JobError::ResourceExists));
+
+    // Nothing has been changed by the failed moves:
+    QCOMPARE(server.fileData("/a.txt"), QByteArray("A"));
+    QCOMPARE(server.fileData("/b.txt"), QByteArray("B"));
+    QVERIFY(!server.exists("/c.txt"));
+}
+
+void DropboxMoveJobTest::overwrite()
+{
+    FakeDropboxServer server;
+    QVERIFY(server.listen());
+    server.putFile("/a.txt", "A");
+    server.putFile("/b.txt", "B");
+    RedirectingNetworkAccessManager nam(server.serverUrl());
+
+    // Dropbox cannot replace targets, so the job removes the target first:
+    DropboxMoveJob job;
+    job.setNetworkAccessManager(&nam);
+    job.setToken("fake-token");
+    job.setPath("/a.txt");
+    job.setTargetPath("/b.txt");
+    job.setOverwrite(true);
+    QVERIFY(runJob(job));
+    QVERIFY(!server.exists("/a.txt"));
+    QCOMPARE(server.fileData("/b.txt"), QByteArray("A"));
+}
+
+void DropboxMoveJobTest::cleanupTestCase() {}
+
+bool DropboxMoveJobTest::runJob(DropboxMoveJob& job, JobError expectedError)
+{
+    QSignalSpy finished(&job, &DropboxMoveJob::finished);
+    job.start();
+    SQ_VERIFY(finished.wait());
+    SQ_COMPARE(job.error(), expectedError);
+    return true;
+}
+
+QTEST_MAIN(DropboxMoveJobTest)
+
+#include "tst_dropboxmovejob.moc"
@@ -0,0 +1,2 @@
+TESTNAME = dropboxuploadfilebatchjob
+include(../test.pri)
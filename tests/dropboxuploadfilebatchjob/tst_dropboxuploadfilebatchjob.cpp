@@ -0,0 +1,158 @@
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <QtTest>
+
+// add necessary includes here
+#include "../shared/fakedropboxserver.h"
+#include "../shared/utils.h"
+#include "SynqClient/DropboxUploadFileBatchJob"
+
+using SynqClient::DropboxUploadFileBatchJob;
+using SynqClient::JobError;
+using SynqClient::UnitTest::createFiles;
+using SynqClient::UnitTest::FakeDropboxServer;
+using SynqClient::UnitTest::RedirectingNetworkAccessManager;
+
+class DropboxUploadFileBatchJobTest : public QObject
+{
+    Q_OBJECT
+
+public:
+    DropboxUploadFileBatchJobTest();
+    ~DropboxUploadFileBatchJobTest();
+
+private slots:
+    void initTestCase();
+    void uploadBatch();
+    void conditionalUploads();
+    void parallelUploads();
+    void parallelUploads_data();
+    void cleanupTestCase();
+
+private:
+    static bool runJob(DropboxUploadFileBatchJob& job);
+};
+
+DropboxUploadFileBatchJobTest::DropboxUploadFileBatchJobTest() {}
+
+DropboxUploadFileBatchJobTest::~DropboxUploadFileBatchJobTest() {}
+
+void DropboxUploadFileBatchJobTest::initTestCase() {}
+
+void DropboxUploadFileBatchJobTest::uploadBatch()
+{
+    FakeDropboxServer server;
+    QVERIFY(server.listen());
+    QTemporaryDir tmpDir;
+    QVERIFY(createFiles(tmpDir.path(), 5));
+    RedirectingNetworkAccessManager nam(server.serverUrl());
+
+    DropboxUploadFileBatchJob job;
+    job.setNetworkAccessManager(&nam);
+    job.setToken("fake-token");
+    for (int i = 0; i < 5; ++i) {
+        job.addFile(tmpDir.filePath(QString("file-%1.txt").arg(i)),
+                    QString("/folder/file-%1.txt").arg(i));
+    }
+    job.addFile(tmpDir.filePath("does-not-exist.txt"), "/folder/missing.txt");
+    QVERIFY(runJob(job));
+
+    // One upload session per file, committed within a single request:
+    QCOMPARE(server.numRequests("POST"), 6);
+    QCOMPARE(job.failedEntries(), QStringList({ "/folder/missing.txt" }));
+    QCOMPARE(job.entryError("/folder/missing.txt"), JobError::InvalidParameter);
+    for (int i = 0; i < 5; ++i) {
+        auto remoteFilename = QString("/folder/file-%1.txt").arg(i);
+        QCOMPARE(server.fileData(remoteFilename), QByteArray::number(i));
+        QCOMPARE(job.fileInfo(remoteFilename).name(), QString("file-%1.txt").arg(i));
+        QVERIFY(!job.fileInfo(remoteFilename).syncAttribute().isEmpty());
+    }
+    QVERIFY(!server.exists("/folder/missing.txt"));
+}
+
+void DropboxUploadFileBatchJobTest::conditionalUploads()
+{
+    FakeDropboxServer server;
+    QVERIFY(server.listen());
+    QTemporaryDir tmpDir;
+    QVERIFY(createFiles(tmpDir.path(), 3));
+    RedirectingNetworkAccessManager nam(server.serverUrl());
+
+    QString syncAttribute;
+    {
+        DropboxUploadFileBatchJob job;
+        job.setNetworkAccessManager(&nam);
+        job.setToken("fake-token");
+        job.addFile(tmpDir.filePath("file-0.txt"), "/file-0.txt");
+        job.addFile(tmpDir.filePath("file-1.txt"), "/file-1.txt");
+        QVERIFY(runJob(job));
+        QVERIFY(job.failedEntries().isEmpty());
+        syncAttribute = job.fileInfo("/file-0.txt").syncAttribute();
+    }
+
+    {
+        DropboxUploadFileBatchJob job;
+        job.setNetworkAccessManager(&nam);
+        job.setToken("fake-token");
+        job.addFile(tmpDir.filePath("file-2.txt"), "/file-0.txt", syncAttribute);
+        job.addFile(tmpDir.filePath("file-2.txt"), "/file-1.txt", "0123456789abcdef");
+        QVERIFY(runJob(job));
+        QCOMPARE(job.entryError("/file-0.txt"), JobError::NoError);
+        QCOMPARE(job.entryError("/file-1.txt"), JobError::SyncAttributeMismatch);
+        QCOMPARE(server.fileData("/file-0.txt"), QByteArray("2"));
+        QCOMPARE(server.fileData("/file-1.txt"), QByteArray("1"));
+    }
+}
+
+void DropboxUploadFileBatchJobTest::parallelUploads()
+{
+    QFETCH(int, maxParallelUploads);
+
+    FakeDropboxServer server;
+    server.setLatency(50);
+    QVERIFY(server.listen());
+    QTemporaryDir tmpDir;
+    QVERIFY(createFiles(tmpDir.path(), 8));
+    RedirectingNetworkAccessManager nam(server.serverUrl());
+
+    DropboxUploadFileBatchJob job;
+    job.setNetworkAccessManager(&nam);
+    job.setToken("fake-token");
+    QCOMPARE(job.maxParallelUploads(), 1);
+    job.setMaxParallelUploads(maxParallelUploads);
+    for (int i = 0; i < 8; ++i) {
+        job.addFile(tmpDir.filePath(QString("file-%1.txt").arg(i)),
+                    QString("/file-%1.txt").arg(i));
+    }
+    QVERIFY(runJob(job));
+    QVERIFY(job.failedEntries().isEmpty());
+    QCOMPARE(server.numRequests("POST"), 9);
+    QVERIFY(server.maxParallelRequests() <= maxParallelUploads);
+    QVERIFY(maxParallelUploads == 1 || server.maxParallelRequests() > 1);
+    for (int i = 0; i < 8; ++i) {
+        QCOMPARE(server.fileData(QString("/file-%1.txt").arg(i)), QByteArray::number(i));
+    }
+}
+
+void DropboxUploadFileBatchJobTest::parallelUploads_data()
+{
+    QTest::addColumn<int>("maxParallelUploads");
+
+    QTest::newRow("Sequential") << 1;
+    QTest::newRow("Parallel") << 3;
+}
+
+void DropboxUploadFileBatchJobTest::cleanupTestCase() {}
+
+bool DropboxUploadFileBatchJobTest::runJob(DropboxUploadFileBatchJob& job)
+{
+    QSignalSpy finished(&job, &DropboxUploadFileBatchJob::finished);
+    job.start();
+    SQ_VERIFY(finished.wait());
+    SQ_COMPARE(job.error(), JobError::NoError);
+    return true;
+}
+
+QTEST_MAIN(DropboxUploadFileBatchJobTest)
+
+#include "tst_dropboxuploadfilebatchjob.moc"
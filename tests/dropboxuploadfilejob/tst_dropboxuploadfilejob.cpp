@@ -1,6 +1,9 @@
+#include <QCryptographicHash>
+#include <QTemporaryDir>
 #include <QtTest>
 
 // add necessary includes here
+#include "../shared/fakedropboxserver.h"
 #include "../shared/utils.h"
 #include "SynqClient/DropboxCreateDirectoryJob"
 #include "SynqClient/DropboxGetFileInfoJob"
@@ -10,6 +13,9 @@ using SynqClient::DropboxCreateDirectoryJob;
 using SynqClient::DropboxGetFileInfoJob;
 using SynqClient::DropboxUploadFileJob;
 using SynqClient::JobError;
+using SynqClient::UnitTest::createLargeData;
+using SynqClient::UnitTest::FakeDropboxServer;
+using SynqClient::UnitTest::RedirectingNetworkAccessManager;
 
 class DropboxUploadFileJobTest : public QObject
 {
@@ -25,6 +31,7 @@ private slots:
     void uploadDevice();
     void uploadData();
     void uploadSyncAttribute();
+    void uploadLargeFile();
     void cleanupTestCase();
 };
 
@@ -224,6 +231,11 @@ void DropboxUploadFileJobTest::uploadSyncAttribute()
         QCOMPARE(job.errorString(), QString());
         QCOMPARE(job.error(), JobError::NoError);
         originalEtag = job.fileInfo().syncAttribute();
+
+        // The content hash of small files is the SHA-256 of the SHA-256 of their content:
+        auto blockHash = QCryptographicHash::hash("Hello World!\n", QCryptographicHash::Sha256);
+        auto contentHash = QCryptographicHash::hash(blockHash, QCryptographicHash::Sha256);
+        QCOMPARE(job.fileInfo().checksum("DROPBOX"), QString::fromLatin1(contentHash.toHex()));
     }
 
     {
@@ -256,6 +268,37 @@ void DropboxUploadFileJobTest::uploadSyncAttribute()
     }
 }
 
+void DropboxUploadFileJobTest::uploadLargeFile()
+{
+    FakeDropboxServer server;
+    QVERIFY(server.listen());
+    RedirectingNetworkAccessManager nam(server.serverUrl());
+
+    // The content hash is built from 4 MiB blocks - use a file spanning several, the last one
+    // being incomplete:
+    auto data = createLargeData(9 * 1024 * 1024 + 123);
+    QTemporaryDir tmpDir;
+    auto localFileName = tmpDir.filePath("large.dat");
+    {
+        QFile localFile(localFileName);
+        QVERIFY(localFile.open(QIODevice::WriteOnly));
+        QCOMPARE(localFile.write(data), qint64(data.size()));
+    }
+
+    DropboxUploadFileJob job;
+    job.setNetworkAccessManager(&nam);
+    job.setToken("fake-token");
+    job.setLocalFilename(localFileName);
+    job.setRemoteFilename("/large.dat");
+    QSignalSpy spy(&job, &DropboxUploadFileJob::finished);
+    job.start();
+    QVERIFY(spy.wait(30000));
+    QCOMPARE(job.errorString(), QString());
+    QCOMPARE(job.error(), JobError::NoError);
+    QCOMPARE(server.fileData("/large.dat"), data);
+    QCOMPARE(job.fileInfo().checksum("DROPBOX"), FakeDropboxServer::contentHash(data));
+}
+
 void DropboxUploadFileJobTest::cleanupTestCase() {}
 
 QTEST_MAIN(DropboxUploadFileJobTest)
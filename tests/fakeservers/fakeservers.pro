@@ -0,0 +1,2 @@
+TESTNAME = fakeservers
+include(../test.pri)
@@ -0,0 +1,465 @@
+#include <QElapsedTimer>
+#include <QFile>
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <QtTest>
+
+// add necessary includes here
+#include "../shared/fakedropboxserver.h"
+#include "../shared/fakewebdavserver.h"
+#include "../shared/utils.h"
+#include "SynqClient/CreateDirectoryJob"
+#include "SynqClient/DeleteJob"
+#include "SynqClient/DirectorySynchronizer"
+#include "SynqClient/DownloadFileJob"
+#include "SynqClient/DropboxJobFactory"
+#include "SynqClient/GetFileInfoJob"
+#include "SynqClient/JSONSyncStateDatabase"
+#include "SynqClient/ListFilesJob"
+#include "SynqClient/UploadFileJob"
+#include "SynqClient/WebDAVJobFactory"
+
+using SynqClient::AbstractJobFactory;
+using SynqClient::DirectorySynchronizer;
+using SynqClient::DropboxJobFactory;
+using SynqClient::JobError;
+using SynqClient::JSONSyncStateDatabase;
+using SynqClient::SynchronizerError;
+using SynqClient::SynchronizerState;
+using SynqClient::WebDAVJobFactory;
+using SynqClient::WebDAVServerType;
+using SynqClient::WebDAVWorkaround;
+using SynqClient::WebDAVWorkarounds;
+using SynqClient::UnitTest::FakeDropboxServer;
+using SynqClient::UnitTest::FakeHttpServer;
+using SynqClient::UnitTest::FakeWebDAVServer;
+using SynqClient::UnitTest::RedirectingNetworkAccessManager;
+
+namespace {
+
+/**
+ * @brief A WebDAV server rejecting all uploads.
+ */
+class FailingUploadsServer : public FakeWebDAVServer
+{
+protected:
+    Response handleRequest(const Request& request) override
+    {
+        if (request.method == "PUT") {
+            return Response(500);
+        }
+        return FakeWebDAVServer::handleRequest(request);
+    }
+};
+
+} // namespace
+
+class FakeServersTest : public QObject
+{
+    Q_OBJECT
+
+public:
+    FakeServersTest();
+    ~FakeServersTest();
+
+private slots:
+    void initTestCase();
+    void webdavJobs();
+    void webdavJobs_data();
+    void webdavQuirks();
+    void webdavQuirks_data();
+    void webdavServerTestCleanup();
+    void tooManyRequests();
+    void latencyAndBandwidth();
+    void directorySynchronizer();
+    void directorySynchronizer_data();
+    void serverSideCopies();
+    void serverSideCopies_data();
+    void cleanupTestCase();
+
+private:
+    bool runJob(SynqClient::AbstractJob* job);
+    bool syncDir(const QString& localPath, const QString& syncDbPath,
+                 AbstractJobFactory* jobFactory);
+    bool writeFile(const QString& fileName, const QByteArray& data) const;
+    QByteArray readFile(const QString& fileName) const;
+};
+
+FakeServersTest::FakeServersTest() {}
+
+FakeServersTest::~FakeServersTest() {}
+
+void FakeServersTest::initTestCase() {}
+
+void FakeServersTest::webdavJobs()
+{
+    QFETCH(WebDAVServerType, type);
+
+    FakeWebDAVServer server(type);
+    QVERIFY(server.listen());
+    QNetworkAccessManager nam;
+    WebDAVJobFactory factory;
+    factory.setNetworkAccessManager(&nam);
+    factory.setServerType(type);
+    factory.setUrl(server.url());
+
+    {
+        auto job = factory.createDirectory(&factory);
+        job->setPath("/folder");
+        QVERIFY(runJob(job));
+        QVERIFY(server.isDirectory("/folder"));
+    }
+
+    {
+        auto job = factory.uploadFile(&factory);
+        job->setRemoteFilename("/folder/file.txt");
+        job->setData("Hello World");
+        QVERIFY(runJob(job));
+        QCOMPARE(server.fileData("/folder/file.txt"), QByteArray("Hello World"));
+    }
+
+    {
+        auto job = factory.getFileInfo(&factory);
+        job->setPath("/folder/file.txt");
+        QVERIFY(runJob(job));
+        QVERIFY(job->fileInfo().isFile());
+        QCOMPARE(job->fileInfo().size(), qint64(11));
+        if (type != WebDAVServerType::Generic) {
+            QVERIFY(!job->fileInfo().fileId().isEmpty());
+            QCOMPARE(job->fileInfo().checksum("SHA1"),
+                     QString::fromUtf8(QCryptographicHash::hash("Hello World",
+                                                                QCryptographicHash::Sha1)
+                                               .toHex()));
+        }
+    }
+
+    {
+        auto job = factory.listFiles(&factory);
+        job->setPath("/folder");
+        QVERIFY(runJob(job));
+        QCOMPARE(job->entries().length(), 1);
+        QCOMPARE(job->entries().at(0).name(), QString("file.txt"));
+    }
+
+    {
+        auto job = factory.downloadFile(&factory);
+        job->setRemoteFilename("/folder/file.txt");
+        QVERIFY(runJob(job));
+        QCOMPARE(job->data(), QByteArray("Hello World"));
+    }
+
+    {
+        auto job = factory.deleteResource(&factory);
+        job->setPath("/folder");
+        QVERIFY(runJob(job));
+        QVERIFY(!server.exists("/folder"));
+        QVERIFY(!server.exists("/folder/file.txt"));
+    }
+
+    QCOMPARE(server.numTooManyRequests(), 0);
+    QCOMPARE(server.numRequests("PUT"), 1);
+}
+
+void FakeServersTest::webdavJobs_data()
+{
+    QTest::addColumn<WebDAVServerType>("type");
+
+    QTest::newRow("Generic") << WebDAVServerType::Generic;
+    QTest::newRow("NextCloud") << WebDAVServerType::NextCloud;
+}
+
+void FakeServersTest::webdavQuirks()
+{
+    QFETCH(int, quirks);
+    QFETCH(int, expectedWorkarounds);
+    QFETCH(bool, syncCollection);
+
+    FakeWebDAVServer server;
+    server.setQuirks(static_cast<WebDAVWorkarounds>(quirks));
+    server.setSyncCollectionSupported(syncCollection);
+    QVERIFY(server.listen());
+    QNetworkAccessManager nam;
+    WebDAVJobFactory factory;
+    factory.setNetworkAccessManager(&nam);
+    factory.setUrl(server.url());
+
+    QSignalSpy serverTestFinished(&factory, &WebDAVJobFactory::serverTestFinished);
+    factory.testServer();
+    QVERIFY(serverTestFinished.wait());
+    QCOMPARE(serverTestFinished.at(0).at(0).toBool(), true);
+    QCOMPARE(factory.workarounds(), static_cast<WebDAVWorkarounds>(expectedWorkarounds));
+    QCOMPARE(factory.syncCollectionSupported(), syncCollection);
+
+    // The test only reports sync-collection support, it does not switch the mode:
+    QVERIFY(!factory.syncCollectionEnabled());
+
+    // The temporary folder has been removed:
+    auto job = factory.listFiles(&factory);
+    job->setPath("/");
+    QVERIFY(runJob(job));
+    QCOMPARE(job->entries().length(), 0);
+}
+
+void FakeServersTest::webdavQuirks_data()
+{
+    QTest::addColumn<int>("quirks");
+    QTest::addColumn<int>("expectedWorkarounds");
+    QTest::addColumn<bool>("syncCollection");
+
+    auto noRecursiveFolderETags = static_cast<int>(WebDAVWorkaround::NoRecursiveFolderETags);
+    auto inconsistentETags =
+            static_cast<int>(WebDAVWorkaround::InconsistentETagsUsingPROPFINDAndGET);
+    auto apacheETags =
+            static_cast<int>(WebDAVWorkaround::DerivePROPFINDETagsFromGETETagsForApache);
+
+    QTest::newRow("No quirks") << 0 << 0 << false;
+    QTest::newRow("Sync Collection") << 0 << 0 << true;
+    QTest::newRow("No recursive folder ETags")
+            << noRecursiveFolderETags << noRecursiveFolderETags << false;
+    QTest::newRow("Inconsistent ETags") << inconsistentETags << inconsistentETags << false;
+    QTest::newRow("Apache ETags") << apacheETags << (inconsistentETags | apacheETags) << false;
+}
+
+void FakeServersTest::webdavServerTestCleanup()
+{
+    FailingUploadsServer server;
+    server.setSyncCollectionSupported(true);
+    QVERIFY(server.listen());
+    QNetworkAccessManager nam;
+    WebDAVJobFactory factory;
+    factory.setNetworkAccessManager(&nam);
+    factory.setUrl(server.url());
+
+    QSignalSpy serverTestFinished(&factory, &WebDAVJobFactory::serverTestFinished);
+    factory.testServer();
+    QVERIFY(serverTestFinished.wait());
+    QCOMPARE(serverTestFinished.at(0).at(0).toBool(), false);
+    QVERIFY(!factory.syncCollectionSupported());
+    QCOMPARE(server.numRequests("DELETE"), 1);
+
+    // Even though the test failed, the temporary folder has been removed:
+    auto job = factory.listFiles(&factory);
+    job->setPath("/");
+    QVERIFY(runJob(job));
+    QCOMPARE(job->entries().length(), 0);
+}
+
+void FakeServersTest::tooManyRequests()
+{
+    FakeWebDAVServer server;
+    server.setTooManyRequestsInterval(2);
+    server.setRetryAfter(1);
+    QVERIFY(server.listen());
+    QNetworkAccessManager nam;
+    WebDAVJobFactory factory;
+    factory.setNetworkAccessManager(&nam);
+    factory.setUrl(server.url());
+
+    for (int i = 0; i < 3; ++i) {
+        auto job = factory.uploadFile(&factory);
+        job->setRemoteFilename(QString("/file-%1.txt").arg(i));
+        job->setData("Retry me");
+        QVERIFY(runJob(job));
+        QCOMPARE(server.fileData(QString("/file-%1.txt").arg(i)), QByteArray("Retry me"));
+    }
+    QVERIFY(server.numTooManyRequests() > 0);
+    QCOMPARE(server.numRequests(), 3 + server.numTooManyRequests());
+}
+
+void FakeServersTest::latencyAndBandwidth()
+{
+    FakeWebDAVServer server;
+    server.setLatency(100);
+    server.setBandwidth(100 * 1024);
+    server.putFile("/large.dat", QByteArray(50 * 1024, 'x'));
+    QVERIFY(server.listen());
+    QNetworkAccessManager nam;
+    WebDAVJobFactory factory;
+    factory.setNetworkAccessManager(&nam);
+    factory.setUrl(server.url());
+
+    QElapsedTimer timer;
+    timer.start();
+    auto job = factory.downloadFile(&factory);
+    job->setRemoteFilename("/large.dat");
+    QVERIFY(runJob(job));
+    QCOMPARE(job->data().size(), 50 * 1024);
+    // 100ms latency plus 500ms for the transfer (allowing for some inaccuracy of timers):
+    QVERIFY(timer.elapsed() >= 500);
+    QVERIFY(server.bytesSent() > 50 * 1024);
+    QCOMPARE(server.maxParallelRequests(), 1);
+}
+
+void FakeServersTest::directorySynchronizer()
+{
+    QFETCH(QString, backend);
+
+    QScopedPointer<FakeHttpServer> server;
+    QScopedPointer<QNetworkAccessManager> nam;
+    QScopedPointer<AbstractJobFactory> factory;
+    if (backend == "Dropbox") {
+        server.reset(new FakeDropboxServer);
+        QVERIFY(server->listen());
+        nam.reset(new RedirectingNetworkAccessManager(server->serverUrl()));
+        auto dropboxFactory = new DropboxJobFactory;
+        dropboxFactory->setNetworkAccessManager(nam.data());
+        dropboxFactory->setToken("fake-token");
+        factory.reset(dropboxFactory);
+    } else {
+        auto type = backend == "NextCloud" ? WebDAVServerType::NextCloud
+                                           : WebDAVServerType::Generic;
+        auto webdavServer = new FakeWebDAVServer(type);
+        webdavServer->setSyncCollectionSupported(type == WebDAVServerType::NextCloud);
+        server.reset(webdavServer);
+        QVERIFY(server->listen());
+        nam.reset(new QNetworkAccessManager);
+        auto webdavFactory = new WebDAVJobFactory;
+        webdavFactory->setNetworkAccessManager(nam.data());
+        webdavFactory->setServerType(type);
+        webdavFactory->setUrl(webdavServer->url());
+        webdavFactory->setSyncCollectionEnabled(webdavServer->syncCollectionSupported());
+        factory.reset(webdavFactory);
+    }
+
+    QTemporaryDir tmpDir1;
+    QTemporaryDir tmpDir2;
+    QTemporaryDir metaTmpDir;
+    auto dbPath1 = metaTmpDir.path() + "/syncdb1.json";
+    auto dbPath2 = metaTmpDir.path() + "/syncdb2.json";
+    QVERIFY(writeFile(tmpDir1.path() + "/top/sub/a.txt", "File A\n"));
+    QVERIFY(writeFile(tmpDir1.path() + "/top/b.txt", "File B\n"));
+    QVERIFY(writeFile(tmpDir1.path() + "/c.txt", "File C\n"));
+
+    QVERIFY(syncDir(tmpDir1.path(), dbPath1, factory.data()));
+    QVERIFY(syncDir(tmpDir2.path(), dbPath2, factory.data()));
+    QCOMPARE(readFile(tmpDir2.path() + "/top/sub/a.txt"), QByteArray("File A\n"));
+    QCOMPARE(readFile(tmpDir2.path() + "/top/b.txt"), QByteArray("File B\n"));
+    QCOMPARE(readFile(tmpDir2.path() + "/c.txt"), QByteArray("File C\n"));
+
+    QVERIFY(writeFile(tmpDir2.path() + "/top/b.txt", "File B - edited\n"));
+    QVERIFY(QFile::remove(tmpDir2.path() + "/c.txt"));
+    QVERIFY(writeFile(tmpDir2.path() + "/d.txt", "File D\n"));
+    QVERIFY(syncDir(tmpDir2.path(), dbPath2, factory.data()));
+    QVERIFY(syncDir(tmpDir1.path(), dbPath1, factory.data()));
+    QCOMPARE(readFile(tmpDir1.path() + "/top/b.txt"), QByteArray("File B - edited\n"));
+    QVERIFY(!QFile::exists(tmpDir1.path() + "/c.txt"));
+    QCOMPARE(readFile(tmpDir1.path() + "/d.txt"), QByteArray("File D\n"));
+}
+
+void FakeServersTest::directorySynchronizer_data()
+{
+    QTest::addColumn<QString>("backend");
+
+    QTest::newRow("Generic") << "Generic";
+    QTest::newRow("NextCloud") << "NextCloud";
+    QTest::newRow("Dropbox") << "Dropbox";
+}
+
+void FakeServersTest::serverSideCopies()
+{
+    QFETCH(WebDAVServerType, type);
+
+    FakeWebDAVServer server(type);
+    QVERIFY(server.listen());
+    QNetworkAccessManager nam;
+    WebDAVJobFactory factory;
+    factory.setNetworkAccessManager(&nam);
+    factory.setServerType(type);
+    factory.setUrl(server.url());
+
+    // The uploaded file gets its checksum from the upload. The fake server does not report
+    // checksums for downloads, so the downloaded one is hashed only when looking for copies:
+    QByteArray uploadedData(100 * 1024, 'u');
+    QByteArray downloadedData(100 * 1024, 'd');
+    server.putFile("/sync/downloaded.dat", downloadedData);
+    QTemporaryDir tmpDir;
+    QTemporaryDir metaTmpDir;
+    auto dbPath = metaTmpDir.path() + "/syncdb.json";
+    QVERIFY(writeFile(tmpDir.path() + "/uploaded.dat", uploadedData));
+    QVERIFY(syncDir(tmpDir.path(), dbPath, &factory));
+    QCOMPARE(readFile(tmpDir.path() + "/downloaded.dat"), downloadedData);
+
+    QVERIFY(writeFile(tmpDir.path() + "/copies/uploaded.dat", uploadedData));
+    QVERIFY(writeFile(tmpDir.path() + "/copies/downloaded.dat", downloadedData));
+    server.resetStatistics();
+    QVERIFY(syncDir(tmpDir.path(), dbPath, &factory));
+    QCOMPARE(server.numRequests("COPY"), 2);
+    QCOMPARE(server.numRequests("PUT"), 0);
+    QCOMPARE(server.fileData("/sync/copies/uploaded.dat"), uploadedData);
+    QCOMPARE(server.fileData("/sync/copies/downloaded.dat"), downloadedData);
+
+    // The copies carry a fingerprint as well, so they can be the source of further copies:
+    QVERIFY(QFile::remove(tmpDir.path() + "/uploaded.dat"));
+    QVERIFY(QFile::remove(tmpDir.path() + "/downloaded.dat"));
+    QVERIFY(writeFile(tmpDir.path() + "/more/uploaded.dat", uploadedData));
+    server.resetStatistics();
+    QVERIFY(syncDir(tmpDir.path(), dbPath, &factory));
+    QCOMPARE(server.numRequests("COPY"), 1);
+    QCOMPARE(server.numRequests("PUT"), 0);
+    QVERIFY(!server.exists("/sync/uploaded.dat"));
+    QCOMPARE(server.fileData("/sync/more/uploaded.dat"), uploadedData);
+}
+
+void FakeServersTest::serverSideCopies_data()
+{
+    QTest::addColumn<WebDAVServerType>("type");
+
+    QTest::newRow("Generic") << WebDAVServerType::Generic;
+    QTest::newRow("NextCloud") << WebDAVServerType::NextCloud;
+}
+
+void FakeServersTest::cleanupTestCase() {}
+
+bool FakeServersTest::runJob(SynqClient::AbstractJob* job)
+{
+    QSignalSpy finished(job, &SynqClient::AbstractJob::finished);
+    job->start();
+    SQ_VERIFY(finished.wait());
+    SQ_COMPARE(job->error(), JobError::NoError);
+    return true;
+}
+
+bool FakeServersTest::syncDir(const QString& localPath, const QString& syncDbPath,
+                              AbstractJobFactory* jobFactory)
+{
+    JSONSyncStateDatabase syncDb(syncDbPath);
+    DirectorySynchronizer sync_;
+    sync_.setJobFactory(jobFactory);
+    sync_.setLocalDirectoryPath(localPath);
+    sync_.setRemoteDirectoryPath("/sync");
+    sync_.setSyncStateDatabase(&syncDb);
+    sync_.start();
+    QSignalSpy spy(&sync_, &DirectorySynchronizer::finished);
+    SQ_VERIFY(spy.wait(60000));
+    SQ_COMPARE(sync_.state(), SynchronizerState::Finished);
+    SQ_COMPARE(sync_.errorString(), QString());
+    SQ_COMPARE(sync_.error(), SynchronizerError::NoError);
+    return true;
+}
+
+bool FakeServersTest::writeFile(const QString& fileName, const QByteArray& data) const
+{
+    QFileInfo fi(fileName);
+    if (fi.dir().mkpath(".")) {
+        QFile file(fileName);
+        if (file.open(QIODevice::WriteOnly)) {
+            file.write(data);
+            file.close();
+            return true;
+        }
+    }
+    return false;
+}
+
+QByteArray FakeServersTest::readFile(const QString& fileName) const
+{
+    QFile file(fileName);
+    if (file.open(QIODevice::ReadOnly)) {
+        return file.readAll();
+    }
+    return QByteArray();
+}
+
+QTEST_MAIN(FakeServersTest)
+
+#include "tst_fakeservers.moc"
@@ -0,0 +1,12 @@
+TESTNAME = hashingdevice
+include(../test.pri)
+
+# The classes under test are internal to the library (and hence not exported from it), so
+# compile them right into the test:
+SOURCES += \
+    ../../libsynqclient/src/contenthasher.cpp \
+    ../../libsynqclient/src/hashingdevice.cpp
+HEADERS += \
+    ../../libsynqclient/src/contenthasher.h \
+    ../../libsynqclient/src/hashingdevice.h
+INCLUDEPATH += $$PWD/../../libsynqclient/src
@@ -0,0 +1,191 @@
+#include <QBuffer>
+#include <QCryptographicHash>
+#include <QSharedPointer>
+#include <QTemporaryDir>
+#include <QtTest>
+
+#include "../shared/fakedropboxserver.h"
+#include "../shared/utils.h"
+#include "contenthasher.h"
+#include "hashingdevice.h"
+
+using SynqClient::ContentHasher;
+using SynqClient::HashingDevice;
+using SynqClient::UnitTest::createLargeData;
+using SynqClient::UnitTest::FakeDropboxServer;
+
+// A buffer which returns only a few bytes per read, like a device waiting for the network:
+class TricklingBuffer : public QBuffer
+{
+public:
+    TricklingBuffer(const QByteArray& data, qint64 maxReadSize)
+        : QBuffer(), m_maxReadSize(maxReadSize)
+    {
+        setData(data);
+        open(QIODevice::ReadOnly | QIODevice::Unbuffered);
+    }
+
+protected:
+    qint64 readData(char* data, qint64 maxSize) override
+    {
+        return QBuffer::readData(data, qMin(maxSize, m_maxReadSize));
+    }
+
+private:
+    qint64 m_maxReadSize;
+};
+
+class HashingDeviceTest : public QObject
+{
+    Q_OBJECT
+
+public:
+    HashingDeviceTest();
+    ~HashingDeviceTest();
+
+private slots:
+    void initTestCase();
+    void partialReads();
+    void seekBackwards();
+    void seekForwards();
+    void incompleteRead();
+    void dropboxContentHash();
+    void hashFile();
+    void cleanupTestCase();
+
+private:
+    QByteArray readAll(HashingDevice* device, const QVector<qint64>& chunkSizes);
+    QByteArray read(HashingDevice* device, qint64 size);
+    QString sha1(const QByteArray& data);
+};
+
+HashingDeviceTest::HashingDeviceTest() {}
+
+HashingDeviceTest::~HashingDeviceTest() {}
+
+void HashingDeviceTest::initTestCase() {}
+
+void HashingDeviceTest::partialReads()
+{
+    auto data = createLargeData(100 * 1024 + 7);
+    auto source = QSharedPointer<QIODevice>(new TricklingBuffer(data, 1000));
+    HashingDevice device(source, ContentHasher::SHA1);
+    QCOMPARE(device.algorithm(), QString(ContentHasher::SHA1));
+    QCOMPARE(device.size(), qint64(data.size()));
+    QCOMPARE(readAll(&device, { 1, 4096, 333, 1000, 65536 }), data);
+    QVERIFY(device.atEnd());
+    QCOMPARE(device.result(), sha1(data));
+}
+
+void HashingDeviceTest::seekBackwards()
+{
+    auto data = createLargeData(10 * 1024);
+    auto source = QSharedPointer<QIODevice>(new TricklingBuffer(data, 1000));
+    HashingDevice device(source, ContentHasher::SHA1);
+
+    // Re-reading data (as e.g. done when a request is restarted) must not hash it twice:
+    QCOMPARE(read(&device, 2000), data.left(2000));
+    QVERIFY(device.seek(500));
+    QCOMPARE(read(&device, 1000), data.mid(500, 1000));
+    QVERIFY(device.seek(0));
+    QCOMPARE(readAll(&device, { 777 }), data);
+    QCOMPARE(device.result(), sha1(data));
+}
+
+void HashingDeviceTest::seekForwards()
+{
+    auto data = createLargeData(10 * 1024);
+    auto source = QSharedPointer<QIODevice>(new TricklingBuffer(data, 1000));
+    HashingDevice device(source, ContentHasher::SHA1);
+
+    // Skipping data makes the checksum unavailable, even if the device is read to the end:
+    QCOMPARE(read(&device, 1000), data.left(1000));
+    QVERIFY(device.seek(2000));
+    QCOMPARE(readAll(&device, { 1000 }), data.mid(2000));
+    QVERIFY(device.result().isEmpty());
+
+    // ... and even if the skipped data is read afterwards:
+    QVERIFY(device.seek(0));
+    QCOMPARE(readAll(&device, { 1000 }), data);
+    QVERIFY(device.result().isEmpty());
+}
+
+void HashingDeviceTest::incompleteRead()
+{
+    auto data = createLargeData(10 * 1024);
+    auto source = QSharedPointer<QIODevice>(new TricklingBuffer(data, 1000));
+    HashingDevice device(source, ContentHasher::SHA1);
+    QCOMPARE(read(&device, 5000), data.left(5000));
+    QVERIFY(!device.atEnd());
+    QVERIFY(device.result().isEmpty());
+}
+
+void HashingDeviceTest::dropboxContentHash()
+{
+    // Use a size which is not a multiple of the 4 MiB blocks the content hash is built from and
+    // chunk sizes which don't align with the block boundaries:
+    auto data = createLargeData(9 * 1024 * 1024 + 123);
+    auto source = QSharedPointer<QIODevice>(new TricklingBuffer(data, 100 * 1000));
+    HashingDevice device(source, ContentHasher::Dropbox);
+    QCOMPARE(readAll(&device, { 65536, 12345 }), data);
+    QCOMPARE(device.result(), FakeDropboxServer::contentHash(data));
+
+    ContentHasher hasher(ContentHasher::Dropbox);
+    hasher.addData(data.left(4 * 1024 * 1024));
+    QCOMPARE(hasher.result(), FakeDropboxServer::contentHash(data.left(4 * 1024 * 1024)));
+    hasher.reset();
+    QCOMPARE(hasher.result(), FakeDropboxServer::contentHash(QByteArray()));
+}
+
+void HashingDeviceTest::hashFile()
+{
+    QTemporaryDir tmpDir;
+    auto data = createLargeData(4 * 1024 * 1024 + 1);
+    auto fileName = tmpDir.filePath("large.dat");
+    {
+        QFile file(fileName);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        QCOMPARE(file.write(data), qint64(data.size()));
+    }
+    QCOMPARE(ContentHasher::hashFile(fileName, ContentHasher::Dropbox),
+             FakeDropboxServer::contentHash(data));
+    QCOMPARE(ContentHasher::hashFile(fileName, ContentHasher::SHA1), sha1(data));
+}
+
+void HashingDeviceTest::cleanupTestCase() {}
+
+QByteArray HashingDeviceTest::readAll(HashingDevice* device, const QVector<qint64>& chunkSizes)
+{
+    QByteArray result;
+    int i = 0;
+    while (!device->atEnd()) {
+        auto chunk = device->read(chunkSizes.at(i++ % chunkSizes.size()));
+        if (chunk.isEmpty()) {
+            break;
+        }
+        result.append(chunk);
+    }
+    return result;
+}
+
+QByteArray HashingDeviceTest::read(HashingDevice* device, qint64 size)
+{
+    QByteArray result;
+    while (result.size() < size) {
+        auto chunk = device->read(size - result.size());
+        if (chunk.isEmpty()) {
+            break;
+        }
+        result.append(chunk);
+    }
+    return result;
+}
+
+QString HashingDeviceTest::sha1(const QByteArray& data)
+{
+    return QString::fromLatin1(QCryptographicHash::hash(data, QCryptographicHash::Sha1).toHex());
+}
+
+QTEST_MAIN(HashingDeviceTest)
+
+#include "tst_hashingdevice.moc"
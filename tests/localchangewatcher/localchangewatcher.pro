@@ -0,0 +1,2 @@
+TESTNAME = localchangewatcher
+include(../test.pri)
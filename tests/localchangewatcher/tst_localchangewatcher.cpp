@@ -0,0 +1,243 @@
+#include <QtTest>
+#include <QTemporaryDir>
+
+// add necessary includes here
+#include "SynqClient/LocalChangeWatcher"
+
+using SynqClient::LocalChangeWatcher;
+
+class LocalChangeWatcherTest : public QObject
+{
+    Q_OBJECT
+
+public:
+    LocalChangeWatcherTest();
+    ~LocalChangeWatcherTest();
+
+private slots:
+    void initTestCase();
+    void properties();
+    void watchForChanges();
+    void filter();
+    void persistState();
+    void fallbackWatchesFiles();
+    void fallbackWatchLimit();
+    void cleanupTestCase();
+
+private:
+    static bool writeFile(const QString& path, const QByteArray& data);
+};
+
+LocalChangeWatcherTest::LocalChangeWatcherTest() {}
+
+LocalChangeWatcherTest::~LocalChangeWatcherTest() {}
+
+void LocalChangeWatcherTest::initTestCase() {}
+
+void LocalChangeWatcherTest::properties()
+{
+    LocalChangeWatcher watcher;
+    QVERIFY(!watcher.running());
+    QVERIFY(watcher.fullScanRequired());
+    QVERIFY(watcher.dirtyPaths().isEmpty());
+    QVERIFY(!watcher.exclusiveAccess());
+
+    // Watching a non-existing directory must fail:
+    watcher.setDirectory("/this/path/does/not/exist");
+    watcher.start();
+    QVERIFY(!watcher.running());
+
+    watcher.markDirty("foo/bar/");
+    QCOMPARE(watcher.dirtyPaths(), QSet<QString>({ "/foo/bar" }));
+    watcher.clear();
+    QVERIFY(watcher.dirtyPaths().isEmpty());
+    QVERIFY(!watcher.fullScanRequired());
+    watcher.requestFullScan();
+    QVERIFY(watcher.fullScanRequired());
+}
+
+void LocalChangeWatcherTest::watchForChanges()
+{
+    QTemporaryDir tmpDir;
+    QVERIFY(tmpDir.isValid());
+    QVERIFY(QDir(tmpDir.path()).mkpath("sub/folder"));
+    QVERIFY(writeFile(tmpDir.filePath("sub/folder/file.txt"), "Hello"));
+
+    LocalChangeWatcher watcher;
+    QSignalSpy runningSpy(&watcher, &LocalChangeWatcher::runningChanged);
+    QSignalSpy changedSpy(&watcher, &LocalChangeWatcher::localChanged);
+    watcher.setDirectory(tmpDir.path());
+    watcher.start();
+    QVERIFY(watcher.running());
+    QCOMPARE(runningSpy.count(), 1);
+
+    // Without persisted state, we have to do a full scan first:
+    QVERIFY(watcher.fullScanRequired());
+    watcher.clear();
+    QVERIFY(!watcher.fullScanRequired());
+    QVERIFY(watcher.dirtyPaths().isEmpty());
+
+    // Changing a file marks its folder as dirty:
+    QVERIFY(writeFile(tmpDir.filePath("sub/folder/file.txt"), "Hello World"));
+    QVERIFY(changedSpy.wait());
+    QTRY_VERIFY(watcher.dirtyPaths().contains("/sub/folder"));
+    QVERIFY(!watcher.dirtyPaths().contains("/"));
+    watcher.clear();
+
+    // Creating a folder marks the parent folder dirty and watches the new one:
+    QVERIFY(QDir(tmpDir.path()).mkpath("new-folder"));
+    QTRY_VERIFY(watcher.dirtyPaths().contains("/"));
+    watcher.clear();
+    QTest::qWait(100);
+    watcher.clear();
+    QVERIFY(writeFile(tmpDir.filePath("new-folder/file.txt"), "Hello"));
+    QTRY_VERIFY(watcher.dirtyPaths().contains("/new-folder"));
+    watcher.clear();
+
+    // Deleting a file marks its folder as dirty:
+    QVERIFY(QFile::remove(tmpDir.filePath("sub/folder/file.txt")));
+    QTRY_VERIFY(watcher.dirtyPaths().contains("/sub/folder"));
+
+    watcher.stop();
+    QVERIFY(!watcher.running());
+    QCOMPARE(runningSpy.count(), 2);
+}
+
+void LocalChangeWatcherTest::filter()
+{
+    QTemporaryDir tmpDir;
+    QVERIFY(tmpDir.isValid());
+    QVERIFY(QDir(tmpDir.path()).mkpath("included"));
+    QVERIFY(QDir(tmpDir.path()).mkpath("excluded"));
+
+    LocalChangeWatcher watcher;
+    watcher.setDirectory(tmpDir.path());
+    watcher.setFilter([](const QString& path, const SynqClient::FileInfo&) {
+        return !path.startsWith("/excluded");
+    });
+    watcher.start();
+    QVERIFY(watcher.running());
+    watcher.clear();
+
+    QVERIFY(writeFile(tmpDir.filePath("excluded/file.txt"), "Hello"));
+    QVERIFY(writeFile(tmpDir.filePath("included/file.txt"), "Hello"));
+    QTRY_VERIFY(watcher.dirtyPaths().contains("/included"));
+    QTest::qWait(100);
+    QVERIFY(!watcher.dirtyPaths().contains("/excluded"));
+}
+
+void LocalChangeWatcherTest::persistState()
+{
+    QTemporaryDir tmpDir;
+    QVERIFY(tmpDir.isValid());
+    QVERIFY(QDir(tmpDir.path()).mkpath("sub"));
+    auto stateFile = tmpDir.filePath("local-changes.json");
+
+    {
+        LocalChangeWatcher watcher;
+        watcher.setDirectory(tmpDir.path());
+        watcher.setStateFile(stateFile);
+        watcher.setExclusiveAccess(true);
+        watcher.start();
+        QVERIFY(watcher.running());
+        QVERIFY(watcher.fullScanRequired());
+        watcher.clear();
+
+        QVERIFY(writeFile(tmpDir.filePath("sub/file.txt"), "Hello"));
+        QTRY_VERIFY(watcher.dirtyPaths().contains("/sub"));
+        watcher.stop();
+
+        // Writing the state file itself must not mark anything as dirty:
+        QCOMPARE(watcher.dirtyPaths(), QSet<QString>({ "/sub" }));
+    }
+
+    {
+        // With exclusive access, the dirty state is restored as is:
+        LocalChangeWatcher watcher;
+        watcher.setDirectory(tmpDir.path());
+        watcher.setStateFile(stateFile);
+        watcher.setExclusiveAccess(true);
+        watcher.start();
+        QVERIFY(!watcher.fullScanRequired());
+        QCOMPARE(watcher.dirtyPaths(), QSet<QString>({ "/sub" }));
+    }
+
+    {
+        // Otherwise, a full scan is required, but dirty paths are still restored:
+        LocalChangeWatcher watcher;
+        watcher.setDirectory(tmpDir.path());
+        watcher.setStateFile(stateFile);
+        watcher.start();
+        QVERIFY(watcher.fullScanRequired());
+        QCOMPARE(watcher.dirtyPaths(), QSet<QString>({ "/sub" }));
+    }
+}
+
+void LocalChangeWatcherTest::fallbackWatchesFiles()
+{
+    // Use the QFileSystemWatcher, forced to poll (so changes of files are not reported as changes
+    // of their folders, like on some platforms):
+    qputenv("SYNQCLIENT_LOCALCHANGEWATCHER_POLL", "1");
+    QTemporaryDir tmpDir;
+    QVERIFY(tmpDir.isValid());
+    QVERIFY(QDir(tmpDir.path()).mkpath("sub"));
+    QVERIFY(writeFile(tmpDir.filePath("sub/file.txt"), "Hello"));
+
+    LocalChangeWatcher watcher;
+    watcher.setDirectory(tmpDir.path());
+    watcher.start();
+    QVERIFY(watcher.running());
+    watcher.clear();
+    QVERIFY(!watcher.fullScanRequired());
+
+    // Editing a file in place marks its folder as dirty:
+    {
+        QFile file(tmpDir.filePath("sub/file.txt"));
+        QVERIFY(file.open(QIODevice::ReadWrite));
+        QVERIFY(file.seek(file.size()));
+        file.write(" World");
+    }
+    QTRY_VERIFY(watcher.dirtyPaths().contains("/sub"));
+    QVERIFY(!watcher.fullScanRequired());
+    qunsetenv("SYNQCLIENT_LOCALCHANGEWATCHER_POLL");
+}
+
+void LocalChangeWatcherTest::fallbackWatchLimit()
+{
+    // If there are too many files to watch, a full scan is required on each sync:
+    qputenv("SYNQCLIENT_LOCALCHANGEWATCHER_POLL", "1");
+    QTemporaryDir tmpDir;
+    QVERIFY(tmpDir.isValid());
+    for (int i = 0; i < 1100; ++i) {
+        QVERIFY(writeFile(tmpDir.filePath(QString("file-%1.txt").arg(i)), "Hello"));
+    }
+
+    LocalChangeWatcher watcher;
+    watcher.setDirectory(tmpDir.path());
+    watcher.start();
+    QVERIFY(watcher.running());
+    QVERIFY(watcher.fullScanRequired());
+    watcher.clear();
+    QVERIFY(watcher.fullScanRequired());
+    qunsetenv("SYNQCLIENT_LOCALCHANGEWATCHER_POLL");
+}
+
+void LocalChangeWatcherTest::cleanupTestCase()
+{
+    qunsetenv("SYNQCLIENT_LOCALCHANGEWATCHER_POLL");
+}
+
+bool LocalChangeWatcherTest::writeFile(const QString& path, const QByteArray& data)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    file.write(data);
+    file.close();
+    return true;
+}
+
+QTEST_MAIN(LocalChangeWatcherTest)
+
+#include "tst_localchangewatcher.moc"
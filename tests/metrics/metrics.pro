@@ -0,0 +1,2 @@
+TESTNAME = metrics
+include(../test.pri)
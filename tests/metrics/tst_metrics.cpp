@@ -0,0 +1,413 @@
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <QtTest>
+
+// add necessary includes here
+#include "../shared/fakewebdavserver.h"
+#include "../shared/utils.h"
+#include "SynqClient/DirectorySynchronizer"
+#include "SynqClient/DownloadFileJob"
+#include "SynqClient/JSONSyncStateDatabase"
+#include "SynqClient/JobMetrics"
+#include "SynqClient/SyncEvent"
+#include "SynqClient/SyncProgress"
+#include "SynqClient/SyncStatistics"
+#include "SynqClient/SyncTracer"
+#include "SynqClient/UploadFileJob"
+#include "SynqClient/WebDAVJobFactory"
+
+using SynqClient::DirectorySynchronizer;
+using SynqClient::JobError;
+using SynqClient::JobMetrics;
+using SynqClient::JSONSyncStateDatabase;
+using SynqClient::SynchronizerError;
+using SynqClient::SynchronizerLogEntryType;
+using SynqClient::SynchronizerPhase;
+using SynqClient::SyncEvent;
+using SynqClient::SyncProgress;
+using SynqClient::SyncStatistics;
+using SynqClient::SyncTracer;
+using SynqClient::WebDAVJobFactory;
+using SynqClient::UnitTest::FakeWebDAVServer;
+
+class MetricsTest : public QObject
+{
+    Q_OBJECT
+
+public:
+    MetricsTest();
+    ~MetricsTest();
+
+private slots:
+    void initTestCase();
+    void jobMetrics();
+    void retries();
+    void syncStatistics();
+    void trace();
+    void progress();
+    void syncEvents();
+    void cleanupTestCase();
+
+private:
+    bool runJob(SynqClient::AbstractJob* job);
+};
+
+MetricsTest::MetricsTest() {}
+
+MetricsTest::~MetricsTest() {}
+
+void MetricsTest::initTestCase() {}
+
+void MetricsTest::jobMetrics()
+{
+    FakeWebDAVServer server;
+    server.setLatency(50);
+    QVERIFY(server.listen());
+    QNetworkAccessManager nam;
+    WebDAVJobFactory factory;
+    factory.setNetworkAccessManager(&nam);
+    factory.setUrl(server.url());
+
+    QByteArray data(1000, 'x');
+    {
+        auto job = factory.uploadFile(&factory);
+        job->setRemoteFilename("/file.dat");
+        job->setData(data);
+        QVERIFY(job->metrics().queuedTime().isValid());
+        QVERIFY(!job->metrics().startedTime().isValid());
+        QCOMPARE(job->metrics().duration(), qint64(-1));
+        QVERIFY(runJob(job));
+        auto metrics = job->metrics();
+        QCOMPARE(metrics.requests(), 1);
+        QCOMPARE(metrics.retries(), 0);
+        QCOMPARE(metrics.bytesSent(), qint64(data.size()));
+        QVERIFY(metrics.queueDuration() >= 0);
+        QVERIFY(metrics.timeToFirstByte() >= 40);
+        QVERIFY(metrics.duration() >= metrics.timeToFirstByte());
+    }
+
+    {
+        auto job = factory.downloadFile(&factory);
+        job->setRemoteFilename("/file.dat");
+        QVERIFY(runJob(job));
+        auto metrics = job->metrics();
+        QCOMPARE(metrics.requests(), 1);
+        QCOMPARE(metrics.bytesReceived(), qint64(data.size()));
+        QCOMPARE(metrics.bytesSent(), qint64(0));
+        QVERIFY(metrics.firstByteTime() <= metrics.finishedTime());
+    }
+}
+
+void MetricsTest::retries()
+{
+    FakeWebDAVServer server;
+    server.setTooManyRequestsInterval(2);
+    server.setRetryAfter(1);
+    QVERIFY(server.listen());
+    QNetworkAccessManager nam;
+    WebDAVJobFactory factory;
+    factory.setNetworkAccessManager(&nam);
+    factory.setUrl(server.url());
+
+    int requests = 0;
+    int retries = 0;
+    for (int i = 0; i < 3; ++i) {
+        auto job = factory.uploadFile(&factory);
+        job->setRemoteFilename(QString("/file-%1.txt").arg(i));
+        job->setData("Retry me");
+        QVERIFY(runJob(job));
+        requests += job->metrics().requests();
+        retries += job->metrics().retries();
+    }
+    QCOMPARE(requests, server.numRequests());
+    QCOMPARE(retries, server.numTooManyRequests());
+    QVERIFY(retries > 0);
+}
+
+void MetricsTest::syncStatistics()
+{
+    FakeWebDAVServer server;
+    server.setLatency(20);
+    QVERIFY(server.listen());
+    QNetworkAccessManager nam;
+    WebDAVJobFactory factory;
+    factory.setNetworkAccessManager(&nam);
+    factory.setUrl(server.url());
+
+    QTemporaryDir tmpDir;
+    QTemporaryDir metaTmpDir;
+    qint64 totalSize = 0;
+    for (int i = 0; i < 5; ++i) {
+        QFile file(tmpDir.filePath(QString("file-%1.txt").arg(i)));
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        QByteArray data(100 * (i + 1), 'x');
+        QCOMPARE(file.write(data), qint64(data.size()));
+        totalSize += data.size();
+    }
+
+    JSONSyncStateDatabase syncDb(metaTmpDir.filePath("syncdb.json"));
+    DirectorySynchronizer sync;
+    sync.setJobFactory(&factory);
+    sync.setLocalDirectoryPath(tmpDir.path());
+    sync.setRemoteDirectoryPath("/sync");
+    sync.setSyncStateDatabase(&syncDb);
+    sync.setStatisticsInterval(10);
+    QSignalSpy statisticsAvailable(&sync, &DirectorySynchronizer::statisticsAvailable);
+    QSignalSpy finished(&sync, &DirectorySynchronizer::finished);
+    sync.start();
+    QVERIFY(finished.wait());
+    QCOMPARE(sync.error(), SynchronizerError::NoError);
+
+    // Periodic snapshots plus the final one:
+    QVERIFY(statisticsAvailable.count() > 1);
+    auto stats = sync.statistics();
+    auto lastSnapshot = statisticsAvailable.last().at(0).value<SyncStatistics>();
+    QCOMPARE(lastSnapshot.jobs(), stats.jobs());
+    QCOMPARE(lastSnapshot.finishTime(), stats.finishTime());
+
+    QVERIFY(stats.startTime().isValid());
+    QVERIFY(stats.finishTime().isValid());
+    QVERIFY(stats.duration() >= 0);
+    QVERIFY(stats.jobs() >= 5);
+    QCOMPARE(stats.requests(), server.numRequests());
+    QCOMPARE(stats.retries(), 0);
+    QVERIFY(stats.bytesSent() >= totalSize);
+    QVERIFY(stats.phaseDuration(SynchronizerPhase::CreateRemoteFolder) >= 20);
+    QVERIFY(stats.phaseDuration(SynchronizerPhase::RemoteListing) >= 20);
+    QVERIFY(stats.phaseDuration(SynchronizerPhase::Transfers) >= 20);
+    QVERIFY(stats.uploadRate() > 0);
+
+    int latencies = 0;
+    for (auto count : stats.latencyHistogram()) {
+        latencies += count;
+    }
+    QCOMPARE(stats.latencyHistogram().length(),
+             SyncStatistics::latencyHistogramBounds().length() + 1);
+    QCOMPARE(latencies, stats.jobs());
+    QCOMPARE(stats.latencyHistogram().at(0), 0);
+
+    auto map = stats.toVariantMap();
+    QCOMPARE(map.value("requests").toInt(), stats.requests());
+    QCOMPARE(map.value("phases").toMap().value("Transfers").toLongLong(),
+             stats.phaseDuration(SynchronizerPhase::Transfers));
+    QCOMPARE(map.value("latencyHistogram").toList().length(), stats.latencyHistogram().length());
+}
+
+void MetricsTest::trace()
+{
+    FakeWebDAVServer server;
+    QVERIFY(server.listen());
+    QNetworkAccessManager nam;
+    WebDAVJobFactory factory;
+    factory.setNetworkAccessManager(&nam);
+    factory.setUrl(server.url());
+
+    QTemporaryDir tmpDir;
+    QTemporaryDir metaTmpDir;
+    for (int i = 0; i < 3; ++i) {
+        QFile file(tmpDir.filePath(QString("file-%1.txt").arg(i)));
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        QVERIFY(file.write("Trace me") > 0);
+    }
+
+    JSONSyncStateDatabase syncDb(metaTmpDir.filePath("syncdb.json"));
+    SyncTracer tracer;
+    QVERIFY(tracer.isEmpty());
+    DirectorySynchronizer sync;
+    sync.setJobFactory(&factory);
+    sync.setLocalDirectoryPath(tmpDir.path());
+    sync.setRemoteDirectoryPath("/sync");
+    sync.setSyncStateDatabase(&syncDb);
+    sync.setTracer(&tracer);
+    QSignalSpy finished(&sync, &DirectorySynchronizer::finished);
+    sync.start();
+    QVERIFY(finished.wait());
+    QCOMPARE(sync.error(), SynchronizerError::NoError);
+    QVERIFY(!tracer.isEmpty());
+
+    QJsonParseError error;
+    auto doc = QJsonDocument::fromJson(tracer.toJson(), &error);
+    QCOMPARE(error.error, QJsonParseError::NoError);
+    QCOMPARE(doc.object().value("displayTimeUnit").toString(), QString("ms"));
+    auto events = doc.object().value("traceEvents").toArray();
+
+    QSet<QString> phases;
+    QSet<QString> uploadedPaths;
+    QSet<QString> trackNames;
+    int schedulerDecisions = 0;
+    for (const auto& value : events) {
+        auto event = value.toObject();
+        auto type = event.value("ph").toString();
+        auto args = event.value("args").toObject();
+        QCOMPARE(event.value("pid").toInt(), 1);
+        if (type == "M") {
+            if (event.value("name").toString() == "thread_name") {
+                trackNames << args.value("name").toString();
+            }
+            continue;
+        }
+        QVERIFY(event.value("ts").toDouble() >= 0);
+        auto category = event.value("cat").toString();
+        if (type == "X" && category == "phase") {
+            phases << event.value("name").toString();
+        } else if (type == "X" && category == "job") {
+            QVERIFY(event.value("dur").toDouble() >= 0);
+            QVERIFY(!args.value("type").toString().isEmpty());
+            if (args.value("type").toString().contains("Upload")) {
+                if (args.contains("paths")) {
+                    for (const auto& path : args.value("paths").toArray()) {
+                        uploadedPaths << path.toString();
+                    }
+                } else {
+                    uploadedPaths << args.value("path").toString();
+                }
+                QVERIFY(args.value("bytesSent").toInt() > 0);
+                QVERIFY(args.value("httpStatus").toInt() >= 200);
+            }
+        } else if (type == "i" && category == "scheduler") {
+            ++schedulerDecisions;
+        }
+    }
+
+    QVERIFY(phases.contains("RemoteListing"));
+    QVERIFY(phases.contains("Transfers"));
+    QCOMPARE(uploadedPaths,
+             QSet<QString>({ "/sync/file-0.txt", "/sync/file-1.txt", "/sync/file-2.txt" }));
+    QVERIFY(schedulerDecisions > 0);
+    QVERIFY(trackNames.contains("Sync phases"));
+    QVERIFY(trackNames.contains("Scheduler"));
+    QVERIFY(trackNames.contains("Jobs #1"));
+
+    QTemporaryDir traceDir;
+    QVERIFY(tracer.save(traceDir.filePath("trace.json")));
+    tracer.clear();
+    QVERIFY(tracer.isEmpty());
+}
+
+void MetricsTest::progress()
+{
+    FakeWebDAVServer server;
+    server.setLatency(10);
+    QVERIFY(server.listen());
+    QNetworkAccessManager nam;
+    WebDAVJobFactory factory;
+    factory.setNetworkAccessManager(&nam);
+    factory.setUrl(server.url());
+
+    // One large file and many tiny ones - the large one must dominate the progress:
+    qint64 totalSize = 0;
+    QByteArray largeFile(4 * 1024 * 1024, 'x');
+    server.putFile("/sync/large.dat", largeFile);
+    totalSize += largeFile.size();
+    for (int i = 0; i < 20; ++i) {
+        QByteArray data = QByteArray::number(i);
+        server.putFile(QString("/sync/small-%1.txt").arg(i), data);
+        totalSize += data.size();
+    }
+
+    QTemporaryDir tmpDir;
+    QTemporaryDir metaTmpDir;
+    JSONSyncStateDatabase syncDb(metaTmpDir.filePath("syncdb.json"));
+    DirectorySynchronizer sync;
+    sync.setJobFactory(&factory);
+    sync.setLocalDirectoryPath(tmpDir.path());
+    sync.setRemoteDirectoryPath("/sync");
+    sync.setSyncStateDatabase(&syncDb);
+    sync.setProgressInterval(5);
+    QCOMPARE(sync.progressInterval(), 5);
+    QSignalSpy progressAvailable(&sync, &DirectorySynchronizer::progressAvailable);
+    QSignalSpy finished(&sync, &DirectorySynchronizer::finished);
+    sync.start();
+    QVERIFY(finished.wait());
+    QCOMPARE(sync.error(), SynchronizerError::NoError);
+    QVERIFY(progressAvailable.count() > 0);
+
+    int lastProgress = -1;
+    for (const auto& args : progressAvailable) {
+        auto progress = args.at(0).value<SyncProgress>();
+        QVERIFY(progress.progress() >= lastProgress);
+        QVERIFY(progress.bytesDone() <= progress.bytesTotal());
+        if (progress.actionsDone() == progress.actionsTotal()
+            && progress.bytesDone() < largeFile.size() / 2) {
+            // All downloads started but most of the data is still missing:
+            QVERIFY(progress.progress() < 60);
+        }
+        lastProgress = progress.progress();
+    }
+
+    auto progress = sync.currentProgress();
+    QCOMPARE(progress.progress(), 100);
+    QCOMPARE(progress.actionsDone(), progress.actionsTotal());
+    QCOMPARE(progress.actionsTotal(), 21);
+    QCOMPARE(progress.bytesTotal(), totalSize);
+    QCOMPARE(progress.bytesDone(), totalSize);
+    QCOMPARE(progress.eta(), qint64(0));
+    auto last = progressAvailable.last().at(0).value<SyncProgress>();
+    QCOMPARE(last.progress(), 100);
+    QCOMPARE(progress.toVariantMap().value("bytesTotal").toLongLong(), totalSize);
+}
+
+void MetricsTest::syncEvents()
+{
+    FakeWebDAVServer server;
+    QVERIFY(server.listen());
+    server.putFile("/sync/remote.txt", "Remote");
+    QNetworkAccessManager nam;
+    WebDAVJobFactory factory;
+    factory.setNetworkAccessManager(&nam);
+    factory.setUrl(server.url());
+
+    QTemporaryDir tmpDir;
+    QTemporaryDir metaTmpDir;
+    QVERIFY(QDir(tmpDir.path()).mkpath("folder"));
+    for (const auto& name : { "local.txt", "folder/nested.txt" }) {
+        QFile file(tmpDir.filePath(name));
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        QVERIFY(file.write("Local") > 0);
+    }
+
+    JSONSyncStateDatabase syncDb(metaTmpDir.filePath("syncdb.json"));
+    DirectorySynchronizer sync;
+    sync.setJobFactory(&factory);
+    sync.setLocalDirectoryPath(tmpDir.path());
+    sync.setRemoteDirectoryPath("/sync");
+    sync.setSyncStateDatabase(&syncDb);
+    QSignalSpy syncEventAvailable(&sync, &DirectorySynchronizer::syncEventAvailable);
+    QSignalSpy finished(&sync, &DirectorySynchronizer::finished);
+    sync.start();
+    QVERIFY(finished.wait());
+    QCOMPARE(sync.error(), SynchronizerError::NoError);
+
+    QMap<QString, SynchronizerLogEntryType> events;
+    for (const auto& args : syncEventAvailable) {
+        auto event = args.at(0).value<SyncEvent>();
+        QCOMPARE(event.sourcePathId(), SyncEvent::NoPath);
+        QVERIFY(event.pathId() != SyncEvent::NoPath);
+        events.insert(sync.eventPath(event.pathId()), event.type());
+    }
+    QCOMPARE(events.value("/local.txt"), SynchronizerLogEntryType::Upload);
+    QCOMPARE(events.value("/folder/nested.txt"), SynchronizerLogEntryType::Upload);
+    QCOMPARE(events.value("/folder"), SynchronizerLogEntryType::RemoteMkDir);
+    QCOMPARE(events.value("/remote.txt"), SynchronizerLogEntryType::Download);
+    QCOMPARE(sync.eventPath(SyncEvent::NoPath), QString());
+}
+
+void MetricsTest::cleanupTestCase() {}
+
+bool MetricsTest::runJob(SynqClient::AbstractJob* job)
+{
+    QSignalSpy finished(job, &SynqClient::AbstractJob::finished);
+    job->start();
+    SQ_VERIFY(finished.wait());
+    SQ_COMPARE(job->error(), JobError::NoError);
+    return true;
+}
+
+QTEST_MAIN(MetricsTest)
+
+#include "tst_metrics.moc"
@@ -0,0 +1,704 @@
+#include "fakedropboxserver.h"
+
+#include <QCryptographicHash>
+#include <QDir>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QSet>
+
+namespace SynqClient {
+namespace UnitTest {
+
+namespace {
+
+// The block size used to calculate content hashes:
+const int ContentHashBlockSize = 4 * 1024 * 1024;
+
+QString cleanPath(const QString& path)
+{
+    return QDir::cleanPath("/" + path);
+}
+
+QString parentPath(const QString& path)
+{
+    auto index = path.lastIndexOf('/');
+    if (index <= 0) {
+        return "/";
+    }
+    return path.left(index);
+}
+
+QString revString(quint64 rev)
+{
+    return QString("%1").arg(rev, 9, 16, QChar('0'));
+}
+
+/**
+ * @brief Create a tagged union value as used by the Dropbox API.
+ *
+ * For example, tag("path", tag("not_found")) yields
+ * `{".tag": "path", "path": {".tag": "not_found"}}`.
+ */
+QJsonObject tag(const QString& name, const QJsonObject& value = QJsonObject())
+{
+    QJsonObject result { { ".tag", name } };
+    if (!value.isEmpty()) {
+        result.insert(name, value);
+    }
+    return result;
+}
+
+FakeHttpServer::Response jsonResponse(const QJsonObject& object, int status = 200)
+{
+    FakeHttpServer::Response response(status, QJsonDocument(object).toJson(QJsonDocument::Compact));
+    response.setHeader("Content-Type", "application/json");
+    return response;
+}
+
+FakeHttpServer::Response errorResponse(const QJsonObject& error)
+{
+    return jsonResponse(QJsonObject { { "error_summary", error.value(".tag").toString() + "/" },
+                                      { "error", error } },
+                        409);
+}
+
+} // namespace
+
+FakeDropboxServer::FakeDropboxServer(QObject* parent)
+    : FakeHttpServer(parent),
+      m_entries(),
+      m_changes(),
+      m_sequence(0),
+      m_nextId(1),
+      m_longpollTimeout(1000),
+      m_uploadSessions()
+{
+}
+
+FakeDropboxServer::~FakeDropboxServer() {}
+
+/**
+ * @brief The time in milliseconds after which a longpoll request without changes returns.
+ *
+ * On Dropbox, the client specifies the timeout (which is at least 30 seconds). To keep tests
+ * fast, the fake server uses this - much shorter - timeout instead. Note that - unlike on
+ * Dropbox - changes happening while a longpoll request is pending are only reported by the next
+ * request.
+ */
+int FakeDropboxServer::longpollTimeout() const
+{
+    return m_longpollTimeout;
+}
+
+void FakeDropboxServer::setLongpollTimeout(int longpollTimeout)
+{
+    m_longpollTimeout = longpollTimeout;
+}
+
+/**
+ * @brief Store a file on the server, creating missing parent folders.
+ */
+void FakeDropboxServer::putFile(const QString& path, const QByteArray& data)
+{
+    writeFile(cleanPath(path), data);
+}
+
+/**
+ * @brief Create a folder on the server, including missing parent folders.
+ */
+void FakeDropboxServer::makeDirectory(const QString& path)
+{
+    auto folderPath = cleanPath(path);
+    if (folderPath != "/" && !m_entries.contains(key(folderPath))) {
+        createDirectory(folderPath);
+    }
+}
+
+/**
+ * @brief Remove the resource at the @p path (including its children) from the server.
+ */
+void FakeDropboxServer::remove(const QString& path)
+{
+    if (m_entries.contains(key(path))) {
+        removeEntry(cleanPath(path));
+    }
+}
+
+/**
+ * @brief Check if a resource exists on the server.
+ */
+bool FakeDropboxServer::exists(const QString& path) const
+{
+    return key(path) == "/" || m_entries.contains(key(path));
+}
+
+/**
+ * @brief Check if the resource at the @p path is a folder.
+ */
+bool FakeDropboxServer::isDirectory(const QString& path) const
+{
+    return key(path) == "/" || m_entries.value(key(path)).isDirectory;
+}
+
+/**
+ * @brief The content of the file at the @p path.
+ */
+QByteArray FakeDropboxServer::fileData(const QString& path) const
+{
+    return m_entries.value(key(path)).data;
+}
+
+/**
+ * @brief Calculate the Dropbox content hash of the @p data.
+ *
+ * The hash is the SHA256 of the concatenated SHA256 hashes of 4 MiB blocks of the data.
+ */
+QString FakeDropboxServer::contentHash(const QByteArray& data)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    for (int offset = 0; offset < data.size(); offset += ContentHashBlockSize) {
+        hash.addData(QCryptographicHash::hash(data.mid(offset, ContentHashBlockSize),
+                                              QCryptographicHash::Sha256));
+    }
+    return QString::fromUtf8(hash.result().toHex());
+}
+
+/**
+ * @brief Implementation of FakeHttpServer::handleRequest().
+ */
+FakeHttpServer::Response FakeDropboxServer::handleRequest(const Request& request)
+{
+    if (request.method != "POST") {
+        return Response(405);
+    }
+    auto endpoint = request.path;
+    if (endpoint != "/2/files/list_folder/longpoll"
+        && !request.header("Authorization").startsWith("Bearer ")) {
+        return jsonResponse(QJsonObject { { "error_summary", "missing_auth/" },
+                                          { "error", tag("invalid_access_token") } },
+                            401);
+    }
+
+    // Content endpoints get their arguments via a header, all others via the body:
+    auto isContentEndpoint = endpoint == "/2/files/download" || endpoint == "/2/files/upload"
+            || endpoint == "/2/files/upload_session/start";
+    QJsonParseError parseError;
+    auto doc = QJsonDocument::fromJson(
+            isContentEndpoint ? request.header("Dropbox-API-Arg") : request.body, &parseError);
+    if (parseError.error != QJsonParseError::NoError) {
+        return Response(400, "Error in call to API function: could not decode input as JSON");
+    }
+    auto arg = doc.object();
+
+    if (endpoint == "/2/files/list_folder") {
+        return handleListFolder(arg);
+    } else if (endpoint == "/2/files/list_folder/continue") {
+        return handleListFolderContinue(arg);
+    } else if (endpoint == "/2/files/list_folder/longpoll") {
+        return handleLongpoll(arg);
+    } else if (endpoint == "/2/files/get_metadata") {
+        return handleGetMetadata(arg);
+    } else if (endpoint == "/2/files/download") {
+        return handleDownload(arg);
+    } else if (endpoint == "/2/files/upload") {
+        return handleUpload(arg, request.body);
+    } else if (endpoint == "/2/files/create_folder_v2") {
+        return handleCreateFolder(arg);
+    } else if (endpoint == "/2/files/delete_v2") {
+        return handleDelete(arg);
+    } else if (endpoint == "/2/files/move_v2") {
+        return handleMoveOrCopy(arg, true);
+    } else if (endpoint == "/2/files/copy_v2") {
+        return handleMoveOrCopy(arg, false);
+    } else if (endpoint == "/2/files/create_folder_batch") {
+        return handleCreateFolderBatch(arg);
+    } else if (endpoint == "/2/files/delete_batch") {
+        return handleDeleteBatch(arg);
+    } else if (endpoint == "/2/files/upload_session/start") {
+        return handleUploadSessionStart(request.body);
+    } else if (endpoint == "/2/files/upload_session/finish_batch_v2") {
+        return handleUploadSessionFinishBatch(arg);
+    }
+    return Response(404);
+}
+
+QString FakeDropboxServer::key(const QString& path)
+{
+    return cleanPath(path).toLower();
+}
+
+QJsonObject FakeDropboxServer::metadata(const QString& key) const
+{
+    const auto entry = m_entries.value(key);
+    QJsonObject result { { ".tag", entry.isDirectory ? "folder" : "file" },
+                         { "name", entry.path.section('/', -1) },
+                         { "id", entry.id },
+                         { "path_display", entry.path },
+                         { "path_lower", entry.path.toLower() } };
+    if (!entry.isDirectory) {
+        result.insert("rev", revString(entry.rev));
+        result.insert("size", entry.data.size());
+        result.insert("content_hash", contentHash(entry.data));
+        result.insert("server_modified", entry.serverModified.toString(Qt::ISODate));
+        result.insert("client_modified", entry.serverModified.toString(Qt::ISODate));
+        result.insert("is_downloadable", true);
+    }
+    return result;
+}
+
+/**
+ * @brief The keys of the entries within the folder at @p path, sorted by name.
+ */
+QStringList FakeDropboxServer::children(const QString& path, bool recursive) const
+{
+    QStringList result;
+    auto folderKey = key(path);
+    auto childPrefix = folderKey == "/" ? folderKey : folderKey + "/";
+    for (auto it = m_entries.lowerBound(childPrefix); it != m_entries.cend(); ++it) {
+        if (!it.key().startsWith(childPrefix)) {
+            break;
+        }
+        if (recursive || !it.key().mid(childPrefix.length()).contains('/')) {
+            result << it.key();
+        }
+    }
+    return result;
+}
+
+bool FakeDropboxServer::hasFileAncestor(const QString& path) const
+{
+    for (auto parent = parentPath(path); parent != "/"; parent = parentPath(parent)) {
+        if (m_entries.contains(key(parent)) && !m_entries[key(parent)].isDirectory) {
+            return true;
+        }
+    }
+    return false;
+}
+
+QString FakeDropboxServer::cursor(const QString& path, bool recursive) const
+{
+    QJsonObject cursorData { { "path", key(path) },
+                             { "recursive", recursive },
+                             { "sequence", QString::number(m_sequence) } };
+    return QString::fromUtf8(QJsonDocument(cursorData)
+                                     .toJson(QJsonDocument::Compact)
+                                     .toBase64(QByteArray::Base64UrlEncoding));
+}
+
+/**
+ * @brief The changes within a folder since the @p cursor has been issued.
+ *
+ * Only the latest change of each entry is returned. The path of the folder and whether the
+ * listing is recursive are read from the cursor. If the cursor is invalid, @p ok is set to false.
+ */
+QVector<FakeDropboxServer::Change> FakeDropboxServer::changesSince(const QString& cursor,
+                                                                   QString& path,
+                                                                   bool& recursive,
+                                                                   bool& ok) const
+{
+    QVector<Change> result;
+    auto cursorData = QJsonDocument::fromJson(
+                              QByteArray::fromBase64(cursor.toUtf8(),
+                                                     QByteArray::Base64UrlEncoding))
+                              .object();
+    path = cursorData.value("path").toString();
+    recursive = cursorData.value("recursive").toBool();
+    auto sequence = cursorData.value("sequence").toString().toULongLong(&ok);
+    if (!ok || path.isEmpty() || sequence > m_sequence) {
+        ok = false;
+        return result;
+    }
+    auto childPrefix = path == "/" ? path : path + "/";
+    QSet<QString> seen;
+    for (auto it = m_changes.crbegin(); it != m_changes.crend() && it->sequence > sequence;
+         ++it) {
+        if (it->path.startsWith(childPrefix) && !seen.contains(it->path)
+            && (recursive || !it->path.mid(childPrefix.length()).contains('/'))) {
+            seen.insert(it->path);
+            result.prepend(*it);
+        }
+    }
+    return result;
+}
+
+void FakeDropboxServer::recordChange(const QString& path)
+{
+    m_changes << Change { ++m_sequence, key(path), path };
+}
+
+void FakeDropboxServer::createParents(const QString& path)
+{
+    auto parent = parentPath(path);
+    if (parent != "/" && !m_entries.contains(key(parent))) {
+        createDirectory(parent);
+    }
+}
+
+void FakeDropboxServer::writeFile(const QString& path, const QByteArray& data)
+{
+    createParents(path);
+    recordChange(path);
+    auto& entry = m_entries[key(path)];
+    if (entry.id.isEmpty()) {
+        entry.id = QString("id:fake%1").arg(m_nextId++);
+        entry.path = path;
+    }
+    entry.isDirectory = false;
+    entry.data = data;
+    entry.rev = m_sequence;
+    entry.serverModified =
+            QDateTime::fromSecsSinceEpoch(QDateTime::currentSecsSinceEpoch(), Qt::UTC);
+}
+
+void FakeDropboxServer::createDirectory(const QString& path)
+{
+    createParents(path);
+    recordChange(path);
+    Entry entry;
+    entry.isDirectory = true;
+    entry.path = path;
+    entry.id = QString("id:fake%1").arg(m_nextId++);
+    m_entries[key(path)] = entry;
+}
+
+void FakeDropboxServer::removeEntry(const QString& path)
+{
+    auto keys = children(path, true);
+    keys.prepend(key(path));
+    for (const auto& removedKey : qAsConst(keys)) {
+        recordChange(m_entries.take(removedKey).path);
+    }
+}
+
+/**
+ * @brief The entry at @p path together with all entries below it.
+ */
+QVector<FakeDropboxServer::Entry> FakeDropboxServer::subtree(const QString& path) const
+{
+    QVector<Entry> result { m_entries.value(key(path)) };
+    const auto keys = children(path, true);
+    for (const auto& childKey : keys) {
+        result << m_entries.value(childKey);
+    }
+    return result;
+}
+
+/**
+ * @brief Insert the @p entries previously located at @p source at the @p target path.
+ */
+void FakeDropboxServer::insertSubtree(const QVector<Entry>& entries, const QString& source,
+                                      const QString& target, bool keepIds)
+{
+    createParents(target);
+    for (auto entry : entries) {
+        entry.path = target + entry.path.mid(source.length());
+        if (!keepIds) {
+            entry.id = QString("id:fake%1").arg(m_nextId++);
+        }
+        recordChange(entry.path);
+        if (!entry.isDirectory) {
+            entry.rev = m_sequence;
+        }
+        m_entries[key(entry.path)] = entry;
+    }
+}
+
+/**
+ * @brief Store a file.
+ *
+ * If the upload fails, the reason (e.g. a conflict) is stored in @p error.
+ */
+QJsonObject FakeDropboxServer::upload(const QString& path, const QJsonValue& mode,
+                                      const QByteArray& data, QJsonObject& error)
+{
+    auto filePath = cleanPath(path);
+    auto existing = m_entries.constFind(key(filePath));
+    auto exists = existing != m_entries.cend();
+    if (filePath == "/" || (exists && existing->isDirectory)) {
+        error = tag("conflict", tag("folder"));
+        return QJsonObject();
+    }
+    if (hasFileAncestor(filePath)) {
+        error = tag("conflict", tag("file"));
+        return QJsonObject();
+    }
+    auto modeTag = mode.isObject() ? mode.toObject().value(".tag").toString() : mode.toString();
+    if ((modeTag == "update"
+         && (!exists || revString(existing->rev) != mode.toObject().value("update").toString()))
+        || (modeTag == "add" && exists)) {
+        error = tag("conflict", tag("file"));
+        return QJsonObject();
+    }
+    writeFile(filePath, data);
+    return metadata(key(filePath));
+}
+
+/**
+ * @brief Create a folder.
+ *
+ * If this fails, the reason (which is a LookupError/WriteError) is stored in @p error.
+ */
+QJsonObject FakeDropboxServer::createFolder(const QString& path, QJsonObject& error)
+{
+    auto folderPath = cleanPath(path);
+    if (folderPath == "/" || m_entries.contains(key(folderPath))) {
+        error = tag("conflict", tag(isDirectory(folderPath) ? "folder" : "file"));
+        return QJsonObject();
+    }
+    if (hasFileAncestor(folderPath)) {
+        error = tag("conflict", tag("file"));
+        return QJsonObject();
+    }
+    createDirectory(folderPath);
+    return metadata(key(folderPath));
+}
+
+/**
+ * @brief Delete a file or folder.
+ *
+ * If this fails, the error (which is a DeleteError) is stored in @p error.
+ */
+QJsonObject FakeDropboxServer::deleteResource(const QString& path, const QJsonValue& parentRev,
+                                              QJsonObject& error)
+{
+    auto resourcePath = cleanPath(path);
+    if (!m_entries.contains(key(resourcePath))) {
+        error = tag("path_lookup", tag("not_found"));
+        return QJsonObject();
+    }
+    auto entry = m_entries.value(key(resourcePath));
+    if (!parentRev.isUndefined()
+        && (entry.isDirectory || revString(entry.rev) != parentRev.toString())) {
+        error = tag("path_write", tag("conflict", tag("file")));
+        return QJsonObject();
+    }
+    auto result = metadata(key(resourcePath));
+    removeEntry(entry.path);
+    return result;
+}
+
+FakeHttpServer::Response FakeDropboxServer::handleListFolder(const QJsonObject& arg)
+{
+    auto path = cleanPath(arg.value("path").toString());
+    auto recursive = arg.value("recursive").toBool();
+    if (!exists(path)) {
+        return errorResponse(tag("path", tag("not_found")));
+    }
+    if (!isDirectory(path)) {
+        return errorResponse(tag("path", tag("not_folder")));
+    }
+    auto keys = children(path, recursive);
+    if (recursive && path != "/") {
+        // Recursive listings include the folder itself:
+        keys.prepend(key(path));
+    }
+    QJsonArray entries;
+    for (const auto& entryKey : qAsConst(keys)) {
+        entries << metadata(entryKey);
+    }
+    return jsonResponse(QJsonObject { { "entries", entries },
+                                      { "cursor", cursor(path, recursive) },
+                                      { "has_more", false } });
+}
+
+FakeHttpServer::Response FakeDropboxServer::handleListFolderContinue(const QJsonObject& arg)
+{
+    QString path;
+    bool recursive;
+    bool ok;
+    auto changes = changesSince(arg.value("cursor").toString(), path, recursive, ok);
+    if (!ok) {
+        return errorResponse(tag("reset"));
+    }
+    QJsonArray entries;
+    for (const auto& change : qAsConst(changes)) {
+        if (m_entries.contains(change.path)) {
+            entries << metadata(change.path);
+        } else {
+            entries << QJsonObject { { ".tag", "deleted" },
+                                     { "name", change.displayPath.section('/', -1) },
+                                     { "path_display", change.displayPath },
+                                     { "path_lower", change.path } };
+        }
+    }
+    return jsonResponse(QJsonObject { { "entries", entries },
+                                      { "cursor", cursor(path, recursive) },
+                                      { "has_more", false } });
+}
+
+FakeHttpServer::Response FakeDropboxServer::handleLongpoll(const QJsonObject& arg)
+{
+    QString path;
+    bool recursive;
+    bool ok;
+    auto changes = changesSince(arg.value("cursor").toString(), path, recursive, ok);
+    if (!ok) {
+        return errorResponse(tag("reset"));
+    }
+    auto response = jsonResponse(QJsonObject { { "changes", !changes.isEmpty() } });
+    if (changes.isEmpty()) {
+        response.delay = m_longpollTimeout;
+    }
+    return response;
+}
+
+FakeHttpServer::Response FakeDropboxServer::handleGetMetadata(const QJsonObject& arg)
+{
+    auto path = cleanPath(arg.value("path").toString());
+    if (path == "/" || !m_entries.contains(key(path))) {
+        return errorResponse(tag("path", tag("not_found")));
+    }
+    return jsonResponse(metadata(key(path)));
+}
+
+FakeHttpServer::Response FakeDropboxServer::handleDownload(const QJsonObject& arg)
+{
+    auto path = cleanPath(arg.value("path").toString());
+    if (path == "/" || !m_entries.contains(key(path))) {
+        return errorResponse(tag("path", tag("not_found")));
+    }
+    if (isDirectory(path)) {
+        return errorResponse(tag("path", tag("not_file")));
+    }
+    Response response(200, m_entries[key(path)].data);
+    response.setHeader("Content-Type", "application/octet-stream");
+    response.setHeader("Dropbox-API-Result",
+                       QJsonDocument(metadata(key(path))).toJson(QJsonDocument::Compact));
+    return response;
+}
+
+FakeHttpServer::Response FakeDropboxServer::handleUpload(const QJsonObject& arg,
+                                                         const QByteArray& data)
+{
+    QJsonObject reason;
+    auto result = upload(arg.value("path").toString(), arg.value("mode"), data, reason);
+    if (!reason.isEmpty()) {
+        return errorResponse(QJsonObject { { ".tag", "path" }, { "reason", reason } });
+    }
+    return jsonResponse(result);
+}
+
+FakeHttpServer::Response FakeDropboxServer::handleCreateFolder(const QJsonObject& arg)
+{
+    QJsonObject error;
+    auto result = createFolder(arg.value("path").toString(), error);
+    if (!error.isEmpty()) {
+        return errorResponse(tag("path", error));
+    }
+    return jsonResponse(QJsonObject { { "metadata", result } });
+}
+
+FakeHttpServer::Response FakeDropboxServer::handleDelete(const QJsonObject& arg)
+{
+    QJsonObject error;
+    auto result = deleteResource(arg.value("path").toString(), arg.value("parent_rev"), error);
+    if (!error.isEmpty()) {
+        return errorResponse(error);
+    }
+    return jsonResponse(QJsonObject { { "metadata", result } });
+}
+
+FakeHttpServer::Response FakeDropboxServer::handleMoveOrCopy(const QJsonObject& arg, bool move)
+{
+    auto source = cleanPath(arg.value("from_path").toString());
+    auto target = cleanPath(arg.value("to_path").toString());
+    if (source == "/" || !m_entries.contains(key(source))) {
+        return errorResponse(tag("from_lookup", tag("not_found")));
+    }
+    source = m_entries[key(source)].path;
+    if (key(target).startsWith(key(source) + "/")) {
+        return errorResponse(tag("cant_move_folder_into_itself"));
+    }
+    // Moving an item to a path which only differs in case renames it:
+    auto isRename = move && key(target) == key(source);
+    if (target == "/" || (m_entries.contains(key(target)) && !isRename)) {
+        return errorResponse(
+                tag("to", tag("conflict", tag(isDirectory(target) ? "folder" : "file"))));
+    }
+    if (hasFileAncestor(target)) {
+        return errorResponse(tag("to", tag("conflict", tag("file"))));
+    }
+    auto entries = subtree(source);
+    if (move) {
+        removeEntry(source);
+    }
+    insertSubtree(entries, source, target, move);
+    return jsonResponse(QJsonObject { { "metadata", metadata(key(target)) } });
+}
+
+FakeHttpServer::Response FakeDropboxServer::handleCreateFolderBatch(const QJsonObject& arg)
+{
+    QJsonArray entries;
+    const auto paths = arg.value("paths").toArray();
+    for (const auto& path : paths) {
+        QJsonObject error;
+        auto result = createFolder(path.toString(), error);
+        if (error.isEmpty()) {
+            entries << QJsonObject { { ".tag", "success" }, { "metadata", result } };
+        } else {
+            entries << QJsonObject { { ".tag", "failure" }, { "failure", tag("path", error) } };
+        }
+    }
+    return jsonResponse(QJsonObject { { ".tag", "complete" }, { "entries", entries } });
+}
+
+FakeHttpServer::Response FakeDropboxServer::handleDeleteBatch(const QJsonObject& arg)
+{
+    QJsonArray entries;
+    const auto args = arg.value("entries").toArray();
+    for (const auto& entryArg : args) {
+        auto entryObject = entryArg.toObject();
+        QJsonObject error;
+        auto result = deleteResource(entryObject.value("path").toString(),
+                                     entryObject.value("parent_rev"), error);
+        if (error.isEmpty()) {
+            entries << QJsonObject { { ".tag", "success" }, { "metadata", result } };
+        } else {
+            entries << QJsonObject { { ".tag", "failure" }, { "failure", error } };
+        }
+    }
+    return jsonResponse(QJsonObject { { ".tag", "complete" }, { "entries", entries } });
+}
+
+FakeHttpServer::Response FakeDropboxServer::handleUploadSessionStart(const QByteArray& data)
+{
+    auto sessionId = QString("session%1").arg(m_nextId++);
+    m_uploadSessions.insert(sessionId, data);
+    return jsonResponse(QJsonObject { { "session_id", sessionId } });
+}
+
+FakeHttpServer::Response
+FakeDropboxServer::handleUploadSessionFinishBatch(const QJsonObject& arg)
+{
+    QJsonArray entries;
+    const auto args = arg.value("entries").toArray();
+    for (const auto& entryArg : args) {
+        auto cursorArg = entryArg.toObject().value("cursor").toObject();
+        auto commit = entryArg.toObject().value("commit").toObject();
+        auto sessionId = cursorArg.value("session_id").toString();
+        if (!m_uploadSessions.contains(sessionId)) {
+            entries << QJsonObject { { ".tag", "failure" },
+                                     { "failure", tag("lookup_failed", tag("not_found")) } };
+            continue;
+        }
+        auto data = m_uploadSessions.take(sessionId);
+        if (static_cast<qint64>(cursorArg.value("offset").toDouble()) != data.size()) {
+            entries << QJsonObject { { ".tag", "failure" },
+                                     { "failure", tag("lookup_failed", tag("incorrect_offset")) } };
+            continue;
+        }
+        QJsonObject reason;
+        auto result = upload(commit.value("path").toString(), commit.value("mode"), data, reason);
+        if (reason.isEmpty()) {
+            // Successful entries are file metadata with an additional tag:
+            result.insert(".tag", "success");
+            entries << result;
+        } else {
+            entries << QJsonObject { { ".tag", "failure" }, { "failure", tag("path", reason) } };
+        }
+    }
+    return jsonResponse(QJsonObject { { "entries", entries } });
+}
+
+} // namespace UnitTest
+} // namespace SynqClient
@@ -0,0 +1,113 @@
+#ifndef SYNQCLIENT_UT_FAKEDROPBOXSERVER_H_
+#define SYNQCLIENT_UT_FAKEDROPBOXSERVER_H_
+
+#include <QDateTime>
+#include <QJsonObject>
+#include <QMap>
+#include <QVector>
+
+#include "fakehttpserver.h"
+
+namespace SynqClient {
+namespace UnitTest {
+
+/**
+ * @brief An in-memory server implementing the parts of the Dropbox API used by the library.
+ *
+ * As the Dropbox jobs use fixed URLs, requests must be redirected to this server, e.g. by using a
+ * RedirectingNetworkAccessManager. The server accepts any bearer token.
+ *
+ * Like on Dropbox, paths are case insensitive and parent folders are created implicitly when
+ * uploading files or creating folders.
+ */
+class FakeDropboxServer : public FakeHttpServer
+{
+    Q_OBJECT
+
+public:
+    explicit FakeDropboxServer(QObject* parent = nullptr);
+    ~FakeDropboxServer() override;
+
+    int longpollTimeout() const;
+    void setLongpollTimeout(int longpollTimeout);
+
+    void putFile(const QString& path, const QByteArray& data);
+    void makeDirectory(const QString& path);
+    void remove(const QString& path);
+    bool exists(const QString& path) const;
+    bool isDirectory(const QString& path) const;
+    QByteArray fileData(const QString& path) const;
+
+    static QString contentHash(const QByteArray& data);
+
+protected:
+    Response handleRequest(const Request& request) override;
+
+private:
+    struct Entry
+    {
+        bool isDirectory = false;
+        QString path;
+        QByteArray data;
+        quint64 rev = 0;
+        QString id;
+        QDateTime serverModified;
+    };
+
+    struct Change
+    {
+        quint64 sequence;
+        QString path;
+        QString displayPath;
+    };
+
+    QMap<QString, Entry> m_entries;
+    QVector<Change> m_changes;
+    quint64 m_sequence;
+    quint64 m_nextId;
+    int m_longpollTimeout;
+    QMap<QString, QByteArray> m_uploadSessions;
+
+    static QString key(const QString& path);
+
+    QJsonObject metadata(const QString& key) const;
+    QStringList children(const QString& path, bool recursive) const;
+    bool hasFileAncestor(const QString& path) const;
+    QString cursor(const QString& path, bool recursive) const;
+    QVector<Change> changesSince(const QString& cursor, QString& path, bool& recursive,
+                                 bool& ok) const;
+
+    void recordChange(const QString& path);
+    void createParents(const QString& path);
+    void writeFile(const QString& path, const QByteArray& data);
+    void createDirectory(const QString& path);
+    void removeEntry(const QString& path);
+    QVector<Entry> subtree(const QString& path) const;
+    void insertSubtree(const QVector<Entry>& entries, const QString& source,
+                       const QString& target, bool keepIds);
+
+    QJsonObject upload(const QString& path, const QJsonValue& mode, const QByteArray& data,
+                       QJsonObject& error);
+    QJsonObject createFolder(const QString& path, QJsonObject& error);
+    QJsonObject deleteResource(const QString& path, const QJsonValue& parentRev,
+                               QJsonObject& error);
+
+    Response handleListFolder(const QJsonObject& arg);
+    Response handleListFolderContinue(const QJsonObject& arg);
+    Response handleLongpoll(const QJsonObject& arg);
+    Response handleGetMetadata(const QJsonObject& arg);
+    Response handleDownload(const QJsonObject& arg);
+    Response handleUpload(const QJsonObject& arg, const QByteArray& data);
+    Response handleCreateFolder(const QJsonObject& arg);
+    Response handleDelete(const QJsonObject& arg);
+    Response handleMoveOrCopy(const QJsonObject& arg, bool move);
+    Response handleCreateFolderBatch(const QJsonObject& arg);
+    Response handleDeleteBatch(const QJsonObject& arg);
+    Response handleUploadSessionStart(const QByteArray& data);
+    Response handleUploadSessionFinishBatch(const QJsonObject& arg);
+};
+
+} // namespace UnitTest
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_UT_FAKEDROPBOXSERVER_H_
@@ -0,0 +1,405 @@
+#include "fakehttpserver.h"
+
+#include <QNetworkRequest>
+#include <QTcpSocket>
+#include <QTimer>
+
+namespace SynqClient {
+namespace UnitTest {
+
+namespace {
+
+// The interval in which bandwidth limited responses are sent in slices:
+const int BandwidthSliceInterval = 20;
+
+} // namespace
+
+FakeHttpServer::FakeHttpServer(QObject* parent)
+    : QObject(parent),
+      m_server(),
+      m_connections(),
+      m_latency(0),
+      m_bandwidth(0),
+      m_tooManyRequestsInterval(0),
+      m_retryAfter(1),
+      m_numRequests(0),
+      m_numRequestsByMethod(),
+      m_numTooManyRequests(0),
+      m_parallelRequests(0),
+      m_maxParallelRequests(0),
+      m_bytesReceived(0),
+      m_bytesSent(0)
+{
+    connect(&m_server, &QTcpServer::newConnection, this, &FakeHttpServer::onNewConnection);
+}
+
+FakeHttpServer::~FakeHttpServer()
+{
+    m_server.close();
+    const auto sockets = m_connections.keys();
+    for (auto socket : sockets) {
+        socket->disconnect(this);
+        socket->abort();
+        delete socket;
+    }
+}
+
+/**
+ * @brief Start listening on a random port of the loopback interface.
+ */
+bool FakeHttpServer::listen()
+{
+    return m_server.listen(QHostAddress::LocalHost);
+}
+
+/**
+ * @brief The URL of the server, e.g. http://127.0.0.1:12345.
+ */
+QUrl FakeHttpServer::serverUrl() const
+{
+    QUrl url;
+    url.setScheme("http");
+    url.setHost(m_server.serverAddress().toString());
+    url.setPort(m_server.serverPort());
+    return url;
+}
+
+/**
+ * @brief The time in milliseconds the server waits before answering a request.
+ */
+int FakeHttpServer::latency() const
+{
+    return m_latency;
+}
+
+void FakeHttpServer::setLatency(int latency)
+{
+    m_latency = latency;
+}
+
+/**
+ * @brief The bandwidth in bytes per second.
+ *
+ * If set to a value larger than 0, sending responses is throttled accordingly. Request bodies are
+ * processed only after the time it would take to transfer them with this bandwidth. By default,
+ * the bandwidth is not limited.
+ */
+qint64 FakeHttpServer::bandwidth() const
+{
+    return m_bandwidth;
+}
+
+void FakeHttpServer::setBandwidth(qint64 bandwidth)
+{
+    m_bandwidth = bandwidth;
+}
+
+/**
+ * @brief Answer every n-th request with "429 Too Many Requests".
+ *
+ * If set to a value larger than 0, every n-th request is rejected instead of being processed. Set
+ * to 0 (the default) to disable this.
+ */
+int FakeHttpServer::tooManyRequestsInterval() const
+{
+    return m_tooManyRequestsInterval;
+}
+
+void FakeHttpServer::setTooManyRequestsInterval(int interval)
+{
+    m_tooManyRequestsInterval = interval;
+}
+
+/**
+ * @brief The value of the Retry-After header sent with "429 Too Many Requests" responses.
+ */
+int FakeHttpServer::retryAfter() const
+{
+    return m_retryAfter;
+}
+
+void FakeHttpServer::setRetryAfter(int retryAfter)
+{
+    m_retryAfter = retryAfter;
+}
+
+/**
+ * @brief The number of requests received (including rejected ones).
+ */
+int FakeHttpServer::numRequests() const
+{
+    return m_numRequests;
+}
+
+/**
+ * @brief The number of requests received using the HTTP @p method.
+ */
+int FakeHttpServer::numRequests(const QByteArray& method) const
+{
+    return m_numRequestsByMethod.value(method);
+}
+
+/**
+ * @brief The number of requests which have been answered with "429 Too Many Requests".
+ */
+int FakeHttpServer::numTooManyRequests() const
+{
+    return m_numTooManyRequests;
+}
+
+/**
+ * @brief The maximum number of requests which have been processed at the same time.
+ */
+int FakeHttpServer::maxParallelRequests() const
+{
+    return m_maxParallelRequests;
+}
+
+/**
+ * @brief The number of bytes received, including headers.
+ */
+qint64 FakeHttpServer::bytesReceived() const
+{
+    return m_bytesReceived;
+}
+
+/**
+ * @brief The number of bytes sent, including headers.
+ */
+qint64 FakeHttpServer::bytesSent() const
+{
+    return m_bytesSent;
+}
+
+/**
+ * @brief Reset all statistics collected so far.
+ */
+void FakeHttpServer::resetStatistics()
+{
+    m_numRequests = 0;
+    m_numRequestsByMethod.clear();
+    m_numTooManyRequests = 0;
+    m_maxParallelRequests = m_parallelRequests;
+    m_bytesReceived = 0;
+    m_bytesSent = 0;
+}
+
+/**
+ * @brief The reason phrase to send for the given HTTP @p status.
+ */
+QByteArray FakeHttpServer::reasonPhrase(int status)
+{
+    switch (status) {
+    case 200:
+        return "OK";
+    case 201:
+        return "Created";
+    case 204:
+        return "No Content";
+    case 207:
+        return "Multi-Status";
+    case 400:
+        return "Bad Request";
+    case 401:
+        return "Unauthorized";
+    case 403:
+        return "Forbidden";
+    case 404:
+        return "Not Found";
+    case 405:
+        return "Method Not Allowed";
+    case 409:
+        return "Conflict";
+    case 412:
+        return "Precondition Failed";
+    case 429:
+        return "Too Many Requests";
+    case 501:
+        return "Not Implemented";
+    default:
+        return "Unknown";
+    }
+}
+
+void FakeHttpServer::onNewConnection()
+{
+    while (m_server.hasPendingConnections()) {
+        auto socket = m_server.nextPendingConnection();
+        socket->setParent(nullptr);
+        m_connections.insert(socket, Connection());
+        connect(socket, &QTcpSocket::readyRead, this, [=]() { processData(socket); });
+        connect(socket, &QTcpSocket::disconnected, this, [=]() {
+            if (m_connections.value(socket).busy) {
+                --m_parallelRequests;
+            }
+            m_connections.remove(socket);
+            socket->deleteLater();
+        });
+    }
+}
+
+void FakeHttpServer::processData(QTcpSocket* socket)
+{
+    if (!m_connections.contains(socket)) {
+        return;
+    }
+    auto& connection = m_connections[socket];
+    auto data = socket->readAll();
+    m_bytesReceived += data.length();
+    connection.buffer.append(data);
+    if (connection.busy) {
+        // We read the next request once the current one has been answered:
+        return;
+    }
+
+    if (connection.contentLength < 0) {
+        auto end = connection.buffer.indexOf("\r\n\r\n");
+        if (end < 0) {
+            return;
+        }
+        auto lines = connection.buffer.left(end).split('\n');
+        connection.buffer.remove(0, end + 4);
+        auto requestLine = lines.takeFirst().trimmed().split(' ');
+        if (requestLine.length() < 3) {
+            socket->abort();
+            return;
+        }
+        Request request;
+        request.method = requestLine.at(0);
+        QUrl target(QString::fromUtf8(requestLine.at(1)));
+        request.path = target.path(QUrl::FullyDecoded);
+        request.query = QUrlQuery(target);
+        for (const auto& line : qAsConst(lines)) {
+            auto colon = line.indexOf(':');
+            if (colon > 0) {
+                request.headers.insert(line.left(colon).trimmed().toLower(),
+                                       line.mid(colon + 1).trimmed());
+            }
+        }
+        connection.request = request;
+        connection.contentLength = request.header("Content-Length").toLongLong();
+        connection.close = request.header("Connection").toLower() == "close";
+    }
+
+    if (connection.buffer.length() < connection.contentLength) {
+        return;
+    }
+    connection.request.body = connection.buffer.left(static_cast<int>(connection.contentLength));
+    connection.buffer.remove(0, static_cast<int>(connection.contentLength));
+    connection.contentLength = -1;
+    connection.busy = true;
+    processRequest(socket);
+}
+
+void FakeHttpServer::processRequest(QTcpSocket* socket)
+{
+    auto request = m_connections.value(socket).request;
+    ++m_numRequests;
+    ++m_numRequestsByMethod[request.method];
+    ++m_parallelRequests;
+    m_maxParallelRequests = qMax(m_maxParallelRequests, m_parallelRequests);
+
+    Response response;
+    if (m_tooManyRequestsInterval > 0 && m_numRequests % m_tooManyRequestsInterval == 0) {
+        ++m_numTooManyRequests;
+        response.status = 429;
+        response.setHeader("Retry-After", QByteArray::number(m_retryAfter));
+    } else {
+        response = handleRequest(request);
+    }
+
+    auto delay = m_latency + response.delay + transferTime(request.body.length());
+    QTimer::singleShot(delay, socket, [=]() { sendResponse(socket, response); });
+}
+
+void FakeHttpServer::sendResponse(QTcpSocket* socket, const Response& response)
+{
+    if (!m_connections.contains(socket)) {
+        // The client closed the connection in the meantime.
+        return;
+    }
+    QByteArray header = "HTTP/1.1 " + QByteArray::number(response.status) + " "
+            + reasonPhrase(response.status) + "\r\n";
+    bool hasContentType = false;
+    for (const auto& h : response.headers) {
+        header += h.first + ": " + h.second + "\r\n";
+        hasContentType = hasContentType || h.first.toLower() == "content-type";
+    }
+    if (!hasContentType && !response.body.isEmpty()) {
+        header += "Content-Type: application/octet-stream\r\n";
+    }
+    header += "Content-Length: " + QByteArray::number(response.body.length()) + "\r\n";
+    if (m_connections.value(socket).close) {
+        header += "Connection: close\r\n";
+    }
+    header += "\r\n";
+    m_bytesSent += socket->write(header);
+    sendBody(socket, response.body, 0);
+}
+
+void FakeHttpServer::sendBody(QTcpSocket* socket, const QByteArray& body, qint64 offset)
+{
+    if (!m_connections.contains(socket)) {
+        return;
+    }
+    if (m_bandwidth <= 0) {
+        m_bytesSent += socket->write(body.mid(static_cast<int>(offset)));
+        finishResponse(socket);
+        return;
+    }
+    auto sliceSize = qMax<qint64>(1, m_bandwidth * BandwidthSliceInterval / 1000);
+    auto slice = body.mid(static_cast<int>(offset), static_cast<int>(sliceSize));
+    m_bytesSent += socket->write(slice);
+    offset += slice.length();
+    if (offset < body.length()) {
+        QTimer::singleShot(BandwidthSliceInterval, socket,
+                           [=]() { sendBody(socket, body, offset); });
+    } else {
+        finishResponse(socket);
+    }
+}
+
+void FakeHttpServer::finishResponse(QTcpSocket* socket)
+{
+    --m_parallelRequests;
+    auto& connection = m_connections[socket];
+    connection.busy = false;
+    if (connection.close) {
+        socket->disconnectFromHost();
+    } else if (!connection.buffer.isEmpty()) {
+        // Process the next request which might already have been received:
+        QTimer::singleShot(0, socket, [=]() { processData(socket); });
+    }
+}
+
+int FakeHttpServer::transferTime(qint64 bytes) const
+{
+    if (m_bandwidth <= 0) {
+        return 0;
+    }
+    return static_cast<int>(bytes * 1000 / m_bandwidth);
+}
+
+RedirectingNetworkAccessManager::RedirectingNetworkAccessManager(const QUrl& target,
+                                                                 QObject* parent)
+    : QNetworkAccessManager(parent), m_target(target)
+{
+}
+
+QNetworkReply* RedirectingNetworkAccessManager::createRequest(Operation op,
+                                                              const QNetworkRequest& request,
+                                                              QIODevice* outgoingData)
+{
+    auto redirectedRequest = request;
+    auto url = request.url();
+    url.setScheme(m_target.scheme());
+    url.setHost(m_target.host());
+    url.setPort(m_target.port());
+    redirectedRequest.setUrl(url);
+    // The fake servers only speak HTTP/1.1:
+    redirectedRequest.setAttribute(QNetworkRequest::Http2AllowedAttribute, false);
+    return QNetworkAccessManager::createRequest(op, redirectedRequest, outgoingData);
+}
+
+} // namespace UnitTest
+} // namespace SynqClient
@@ -0,0 +1,154 @@
+#ifndef SYNQCLIENT_UT_FAKEHTTPSERVER_H_
+#define SYNQCLIENT_UT_FAKEHTTPSERVER_H_
+
+#include <QByteArray>
+#include <QHash>
+#include <QList>
+#include <QMap>
+#include <QNetworkAccessManager>
+#include <QObject>
+#include <QPair>
+#include <QString>
+#include <QTcpServer>
+#include <QUrl>
+#include <QUrlQuery>
+
+class QTcpSocket;
+
+namespace SynqClient {
+namespace UnitTest {
+
+/**
+ * @brief A minimal HTTP/1.1 server running inside the test process.
+ *
+ * This is the base for the fake servers used to run tests and benchmarks without a real backend.
+ * The server listens on the loopback interface and hands each request to handleRequest(). To
+ * emulate real world conditions, a latency per request, a bandwidth limit and the injection of
+ * "429 Too Many Requests" responses can be configured.
+ */
+class FakeHttpServer : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Request
+    {
+        QByteArray method;
+        QString path;
+        QUrlQuery query;
+        QMap<QByteArray, QByteArray> headers;
+        QByteArray body;
+
+        QByteArray header(const QByteArray& name) const { return headers.value(name.toLower()); }
+    };
+
+    struct Response
+    {
+        int status = 200;
+        QList<QPair<QByteArray, QByteArray>> headers;
+        QByteArray body;
+        int delay = 0;
+
+        Response() {}
+        explicit Response(int status, const QByteArray& body = QByteArray())
+            : status(status), body(body)
+        {
+        }
+
+        Response& setHeader(const QByteArray& name, const QByteArray& value)
+        {
+            headers << qMakePair(name, value);
+            return *this;
+        }
+    };
+
+    explicit FakeHttpServer(QObject* parent = nullptr);
+    ~FakeHttpServer() override;
+
+    bool listen();
+    QUrl serverUrl() const;
+
+    int latency() const;
+    void setLatency(int latency);
+
+    qint64 bandwidth() const;
+    void setBandwidth(qint64 bandwidth);
+
+    int tooManyRequestsInterval() const;
+    void setTooManyRequestsInterval(int interval);
+
+    int retryAfter() const;
+    void setRetryAfter(int retryAfter);
+
+    int numRequests() const;
+    int numRequests(const QByteArray& method) const;
+    int numTooManyRequests() const;
+    int maxParallelRequests() const;
+    qint64 bytesReceived() const;
+    qint64 bytesSent() const;
+    void resetStatistics();
+
+protected:
+    virtual Response handleRequest(const Request& request) = 0;
+
+    static QByteArray reasonPhrase(int status);
+
+private:
+    struct Connection
+    {
+        QByteArray buffer;
+        Request request;
+        qint64 contentLength = -1;
+        bool busy = false;
+        bool close = false;
+    };
+
+    QTcpServer m_server;
+    QHash<QTcpSocket*, Connection> m_connections;
+    int m_latency;
+    qint64 m_bandwidth;
+    int m_tooManyRequestsInterval;
+    int m_retryAfter;
+    int m_numRequests;
+    QHash<QByteArray, int> m_numRequestsByMethod;
+    int m_numTooManyRequests;
+    int m_parallelRequests;
+    int m_maxParallelRequests;
+    qint64 m_bytesReceived;
+    qint64 m_bytesSent;
+
+    void onNewConnection();
+    void processData(QTcpSocket* socket);
+    void processRequest(QTcpSocket* socket);
+    void sendResponse(QTcpSocket* socket, const Response& response);
+    void sendBody(QTcpSocket* socket, const QByteArray& body, qint64 offset);
+    void finishResponse(QTcpSocket* socket);
+    int transferTime(qint64 bytes) const;
+};
+
+/**
+ * @brief A network access manager sending all requests to a fake server.
+ *
+ * Some backends (like Dropbox) use fixed URLs. This class rewrites the scheme, host and port of
+ * each request, so that it is sent to the @p target (usually the FakeHttpServer::serverUrl())
+ * instead.
+ */
+class RedirectingNetworkAccessManager : public QNetworkAccessManager
+{
+    Q_OBJECT
+
+public:
+    explicit RedirectingNetworkAccessManager(const QUrl& target, QObject* parent = nullptr);
+
+protected:
+    QNetworkReply* createRequest(Operation op, const QNetworkRequest& request,
+                                 QIODevice* outgoingData = nullptr) override;
+
+private:
+    QUrl m_target;
+};
+
+} // namespace UnitTest
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_UT_FAKEHTTPSERVER_H_
@@ -0,0 +1,815 @@
+#include "fakewebdavserver.h"
+
+#include <QCryptographicHash>
+#include <QDir>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QLocale>
+#include <QSet>
+#include <QXmlStreamReader>
+#include <QXmlStreamWriter>
+
+#include "utils.h"
+
+namespace SynqClient {
+namespace UnitTest {
+
+namespace {
+
+const char* DAVNamespace = "DAV:";
+const char* OwnCloudNamespace = "http://owncloud.org/ns";
+const char* SyncTokenPrefix = "http://synqclient.fake/sync/";
+
+QString cleanPath(const QString& path)
+{
+    return QDir::cleanPath("/" + path);
+}
+
+QString parentPath(const QString& path)
+{
+    if (path == "/") {
+        return QString();
+    }
+    auto index = path.lastIndexOf('/');
+    if (index <= 0) {
+        return "/";
+    }
+    return path.left(index);
+}
+
+QByteArray sha1(const QByteArray& data)
+{
+    return QCryptographicHash::hash(data, QCryptographicHash::Sha1).toHex();
+}
+
+FakeHttpServer::Response xmlResponse(int status, const QByteArray& body)
+{
+    FakeHttpServer::Response response(status, body);
+    response.setHeader("Content-Type", "application/xml; charset=utf-8");
+    return response;
+}
+
+} // namespace
+
+FakeWebDAVServer::FakeWebDAVServer(WebDAVServerType serverType, QObject* parent)
+    : FakeHttpServer(parent),
+      m_serverType(serverType),
+      m_quirks(WebDAVWorkaround::NoWorkarounds),
+      m_flags(static_cast<int>(WebDAVServerFlag::Empty)),
+      m_syncCollectionSupported(false),
+      m_bulkUploadSupported(true),
+      m_corruptDownloads(false),
+      m_entries(),
+      m_changes(),
+      m_version(0),
+      m_nextInode(1)
+{
+    createDirectory("/");
+}
+
+FakeWebDAVServer::~FakeWebDAVServer() {}
+
+/**
+ * @brief The type of server emulated.
+ */
+WebDAVServerType FakeWebDAVServer::serverType() const
+{
+    return m_serverType;
+}
+
+/**
+ * @brief The URL to configure in jobs and job factories to talk to this server.
+ */
+QUrl FakeWebDAVServer::url() const
+{
+    auto result = serverUrl();
+    if (m_serverType == WebDAVServerType::Generic) {
+        // NextCloud and ownCloud servers are addressed by their root URL:
+        result.setPath(prefix());
+    }
+    return result;
+}
+
+/**
+ * @brief Misbehavior of real world servers to emulate.
+ *
+ * Each flag set makes the server behave like the servers the corresponding workaround is meant
+ * for:
+ *
+ * - WebDAVWorkaround::NoRecursiveFolderETags: Changing a resource only updates the ETag of its
+ *   direct parent folder, not the ones of folders further up the hierarchy.
+ * - WebDAVWorkaround::InconsistentETagsUsingPROPFINDAndGET: GET requests report another ETag
+ *   than PROPFIND requests.
+ * - WebDAVWorkaround::DerivePROPFINDETagsFromGETETagsForApache: Like Apache's mod_dav, PROPFIND
+ *   reports ETags of the form "size-mtime" while GET reports ones of the form
+ *   "inode-size-mtime". No ETag is sent when uploading files.
+ */
+WebDAVWorkarounds FakeWebDAVServer::quirks() const
+{
+    return m_quirks;
+}
+
+void FakeWebDAVServer::setQuirks(WebDAVWorkarounds quirks)
+{
+    m_quirks = quirks;
+}
+
+/**
+ * @brief The WebDAVServerFlag values describing the server.
+ *
+ * These are the same flags which can be specified for real servers used in tests: If
+ * WebDAVServerFlag::NoIfMatch is set, the If-Match header is ignored. If
+ * WebDAVServerFlag::NoEtagOnDownload is set, no ETag is sent when downloading files.
+ */
+int FakeWebDAVServer::flags() const
+{
+    return m_flags;
+}
+
+void FakeWebDAVServer::setFlags(int flags)
+{
+    m_flags = flags;
+}
+
+/**
+ * @brief Whether the server answers sync-collection REPORTs (see RFC 6578).
+ *
+ * This is disabled by default, in which case such reports are answered with "501 Not
+ * Implemented".
+ */
+bool FakeWebDAVServer::syncCollectionSupported() const
+{
+    return m_syncCollectionSupported;
+}
+
+void FakeWebDAVServer::setSyncCollectionSupported(bool syncCollectionSupported)
+{
+    m_syncCollectionSupported = syncCollectionSupported;
+}
+
+/**
+ * @brief Whether the server provides NextCloud's bulk upload endpoint.
+ *
+ * This is enabled by default but only takes effect when emulating NextCloud. If disabled, bulk
+ * uploads are answered with "404 Not Found", like older NextCloud versions do.
+ */
+bool FakeWebDAVServer::bulkUploadSupported() const
+{
+    return m_bulkUploadSupported;
+}
+
+void FakeWebDAVServer::setBulkUploadSupported(bool bulkUploadSupported)
+{
+    m_bulkUploadSupported = bulkUploadSupported;
+}
+
+/**
+ * @brief Whether the data of downloaded files is corrupted in transit.
+ *
+ * If enabled, the last byte of each downloaded file is altered, while the headers (like the
+ * OC-Checksum) still describe the stored data. This is disabled by default.
+ */
+bool FakeWebDAVServer::corruptDownloads() const
+{
+    return m_corruptDownloads;
+}
+
+void FakeWebDAVServer::setCorruptDownloads(bool corruptDownloads)
+{
+    m_corruptDownloads = corruptDownloads;
+}
+
+/**
+ * @brief Store a file on the server, creating missing parent folders.
+ */
+void FakeWebDAVServer::putFile(const QString& path, const QByteArray& data)
+{
+    auto filePath = cleanPath(path);
+    makeDirectory(parentPath(filePath));
+    writeFile(filePath, data);
+}
+
+/**
+ * @brief Create a folder on the server, including missing parent folders.
+ */
+void FakeWebDAVServer::makeDirectory(const QString& path)
+{
+    auto dirPath = cleanPath(path);
+    if (m_entries.contains(dirPath)) {
+        return;
+    }
+    makeDirectory(parentPath(dirPath));
+    createDirectory(dirPath);
+}
+
+/**
+ * @brief Remove the resource at the @p path (including its children) from the server.
+ */
+void FakeWebDAVServer::remove(const QString& path)
+{
+    auto resourcePath = cleanPath(path);
+    if (resourcePath != "/" && m_entries.contains(resourcePath)) {
+        removeEntry(resourcePath);
+    }
+}
+
+/**
+ * @brief Move the resource at @p source (including its children) to @p target on the server.
+ *
+ * Like a MOVE request, this keeps the file IDs and ETags of the moved resources. Missing parent
+ * folders of the target are created.
+ */
+void FakeWebDAVServer::move(const QString& source, const QString& target)
+{
+    auto sourcePath = cleanPath(source);
+    auto targetPath = cleanPath(target);
+    if (sourcePath != "/" && m_entries.contains(sourcePath) && !m_entries.contains(targetPath)) {
+        makeDirectory(parentPath(targetPath));
+        copyEntry(sourcePath, targetPath, true);
+        removeEntry(sourcePath);
+    }
+}
+
+/**
+ * @brief Check if a resource exists on the server.
+ */
+bool FakeWebDAVServer::exists(const QString& path) const
+{
+    return m_entries.contains(cleanPath(path));
+}
+
+/**
+ * @brief Check if the resource at the @p path is a folder.
+ */
+bool FakeWebDAVServer::isDirectory(const QString& path) const
+{
+    return m_entries.value(cleanPath(path)).isDirectory;
+}
+
+/**
+ * @brief The content of the file at the @p path.
+ */
+QByteArray FakeWebDAVServer::fileData(const QString& path) const
+{
+    return m_entries.value(cleanPath(path)).data;
+}
+
+/**
+ * @brief Implementation of FakeHttpServer::handleRequest().
+ */
+FakeHttpServer::Response FakeWebDAVServer::handleRequest(const Request& request)
+{
+    if (m_serverType == WebDAVServerType::NextCloud && m_bulkUploadSupported
+        && request.method == "POST" && cleanPath(request.path) == "/remote.php/dav/bulk") {
+        return handleBulkUpload(request);
+    }
+    auto path = pathFromUrlPath(request.path);
+    if (path.isNull()) {
+        return Response(404);
+    }
+    if (request.method == "PROPFIND") {
+        return handlePropFind(request, path);
+    } else if (request.method == "GET") {
+        return handleGet(path);
+    } else if (request.method == "PUT") {
+        return handlePut(request, path);
+    } else if (request.method == "MKCOL") {
+        return handleMkCol(path);
+    } else if (request.method == "DELETE") {
+        return handleDelete(request, path);
+    } else if (request.method == "MOVE") {
+        return handleMoveOrCopy(request, path, true);
+    } else if (request.method == "COPY") {
+        return handleMoveOrCopy(request, path, false);
+    } else if (request.method == "REPORT") {
+        return handleReport(request, path);
+    }
+    return Response(405);
+}
+
+QString FakeWebDAVServer::prefix() const
+{
+    switch (m_serverType) {
+    case WebDAVServerType::NextCloud:
+    case WebDAVServerType::OwnCloud:
+        return "/remote.php/webdav";
+    case WebDAVServerType::Generic:
+        break;
+    }
+    return "/dav";
+}
+
+/**
+ * @brief Get the path of a resource from the path of a request URL.
+ *
+ * Returns a null string if the @p urlPath does not point to a resource within the WebDAV tree.
+ */
+QString FakeWebDAVServer::pathFromUrlPath(const QString& urlPath) const
+{
+    auto path = cleanPath(urlPath);
+    if (path == prefix()) {
+        return "/";
+    }
+    if (path.startsWith(prefix() + "/")) {
+        return path.mid(prefix().length());
+    }
+    return QString();
+}
+
+QString FakeWebDAVServer::hrefForPath(const QString& path) const
+{
+    QString href = prefix() + path;
+    if (m_entries.value(path).isDirectory && !href.endsWith("/")) {
+        href += "/";
+    }
+    return QString::fromUtf8(QUrl::toPercentEncoding(href, "/"));
+}
+
+/**
+ * @brief The paths of the resources within the folder at @p path, sorted by name.
+ */
+QStringList FakeWebDAVServer::children(const QString& path, bool recursive) const
+{
+    QStringList result;
+    auto childPrefix = path == "/" ? path : path + "/";
+    for (auto it = m_entries.lowerBound(childPrefix); it != m_entries.cend(); ++it) {
+        if (!it.key().startsWith(childPrefix)) {
+            break;
+        }
+        if (it.key() != path
+            && (recursive || !it.key().mid(childPrefix.length()).contains('/'))) {
+            result << it.key();
+        }
+    }
+    return result;
+}
+
+qint64 FakeWebDAVServer::recursiveSize(const QString& path) const
+{
+    qint64 result = m_entries.value(path).data.size();
+    const auto paths = children(path, true);
+    for (const auto& child : paths) {
+        result += m_entries.value(child).data.size();
+    }
+    return result;
+}
+
+QByteArray FakeWebDAVServer::propFindETag(const Entry& entry) const
+{
+    if (m_quirks.testFlag(WebDAVWorkaround::DerivePROPFINDETagsFromGETETagsForApache)) {
+        return "\"" + QByteArray::number(entry.data.size(), 16) + "-"
+                + QByteArray::number(entry.version, 16) + "\"";
+    }
+    return "\"" + QByteArray::number(entry.version) + "\"";
+}
+
+QByteArray FakeWebDAVServer::getETag(const Entry& entry) const
+{
+    if (m_quirks.testFlag(WebDAVWorkaround::DerivePROPFINDETagsFromGETETagsForApache)) {
+        return "\"" + QByteArray::number(entry.inode, 16) + "-"
+                + QByteArray::number(entry.data.size(), 16) + "-"
+                + QByteArray::number(entry.version, 16) + "\"";
+    }
+    if (m_quirks.testFlag(WebDAVWorkaround::InconsistentETagsUsingPROPFINDAndGET)) {
+        return "\"get-" + QByteArray::number(entry.version) + "\"";
+    }
+    return propFindETag(entry);
+}
+
+/**
+ * @brief Check the value of an If-Match header sent for the resource at @p path.
+ *
+ * To be able to use the server together with the quirks, both the ETags reported via PROPFIND
+ * and GET are accepted.
+ */
+bool FakeWebDAVServer::matchesETag(const QString& path, const QByteArray& etag) const
+{
+    if (m_flags & static_cast<int>(WebDAVServerFlag::NoIfMatch)) {
+        return true;
+    }
+    if (!m_entries.contains(path)) {
+        return false;
+    }
+    const auto& entry = m_entries[path];
+    return etag == propFindETag(entry) || etag == getETag(entry);
+}
+
+/**
+ * @brief Record a change of the resource at @p path.
+ *
+ * This assigns a new ETag to the resource and its parent folders.
+ */
+void FakeWebDAVServer::touch(const QString& path)
+{
+    ++m_version;
+    auto now = QDateTime::currentDateTimeUtc();
+    auto current = path;
+    while (!current.isNull()) {
+        if (m_entries.contains(current)) {
+            auto& entry = m_entries[current];
+            entry.version = m_version;
+            entry.lastModified = now;
+        }
+        m_changes << Change { m_version, current };
+        if (current != path
+            && m_quirks.testFlag(WebDAVWorkaround::NoRecursiveFolderETags)) {
+            // Only the direct parent is updated:
+            break;
+        }
+        current = parentPath(current);
+    }
+}
+
+void FakeWebDAVServer::writeFile(const QString& path, const QByteArray& data)
+{
+    auto& entry = m_entries[path];
+    if (entry.inode == 0) {
+        entry.inode = m_nextInode++;
+        entry.fileId = QString("%1ocfake").arg(entry.inode, 8, 10, QChar('0'));
+    }
+    entry.isDirectory = false;
+    entry.data = data;
+    touch(path);
+}
+
+void FakeWebDAVServer::createDirectory(const QString& path)
+{
+    Entry entry;
+    entry.isDirectory = true;
+    entry.inode = m_nextInode++;
+    entry.fileId = QString("%1ocfake").arg(entry.inode, 8, 10, QChar('0'));
+    m_entries[path] = entry;
+    touch(path);
+}
+
+void FakeWebDAVServer::removeEntry(const QString& path)
+{
+    auto paths = children(path, true);
+    paths.prepend(path);
+    for (const auto& removedPath : qAsConst(paths)) {
+        m_entries.remove(removedPath);
+        m_changes << Change { ++m_version, removedPath };
+    }
+    touch(parentPath(path));
+}
+
+void FakeWebDAVServer::copyEntry(const QString& source, const QString& target, bool keepFileIds)
+{
+    auto paths = children(source, true);
+    paths.prepend(source);
+    for (const auto& sourcePath : qAsConst(paths)) {
+        auto targetPath = target + sourcePath.mid(source.length());
+        auto entry = m_entries.value(sourcePath);
+        if (keepFileIds) {
+            // Moved resources keep their ETags (like on NextCloud):
+            m_entries[targetPath] = entry;
+            m_changes << Change { ++m_version, targetPath };
+        } else {
+            entry.inode = m_nextInode++;
+            entry.fileId = QString("%1ocfake").arg(entry.inode, 8, 10, QChar('0'));
+            m_entries[targetPath] = entry;
+            touch(targetPath);
+        }
+    }
+    if (keepFileIds) {
+        touch(parentPath(target));
+    }
+}
+
+void FakeWebDAVServer::writeResponse(QXmlStreamWriter& writer, const QString& path) const
+{
+    const auto& entry = m_entries[path];
+    auto isOwnCloud = m_serverType != WebDAVServerType::Generic;
+    writer.writeStartElement(DAVNamespace, "response");
+    writer.writeTextElement(DAVNamespace, "href", hrefForPath(path));
+    writer.writeStartElement(DAVNamespace, "propstat");
+    writer.writeStartElement(DAVNamespace, "prop");
+    writer.writeTextElement(DAVNamespace, "getetag", QString::fromUtf8(propFindETag(entry)));
+    writer.writeStartElement(DAVNamespace, "resourcetype");
+    if (entry.isDirectory) {
+        writer.writeEmptyElement(DAVNamespace, "collection");
+    }
+    writer.writeEndElement();
+    if (!entry.isDirectory) {
+        writer.writeTextElement(DAVNamespace, "getcontentlength",
+                                QString::number(entry.data.size()));
+    }
+    writer.writeTextElement(
+            DAVNamespace, "getlastmodified",
+            QLocale::c().toString(entry.lastModified, "ddd, dd MMM yyyy hh:mm:ss 'GMT'"));
+    if (isOwnCloud) {
+        writer.writeTextElement(OwnCloudNamespace, "fileid", entry.fileId);
+        writer.writeTextElement(OwnCloudNamespace, "size", QString::number(recursiveSize(path)));
+        if (!entry.isDirectory) {
+            writer.writeStartElement(OwnCloudNamespace, "checksums");
+            writer.writeTextElement(OwnCloudNamespace, "checksum",
+                                    "SHA1:" + QString::fromUtf8(sha1(entry.data)));
+            writer.writeEndElement();
+        }
+    }
+    writer.writeEndElement(); // prop
+    writer.writeTextElement(DAVNamespace, "status", "HTTP/1.1 200 OK");
+    writer.writeEndElement(); // propstat
+    writer.writeEndElement(); // response
+}
+
+FakeHttpServer::Response FakeWebDAVServer::handlePropFind(const Request& request,
+                                                          const QString& path)
+{
+    if (!m_entries.contains(path)) {
+        return Response(404);
+    }
+    QStringList paths { path };
+    if (request.header("Depth") != "0" && m_entries[path].isDirectory) {
+        paths << children(path, false);
+    }
+
+    QByteArray body;
+    QXmlStreamWriter writer(&body);
+    writer.writeStartDocument();
+    writer.writeNamespace(DAVNamespace, "d");
+    writer.writeNamespace(OwnCloudNamespace, "oc");
+    writer.writeStartElement(DAVNamespace, "multistatus");
+    for (const auto& entryPath : qAsConst(paths)) {
+        writeResponse(writer, entryPath);
+    }
+    writer.writeEndElement();
+    writer.writeEndDocument();
+    return xmlResponse(207, body);
+}
+
+FakeHttpServer::Response FakeWebDAVServer::handleGet(const QString& path)
+{
+    if (!m_entries.contains(path)) {
+        return Response(404);
+    }
+    const auto& entry = m_entries[path];
+    if (entry.isDirectory) {
+        return Response(405);
+    }
+    Response response(200, entry.data);
+    if (!(m_flags & static_cast<int>(WebDAVServerFlag::NoEtagOnDownload))) {
+        response.setHeader("ETag", getETag(entry));
+    }
+    if (m_serverType != WebDAVServerType::Generic) {
+        response.setHeader("OC-Checksum", "SHA1:" + sha1(entry.data));
+    }
+    if (m_corruptDownloads && !response.body.isEmpty()) {
+        auto last = response.body.size() - 1;
+        response.body[last] = static_cast<char>(response.body.at(last) ^ 0x01);
+    }
+    return response;
+}
+
+FakeHttpServer::Response FakeWebDAVServer::handlePut(const Request& request, const QString& path)
+{
+    auto parent = parentPath(path);
+    if (parent.isNull() || !m_entries.value(parent).isDirectory) {
+        return Response(409);
+    }
+    if (m_entries.value(path).isDirectory) {
+        return Response(405);
+    }
+    auto ifMatch = request.header("If-Match");
+    if (!ifMatch.isEmpty() && !matchesETag(path, ifMatch)) {
+        return Response(412);
+    }
+    auto checksum = request.header("OC-Checksum");
+    if (m_serverType != WebDAVServerType::Generic && checksum.startsWith("SHA1:")
+        && checksum.mid(5).toLower() != sha1(request.body)) {
+        return Response(400);
+    }
+    auto created = !m_entries.contains(path);
+    writeFile(path, request.body);
+
+    Response response(created ? 201 : 204);
+    if (!m_quirks.testFlag(WebDAVWorkaround::DerivePROPFINDETagsFromGETETagsForApache)) {
+        response.setHeader("ETag", propFindETag(m_entries[path]));
+    }
+    if (m_serverType != WebDAVServerType::Generic) {
+        response.setHeader("OC-Checksum", "SHA1:" + sha1(request.body));
+    }
+    return response;
+}
+
+FakeHttpServer::Response FakeWebDAVServer::handleMkCol(const QString& path)
+{
+    if (m_entries.contains(path)) {
+        return Response(405);
+    }
+    if (!m_entries.value(parentPath(path)).isDirectory) {
+        return Response(409);
+    }
+    createDirectory(path);
+    return Response(201);
+}
+
+FakeHttpServer::Response FakeWebDAVServer::handleDelete(const Request& request,
+                                                        const QString& path)
+{
+    if (path == "/") {
+        return Response(403);
+    }
+    if (!m_entries.contains(path)) {
+        return Response(404);
+    }
+    auto ifMatch = request.header("If-Match");
+    if (!ifMatch.isEmpty() && !matchesETag(path, ifMatch)) {
+        return Response(412);
+    }
+    removeEntry(path);
+    return Response(204);
+}
+
+FakeHttpServer::Response FakeWebDAVServer::handleMoveOrCopy(const Request& request,
+                                                            const QString& path, bool move)
+{
+    QUrl destination(QString::fromUtf8(request.header("Destination")));
+    auto target = pathFromUrlPath(destination.path(QUrl::FullyDecoded));
+    if (target.isNull()) {
+        return Response(400);
+    }
+    if (!m_entries.contains(path)) {
+        return Response(404);
+    }
+    if (path == "/" || target == "/" || target == path || target.startsWith(path + "/")) {
+        return Response(403);
+    }
+    if (!m_entries.value(parentPath(target)).isDirectory) {
+        return Response(409);
+    }
+    auto status = 201;
+    if (m_entries.contains(target)) {
+        if (request.header("Overwrite").toUpper() == "F") {
+            return Response(412);
+        }
+        removeEntry(target);
+        status = 204;
+    }
+    copyEntry(path, target, move);
+    if (move) {
+        removeEntry(path);
+    }
+    Response response(status);
+    if (!m_entries[target].isDirectory) {
+        response.setHeader("ETag", propFindETag(m_entries[target]));
+    }
+    return response;
+}
+
+FakeHttpServer::Response FakeWebDAVServer::handleReport(const Request& request,
+                                                        const QString& path)
+{
+    if (!m_syncCollectionSupported) {
+        return Response(501);
+    }
+    if (!m_entries.value(path).isDirectory) {
+        return Response(404);
+    }
+
+    QXmlStreamReader reader(request.body);
+    QString syncToken;
+    bool isSyncCollection = false;
+    while (!reader.atEnd()) {
+        if (reader.readNextStartElement()) {
+            if (reader.name() == QStringLiteral("sync-collection")) {
+                isSyncCollection = true;
+            } else if (reader.name() == QStringLiteral("sync-token")) {
+                syncToken = reader.readElementText();
+            }
+        }
+    }
+    if (!isSyncCollection) {
+        return Response(400);
+    }
+
+    QStringList paths;
+    if (syncToken.isEmpty()) {
+        paths = children(path, true);
+    } else {
+        bool ok = false;
+        auto sequence = syncToken.startsWith(SyncTokenPrefix)
+                ? syncToken.mid(QString(SyncTokenPrefix).length()).toULongLong(&ok)
+                : 0;
+        if (!ok || sequence > m_version) {
+            return xmlResponse(403,
+                               "<?xml version=\"1.0\"?><d:error xmlns:d=\"DAV:\">"
+                               "<d:valid-sync-token/></d:error>");
+        }
+        QSet<QString> seen;
+        auto childPrefix = path == "/" ? path : path + "/";
+        for (const auto& change : qAsConst(m_changes)) {
+            if (change.sequence > sequence && change.path.startsWith(childPrefix)
+                && !seen.contains(change.path)) {
+                seen.insert(change.path);
+                paths << change.path;
+            }
+        }
+    }
+
+    QByteArray body;
+    QXmlStreamWriter writer(&body);
+    writer.writeStartDocument();
+    writer.writeNamespace(DAVNamespace, "d");
+    writer.writeNamespace(OwnCloudNamespace, "oc");
+    writer.writeStartElement(DAVNamespace, "multistatus");
+    for (const auto& entryPath : qAsConst(paths)) {
+        if (m_entries.contains(entryPath)) {
+            writeResponse(writer, entryPath);
+        } else {
+            writer.writeStartElement(DAVNamespace, "response");
+            writer.writeTextElement(DAVNamespace, "href",
+                                    QString::fromUtf8(QUrl::toPercentEncoding(
+                                            prefix() + entryPath, "/")));
+            writer.writeTextElement(DAVNamespace, "status", "HTTP/1.1 404 Not Found");
+            writer.writeEndElement();
+        }
+    }
+    writer.writeTextElement(DAVNamespace, "sync-token",
+                            SyncTokenPrefix + QString::number(m_version));
+    writer.writeEndElement();
+    writer.writeEndDocument();
+    return xmlResponse(207, body);
+}
+
+/**
+ * @brief Handle a request to the NextCloud bulk upload endpoint.
+ *
+ * The request body is a multipart/related message with one part per file. The target path and
+ * the MD5 sum of each file are given in the X-File-Path and X-File-MD5 headers of its part. The
+ * result is reported per file as JSON object, using the file path as key.
+ */
+FakeHttpServer::Response FakeWebDAVServer::handleBulkUpload(const Request& request)
+{
+    QByteArray boundary;
+    const auto contentTypeParams = request.header("Content-Type").split(';');
+    for (const auto& param : contentTypeParams) {
+        auto trimmed = param.trimmed();
+        if (trimmed.startsWith("boundary=")) {
+            boundary = trimmed.mid(9);
+            if (boundary.startsWith('"') && boundary.endsWith('"')) {
+                boundary = boundary.mid(1, boundary.length() - 2);
+            }
+        }
+    }
+    if (boundary.isEmpty()) {
+        return Response(400);
+    }
+
+    QJsonObject results;
+    const auto delimiter = "--" + boundary;
+    auto pos = request.body.indexOf(delimiter);
+    while (pos >= 0) {
+        pos += delimiter.length();
+        if (request.body.mid(pos, 2) == "--") {
+            // Closing delimiter:
+            break;
+        }
+        auto headersEnd = request.body.indexOf("\r\n\r\n", pos);
+        if (headersEnd < 0) {
+            return Response(400);
+        }
+        QMap<QByteArray, QByteArray> headers;
+        const auto headerLines = request.body.mid(pos, headersEnd - pos).split('\n');
+        for (const auto& line : headerLines) {
+            auto colon = line.indexOf(':');
+            if (colon > 0) {
+                headers[line.left(colon).trimmed().toLower()] = line.mid(colon + 1).trimmed();
+            }
+        }
+        auto dataStart = headersEnd + 4;
+        auto nextPos = request.body.indexOf("\r\n" + delimiter, dataStart);
+        if (nextPos < 0) {
+            return Response(400);
+        }
+        auto data = request.body.mid(dataStart, nextPos - dataStart);
+        pos = nextPos + 2;
+
+        auto path = cleanPath(QString::fromUtf8(headers.value("x-file-path")));
+        auto parent = parentPath(path);
+        QJsonObject result;
+        if (headers.value("x-file-md5").toLower()
+            != QCryptographicHash::hash(data, QCryptographicHash::Md5).toHex()) {
+            result = { { "error", true }, { "message", "Computed md5 hash is incorrect." } };
+        } else if (parent.isNull() || !m_entries.value(parent).isDirectory
+                   || m_entries.value(path).isDirectory) {
+            result = { { "error", true }, { "message", "Cannot write file." } };
+        } else {
+            writeFile(path, data);
+            const auto& entry = m_entries[path];
+            // Unlike in ETag headers, NextCloud reports the etag without quotes here:
+            auto etag = QString::fromUtf8(propFindETag(entry));
+            etag.remove('"');
+            result = { { "error", false },
+                       { "etag", etag },
+                       { "fileid", static_cast<qint64>(entry.inode) } };
+        }
+        results.insert(path, result);
+    }
+    Response response(200, QJsonDocument(results).toJson(QJsonDocument::Compact));
+    response.setHeader("Content-Type", "application/json; charset=utf-8");
+    return response;
+}
+
+} // namespace UnitTest
+} // namespace SynqClient
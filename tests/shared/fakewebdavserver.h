@@ -0,0 +1,125 @@
+#ifndef SYNQCLIENT_UT_FAKEWEBDAVSERVER_H_
+#define SYNQCLIENT_UT_FAKEWEBDAVSERVER_H_
+
+#include <QDateTime>
+#include <QMap>
+#include <QVector>
+
+#include "SynqClient/libsynqclient.h"
+
+#include "fakehttpserver.h"
+
+class QXmlStreamWriter;
+
+namespace SynqClient {
+namespace UnitTest {
+
+/**
+ * @brief An in-memory WebDAV server.
+ *
+ * This server implements the subset of WebDAV used by the library (PROPFIND, GET, PUT, MKCOL,
+ * DELETE, MOVE, COPY and - optionally - sync-collection REPORTs). Depending on the server type,
+ * it either behaves like a generic WebDAV server or like NextCloud/ownCloud (including file IDs
+ * and checksums). When emulating NextCloud, the bulk upload endpoint is provided as well.
+ *
+ * Using setQuirks(), the server can emulate the misbehavior of real world servers which the
+ * WebDAVWorkaround flags are meant to work around.
+ */
+class FakeWebDAVServer : public FakeHttpServer
+{
+    Q_OBJECT
+
+public:
+    explicit FakeWebDAVServer(WebDAVServerType serverType = WebDAVServerType::Generic,
+                              QObject* parent = nullptr);
+    ~FakeWebDAVServer() override;
+
+    WebDAVServerType serverType() const;
+    QUrl url() const;
+
+    WebDAVWorkarounds quirks() const;
+    void setQuirks(WebDAVWorkarounds quirks);
+
+    int flags() const;
+    void setFlags(int flags);
+
+    bool syncCollectionSupported() const;
+    void setSyncCollectionSupported(bool syncCollectionSupported);
+
+    bool bulkUploadSupported() const;
+    void setBulkUploadSupported(bool bulkUploadSupported);
+
+    bool corruptDownloads() const;
+    void setCorruptDownloads(bool corruptDownloads);
+
+    void putFile(const QString& path, const QByteArray& data);
+    void makeDirectory(const QString& path);
+    void remove(const QString& path);
+    void move(const QString& source, const QString& target);
+    bool exists(const QString& path) const;
+    bool isDirectory(const QString& path) const;
+    QByteArray fileData(const QString& path) const;
+
+protected:
+    Response handleRequest(const Request& request) override;
+
+private:
+    struct Entry
+    {
+        bool isDirectory = false;
+        QByteArray data;
+        quint64 version = 0;
+        quint64 inode = 0;
+        QDateTime lastModified;
+        QString fileId;
+    };
+
+    struct Change
+    {
+        quint64 sequence;
+        QString path;
+    };
+
+    WebDAVServerType m_serverType;
+    WebDAVWorkarounds m_quirks;
+    int m_flags;
+    bool m_syncCollectionSupported;
+    bool m_bulkUploadSupported;
+    bool m_corruptDownloads;
+    QMap<QString, Entry> m_entries;
+    QVector<Change> m_changes;
+    quint64 m_version;
+    quint64 m_nextInode;
+
+    QString prefix() const;
+    QString pathFromUrlPath(const QString& urlPath) const;
+    QString hrefForPath(const QString& path) const;
+    QStringList children(const QString& path, bool recursive) const;
+    qint64 recursiveSize(const QString& path) const;
+
+    QByteArray propFindETag(const Entry& entry) const;
+    QByteArray getETag(const Entry& entry) const;
+    bool matchesETag(const QString& path, const QByteArray& etag) const;
+
+    void touch(const QString& path);
+    void writeFile(const QString& path, const QByteArray& data);
+    void createDirectory(const QString& path);
+    void removeEntry(const QString& path);
+    void copyEntry(const QString& source, const QString& target, bool keepFileIds);
+
+    void writeResponse(QXmlStreamWriter& writer, const QString& path) const;
+
+    Response handlePropFind(const Request& request, const QString& path);
+    Response handleGet(const QString& path);
+    Response handlePut(const Request& request, const QString& path);
+    Response handleMkCol(const QString& path);
+    Response handleDelete(const Request& request, const QString& path);
+    Response handleMoveOrCopy(const Request& request, const QString& path, bool move);
+    Response handleReport(const Request& request, const QString& path);
+    Response handleBulkUpload(const Request& request);
+};
+
+} // namespace UnitTest
+} // namespace SynqClient
+
+#endif // SYNQCLIENT_UT_FAKEWEBDAVSERVER_H_
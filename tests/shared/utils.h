@@ -3,12 +3,17 @@
 
 #include <tuple>
 
+#include <QFile>
+#include <QNetworkAccessManager>
 #include <QString>
 #include <QTest>
 #include <QUrl>
 #include <QtGlobal>
 
 #include "SynqClient/AbstractWebDAVJob"
+#include "SynqClient/DirectorySynchronizer"
+#include "SynqClient/JSONSyncStateDatabase"
+#include "SynqClient/WebDAVJobFactory"
 
 /**
  * @brief Utility macro to verify statements.
@@ -127,6 +132,59 @@ inline void setupWebDAVTestServerData()
     }
 }
 
+/**
+ * @brief Create @p count small files named `file-<i>.txt` in the folder at @p path.
+ *
+ * Each file contains its index as text.
+ */
+inline bool createFiles(const QString& path, int count)
+{
+    for (int i = 0; i < count; ++i) {
+        QFile file(path + QString("/file-%1.txt").arg(i));
+        SQ_VERIFY(file.open(QIODevice::WriteOnly));
+        SQ_VERIFY(file.write(QByteArray::number(i)) > 0);
+    }
+    return true;
+}
+
+/**
+ * @brief Create @p size bytes of test data.
+ *
+ * The data consists of numbered lines of 16 bytes each, so misplaced chunks are easy to spot.
+ * The default size of 8 MiB is much larger than the buffers used while transferring files.
+ */
+inline QByteArray createLargeData(int size = 8 * 1024 * 1024)
+{
+    QByteArray data;
+    data.reserve(size + 16);
+    for (int i = 0; data.size() < size; ++i) {
+        data.append(QByteArray::number(i).rightJustified(15, '0') + "\n");
+    }
+    data.truncate(size);
+    return data;
+}
+
+/**
+ * @brief Configure the @p synchronizer to sync against the WebDAV server at @p url.
+ *
+ * The @p localPath is synced with the @p remotePath, using @p nam to talk to the server and a
+ * JSONSyncStateDatabase stored in @p dbPath.
+ */
+inline void setupWebDAVSynchronizer(SynqClient::DirectorySynchronizer* synchronizer,
+                                    QNetworkAccessManager* nam, const QUrl& url,
+                                    const QString& localPath, const QString& remotePath,
+                                    const QString& dbPath)
+{
+    auto factory = new SynqClient::WebDAVJobFactory(synchronizer);
+    factory->setNetworkAccessManager(nam);
+    factory->setUrl(url);
+    auto db = new SynqClient::JSONSyncStateDatabase(dbPath, synchronizer);
+    synchronizer->setJobFactory(factory);
+    synchronizer->setSyncStateDatabase(db);
+    synchronizer->setLocalDirectoryPath(localPath);
+    synchronizer->setRemoteDirectoryPath(remotePath);
+}
+
 }
 }
 
@@ -0,0 +1,2 @@
+TESTNAME = syncorchestrator
+include(../test.pri)
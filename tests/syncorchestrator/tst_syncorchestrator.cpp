@@ -0,0 +1,285 @@
+#include <QDir>
+#include <QNetworkAccessManager>
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <QtTest>
+
+#include "../shared/fakewebdavserver.h"
+#include "../shared/utils.h"
+#include "SynqClient/DirectorySynchronizer"
+#include "SynqClient/SyncOrchestrator"
+
+using SynqClient::DirectorySynchronizer;
+using SynqClient::SynchronizerError;
+using SynqClient::SyncOrchestrator;
+using SynqClient::UnitTest::createFiles;
+using SynqClient::UnitTest::FakeWebDAVServer;
+using SynqClient::UnitTest::setupWebDAVSynchronizer;
+
+class SyncOrchestratorTest : public QObject
+{
+    Q_OBJECT
+
+public:
+    SyncOrchestratorTest();
+    ~SyncOrchestratorTest();
+
+private slots:
+    void initTestCase();
+    void sharedBudget();
+    void priorityAndStaleness();
+    void removeRunningRoot();
+    void separateAccounts();
+    void cleanupTestCase();
+
+private:
+    bool checkLimits(const SyncOrchestrator& orchestrator);
+    SyncOrchestrator::Setup makeSetup(const QUrl& url, const QString& localPath,
+                                      const QString& remotePath, const QString& dbPath);
+};
+
+SyncOrchestratorTest::SyncOrchestratorTest() {}
+
+SyncOrchestratorTest::~SyncOrchestratorTest() {}
+
+void SyncOrchestratorTest::initTestCase() {}
+
+void SyncOrchestratorTest::sharedBudget()
+{
+    // Two servers listening on different ports count as different hosts:
+    FakeWebDAVServer server1;
+    FakeWebDAVServer server2;
+    server1.setLatency(20);
+    server2.setLatency(20);
+    QVERIFY(server1.listen());
+    QVERIFY(server2.listen());
+    QTemporaryDir tmpDir;
+
+    SyncOrchestrator orchestrator;
+    orchestrator.setMaxJobs(5);
+    orchestrator.setMaxJobsPerHost(3);
+
+    QHash<int, QNetworkAccessManager*> nams;
+    QList<int> roots;
+    for (int i = 0; i < 8; ++i) {
+        auto url = i % 2 == 0 ? server1.url() : server2.url();
+        auto localPath = tmpDir.filePath(QString("local-%1").arg(i));
+        QVERIFY(QDir(tmpDir.path()).mkpath(localPath));
+        QVERIFY(createFiles(localPath, 5));
+        auto setup = makeSetup(url, localPath, QString("/sync-%1").arg(i),
+                               tmpDir.filePath(QString("db-%1.json").arg(i)));
+        roots << orchestrator.addRoot(
+                url, [=, &nams](DirectorySynchronizer* synchronizer, QNetworkAccessManager* nam) {
+                    nams[i] = nam;
+                    setup(synchronizer, nam);
+                });
+    }
+    QCOMPARE(orchestrator.roots(), roots);
+
+    int numLimitViolations = 0;
+    auto check = [&]() {
+        if (!checkLimits(orchestrator)) {
+            ++numLimitViolations;
+        }
+    };
+    connect(&orchestrator, &SyncOrchestrator::rootStarted, this, check);
+    connect(&orchestrator, &SyncOrchestrator::rootFinished, this, check);
+
+    QSignalSpy started(&orchestrator, &SyncOrchestrator::rootStarted);
+    QSignalSpy finished(&orchestrator, &SyncOrchestrator::rootFinished);
+    QSignalSpy idle(&orchestrator, &SyncOrchestrator::idle);
+    orchestrator.scheduleAll();
+    QCOMPARE(orchestrator.numQueued(), 8);
+    QVERIFY(idle.wait(30000));
+    QCOMPARE(idle.count(), 1);
+    QCOMPARE(started.count(), 8);
+    QCOMPARE(finished.count(), 8);
+    QCOMPARE(numLimitViolations, 0);
+    QCOMPARE(orchestrator.numQueued(), 0);
+    QCOMPARE(orchestrator.numRunning(), 0);
+
+    for (int i = 0; i < roots.length(); ++i) {
+        auto root = roots[i];
+        QCOMPARE(orchestrator.lastError(root), SynchronizerError::NoError);
+        QVERIFY(orchestrator.lastSync(root).isValid());
+        QCOMPARE(orchestrator.jobLimit(root), 0);
+        auto& server = i % 2 == 0 ? server1 : server2;
+        for (int j = 0; j < 5; ++j) {
+            QVERIFY(server.exists(QString("/sync-%1/file-%2.txt").arg(i).arg(j)));
+        }
+    }
+
+    // Roots talking to the same host share their network access manager:
+    QCOMPARE(nams[0], nams[2]);
+    QCOMPARE(nams[1], nams[3]);
+    QVERIFY(nams[0] != nams[1]);
+    QCOMPARE(nams[0], orchestrator.networkAccessManager(server1.url()));
+}
+
+void SyncOrchestratorTest::priorityAndStaleness()
+{
+    FakeWebDAVServer server;
+    QVERIFY(server.listen());
+    QTemporaryDir tmpDir;
+
+    SyncOrchestrator orchestrator;
+    orchestrator.setMaxJobs(1);
+    QList<int> roots;
+    for (int i = 0; i < 3; ++i) {
+        auto localPath = tmpDir.filePath(QString("local-%1").arg(i));
+        QVERIFY(QDir(tmpDir.path()).mkpath(localPath));
+        QVERIFY(createFiles(localPath, 1));
+        roots << orchestrator.addRoot(server.url(),
+                                      makeSetup(server.url(), localPath,
+                                                QString("/sync-%1").arg(i),
+                                                tmpDir.filePath(QString("db-%1.json").arg(i))));
+    }
+    orchestrator.setPriority(roots[1], 1);
+    QCOMPARE(orchestrator.priority(roots[1]), 1);
+
+    QList<int> order;
+    connect(&orchestrator, &SyncOrchestrator::rootStarted, this,
+            [&](int root) { order << root; });
+    QSignalSpy idle(&orchestrator, &SyncOrchestrator::idle);
+
+    // Higher priorities first, otherwise in the order the roots have been queued:
+    orchestrator.scheduleAll();
+    QVERIFY(idle.wait());
+    QCOMPARE(order, QList<int>({ roots[1], roots[0], roots[2] }));
+
+    // With equal priorities, the root which has not been synced for the longest time wins:
+    QVERIFY(orchestrator.lastSync(roots[1]) < orchestrator.lastSync(roots[0]));
+    QVERIFY(orchestrator.lastSync(roots[0]) < orchestrator.lastSync(roots[2]));
+    orchestrator.setPriority(roots[1], 0);
+    order.clear();
+    orchestrator.schedule(roots[2]);
+    orchestrator.schedule(roots[0]);
+    orchestrator.schedule(roots[1]);
+    QVERIFY(idle.wait());
+    QCOMPARE(order, QList<int>({ roots[1], roots[0], roots[2] }));
+}
+
+void SyncOrchestratorTest::removeRunningRoot()
+{
+    FakeWebDAVServer server;
+    server.setLatency(200);
+    QVERIFY(server.listen());
+    QTemporaryDir tmpDir;
+    QTemporaryDir metaTmpDir;
+    QVERIFY(createFiles(tmpDir.path(), 20));
+
+    SyncOrchestrator orchestrator;
+    auto root = orchestrator.addRoot(server.url(),
+                                     makeSetup(server.url(), tmpDir.path(), "/sync",
+                                               metaTmpDir.filePath("db.json")));
+    QSignalSpy started(&orchestrator, &SyncOrchestrator::rootStarted);
+    QSignalSpy finished(&orchestrator, &SyncOrchestrator::rootFinished);
+    QSignalSpy idle(&orchestrator, &SyncOrchestrator::idle);
+    orchestrator.schedule(root);
+    QVERIFY(started.wait());
+    QVERIFY(orchestrator.isRunning(root));
+    QVERIFY(orchestrator.jobLimit(root) > 0);
+
+    // Scheduling a running root queues it again:
+    orchestrator.schedule(root);
+    QVERIFY(orchestrator.isQueued(root));
+
+    orchestrator.removeRoot(root);
+    QVERIFY(orchestrator.roots().isEmpty());
+    QVERIFY(!orchestrator.isRunning(root));
+    QCOMPARE(orchestrator.numRunning(), 1);
+    QVERIFY(idle.wait());
+    QCOMPARE(orchestrator.numRunning(), 0);
+    QCOMPARE(started.count(), 1);
+    QCOMPARE(finished.count(), 0);
+}
+
+void SyncOrchestratorTest::separateAccounts()
+{
+    FakeWebDAVServer server;
+    server.setLatency(20);
+    QVERIFY(server.listen());
+    QTemporaryDir tmpDir;
+
+    SyncOrchestrator orchestrator;
+    orchestrator.setMaxJobsPerHost(2);
+    QHash<int, QNetworkAccessManager*> nams;
+    QList<int> roots;
+    const QStringList users { "alice", "bob", "alice" };
+    for (int i = 0; i < users.length(); ++i) {
+        auto url = server.url();
+        url.setUserName(users[i]);
+        auto localPath = tmpDir.filePath(QString("local-%1").arg(i));
+        QVERIFY(QDir(tmpDir.path()).mkpath(localPath));
+        QVERIFY(createFiles(localPath, 3));
+        auto setup = makeSetup(server.url(), localPath, QString("/sync-%1").arg(i),
+                               tmpDir.filePath(QString("db-%1.json").arg(i)));
+        roots << orchestrator.addRoot(
+                url, [=, &nams](DirectorySynchronizer* synchronizer, QNetworkAccessManager* nam) {
+                    nams[i] = nam;
+                    setup(synchronizer, nam);
+                });
+    }
+
+    int numLimitViolations = 0;
+    connect(&orchestrator, &SyncOrchestrator::rootStarted, this, [&]() {
+        int jobs = 0;
+        for (auto root : qAsConst(roots)) {
+            jobs += orchestrator.jobLimit(root);
+        }
+        if (jobs > orchestrator.maxJobsPerHost()) {
+            ++numLimitViolations;
+        }
+    });
+    QSignalSpy idle(&orchestrator, &SyncOrchestrator::idle);
+    orchestrator.scheduleAll();
+    QVERIFY(idle.wait());
+    for (auto root : qAsConst(roots)) {
+        QCOMPARE(orchestrator.lastError(root), SynchronizerError::NoError);
+    }
+
+    // Accounts don't share network access managers (and hence cookies or credentials), but they
+    // still share the budget of their host:
+    QCOMPARE(nams[0], nams[2]);
+    QVERIFY(nams[0] != nams[1]);
+    QCOMPARE(numLimitViolations, 0);
+    auto url = server.url();
+    url.setUserName("bob");
+    url.setPassword("secret");
+    QCOMPARE(orchestrator.networkAccessManager(url), nams[1]);
+}
+
+void SyncOrchestratorTest::cleanupTestCase() {}
+
+bool SyncOrchestratorTest::checkLimits(const SyncOrchestrator& orchestrator)
+{
+    int total = 0;
+    QHash<QString, int> perHost;
+    const auto roots = orchestrator.roots();
+    for (auto root : roots) {
+        if (orchestrator.isRunning(root)) {
+            auto limit = orchestrator.jobLimit(root);
+            SQ_VERIFY(limit > 0);
+            total += limit;
+            perHost[orchestrator.url(root).toString()] += limit;
+        }
+    }
+    SQ_VERIFY(total <= orchestrator.maxJobs());
+    for (auto limit : qAsConst(perHost)) {
+        SQ_VERIFY(limit <= orchestrator.maxJobsPerHost());
+    }
+    return true;
+}
+
+SyncOrchestrator::Setup SyncOrchestratorTest::makeSetup(const QUrl& url, const QString& localPath,
+                                                        const QString& remotePath,
+                                                        const QString& dbPath)
+{
+    return [=](DirectorySynchronizer* synchronizer, QNetworkAccessManager* nam) {
+        setupWebDAVSynchronizer(synchronizer, nam, url, localPath, remotePath, dbPath);
+    };
+}
+
+QTEST_MAIN(SyncOrchestratorTest)
+
+#include "tst_syncorchestrator.moc"
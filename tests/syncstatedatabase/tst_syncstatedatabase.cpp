@@ -1,20 +1,48 @@
 #include <algorithm>
 
+#include <QAtomicInt>
 #include <QSharedPointer>
 #include <QTemporaryDir>
+#include <QThread>
 #include <QtTest>
 
 // add necessary includes here
+#include "SynqClient/AsyncSyncStateDatabase"
 #include "SynqClient/JSONSyncStateDatabase"
 #include "SynqClient/SQLSyncStateDatabase"
 #include "SynqClient/SyncStateDatabase"
 #include "SynqClient/SyncStateEntry"
 
+using SynqClient::AsyncSyncStateDatabase;
 using SynqClient::JSONSyncStateDatabase;
 using SynqClient::SQLSyncStateDatabase;
 using SynqClient::SyncStateDatabase;
 using SynqClient::SyncStateEntry;
 
+class CountingSyncStateDatabase : public JSONSyncStateDatabase
+{
+public:
+    explicit CountingSyncStateDatabase(const QString& filename, QAtomicInt* reads)
+        : JSONSyncStateDatabase(filename), m_reads(reads)
+    {
+    }
+
+    SyncStateEntry getEntry(const QString& path) override
+    {
+        m_reads->ref();
+        return JSONSyncStateDatabase::getEntry(path);
+    }
+
+    QVector<SyncStateEntry> findEntries(const QString& parent, bool* ok) override
+    {
+        m_reads->ref();
+        return JSONSyncStateDatabase::findEntries(parent, ok);
+    }
+
+private:
+    QAtomicInt* m_reads;
+};
+
 class SyncStateDatabaseTest : public QObject
 {
     Q_OBJECT
@@ -39,6 +67,16 @@ private slots:
     void removeEntry_data() { data(); }
     void iterate();
     void iterate_data() { data(); }
+    void flushDatabase();
+    void flushDatabase_data() { data(); }
+    void localFileId();
+    void localFileId_data() { data(); }
+    void fingerprint();
+    void fingerprint_data() { data(); }
+    void remoteFileId();
+    void remoteFileId_data() { data(); }
+    void asyncReadYourWrites();
+    void asyncCachedReads();
     void cleanupTestCase();
 
 private:
@@ -301,6 +339,197 @@ void SyncStateDatabaseTest::iterate()
     }
 }
 
+void SyncStateDatabaseTest::flushDatabase()
+{
+    QFETCH(SyncStateDatabase*, db);
+    QVERIFY(!db->flushDatabase());
+    QVERIFY(db->openDatabase());
+    {
+        SyncStateEntry entry("/foo/bar.txt", QDateTime::currentDateTime(), "v1");
+        QVERIFY(db->addEntry(entry));
+    }
+    QVERIFY(db->flushDatabase());
+    QVERIFY(db->isOpen());
+    {
+        SyncStateEntry entry("/foo/baz.txt", QDateTime::currentDateTime(), "v1");
+        QVERIFY(db->addEntry(entry));
+    }
+    QCOMPARE(db->getEntry("/foo/bar.txt").syncProperty(), "v1");
+    QCOMPARE(db->getEntry("/foo/baz.txt").syncProperty(), "v1");
+    QVERIFY(db->closeDatabase());
+
+    QVERIFY(db->openDatabase());
+    QCOMPARE(db->getEntry("/foo/bar.txt").syncProperty(), "v1");
+    QCOMPARE(db->getEntry("/foo/baz.txt").syncProperty(), "v1");
+    QVERIFY(db->closeDatabase());
+}
+
+void SyncStateDatabaseTest::localFileId()
+{
+    QFETCH(SyncStateDatabase*, db);
+    QVERIFY(db->openDatabase());
+    {
+        SyncStateEntry entry("/foo/id.txt", QDateTime::currentDateTime(), "v1");
+        entry.setLocalFileId("1:42");
+        QVERIFY(db->addEntry(entry));
+        QVERIFY(db->addEntry(
+                SyncStateEntry("/foo/no-id.txt", QDateTime::currentDateTime(), "v1")));
+    }
+    QVERIFY(db->closeDatabase());
+
+    QVERIFY(db->openDatabase());
+    QCOMPARE(db->getEntry("/foo/id.txt").localFileId(), "1:42");
+    QCOMPARE(db->getEntry("/foo/no-id.txt").localFileId(), QString());
+    {
+        auto entries = db->findEntries("/foo");
+        QCOMPARE(entries.length(), 2);
+        for (const auto& entry : qAsConst(entries)) {
+            auto expectedId = entry.path() == "/foo/id.txt" ? QString("1:42") : QString();
+            QCOMPARE(entry.localFileId(), expectedId);
+        }
+    }
+    QVERIFY(db->closeDatabase());
+}
+
+void SyncStateDatabaseTest::fingerprint()
+{
+    QFETCH(SyncStateDatabase*, db);
+    QVERIFY(db->openDatabase());
+    {
+        SyncStateEntry entry("/foo/fingerprint.txt", QDateTime::currentDateTime(), "v1");
+        entry.setFingerprint("4:abcd");
+        QVERIFY(db->addEntry(entry));
+    }
+    QVERIFY(db->closeDatabase());
+
+    QVERIFY(db->openDatabase());
+    QCOMPARE(db->getEntry("/foo/fingerprint.txt").fingerprint(), "4:abcd");
+    QCOMPARE(db->findEntries("/foo").value(0).fingerprint(), "4:abcd");
+    QVERIFY(db->closeDatabase());
+}
+
+void SyncStateDatabaseTest::remoteFileId()
+{
+    QFETCH(SyncStateDatabase*, db);
+    QVERIFY(db->openDatabase());
+    {
+        SyncStateEntry entry("/foo/remote-id.txt", QDateTime::currentDateTime(), "v1");
+        entry.setRemoteFileId("00000042ocabc");
+        QVERIFY(db->addEntry(entry));
+    }
+    QVERIFY(db->closeDatabase());
+
+    QVERIFY(db->openDatabase());
+    QCOMPARE(db->getEntry("/foo/remote-id.txt").remoteFileId(), "00000042ocabc");
+    QCOMPARE(db->findEntries("/foo").value(0).remoteFileId(), "00000042ocabc");
+    QVERIFY(db->closeDatabase());
+}
+
+void SyncStateDatabaseTest::asyncReadYourWrites()
+{
+    QTemporaryDir dir;
+    QThread* dbThread = nullptr;
+    AsyncSyncStateDatabase db([&]() {
+        dbThread = QThread::currentThread();
+        return new SQLSyncStateDatabase(dir.filePath("sync.db"));
+    });
+    QVERIFY(!db.addEntry(SyncStateEntry("/foo", QDateTime::currentDateTime(), "v1")));
+    QVERIFY(db.openDatabase());
+    QVERIFY(dbThread != nullptr);
+    QVERIFY(dbThread != QThread::currentThread());
+
+    // Reads see the writes issued before - both while they are pending and once they are run:
+    for (int i = 0; i < 100; ++i) {
+        auto path = QString("/foo/bar-%1.txt").arg(i);
+        QVERIFY(db.addEntry(SyncStateEntry(path, QDateTime::currentDateTime(), "v1")));
+        QCOMPARE(db.getEntry(path).syncProperty(), "v1");
+        QVERIFY(db.addEntry(SyncStateEntry(path, QDateTime::currentDateTime(), "v2")));
+        QCOMPARE(db.getEntry(path).syncProperty(), "v2");
+    }
+    QCOMPARE(db.findEntries("/foo").length(), 100);
+    QVERIFY(db.removeEntry("/foo/bar-0.txt"));
+    QVERIFY(!db.getEntry("/foo/bar-0.txt").isValid());
+    QVERIFY(db.addEntry(SyncStateEntry("/foo/baz/bar.txt", QDateTime::currentDateTime(), "v1")));
+    QVERIFY(db.removeEntries("/foo/baz"));
+    QVERIFY(!db.getEntry("/foo/baz/bar.txt").isValid());
+    QVERIFY(!db.getEntry("/foo/baz").isValid());
+    QCOMPARE(db.getEntry("/foo/bar-1.txt").syncProperty(), "v2");
+    QVERIFY(db.waitForPendingWrites(10000));
+    QCOMPARE(db.pendingWrites(), 0);
+    QCOMPARE(db.findEntries("/foo").length(), 99);
+
+    // Flushing without blocking:
+    bool flushed = false;
+    bool flushOk = false;
+    QVERIFY(db.addEntry(SyncStateEntry("/foo/last.txt", QDateTime::currentDateTime(), "v1")));
+    db.flushDatabaseLater([&](bool ok) {
+        flushed = true;
+        flushOk = ok;
+    });
+    QTRY_VERIFY(flushed);
+    QVERIFY(flushOk);
+    QVERIFY(db.closeDatabase());
+
+    // Everything has been persisted:
+    QVERIFY(db.openDatabase());
+    QCOMPARE(db.getEntry("/foo/last.txt").syncProperty(), "v1");
+    QCOMPARE(db.findEntries("/foo").length(), 100);
+    QVERIFY(db.closeDatabase());
+}
+
+void SyncStateDatabaseTest::asyncCachedReads()
+{
+    QTemporaryDir dir;
+    QAtomicInt reads;
+    AsyncSyncStateDatabase db(
+            [&]() { return new CountingSyncStateDatabase(dir.filePath("db.json"), &reads); });
+    QVERIFY(db.openDatabase());
+    QVERIFY(db.addEntry(SyncStateEntry("/", QDateTime::currentDateTime(), "root")));
+    QVERIFY(db.addEntry(SyncStateEntry("/foo", QDateTime::currentDateTime(), "v1")));
+    QVERIFY(db.addEntry(SyncStateEntry("/foo/bar.txt", QDateTime::currentDateTime(), "v1")));
+    QVERIFY(db.addEntry(SyncStateEntry("/foo/baz", QDateTime::currentDateTime(), "v1")));
+    QVERIFY(db.addEntry(SyncStateEntry("/foo/baz/bar.txt", QDateTime::currentDateTime(), "v1")));
+    QVERIFY(db.addEntry(SyncStateEntry("/orphan/bar.txt", QDateTime::currentDateTime(), "v1")));
+    QVERIFY(db.closeDatabase());
+
+    // Opening reads everything reachable from the root once:
+    QVERIFY(db.openDatabase());
+    QVERIFY(reads.loadAcquire() > 0);
+    reads.storeRelease(0);
+
+    // Afterwards, reads of known entries and folders are served without the database thread:
+    int numEntries = 0;
+    QVERIFY(db.iterate([&](const SyncStateEntry&) { ++numEntries; }));
+    QCOMPARE(numEntries, 5);
+    QCOMPARE(db.getEntry("/foo/bar.txt").syncProperty(), "v1");
+    QVERIFY(!db.getEntry("/foo/new.txt").isValid());
+    QCOMPARE(db.findEntries("/foo").length(), 2);
+    QVERIFY(db.addEntry(SyncStateEntry("/foo/new.txt", QDateTime::currentDateTime(), "v1")));
+    QCOMPARE(db.getEntry("/foo/new.txt").syncProperty(), "v1");
+    QCOMPARE(db.findEntries("/foo").length(), 3);
+    QVERIFY(db.removeEntry("/foo/bar.txt"));
+    QVERIFY(!db.getEntry("/foo/bar.txt").isValid());
+    QCOMPARE(db.findEntries("/foo").length(), 2);
+    QVERIFY(db.removeEntries("/foo/baz"));
+    QVERIFY(db.findEntries("/foo/baz").isEmpty());
+    QVERIFY(!db.getEntry("/foo/baz").isValid());
+    QCOMPARE(reads.loadAcquire(), 0);
+
+    // Entries which are not reachable from the root are read from the wrapped database:
+    QCOMPARE(db.getEntry("/orphan/bar.txt").syncProperty(), "v1");
+    QCOMPARE(reads.loadAcquire(), 1);
+    QCOMPARE(db.getEntry("/orphan/bar.txt").syncProperty(), "v1");
+    QCOMPARE(reads.loadAcquire(), 1);
+    QVERIFY(db.closeDatabase());
+
+    // The writes have been persisted:
+    QVERIFY(db.openDatabase());
+    QVERIFY(!db.getEntry("/foo/bar.txt").isValid());
+    QCOMPARE(db.getEntry("/foo/new.txt").syncProperty(), "v1");
+    QVERIFY(!db.getEntry("/foo/baz/bar.txt").isValid());
+    QVERIFY(db.closeDatabase());
+}
+
 void SyncStateDatabaseTest::cleanupTestCase() {}
 
 void SyncStateDatabaseTest::data()
@@ -311,6 +540,11 @@ void SyncStateDatabaseTest::data()
             new SQLSyncStateDatabase(tmpDir->path() + "sync.db", this));
     QTest::addRow("JSON") << static_cast<SyncStateDatabase*>(
             new JSONSyncStateDatabase(tmpDir->path() + "/db.json", this));
+    auto path = tmpDir->path();
+    QTest::addRow("AsyncSQL") << static_cast<SyncStateDatabase*>(new AsyncSyncStateDatabase(
+            [=]() { return new SQLSyncStateDatabase(path + "/async-sync.db"); }, this));
+    QTest::addRow("AsyncJSON") << static_cast<SyncStateDatabase*>(new AsyncSyncStateDatabase(
+            [=]() { return new JSONSyncStateDatabase(path + "/async-db.json"); }, this));
 }
 
 QTEST_MAIN(SyncStateDatabaseTest)
@@ -6,8 +6,14 @@ CONFIG -= app_bundle
 
 TEMPLATE = app
 
-SOURCES +=  tst_$${TESTNAME}.cpp
-HEADERS += ../shared/utils.h
+SOURCES +=  tst_$${TESTNAME}.cpp \
+    ../shared/fakedropboxserver.cpp \
+    ../shared/fakehttpserver.cpp \
+    ../shared/fakewebdavserver.cpp
+HEADERS += ../shared/utils.h \
+    ../shared/fakedropboxserver.h \
+    ../shared/fakehttpserver.h \
+    ../shared/fakewebdavserver.h
 
 win32:CONFIG(release, debug|release): LIBS += -L$$OUT_PWD/../../libsynqclient/release/ -lsynqclient
 else:win32:CONFIG(debug, debug|release): LIBS += -L$$OUT_PWD/../../libsynqclient/debug/ -lsynqclient
@@ -3,19 +3,33 @@ TEMPLATE = subdirs
 SUBDIRS += \
     abstractjob \
     compositejob \
+    continuoussynchronizer \
     directorysynchronizer \
+    dropboxchangewatcher \
+    dropboxcopyjob \
     dropboxcreatedirectoryjob \
     dropboxdeletejob \
     dropboxdownloadfilejob \
     dropboxgetfileinfojob \
     dropboxjobfactory \
     dropboxlistfilesjob \
+    dropboxmovejob \
+    dropboxuploadfilebatchjob \
     dropboxuploadfilejob \
+    fakeservers \
+    hashingdevice \
+    localchangewatcher \
+    metrics \
+    syncorchestrator \
     syncstatedatabase \
+    threadedsynchronizer \
+    webdavcopyjob \
     webdavcreatedirectoryjob \
     webdavdeletejob \
     webdavdownloadfilejob \
     webdavgetfileinfojob \
     webdavjobfactory \
     webdavlistfilesjob \
+    webdavmovejob \
+    webdavuploadfilebatchjob \
     webdavuploadfilejob \
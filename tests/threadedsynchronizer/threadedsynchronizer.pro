@@ -0,0 +1,2 @@
+TESTNAME = threadedsynchronizer
+include(../test.pri)
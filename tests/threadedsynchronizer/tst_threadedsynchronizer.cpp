@@ -0,0 +1,271 @@
+#include <QAtomicInt>
+#include <QAtomicPointer>
+#include <QNetworkAccessManager>
+#include <QSemaphore>
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <QThread>
+#include <QtTest>
+
+#include "../shared/fakewebdavserver.h"
+#include "../shared/utils.h"
+#include "SynqClient/DirectorySynchronizer"
+#include "SynqClient/ThreadedSynchronizer"
+
+using SynqClient::DirectorySynchronizer;
+using SynqClient::SynchronizerLogEntryType;
+using SynqClient::SynchronizerError;
+using SynqClient::SynchronizerState;
+using SynqClient::ThreadedSynchronizer;
+using SynqClient::UnitTest::createFiles;
+using SynqClient::UnitTest::FakeWebDAVServer;
+using SynqClient::UnitTest::setupWebDAVSynchronizer;
+
+class ThreadedSynchronizerTest : public QObject
+{
+    Q_OBJECT
+
+public:
+    ThreadedSynchronizerTest();
+    ~ThreadedSynchronizerTest();
+
+private slots:
+    void initTestCase();
+    void runsOnWorkerThread();
+    void concurrentUse();
+    void stopFromOtherThread();
+    void stopBeforeRunStarted();
+    void syncEvents();
+    void cleanupTestCase();
+
+private:
+    ThreadedSynchronizer::Setup makeSetup(const QUrl& url, const QString& localPath,
+                                          const QString& dbPath);
+};
+
+ThreadedSynchronizerTest::ThreadedSynchronizerTest() {}
+
+ThreadedSynchronizerTest::~ThreadedSynchronizerTest() {}
+
+void ThreadedSynchronizerTest::initTestCase() {}
+
+void ThreadedSynchronizerTest::runsOnWorkerThread()
+{
+    FakeWebDAVServer server;
+    QVERIFY(server.listen());
+    QTemporaryDir tmpDir;
+    QTemporaryDir metaTmpDir;
+    QVERIFY(createFiles(tmpDir.path(), 3));
+
+    QAtomicPointer<QThread> setupThread;
+    QAtomicPointer<QThread> synchronizerThread;
+    auto setup = makeSetup(server.url(), tmpDir.path(), metaTmpDir.filePath("syncdb.json"));
+    ThreadedSynchronizer sync;
+    sync.setSetup([&](DirectorySynchronizer* synchronizer) {
+        setupThread.storeRelease(QThread::currentThread());
+        synchronizerThread.storeRelease(synchronizer->thread());
+        setup(synchronizer);
+    });
+    QCOMPARE(sync.state(), SynchronizerState::Ready);
+
+    QSignalSpy finished(&sync, &ThreadedSynchronizer::finished);
+    QSignalSpy progress(&sync, &ThreadedSynchronizer::progress);
+    QVERIFY(sync.start());
+    QCOMPARE(sync.state(), SynchronizerState::Running);
+    QVERIFY(finished.wait());
+    QCOMPARE(finished.count(), 1);
+    QCOMPARE(sync.state(), SynchronizerState::Finished);
+    QCOMPARE(sync.error(), SynchronizerError::NoError);
+    QVERIFY(sync.errorString().isEmpty());
+
+    // Everything ran on the worker thread:
+    QVERIFY(setupThread.loadAcquire() != nullptr);
+    QVERIFY(setupThread.loadAcquire() != QThread::currentThread());
+    QCOMPARE(synchronizerThread.loadAcquire(), setupThread.loadAcquire());
+
+    // Signals are delivered to the thread of the facade:
+    QVERIFY(progress.count() > 0);
+    QCOMPARE(sync.currentProgress().progress(), 100);
+    QVERIFY(sync.statistics().jobs() >= 3);
+    for (int i = 0; i < 3; ++i) {
+        QCOMPARE(server.fileData(QString("/sync/file-%1.txt").arg(i)),
+                 QByteArray::number(i));
+    }
+}
+
+void ThreadedSynchronizerTest::concurrentUse()
+{
+    FakeWebDAVServer server;
+    QVERIFY(server.listen());
+    QTemporaryDir tmpDir;
+    QTemporaryDir metaTmpDir;
+    QVERIFY(createFiles(tmpDir.path(), 10));
+
+    QAtomicInt numSetups;
+    auto setup = makeSetup(server.url(), tmpDir.path(), metaTmpDir.filePath("syncdb.json"));
+    ThreadedSynchronizer sync;
+    sync.setSetup([&](DirectorySynchronizer* synchronizer) {
+        numSetups.ref();
+        setup(synchronizer);
+    });
+    QSignalSpy finished(&sync, &ThreadedSynchronizer::finished);
+
+    // Hammer the facade from several threads. As the server runs in this thread, the sync cannot
+    // finish before all of them are done - hence, exactly one start must succeed:
+    QAtomicInt numStarted;
+    QVector<QThread*> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads << QThread::create([&]() {
+            for (int j = 0; j < 100; ++j) {
+                if (sync.start()) {
+                    numStarted.ref();
+                }
+                sync.state();
+                sync.error();
+                sync.currentProgress().progress();
+                sync.statistics().jobs();
+                if (j % 10 == 0) {
+                    sync.setSetup(sync.setup());
+                }
+            }
+        });
+    }
+    for (auto thread : qAsConst(threads)) {
+        thread->start();
+    }
+    for (auto thread : qAsConst(threads)) {
+        QVERIFY(thread->wait(10000));
+        delete thread;
+    }
+    QCOMPARE(numStarted.loadAcquire(), 1);
+    QCOMPARE(sync.state(), SynchronizerState::Running);
+
+    QVERIFY(finished.wait());
+    QCOMPARE(finished.count(), 1);
+    QCOMPARE(sync.error(), SynchronizerError::NoError);
+    QCOMPARE(numSetups.loadAcquire(), 1);
+    for (int i = 0; i < 10; ++i) {
+        QVERIFY(server.exists(QString("/sync/file-%1.txt").arg(i)));
+    }
+
+    // The facade can be started again - this time from another thread:
+    auto thread = QThread::create([&]() {
+        if (sync.start()) {
+            numStarted.ref();
+        }
+    });
+    thread->start();
+    QVERIFY(thread->wait(10000));
+    delete thread;
+    QCOMPARE(numStarted.loadAcquire(), 2);
+    QVERIFY(finished.wait());
+    QCOMPARE(finished.count(), 2);
+    QCOMPARE(sync.error(), SynchronizerError::NoError);
+    QCOMPARE(numSetups.loadAcquire(), 2);
+}
+
+void ThreadedSynchronizerTest::stopFromOtherThread()
+{
+    FakeWebDAVServer server;
+    server.setLatency(200);
+    QVERIFY(server.listen());
+    QTemporaryDir tmpDir;
+    QTemporaryDir metaTmpDir;
+    QVERIFY(createFiles(tmpDir.path(), 20));
+
+    ThreadedSynchronizer sync;
+    sync.setSetup(makeSetup(server.url(), tmpDir.path(), metaTmpDir.filePath("syncdb.json")));
+    QSignalSpy finished(&sync, &ThreadedSynchronizer::finished);
+    QVERIFY(sync.start());
+
+    auto thread = QThread::create([&]() { sync.stop(); });
+    thread->start();
+    QVERIFY(thread->wait(10000));
+    delete thread;
+
+    QVERIFY(finished.wait());
+    QCOMPARE(sync.state(), SynchronizerState::Finished);
+    QCOMPARE(sync.error(), SynchronizerError::Stopped);
+    QVERIFY(sync.waitForFinished(0));
+}
+
+void ThreadedSynchronizerTest::stopBeforeRunStarted()
+{
+    FakeWebDAVServer server;
+    QVERIFY(server.listen());
+    QTemporaryDir tmpDir;
+    QTemporaryDir metaTmpDir;
+    QVERIFY(createFiles(tmpDir.path(), 3));
+
+    // Keep the worker from starting the synchronizer until the stop has been requested:
+    QSemaphore setupEntered;
+    QSemaphore stopRequested;
+    auto setup = makeSetup(server.url(), tmpDir.path(), metaTmpDir.filePath("syncdb.json"));
+    ThreadedSynchronizer sync;
+    sync.setSetup([&](DirectorySynchronizer* synchronizer) {
+        setupEntered.release();
+        stopRequested.acquire();
+        setup(synchronizer);
+    });
+    QSignalSpy finished(&sync, &ThreadedSynchronizer::finished);
+    QVERIFY(sync.start());
+    sync.stop();
+    stopRequested.release();
+    QVERIFY(setupEntered.tryAcquire(1, 10000));
+
+    QVERIFY(finished.wait());
+    QCOMPARE(sync.error(), SynchronizerError::Stopped);
+    QCOMPARE(server.numRequests("PUT"), 0);
+
+    // A stop only applies to the run it has been issued for:
+    sync.setSetup(setup);
+    QVERIFY(sync.start());
+    QVERIFY(finished.wait());
+    QCOMPARE(sync.error(), SynchronizerError::NoError);
+    QCOMPARE(server.numRequests("PUT"), 3);
+}
+
+void ThreadedSynchronizerTest::syncEvents()
+{
+    FakeWebDAVServer server;
+    QVERIFY(server.listen());
+    QTemporaryDir tmpDir;
+    QTemporaryDir metaTmpDir;
+    QVERIFY(createFiles(tmpDir.path(), 3));
+
+    ThreadedSynchronizer sync;
+    sync.setSetup(makeSetup(server.url(), tmpDir.path(), metaTmpDir.filePath("syncdb.json")));
+    QSignalSpy finished(&sync, &ThreadedSynchronizer::finished);
+    QSignalSpy syncEventAvailable(&sync, &ThreadedSynchronizer::syncEventAvailable);
+    QVERIFY(sync.start());
+    QVERIFY(finished.wait());
+    QCOMPARE(sync.error(), SynchronizerError::NoError);
+
+    // The paths are resolved already, as the synchronizer is gone by now:
+    QMap<QString, SynchronizerLogEntryType> events;
+    for (const auto& args : qAsConst(syncEventAvailable)) {
+        QVERIFY(args.at(2).toString().isEmpty());
+        events.insert(args.at(1).toString(), args.at(0).value<SynchronizerLogEntryType>());
+    }
+    QCOMPARE(events.size(), 3);
+    for (int i = 0; i < 3; ++i) {
+        QCOMPARE(events.value(QString("/file-%1.txt").arg(i)),
+                 SynchronizerLogEntryType::Upload);
+    }
+}
+
+void ThreadedSynchronizerTest::cleanupTestCase() {}
+
+ThreadedSynchronizer::Setup ThreadedSynchronizerTest::makeSetup(const QUrl& url,
+                                                                const QString& localPath,
+                                                                const QString& dbPath)
+{
+    return [=](DirectorySynchronizer* synchronizer) {
+        setupWebDAVSynchronizer(synchronizer, new QNetworkAccessManager(synchronizer), url,
+                                localPath, "/sync", dbPath);
+    };
+}
+
+QTEST_MAIN(ThreadedSynchronizerTest)
+
+#include "tst_threadedsynchronizer.moc"
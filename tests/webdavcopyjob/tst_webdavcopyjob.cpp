@@ -0,0 +1,202 @@
+#include <QNetworkAccessManager>
+#include <QSignalSpy>
+#include <QtTest>
+
+// add necessary includes here
+#include "../shared/fakewebdavserver.h"
+#include "../shared/utils.h"
+#include "SynqClient/WebDAVCopyJob"
+
+using SynqClient::JobError;
+using SynqClient::WebDAVCopyJob;
+using SynqClient::WebDAVServerType;
+using SynqClient::UnitTest::FakeWebDAVServer;
+
+class WebDAVCopyJobTest : public QObject
+{
+    Q_OBJECT
+
+public:
+    WebDAVCopyJobTest();
+    ~WebDAVCopyJobTest();
+
+private slots:
+    void initTestCase();
+    void missingParameters();
+    void copyFile();
+    void copyFile_data();
+    void copyFolder();
+    void copyFolder_data();
+    void errors();
+    void errors_data();
+    void overwrite();
+    void overwrite_data();
+    void cleanupTestCase();
+
+private:
+    static void addServerTypes();
+    static bool runJob(WebDAVCopyJob& job, JobError expectedError = JobError::NoError);
+};
+
+WebDAVCopyJobTest::WebDAVCopyJobTest() {}
+
+WebDAVCopyJobTest::~WebDAVCopyJobTest() {}
+
+void WebDAVCopyJobTest::initTestCase() {}
+
+void WebDAVCopyJobTest::missingParameters()
+{
+    FakeWebDAVServer server;
+    QVERIFY(server.listen());
+    QNetworkAccessManager nam;
+
+    WebDAVCopyJob job;
+    job.setNetworkAccessManager(&nam);
+    job.setUrl(server.url());
+    job.setPath("/foo.txt");
+    QVERIFY(runJob(job, JobError::MissingParameter));
+    QCOMPARE(server.numRequests(), 0);
+}
+
+void WebDAVCopyJobTest::copyFile()
+{
+    QFETCH(WebDAVServerType, type);
+
+    FakeWebDAVServer server(type);
+    QVERIFY(server.listen());
+    server.putFile("/dir/hello.txt", "Hello World!\n");
+    server.makeDirectory("/other");
+    QNetworkAccessManager nam;
+
+    WebDAVCopyJob job;
+    job.setNetworkAccessManager(&nam);
+    job.setUrl(server.url());
+    job.setServerType(type);
+    job.setPath("/dir/hello.txt");
+    job.setTargetPath("/other/copy.txt");
+    QVERIFY(runJob(job));
+    QCOMPARE(server.numRequests("COPY"), 1);
+    QCOMPARE(server.fileData("/dir/hello.txt"), QByteArray("Hello World!\n"));
+    QCOMPARE(server.fileData("/other/copy.txt"), QByteArray("Hello World!\n"));
+    QCOMPARE(job.fileInfo().name(), QString("copy.txt"));
+    QVERIFY(!job.fileInfo().syncAttribute().isEmpty());
+}
+
+void WebDAVCopyJobTest::copyFile_data()
+{
+    addServerTypes();
+}
+
+void WebDAVCopyJobTest::copyFolder()
+{
+    QFETCH(WebDAVServerType, type);
+
+    FakeWebDAVServer server(type);
+    QVERIFY(server.listen());
+    server.putFile("/dir/sub/a.txt", "A");
+    server.putFile("/dir/b.txt", "B");
+    QNetworkAccessManager nam;
+
+    WebDAVCopyJob job;
+    job.setNetworkAccessManager(&nam);
+    job.setUrl(server.url());
+    job.setServerType(type);
+    job.setPath("/dir");
+    job.setTargetPath("/copy");
+    QVERIFY(runJob(job));
+    QCOMPARE(server.fileData("/dir/sub/a.txt"), QByteArray("A"));
+    QCOMPARE(server.fileData("/dir/b.txt"), QByteArray("B"));
+    QVERIFY(server.isDirectory("/copy/sub"));
+    QCOMPARE(server.fileData("/copy/sub/a.txt"), QByteArray("A"));
+    QCOMPARE(server.fileData("/copy/b.txt"), QByteArray("B"));
+}
+
+void WebDAVCopyJobTest::copyFolder_data()
+{
+    addServerTypes();
+}
+
+void WebDAVCopyJobTest::errors()
+{
+    QFETCH(WebDAVServerType, type);
+
+    FakeWebDAVServer server(type);
+    QVERIFY(server.listen());
+    server.putFile("/a.txt", "A");
+    server.putFile("/b.txt", "B");
+    QNetworkAccessManager nam;
+
+    auto copy = [&](const QString& path, const QString& targetPath, JobError expectedError) {
+        WebDAVCopyJob job;
+        job.setNetworkAccessManager(&nam);
+        job.setUrl(server.url());
+        job.setServerType(type);
+        job.setPath(path);
+        job.setTargetPath(targetPath);
+        return runJob(job, expectedError);
+    };
+
+    QVERIFY(copy("/missing.txt", "/c.txt", JobError::ResourceNotFound));
+    QVERIFY(copy("/a.txt", "/b.txt", JobError::ResourceExists));
+    QVERIFY(copy("/a.txt", "/no/such/folder/a.txt", JobError::ServerContentConflict));
+
+    // Nothing has been changed by the failed copies:
+    QCOMPARE(server.fileData("/a.txt"), QByteArray("A"));
+    QCOMPARE(server.fileData("/b.txt"), QByteArray("B"));
+    QVERIFY(!server.exists("/c.txt"));
+}
+
+void WebDAVCopyJobTest::errors_data()
+{
+    addServerTypes();
+}
+
+void WebDAVCopyJobTest::overwrite()
+{
+    QFETCH(WebDAVServerType, type);
+
+    FakeWebDAVServer server(type);
+    QVERIFY(server.listen());
+    server.putFile("/a.txt", "A");
+    server.putFile("/b.txt", "B");
+    QNetworkAccessManager nam;
+
+    WebDAVCopyJob job;
+    job.setNetworkAccessManager(&nam);
+    job.setUrl(server.url());
+    job.setServerType(type);
+    job.setPath("/a.txt");
+    job.setTargetPath("/b.txt");
+    job.setOverwrite(true);
+    QVERIFY(runJob(job));
+    QCOMPARE(server.fileData("/a.txt"), QByteArray("A"));
+    QCOMPARE(server.fileData("/b.txt"), QByteArray("A"));
+}
+
+void WebDAVCopyJobTest::overwrite_data()
+{
+    addServerTypes();
+}
+
+void WebDAVCopyJobTest::cleanupTestCase() {}
+
+void WebDAVCopyJobTest::addServerTypes()
+{
+    QTest::addColumn<WebDAVServerType>("type");
+
+    QTest::newRow("Generic") << WebDAVServerType::Generic;
+    QTest::newRow("NextCloud") << WebDAVServerType::NextCloud;
+}
+
+bool WebDAVCopyJobTest::runJob(WebDAVCopyJob& job, JobError expectedError)
+{
+    QSignalSpy finished(&job, &WebDAVCopyJob::finished);
+    job.start();
+    SQ_VERIFY(finished.wait());
+    SQ_COMPARE(job.error(), expectedError);
+    return true;
+}
+
+QTEST_MAIN(WebDAVCopyJobTest)
+
+#include "tst_webdavcopyjob.moc"
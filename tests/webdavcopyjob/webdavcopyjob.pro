@@ -0,0 +1,2 @@
+TESTNAME = webdavcopyjob
+include(../test.pri)
@@ -6,6 +6,7 @@
 #include <QtTest>
 
 // add necessary includes here
+#include "../shared/fakewebdavserver.h"
 #include "../shared/utils.h"
 #include "SynqClient/WebDAVCreateDirectoryJob"
 #include "SynqClient/WebDAVDownloadFileJob"
@@ -16,7 +17,10 @@ using SynqClient::JobError;
 using SynqClient::WebDAVCreateDirectoryJob;
 using SynqClient::WebDAVDownloadFileJob;
 using SynqClient::WebDAVGetFileInfoJob;
+using SynqClient::WebDAVServerType;
 using SynqClient::WebDAVUploadFileJob;
+using SynqClient::UnitTest::createLargeData;
+using SynqClient::UnitTest::FakeWebDAVServer;
 
 class WebDAVDownloadFileJobTest : public QObject
 {
@@ -34,6 +38,8 @@ private slots:
     void downloadDevice_data();
     void downloadData();
     void downloadData_data();
+    void downloadLargeFile();
+    void downloadLargeFile_data();
     void cleanupTestCase();
 };
 
@@ -254,6 +260,49 @@ void WebDAVDownloadFileJobTest::downloadData_data()
     SynqClient::UnitTest::setupWebDAVTestServerData();
 }
 
+void WebDAVDownloadFileJobTest::downloadLargeFile()
+{
+    QFETCH(WebDAVServerType, type);
+
+    // Much larger than the buffers used while downloading, so data has to be streamed to disk.
+    // Throttling the server makes the data trickle in, so writing to disk has to keep up with
+    // (and not run ahead of) the network:
+    auto data = createLargeData();
+    FakeWebDAVServer server(type);
+    server.setLatency(20);
+    server.setBandwidth(32 * 1024 * 1024);
+    QVERIFY(server.listen());
+    server.putFile("/large.txt", data);
+    QNetworkAccessManager nam;
+
+    QTemporaryDir tmpDir;
+    auto localFileName = QDir(tmpDir.path()).absoluteFilePath("large.txt");
+    WebDAVDownloadFileJob job;
+    job.setNetworkAccessManager(&nam);
+    job.setUrl(server.url());
+    job.setServerType(type);
+    job.setLocalFilename(localFileName);
+    job.setRemoteFilename("/large.txt");
+    QSignalSpy spy(&job, &WebDAVDownloadFileJob::finished);
+    job.start();
+    QVERIFY(spy.wait(60000));
+    QCOMPARE(job.errorString(), QString());
+    QCOMPARE(job.error(), JobError::NoError);
+    QCOMPARE(server.numRequests("GET"), 1);
+    QVERIFY(!job.fileInfo().syncAttribute().isEmpty());
+    QFile file(localFileName);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QVERIFY(file.readAll() == data);
+}
+
+void WebDAVDownloadFileJobTest::downloadLargeFile_data()
+{
+    QTest::addColumn<WebDAVServerType>("type");
+
+    QTest::newRow("Generic") << WebDAVServerType::Generic;
+    QTest::newRow("NextCloud") << WebDAVServerType::NextCloud;
+}
+
 WebDAVDownloadFileJobTest::~WebDAVDownloadFileJobTest() {}
 
 void WebDAVDownloadFileJobTest::initTestCase() {}
@@ -4,7 +4,9 @@
 #include <QtTest>
 
 // add necessary includes here
+#include "SynqClient/WebDAVCreateDirectoryJob"
 #include "SynqClient/WebDAVGetFileInfoJob"
+#include "SynqClient/WebDAVUploadFileJob"
 #include "../shared/utils.h"
 
 class WebDAVGetFileInfoJobTest : public QObject
@@ -22,6 +24,8 @@ private slots:
     void getRootItemFileInfo_data();
     void getFileInfoForNonExistingFile();
     void getFileInfoForNonExistingFile_data();
+    void getFileInfoForFile();
+    void getFileInfoForFile_data();
 };
 
 WebDAVGetFileInfoJobTest::WebDAVGetFileInfoJobTest() {}
@@ -91,6 +95,77 @@ void WebDAVGetFileInfoJobTest::getFileInfoForNonExistingFile_data()
     SynqClient::UnitTest::setupWebDAVTestServerData();
 }
 
+void WebDAVGetFileInfoJobTest::getFileInfoForFile()
+{
+    if (!SynqClient::UnitTest::hasWebDAVServersFromEnv()) {
+        QSKIP("No WebDAV servers configured - skipping test");
+    }
+
+    QFETCH(QUrl, url);
+    QFETCH(SynqClient::WebDAVServerType, type);
+
+    QNetworkAccessManager nam;
+    nam.setRedirectPolicy(QNetworkRequest::NoLessSafeRedirectPolicy);
+
+    QTemporaryDir tmpDir;
+    auto localFileName = tmpDir.filePath("test.txt");
+    {
+        QFile localFile(localFileName);
+        QVERIFY(localFile.open(QIODevice::WriteOnly));
+        localFile.write("Hello World!\n");
+    }
+
+    auto uid = QUuid::createUuid();
+    auto remotePath = "/WebDAVGetFileInfoJobTest-getFileInfoForFile-" + uid.toString();
+    auto remoteFileName = remotePath + "/hello.txt";
+
+    {
+        SynqClient::WebDAVCreateDirectoryJob job;
+        job.setNetworkAccessManager(&nam);
+        job.setUrl(url);
+        job.setServerType(type);
+        job.setPath(remotePath);
+        QSignalSpy spy(&job, &SynqClient::AbstractJob::finished);
+        job.start();
+        QVERIFY(spy.wait());
+    }
+
+    {
+        SynqClient::WebDAVUploadFileJob job;
+        job.setNetworkAccessManager(&nam);
+        job.setUrl(url);
+        job.setServerType(type);
+        job.setLocalFilename(localFileName);
+        job.setRemoteFilename(remoteFileName);
+        QSignalSpy spy(&job, &SynqClient::AbstractJob::finished);
+        job.start();
+        QVERIFY(spy.wait());
+        QCOMPARE(job.error(), SynqClient::JobError::NoError);
+    }
+
+    SynqClient::WebDAVGetFileInfoJob job;
+    job.setNetworkAccessManager(&nam);
+    job.setServerType(type);
+    job.setUrl(url);
+    job.setPath(remoteFileName);
+    QSignalSpy spy(&job, &SynqClient::AbstractJob::finished);
+    job.start();
+    QVERIFY(spy.wait());
+    QCOMPARE(job.error(), SynqClient::JobError::NoError);
+    auto fileInfo = job.fileInfo();
+    QVERIFY(fileInfo.isFile());
+    QCOMPARE(fileInfo.size(), 13);
+    QVERIFY(fileInfo.lastModified().isValid());
+    if (type != SynqClient::WebDAVServerType::Generic) {
+        QVERIFY(!fileInfo.fileId().isEmpty());
+    }
+}
+
+void WebDAVGetFileInfoJobTest::getFileInfoForFile_data()
+{
+    SynqClient::UnitTest::setupWebDAVTestServerData();
+}
+
 QTEST_MAIN(WebDAVGetFileInfoJobTest)
 
 #include "tst_webdavgetfileinfojob.moc"
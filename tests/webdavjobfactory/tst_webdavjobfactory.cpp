@@ -8,15 +8,19 @@
 #include "SynqClient/WebDAVGetFileInfoJob"
 #include "SynqClient/WebDAVJobFactory"
 #include "SynqClient/WebDAVListFilesJob"
+#include "SynqClient/WebDAVUploadFileBatchJob"
 #include "SynqClient/WebDAVUploadFileJob"
 
 using SynqClient::WebDAVCreateDirectoryJob;
 using SynqClient::WebDAVDeleteJob;
 using SynqClient::WebDAVDownloadFileJob;
+using SynqClient::JobType;
+using SynqClient::RemoteChangeDetectionMode;
 using SynqClient::WebDAVGetFileInfoJob;
 using SynqClient::WebDAVJobFactory;
 using SynqClient::WebDAVListFilesJob;
 using SynqClient::WebDAVServerType;
+using SynqClient::WebDAVUploadFileBatchJob;
 using SynqClient::WebDAVUploadFileJob;
 
 class WebDAVJobFactoryTest : public QObject
@@ -30,6 +34,7 @@ public:
 private slots:
     void initTestCase();
     void createJobs();
+    void syncCollection();
     void cleanupTestCase();
 };
 
@@ -48,6 +53,8 @@ void WebDAVJobFactoryTest::createJobs()
     factory.setServerType(WebDAVServerType::NextCloud);
     factory.setUrl(QUrl("https://example.com"));
     factory.setUserAgent("Unit Test");
+    QVERIFY(!factory.http2Allowed());
+    factory.setHttp2Allowed(true);
 
     {
         auto job = factory.createDirectory(&factory);
@@ -57,6 +64,7 @@ void WebDAVJobFactoryTest::createJobs()
         QCOMPARE(davJob->serverType(), WebDAVServerType::NextCloud);
         QCOMPARE(davJob->url(), QUrl("https://example.com"));
         QCOMPARE(davJob->userAgent(), "Unit Test");
+        QVERIFY(davJob->http2Allowed());
     }
 
     {
@@ -67,6 +75,7 @@ void WebDAVJobFactoryTest::createJobs()
         QCOMPARE(davJob->serverType(), WebDAVServerType::NextCloud);
         QCOMPARE(davJob->url(), QUrl("https://example.com"));
         QCOMPARE(davJob->userAgent(), "Unit Test");
+        QVERIFY(davJob->http2Allowed());
     }
 
     {
@@ -77,6 +86,7 @@ void WebDAVJobFactoryTest::createJobs()
         QCOMPARE(davJob->serverType(), WebDAVServerType::NextCloud);
         QCOMPARE(davJob->url(), QUrl("https://example.com"));
         QCOMPARE(davJob->userAgent(), "Unit Test");
+        QVERIFY(davJob->http2Allowed());
     }
 
     {
@@ -87,6 +97,7 @@ void WebDAVJobFactoryTest::createJobs()
         QCOMPARE(davJob->serverType(), WebDAVServerType::NextCloud);
         QCOMPARE(davJob->url(), QUrl("https://example.com"));
         QCOMPARE(davJob->userAgent(), "Unit Test");
+        QVERIFY(davJob->http2Allowed());
     }
 
     {
@@ -97,6 +108,7 @@ void WebDAVJobFactoryTest::createJobs()
         QCOMPARE(davJob->serverType(), WebDAVServerType::NextCloud);
         QCOMPARE(davJob->url(), QUrl("https://example.com"));
         QCOMPARE(davJob->userAgent(), "Unit Test");
+        QVERIFY(davJob->http2Allowed());
     }
 
     {
@@ -107,7 +119,47 @@ void WebDAVJobFactoryTest::createJobs()
         QCOMPARE(davJob->serverType(), WebDAVServerType::NextCloud);
         QCOMPARE(davJob->url(), QUrl("https://example.com"));
         QCOMPARE(davJob->userAgent(), "Unit Test");
+        QVERIFY(davJob->http2Allowed());
     }
+
+    {
+        QVERIFY(factory.maxBatchSize(JobType::UploadFileBatch) > 0);
+        QVERIFY(factory.maxBatchFileSize() > 0);
+        auto job = factory.uploadFileBatch(&factory);
+        auto davJob = qobject_cast<WebDAVUploadFileBatchJob*>(job);
+        QVERIFY(davJob != nullptr);
+        QCOMPARE(davJob->networkAccessManager(), &nam);
+        QCOMPARE(davJob->serverType(), WebDAVServerType::NextCloud);
+        QCOMPARE(davJob->url(), QUrl("https://example.com"));
+        QCOMPARE(davJob->userAgent(), "Unit Test");
+        QVERIFY(davJob->http2Allowed());
+        QVERIFY(davJob->bulkUploadSupported());
+    }
+
+    {
+        // Bulk uploads are only supported by NextCloud:
+        WebDAVJobFactory genericFactory;
+        QCOMPARE(genericFactory.maxBatchSize(JobType::UploadFileBatch), 0);
+        genericFactory.setServerType(WebDAVServerType::NextCloud);
+        QVERIFY(genericFactory.maxBatchSize(JobType::UploadFileBatch) > 0);
+        genericFactory.setServerType(WebDAVServerType::OwnCloud);
+        QCOMPARE(genericFactory.maxBatchSize(JobType::UploadFileBatch), 0);
+    }
+}
+
+void WebDAVJobFactoryTest::syncCollection()
+{
+    WebDAVJobFactory factory;
+    QVERIFY(!factory.syncCollectionEnabled());
+    QCOMPARE(factory.remoteChangeDetectionMode(),
+             RemoteChangeDetectionMode::FoldersWithSyncAttributes);
+    factory.setSyncCollectionEnabled(true);
+    QVERIFY(factory.syncCollectionEnabled());
+    QCOMPARE(factory.remoteChangeDetectionMode(), RemoteChangeDetectionMode::SyncCollection);
+    factory.setSyncCollectionEnabled(false);
+    QVERIFY(!factory.syncCollectionEnabled());
+    QCOMPARE(factory.remoteChangeDetectionMode(),
+             RemoteChangeDetectionMode::FoldersWithSyncAttributes);
 }
 
 void WebDAVJobFactoryTest::cleanupTestCase() {}
@@ -5,12 +5,14 @@
 // add necessary includes here
 #include "../shared/utils.h"
 #include "SynqClient/WebDAVCreateDirectoryJob"
+#include "SynqClient/WebDAVDeleteJob"
 #include "SynqClient/WebDAVGetFileInfoJob"
 #include "SynqClient/WebDAVListFilesJob"
 #include "SynqClient/WebDAVUploadFileJob"
 
 using SynqClient::JobError;
 using SynqClient::WebDAVCreateDirectoryJob;
+using SynqClient::WebDAVDeleteJob;
 using SynqClient::WebDAVGetFileInfoJob;
 using SynqClient::WebDAVListFilesJob;
 using SynqClient::WebDAVUploadFileJob;
@@ -27,6 +29,8 @@ private slots:
     void initTestCase();
     void listFiles();
     void listFiles_data();
+    void listFilesRecursive();
+    void listFilesRecursive_data();
     void cleanupTestCase();
 };
 
@@ -183,6 +187,143 @@ void WebDAVListFilesJobTest::listFiles_data()
     SynqClient::UnitTest::setupWebDAVTestServerData();
 }
 
+void WebDAVListFilesJobTest::listFilesRecursive()
+{
+    if (!SynqClient::UnitTest::hasWebDAVServersFromEnv()) {
+        QSKIP("No WebDAV servers configured - skipping test");
+    }
+
+    QFETCH(QUrl, url);
+    QFETCH(SynqClient::WebDAVServerType, type);
+
+    QNetworkAccessManager nam;
+    nam.setRedirectPolicy(QNetworkRequest::NoLessSafeRedirectPolicy);
+
+    auto testDirUid = QUuid::createUuid();
+    auto remotePath = "/WebDAVListFilesJobTest-listFilesRecursive-" + testDirUid.toString();
+
+    for (const auto& path : { remotePath, remotePath + "/dir1" }) {
+        WebDAVCreateDirectoryJob job;
+        job.setNetworkAccessManager(&nam);
+        job.setUrl(url);
+        job.setServerType(type);
+        job.setPath(path);
+        job.start();
+        QSignalSpy spy(&job, &WebDAVCreateDirectoryJob::finished);
+        QVERIFY(spy.wait());
+        QCOMPARE(job.error(), JobError::NoError);
+    }
+
+    for (const auto& path : { remotePath + "/file1.txt", remotePath + "/dir1/file2.txt" }) {
+        WebDAVUploadFileJob job;
+        job.setNetworkAccessManager(&nam);
+        job.setUrl(url);
+        job.setServerType(type);
+        job.setRemoteFilename(path);
+        job.setData("Hello World!");
+        job.start();
+        QSignalSpy spy(&job, &WebDAVUploadFileJob::finished);
+        QVERIFY(spy.wait());
+        QCOMPARE(job.error(), JobError::NoError);
+    }
+
+    QString cursor;
+
+    {
+        WebDAVListFilesJob job;
+        job.setNetworkAccessManager(&nam);
+        job.setUrl(url);
+        job.setServerType(type);
+        job.setPath(remotePath);
+        job.setRecursive(true);
+        job.start();
+        QSignalSpy spy(&job, &WebDAVListFilesJob::finished);
+        QVERIFY(spy.wait());
+        if (job.error() != JobError::NoError) {
+            QSKIP("Server does not support sync-collection reports - skipping test");
+        }
+        QVERIFY(!job.incremental());
+        QVERIFY(!job.cursor().isEmpty());
+        cursor = job.cursor();
+
+        QStringList expectedPaths { "dir1", "dir1/file2.txt", "file1.txt" };
+        QStringList gotPaths;
+        for (const auto& entry : job.entries()) {
+            gotPaths << entry.path();
+            if (entry.path() == "dir1") {
+                QVERIFY(entry.isDirectory());
+            } else {
+                QVERIFY(entry.isFile());
+                QVERIFY(!entry.syncAttribute().isEmpty());
+            }
+        }
+        std::sort(gotPaths.begin(), gotPaths.end());
+        QCOMPARE(gotPaths, expectedPaths);
+    }
+
+    {
+        WebDAVDeleteJob job;
+        job.setNetworkAccessManager(&nam);
+        job.setUrl(url);
+        job.setServerType(type);
+        job.setPath(remotePath + "/file1.txt");
+        job.start();
+        QSignalSpy spy(&job, &WebDAVDeleteJob::finished);
+        QVERIFY(spy.wait());
+        QCOMPARE(job.error(), JobError::NoError);
+    }
+
+    {
+        WebDAVUploadFileJob job;
+        job.setNetworkAccessManager(&nam);
+        job.setUrl(url);
+        job.setServerType(type);
+        job.setRemoteFilename(remotePath + "/dir1/file3.txt");
+        job.setData("Another file!");
+        job.start();
+        QSignalSpy spy(&job, &WebDAVUploadFileJob::finished);
+        QVERIFY(spy.wait());
+        QCOMPARE(job.error(), JobError::NoError);
+    }
+
+    {
+        WebDAVListFilesJob job;
+        job.setNetworkAccessManager(&nam);
+        job.setUrl(url);
+        job.setServerType(type);
+        job.setPath(remotePath);
+        job.setRecursive(true);
+        job.setCursor(cursor);
+        job.start();
+        QSignalSpy spy(&job, &WebDAVListFilesJob::finished);
+        QVERIFY(spy.wait());
+        QCOMPARE(job.error(), JobError::NoError);
+        QVERIFY(job.incremental());
+        QVERIFY(!job.cursor().isEmpty());
+        QVERIFY(job.cursor() != cursor);
+
+        bool foundDeletedFile = false;
+        bool foundNewFile = false;
+        for (const auto& entry : job.entries()) {
+            QVERIFY(entry.path() != "dir1/file2.txt");
+            if (entry.path() == "file1.txt") {
+                QVERIFY(entry.isDeleted());
+                foundDeletedFile = true;
+            } else if (entry.path() == "dir1/file3.txt") {
+                QVERIFY(entry.isFile());
+                foundNewFile = true;
+            }
+        }
+        QVERIFY(foundDeletedFile);
+        QVERIFY(foundNewFile);
+    }
+}
+
+void WebDAVListFilesJobTest::listFilesRecursive_data()
+{
+    SynqClient::UnitTest::setupWebDAVTestServerData();
+}
+
 void WebDAVListFilesJobTest::cleanupTestCase() {}
 
 QTEST_MAIN(WebDAVListFilesJobTest)
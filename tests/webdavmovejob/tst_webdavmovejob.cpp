@@ -0,0 +1,201 @@
+#include <QNetworkAccessManager>
+#include <QSignalSpy>
+#include <QtTest>
+
+// add necessary includes here
+#include "../shared/fakewebdavserver.h"
+#include "../shared/utils.h"
+#include "SynqClient/WebDAVMoveJob"
+
+using SynqClient::JobError;
+using SynqClient::WebDAVMoveJob;
+using SynqClient::WebDAVServerType;
+using SynqClient::UnitTest::FakeWebDAVServer;
+
+class WebDAVMoveJobTest : public QObject
+{
+    Q_OBJECT
+
+public:
+    WebDAVMoveJobTest();
+    ~WebDAVMoveJobTest();
+
+private slots:
+    void initTestCase();
+    void missingParameters();
+    void moveFile();
+    void moveFile_data();
+    void moveFolder();
+    void moveFolder_data();
+    void errors();
+    void errors_data();
+    void overwrite();
+    void overwrite_data();
+    void cleanupTestCase();
+
+private:
+    static void addServerTypes();
+    static bool runJob(WebDAVMoveJob& job, JobError expectedError = JobError::NoError);
+};
+
+WebDAVMoveJobTest::WebDAVMoveJobTest() {}
+
+WebDAVMoveJobTest::~WebDAVMoveJobTest() {}
+
+void WebDAVMoveJobTest::initTestCase() {}
+
+void WebDAVMoveJobTest::missingParameters()
+{
+    FakeWebDAVServer server;
+    QVERIFY(server.listen());
+    QNetworkAccessManager nam;
+
+    WebDAVMoveJob job;
+    job.setNetworkAccessManager(&nam);
+    job.setUrl(server.url());
+    job.setPath("/foo.txt");
+    QVERIFY(runJob(job, JobError::MissingParameter));
+    QCOMPARE(server.numRequests(), 0);
+}
+
+void WebDAVMoveJobTest::moveFile()
+{
+    QFETCH(WebDAVServerType, type);
+
+    FakeWebDAVServer server(type);
+    QVERIFY(server.listen());
+    server.putFile("/dir/hello.txt", "Hello World!\n");
+    server.makeDirectory("/other");
+    QNetworkAccessManager nam;
+
+    WebDAVMoveJob job;
+    job.setNetworkAccessManager(&nam);
+    job.setUrl(server.url());
+    job.setServerType(type);
+    job.setPath("/dir/hello.txt");
+    job.setTargetPath("/other/renamed.txt");
+    QVERIFY(runJob(job));
+    QCOMPARE(server.numRequests("MOVE"), 1);
+    QVERIFY(!server.exists("/dir/hello.txt"));
+    QCOMPARE(server.fileData("/other/renamed.txt"), QByteArray("Hello World!\n"));
+    QCOMPARE(job.fileInfo().name(), QString("renamed.txt"));
+    QVERIFY(!job.fileInfo().syncAttribute().isEmpty());
+}
+
+void WebDAVMoveJobTest::moveFile_data()
+{
+    addServerTypes();
+}
+
+void WebDAVMoveJobTest::moveFolder()
+{
+    QFETCH(WebDAVServerType, type);
+
+    FakeWebDAVServer server(type);
+    QVERIFY(server.listen());
+    server.putFile("/dir/sub/a.txt", "A");
+    server.putFile("/dir/b.txt", "B");
+    QNetworkAccessManager nam;
+
+    WebDAVMoveJob job;
+    job.setNetworkAccessManager(&nam);
+    job.setUrl(server.url());
+    job.setServerType(type);
+    job.setPath("/dir");
+    job.setTargetPath("/renamed");
+    QVERIFY(runJob(job));
+    QVERIFY(!server.exists("/dir"));
+    QVERIFY(server.isDirectory("/renamed/sub"));
+    QCOMPARE(server.fileData("/renamed/sub/a.txt"), QByteArray("A"));
+    QCOMPARE(server.fileData("/renamed/b.txt"), QByteArray("B"));
+}
+
+void WebDAVMoveJobTest::moveFolder_data()
+{
+    addServerTypes();
+}
+
+void WebDAVMoveJobTest::errors()
+{
+    QFETCH(WebDAVServerType, type);
+
+    FakeWebDAVServer server(type);
+    QVERIFY(server.listen());
+    server.putFile("/a.txt", "A");
+    server.putFile("/b.txt", "B");
+    QNetworkAccessManager nam;
+
+    auto move = [&](const QString& path, const QString& targetPath, JobError expectedError) {
+        WebDAVMoveJob job;
+        job.setNetworkAccessManager(&nam);
+        job.setUrl(server.url());
+        job.setServerType(type);
+        job.setPath(path);
+        job.setTargetPath(targetPath);
+        return runJob(job, expectedError);
+    };
+
+    QVERIFY(move("/missing.txt", "/c.txt", JobError::ResourceNotFound));
+    QVERIFY(move("/a.txt", "/b.txt", JobError::ResourceExists));
+    QVERIFY(move("/a.txt", "/no/such/folder/a.txt", JobError::ServerContentConflict));
+
+    // Nothing has been changed by the failed moves:
+    QCOMPARE(server.fileData("/a.txt"), QByteArray("A"));
+    QCOMPARE(server.fileData("/b.txt"), QByteArray("B"));
+    QVERIFY(!server.exists("/c.txt"));
+}
+
+void WebDAVMoveJobTest::errors_data()
+{
+    addServerTypes();
+}
+
+void WebDAVMoveJobTest::overwrite()
+{
+    QFETCH(WebDAVServerType, type);
+
+    FakeWebDAVServer server(type);
+    QVERIFY(server.listen());
+    server.putFile("/a.txt", "A");
+    server.putFile("/b.txt", "B");
+    QNetworkAccessManager nam;
+
+    WebDAVMoveJob job;
+    job.setNetworkAccessManager(&nam);
+    job.setUrl(server.url());
+    job.setServerType(type);
+    job.setPath("/a.txt");
+    job.setTargetPath("/b.txt");
+    job.setOverwrite(true);
+    QVERIFY(runJob(job));
+    QVERIFY(!server.exists("/a.txt"));
+    QCOMPARE(server.fileData("/b.txt"), QByteArray("A"));
+}
+
+void WebDAVMoveJobTest::overwrite_data()
+{
+    addServerTypes();
+}
+
+void WebDAVMoveJobTest::cleanupTestCase() {}
+
+void WebDAVMoveJobTest::addServerTypes()
+{
+    QTest::addColumn<WebDAVServerType>("type");
+
+    QTest::newRow("Generic") << WebDAVServerType::Generic;
+    QTest::newRow("NextCloud") << WebDAVServerType::NextCloud;
+}
+
+bool WebDAVMoveJobTest::runJob(WebDAVMoveJob& job, JobError expectedError)
+{
+    QSignalSpy finished(&job, &WebDAVMoveJob::finished);
+    job.start();
+    SQ_VERIFY(finished.wait());
+    SQ_COMPARE(job.error(), expectedError);
+    return true;
+}
+
+QTEST_MAIN(WebDAVMoveJobTest)
+
+#include "tst_webdavmovejob.moc"
@@ -0,0 +1,2 @@
+TESTNAME = webdavmovejob
+include(../test.pri)
@@ -0,0 +1,201 @@
+#include <QNetworkAccessManager>
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <QtTest>
+
+// add necessary includes here
+#include "../shared/fakewebdavserver.h"
+#include "../shared/utils.h"
+#include "SynqClient/WebDAVUploadFileBatchJob"
+
+using SynqClient::JobError;
+using SynqClient::WebDAVServerType;
+using SynqClient::WebDAVUploadFileBatchJob;
+using SynqClient::UnitTest::createFiles;
+using SynqClient::UnitTest::FakeWebDAVServer;
+
+class WebDAVUploadFileBatchJobTest : public QObject
+{
+    Q_OBJECT
+
+public:
+    WebDAVUploadFileBatchJobTest();
+    ~WebDAVUploadFileBatchJobTest();
+
+private slots:
+    void initTestCase();
+    void bulkUpload();
+    void bulkUploadFallback();
+    void conditionalUploads();
+    void parallelUploads();
+    void parallelUploads_data();
+    void cleanupTestCase();
+
+private:
+    static bool runJob(WebDAVUploadFileBatchJob& job);
+};
+
+WebDAVUploadFileBatchJobTest::WebDAVUploadFileBatchJobTest() {}
+
+WebDAVUploadFileBatchJobTest::~WebDAVUploadFileBatchJobTest() {}
+
+void WebDAVUploadFileBatchJobTest::initTestCase() {}
+
+void WebDAVUploadFileBatchJobTest::bulkUpload()
+{
+    FakeWebDAVServer server(WebDAVServerType::NextCloud);
+    QVERIFY(server.listen());
+    server.makeDirectory("/folder");
+    QTemporaryDir tmpDir;
+    QVERIFY(createFiles(tmpDir.path(), 5));
+    QNetworkAccessManager nam;
+
+    WebDAVUploadFileBatchJob job;
+    job.setNetworkAccessManager(&nam);
+    job.setUrl(server.url());
+    job.setServerType(WebDAVServerType::NextCloud);
+    for (int i = 0; i < 5; ++i) {
+        job.addFile(tmpDir.filePath(QString("file-%1.txt").arg(i)),
+                    QString("/folder/file-%1.txt").arg(i));
+    }
+    // The parent folder of this one is missing:
+    job.addFile(tmpDir.filePath("file-0.txt"), "/missing/file.txt");
+    QVERIFY(runJob(job));
+    QVERIFY(job.bulkUploadSupported());
+
+    // All files are sent within a single request:
+    QCOMPARE(server.numRequests("POST"), 1);
+    QCOMPARE(server.numRequests("PUT"), 0);
+    for (int i = 0; i < 5; ++i) {
+        auto remoteFilename = QString("/folder/file-%1.txt").arg(i);
+        QCOMPARE(server.fileData(remoteFilename), QByteArray::number(i));
+        QCOMPARE(job.entryError(remoteFilename), JobError::NoError);
+        auto syncAttribute = job.fileInfo(remoteFilename).syncAttribute();
+        QVERIFY(syncAttribute.startsWith("\"") && syncAttribute.endsWith("\""));
+    }
+    QCOMPARE(job.failedEntries(), QStringList({ "/missing/file.txt" }));
+    QVERIFY(!server.exists("/missing"));
+}
+
+void WebDAVUploadFileBatchJobTest::bulkUploadFallback()
+{
+    FakeWebDAVServer server(WebDAVServerType::NextCloud);
+    server.setBulkUploadSupported(false);
+    QVERIFY(server.listen());
+    QTemporaryDir tmpDir;
+    QVERIFY(createFiles(tmpDir.path(), 5));
+    QNetworkAccessManager nam;
+
+    WebDAVUploadFileBatchJob job;
+    job.setNetworkAccessManager(&nam);
+    job.setUrl(server.url());
+    job.setServerType(WebDAVServerType::NextCloud);
+    for (int i = 0; i < 5; ++i) {
+        job.addFile(tmpDir.filePath(QString("file-%1.txt").arg(i)),
+                    QString("/file-%1.txt").arg(i));
+    }
+    QVERIFY(runJob(job));
+    QVERIFY(!job.bulkUploadSupported());
+    QCOMPARE(server.numRequests("POST"), 1);
+    QCOMPARE(server.numRequests("PUT"), 5);
+    QVERIFY(job.failedEntries().isEmpty());
+    for (int i = 0; i < 5; ++i) {
+        auto remoteFilename = QString("/file-%1.txt").arg(i);
+        QCOMPARE(server.fileData(remoteFilename), QByteArray::number(i));
+        QVERIFY(!job.fileInfo(remoteFilename).syncAttribute().isEmpty());
+    }
+}
+
+void WebDAVUploadFileBatchJobTest::conditionalUploads()
+{
+    FakeWebDAVServer server(WebDAVServerType::NextCloud);
+    QVERIFY(server.listen());
+    QTemporaryDir tmpDir;
+    QVERIFY(createFiles(tmpDir.path(), 3));
+    QNetworkAccessManager nam;
+
+    {
+        WebDAVUploadFileBatchJob job;
+        job.setNetworkAccessManager(&nam);
+        job.setUrl(server.url());
+        job.setServerType(WebDAVServerType::NextCloud);
+        job.addFile(tmpDir.filePath("file-0.txt"), "/file-0.txt");
+        job.addFile(tmpDir.filePath("file-1.txt"), "/file-1.txt");
+        QVERIFY(runJob(job));
+        QVERIFY(job.failedEntries().isEmpty());
+        auto syncAttribute = job.fileInfo("/file-0.txt").syncAttribute();
+
+        // Files with a sync attribute cannot be uploaded in bulk:
+        server.resetStatistics();
+        WebDAVUploadFileBatchJob job2;
+        job2.setNetworkAccessManager(&nam);
+        job2.setUrl(server.url());
+        job2.setServerType(WebDAVServerType::NextCloud);
+        job2.addFile(tmpDir.filePath("file-2.txt"), "/file-0.txt", syncAttribute);
+        job2.addFile(tmpDir.filePath("file-2.txt"), "/file-1.txt", "\"outdated\"");
+        job2.addFile(tmpDir.filePath("file-2.txt"), "/file-2.txt");
+        QVERIFY(runJob(job2));
+        QCOMPARE(server.numRequests("POST"), 1);
+        QCOMPARE(server.numRequests("PUT"), 2);
+        QCOMPARE(job2.entryError("/file-0.txt"), JobError::NoError);
+        QCOMPARE(job2.entryError("/file-1.txt"), JobError::SyncAttributeMismatch);
+        QCOMPARE(job2.entryError("/file-2.txt"), JobError::NoError);
+        QCOMPARE(server.fileData("/file-0.txt"), QByteArray("2"));
+        QCOMPARE(server.fileData("/file-1.txt"), QByteArray("1"));
+        QCOMPARE(server.fileData("/file-2.txt"), QByteArray("2"));
+    }
+}
+
+void WebDAVUploadFileBatchJobTest::parallelUploads()
+{
+    QFETCH(int, maxParallelUploads);
+
+    // Generic servers don't support bulk uploads, so all files are uploaded one by one:
+    FakeWebDAVServer server;
+    server.setLatency(50);
+    QVERIFY(server.listen());
+    QTemporaryDir tmpDir;
+    QVERIFY(createFiles(tmpDir.path(), 8));
+    QNetworkAccessManager nam;
+
+    WebDAVUploadFileBatchJob job;
+    job.setNetworkAccessManager(&nam);
+    job.setUrl(server.url());
+    QCOMPARE(job.maxParallelUploads(), 1);
+    job.setMaxParallelUploads(maxParallelUploads);
+    for (int i = 0; i < 8; ++i) {
+        job.addFile(tmpDir.filePath(QString("file-%1.txt").arg(i)),
+                    QString("/file-%1.txt").arg(i));
+    }
+    QVERIFY(runJob(job));
+    QVERIFY(job.failedEntries().isEmpty());
+    QCOMPARE(server.numRequests("PUT"), 8);
+    QVERIFY(server.maxParallelRequests() <= maxParallelUploads);
+    QVERIFY(maxParallelUploads == 1 || server.maxParallelRequests() > 1);
+    for (int i = 0; i < 8; ++i) {
+        QCOMPARE(server.fileData(QString("/file-%1.txt").arg(i)), QByteArray::number(i));
+    }
+}
+
+void WebDAVUploadFileBatchJobTest::parallelUploads_data()
+{
+    QTest::addColumn<int>("maxParallelUploads");
+
+    QTest::newRow("Sequential") << 1;
+    QTest::newRow("Parallel") << 3;
+}
+
+void WebDAVUploadFileBatchJobTest::cleanupTestCase() {}
+
+bool WebDAVUploadFileBatchJobTest::runJob(WebDAVUploadFileBatchJob& job)
+{
+    QSignalSpy finished(&job, &WebDAVUploadFileBatchJob::finished);
+    job.start();
+    SQ_VERIFY(finished.wait());
+    SQ_COMPARE(job.error(), JobError::NoError);
+    return true;
+}
+
+QTEST_MAIN(WebDAVUploadFileBatchJobTest)
+
+#include "tst_webdavuploadfilebatchjob.moc"
@@ -0,0 +1,2 @@
+TESTNAME = webdavuploadfilebatchjob
+include(../test.pri)
@@ -1,4 +1,5 @@
 #include <QBuffer>
+#include <QCryptographicHash>
 #include <QDir>
 #include <QSignalSpy>
 #include <QTemporaryDir>
@@ -6,6 +7,7 @@
 #include <QtTest>
 
 // add necessary includes here
+#include "../shared/fakewebdavserver.h"
 #include "../shared/utils.h"
 #include "SynqClient/WebDAVCreateDirectoryJob"
 #include "SynqClient/WebDAVGetFileInfoJob"
@@ -14,7 +16,10 @@
 using SynqClient::JobError;
 using SynqClient::WebDAVCreateDirectoryJob;
 using SynqClient::WebDAVGetFileInfoJob;
+using SynqClient::WebDAVServerType;
 using SynqClient::WebDAVUploadFileJob;
+using SynqClient::UnitTest::createLargeData;
+using SynqClient::UnitTest::FakeWebDAVServer;
 
 class WebDAVUploadFileJobTest : public QObject
 {
@@ -28,6 +33,8 @@ private slots:
     void initTestCase();
     void uploadLocalFile();
     void uploadLocalFile_data();
+    void uploadLargeLocalFile();
+    void uploadLargeLocalFile_data();
     void uploadDevice();
     void uploadDevice_data();
     void uploadData();
@@ -111,6 +118,52 @@ void WebDAVUploadFileJobTest::uploadLocalFile_data()
     SynqClient::UnitTest::setupWebDAVTestServerData();
 }
 
+void WebDAVUploadFileJobTest::uploadLargeLocalFile()
+{
+    QFETCH(WebDAVServerType, type);
+
+    // Much larger than the buffers used to read ahead, so data has to be streamed from disk
+    // while the throttled server slowly takes it:
+    auto data = createLargeData();
+    QTemporaryDir tmpDir;
+    QDir dir(tmpDir.path());
+    auto localFileName = dir.absoluteFilePath("large.txt");
+    QFile localFile(localFileName);
+    QVERIFY(localFile.open(QIODevice::WriteOnly));
+    QCOMPARE(localFile.write(data), qint64(data.size()));
+    localFile.close();
+
+    FakeWebDAVServer server(type);
+    server.setLatency(20);
+    server.setBandwidth(32 * 1024 * 1024);
+    QVERIFY(server.listen());
+    QNetworkAccessManager nam;
+
+    WebDAVUploadFileJob job;
+    job.setNetworkAccessManager(&nam);
+    job.setUrl(server.url());
+    job.setServerType(type);
+    job.setLocalFilename(localFileName);
+    job.setRemoteFilename("/large.txt");
+    QSignalSpy spy(&job, &WebDAVUploadFileJob::finished);
+    job.start();
+    QVERIFY(spy.wait(60000));
+    QCOMPARE(job.errorString(), QString());
+    QCOMPARE(job.error(), JobError::NoError);
+    QCOMPARE(server.numRequests("PUT"), 1);
+    QVERIFY(server.fileData("/large.txt") == data);
+    QCOMPARE(job.fileInfo().checksum("SHA1"),
+             QString::fromLatin1(QCryptographicHash::hash(data, QCryptographicHash::Sha1).toHex()));
+}
+
+void WebDAVUploadFileJobTest::uploadLargeLocalFile_data()
+{
+    QTest::addColumn<WebDAVServerType>("type");
+
+    QTest::newRow("Generic") << WebDAVServerType::Generic;
+    QTest::newRow("NextCloud") << WebDAVServerType::NextCloud;
+}
+
 void WebDAVUploadFileJobTest::uploadDevice()
 {
     if (!SynqClient::UnitTest::hasWebDAVServersFromEnv()) {